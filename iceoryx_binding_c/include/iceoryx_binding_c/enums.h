@@ -117,6 +117,7 @@ enum iox_AllocationResult
     AllocationResult_UNDEFINED_ERROR,
     AllocationResult_INVALID_PARAMETER_FOR_CHUNK,
     AllocationResult_INVALID_PARAMETER_FOR_REQUEST_HEADER,
+    AllocationResult_CHUNK_QUOTA_EXCEEDED,
     AllocationResult_SUCCESS,
 };
 
@@ -86,6 +86,7 @@ void iox_pub_deinit(iox_pub_t const self);
 ///         describes the error
 /// @note for the user-payload alignment 'IOX_C_CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT' is used
 ///       for a custom user-payload alignment please use 'iox_pub_loan_aligned_chunk'
+/// @note the user-payload is not initialized
 enum iox_AllocationResult
 iox_pub_loan_chunk(iox_pub_t const self, void** const userPayload, const uint64_t userPayloadSize);
 
@@ -128,6 +129,17 @@ void iox_pub_release_chunk(iox_pub_t const self, void* const userPayload);
 /// @param[in] userPayload pointer to the user-payload of the chunk which should be send
 void iox_pub_publish_chunk(iox_pub_t const self, void* const userPayload);
 
+/// @brief copies the user-payload with non-temporal stores into a chunk and sends it; the copy bypasses the cache
+///        and does not evict the working set of the publisher, which pays off for large user-payloads
+/// @param[in] self handle of the publisher
+/// @param[in] userPayload pointer to the user-payload which should be copied
+/// @param[in] userPayloadSize size of the user-payload
+/// @return on success it returns AllocationResult_SUCCESS otherwise a value which
+///         describes the error
+enum iox_AllocationResult iox_pub_publish_streaming_copy_of(iox_pub_t const self,
+                                                            const void* const userPayload,
+                                                            const uint64_t userPayloadSize);
+
 /// @brief offers the service
 /// @param[in] self handle of the publisher
 void iox_pub_offer(iox_pub_t const self);
@@ -24,6 +24,7 @@
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iox/assertions.hpp"
 #include "iox/logging.hpp"
+#include "iox/memory.hpp"
 
 using namespace iox;
 using namespace iox::popo;
@@ -168,6 +169,25 @@ void iox_pub_publish_chunk(iox_pub_t const self, void* const userPayload)
     PublisherPortUser(self->m_portData).sendChunk(ChunkHeader::fromUserPayload(userPayload));
 }
 
+iox_AllocationResult iox_pub_publish_streaming_copy_of(iox_pub_t const self,
+                                                      const void* const userPayload,
+                                                      const uint64_t userPayloadSize)
+{
+    IOX_ENFORCE(self != nullptr, "'self' must not be a 'nullptr'");
+    IOX_ENFORCE(userPayload != nullptr, "'userPayload' must not be a 'nullptr'");
+
+    void* chunk{nullptr};
+    const auto result = iox_pub_loan_chunk(self, &chunk, userPayloadSize);
+    if (result != AllocationResult_SUCCESS)
+    {
+        return result;
+    }
+
+    streamingCopy(chunk, userPayload, userPayloadSize);
+    iox_pub_publish_chunk(self, chunk);
+    return AllocationResult_SUCCESS;
+}
+
 void iox_pub_offer(iox_pub_t const self)
 {
     IOX_ENFORCE(self != nullptr, "'self' must not be a 'nullptr'");
@@ -343,6 +343,47 @@ TEST_F(iox_pub_test, sendDeliversChunk)
     EXPECT_TRUE(static_cast<DummySample*>(maybeSharedChunk->getUserPayload())->dummy == 4711);
 }
 
+TEST_F(iox_pub_test, publishStreamingCopyOfDeliversCopiedChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1fcde26b-9349-406a-a4d4-392986d347be");
+    iox_pub_offer(&m_sut);
+    this->Subscribe(&m_publisherPortData);
+    DummySample sample;
+    sample.dummy = 4712;
+    EXPECT_EQ(AllocationResult_SUCCESS, iox_pub_publish_streaming_copy_of(&m_sut, &sample, sizeof(sample)));
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> m_chunkQueuePopper(&m_chunkQueueData);
+    auto maybeSharedChunk = m_chunkQueuePopper.tryPop();
+
+    ASSERT_TRUE(maybeSharedChunk.has_value());
+    EXPECT_TRUE(static_cast<DummySample*>(maybeSharedChunk->getUserPayload())->dummy == 4712);
+}
+
+TEST_F(iox_pub_test, publishStreamingCopyOfFailsWhenOutOfChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d9716328-cb51-4cb3-b531-73a43abd3e82");
+    void* chunk = nullptr;
+    for (uint32_t i = 0U; i < iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY; ++i)
+    {
+        EXPECT_EQ(AllocationResult_SUCCESS, iox_pub_loan_chunk(&m_sut, &chunk, 100));
+    }
+
+    DummySample sample;
+    EXPECT_EQ(AllocationResult_TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL,
+              iox_pub_publish_streaming_copy_of(&m_sut, &sample, sizeof(sample)));
+}
+
+TEST_F(iox_pub_test, publishStreamingCopyOfWithNullptr)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6d4c3abd-fdb9-43dc-af6d-4ca5b368994b");
+    DummySample sample;
+
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_pub_publish_streaming_copy_of(nullptr, &sample, sizeof(sample)); },
+                             iox::er::ENFORCE_VIOLATION);
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_pub_publish_streaming_copy_of(&m_sut, nullptr, sizeof(sample)); },
+                             iox::er::ENFORCE_VIOLATION);
+}
+
 TEST_F(iox_pub_test, correctServiceDescriptionReturned)
 {
     ::testing::Test::RecordProperty("TEST_ID", "4f91cb12-fbfa-4bad-ad59-ab2579f83fbe");
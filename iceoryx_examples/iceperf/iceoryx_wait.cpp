@@ -22,6 +22,14 @@ IceoryxWait::IceoryxWait(const iox::capro::IdString_t& publisherName,
 {
 }
 
+IceoryxWait::IceoryxWait(const iox::capro::IdString_t& publisherName,
+                         const iox::capro::IdString_t& subscriberName,
+                         const iox::units::Duration spinDuration) noexcept
+    : Iceoryx(publisherName, subscriberName, "C++-Wait-Spin-API")
+    , waitset(iox::popo::WaitStrategy{spinDuration, true})
+{
+}
+
 void IceoryxWait::init() noexcept
 {
     Iceoryx::init();
@@ -17,12 +17,18 @@
 #define IOX_EXAMPLES_ICEPERF_ICEORYX_WAIT_HPP
 
 #include "iceoryx.hpp"
+#include "iceoryx_posh/popo/wait_strategy.hpp"
 
 class IceoryxWait : public Iceoryx
 {
   public:
     IceoryxWait(const iox::capro::IdString_t& publisherName, const iox::capro::IdString_t& subscriberName) noexcept;
 
+    /// @brief Creates a WaitSet which polls for the given duration before it blocks
+    IceoryxWait(const iox::capro::IdString_t& publisherName,
+                const iox::capro::IdString_t& subscriberName,
+                const iox::units::Duration spinDuration) noexcept;
+
   private:
     void init() noexcept override;
     PerfTopic receivePerfTopic() noexcept override;
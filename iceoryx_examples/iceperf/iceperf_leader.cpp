@@ -201,6 +201,14 @@ int IcePerfLeader::run() noexcept
         IceoryxWait iceoryxwait(PUBLISHER, SUBSCRIBER);
         doMeasurement(iceoryxwait);
     }
+
+    if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_CPP_WAIT_SPIN_API)
+    {
+        std::cout << std::endl << "****** ICEORYX WAITSET SPIN ******" << std::endl;
+        IceoryxWait iceoryxwaitspin(
+            PUBLISHER, SUBSCRIBER, iox::units::Duration::fromMicroseconds(m_settings.spinDurationInUs));
+        doMeasurement(iceoryxwaitspin);
+    }
     //! [create an run technologies]
 
     return EXIT_SUCCESS;
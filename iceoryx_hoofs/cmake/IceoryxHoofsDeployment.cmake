@@ -30,5 +30,9 @@ configure_option(
     NAME IOX_MAX_NAMED_PIPE_NUMBER_OF_MESSAGES
     DEFAULT_VALUE 10
 )
+configure_option(
+    NAME IOX_CACHE_LINE_SIZE
+    DEFAULT_VALUE 64
+)
 
 message(STATUS "[i] <<<<<<<<<<<<<< End iceoryx_hoofs configuration: >>>>>>>>>>>>>>")
@@ -78,11 +78,28 @@ class MpmcLockFreeQueue
     /// @note threadsafe, lockfree
     iox::optional<ElementType> push(ElementType&& value) noexcept;
 
+    /// @brief tries to insert multiple values in FIFO order, copies the values internally
+    /// @param values pointer to the values to be inserted
+    /// @param numberOfValues number of values to be inserted
+    /// @return number of inserted values; the values are inserted from the front, i.e. if the queue is full
+    /// only the first values are inserted
+    /// @note threadsafe, lockfree; the free slots are claimed with a single atomic operation per batch of
+    /// MAX_BATCH_SIZE values but concurrent pushes can interleave their values
+    uint64_t tryPushMany(const ElementType* const values, const uint64_t numberOfValues) noexcept;
+
     /// @brief tries to remove value in FIFO order
     /// @return value if removal was successful, empty optional otherwise
     /// @note threadsafe, lockfree
     iox::optional<ElementType> pop() noexcept;
 
+    /// @brief tries to remove multiple values in FIFO order
+    /// @param values pointer to the memory the removed values are move assigned to
+    /// @param maxNumberOfValues maximum number of values to be removed
+    /// @return number of removed values, 0 if the queue is empty
+    /// @note threadsafe, lockfree; the values are claimed with a single atomic operation per batch of
+    /// MAX_BATCH_SIZE values
+    uint64_t popMany(ElementType* const values, const uint64_t maxNumberOfValues) noexcept;
+
     /// @brief check whether the queue is empty
     /// @return true iff the queue is empty
     /// @note that if the queue is used concurrently it might
@@ -98,6 +115,10 @@ class MpmcLockFreeQueue
     /// @note threadsafe, lockfree
     uint64_t size() const noexcept;
 
+    /// @brief the maximum number of values which are claimed with a single atomic operation in tryPushMany and
+    /// popMany; larger requests are processed in multiple batches
+    static constexpr uint64_t MAX_BATCH_SIZE{Capacity < 64U ? Capacity : 64U};
+
   protected:
     using Queue = MpmcIndexQueue<Capacity>;
 
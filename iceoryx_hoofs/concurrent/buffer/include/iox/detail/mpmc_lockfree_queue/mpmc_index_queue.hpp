@@ -85,10 +85,24 @@ class MpmcIndexQueue
     /// and the capacity is large enough to hold them all)
     void push(const ValueType index) noexcept;
 
+    /// @brief push multiple indices into the queue in FIFO order
+    /// @param indices pointer to the indices to be pushed
+    /// @param numberOfIndices number of indices to be pushed
+    /// note that the indices are published cell by cell but the write position is only updated once
+    /// for all of them; concurrent pushes can interleave their indices
+    void pushMany(const ValueType* const indices, const uint64_t numberOfIndices) noexcept;
+
     /// @brief pop an index from the queue in FIFO order if the queue not empty
     /// @return index if the queue was is empty, nullopt oterwise
     optional<ValueType> pop() noexcept;
 
+    /// @brief pop multiple indices from the queue in FIFO order; the indices are claimed with
+    ///        a single update of the read position
+    /// @param indices pointer to the memory where the popped indices are stored
+    /// @param maxNumberOfIndices maximum number of indices to be popped
+    /// @return number of popped indices, 0 if the queue is empty
+    uint64_t popMany(ValueType* const indices, const uint64_t maxNumberOfIndices) noexcept;
+
     /// @brief pop an index from the queue in FIFO order if the queue is full
     /// @return index if the queue was full, nullopt otherwise
     optional<ValueType> popIfFull() noexcept;
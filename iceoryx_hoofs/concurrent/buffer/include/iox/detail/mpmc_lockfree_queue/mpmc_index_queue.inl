@@ -135,6 +135,65 @@ inline void MpmcIndexQueue<Capacity, ValueType>::push(const ValueType index) noe
         writePosition, newWritePosition, std::memory_order_relaxed, std::memory_order_relaxed);
 }
 
+template <uint64_t Capacity, typename ValueType>
+inline void MpmcIndexQueue<Capacity, ValueType>::pushMany(const ValueType* const indices,
+                                                          const uint64_t numberOfIndices) noexcept
+{
+    // the cells are published with the same case analysis as in push, but instead of updating the write position
+    // after each cell we continue with the next cell and update the write position once at the end
+    //
+    // case analysis for the cell at our local writePosition
+    // (1) loaded value is exactly one cycle behind:
+    //     the cell is free, try to publish
+    // (2) loaded value has the same cycle:
+    //     the cell was published by a concurrent push, continue with the next cell
+    // (3) and (4) loaded value is more than one cycle behind or some cycle ahead:
+    //     our writePosition is outdated, reload the write position and try again
+    //
+    // since the write position is only moved over published cells and we move our local writePosition only
+    // over published cells, all cells before our local writePosition are published when we leave the loop
+
+    uint64_t numberOfPublishedIndices{0U};
+    auto writePosition = m_writePosition.load(std::memory_order_relaxed);
+    while (numberOfPublishedIndices < numberOfIndices)
+    {
+        auto oldValue = loadvalueAt(writePosition, std::memory_order_relaxed);
+
+        if (oldValue.isOneCycleBehind(writePosition))
+        {
+            // case (1)
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) the caller provides numberOfIndices
+            Index newValue(indices[numberOfPublishedIndices], writePosition.getCycle());
+            bool published = m_cells[writePosition.getIndex()].compare_exchange_weak(
+                oldValue, newValue, std::memory_order_relaxed, std::memory_order_relaxed);
+            if (published)
+            {
+                ++numberOfPublishedIndices;
+                writePosition = writePosition + 1U;
+            }
+        }
+        else if (oldValue.getCycle() == writePosition.getCycle())
+        {
+            // case (2)
+            writePosition = writePosition + 1U;
+        }
+        else
+        {
+            // case (3) and (4)
+            writePosition = m_writePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    // the write position must not stay behind the published cells, otherwise popIfFull could fail to detect a full
+    // queue when there are no further pushes; concurrent pushes may already have moved it further
+    auto currentWritePosition = m_writePosition.load(std::memory_order_relaxed);
+    while ((writePosition - currentWritePosition) > 0
+           && !m_writePosition.compare_exchange_weak(
+               currentWritePosition, writePosition, std::memory_order_relaxed, std::memory_order_relaxed))
+    {
+    }
+}
+
 template <uint64_t Capacity, typename ValueType>
 inline bool MpmcIndexQueue<Capacity, ValueType>::pop(ValueType& index) noexcept
 {
@@ -195,6 +254,62 @@ inline bool MpmcIndexQueue<Capacity, ValueType>::pop(ValueType& index) noexcept
     return true;
 }
 
+template <uint64_t Capacity, typename ValueType>
+inline uint64_t MpmcIndexQueue<Capacity, ValueType>::popMany(ValueType* const indices,
+                                                             const uint64_t maxNumberOfIndices) noexcept
+{
+    // the cells starting at the read position are collected as long as they are valid to read (see pop) and the
+    // whole range is claimed with a single compare-exchange of the read position; if it fails, the read position
+    // was moved by a concurrent pop and the collected indices are discarded
+    //
+    // a collected cell cannot be overwritten before the compare-exchange: a push only writes a cell whose value is
+    // one cycle behind the write position which requires that the cell was popped before
+
+    if (maxNumberOfIndices == 0U)
+    {
+        return 0U;
+    }
+
+    auto readPosition = m_readPosition.load(std::memory_order_relaxed);
+    while (true)
+    {
+        uint64_t numberOfIndices{0U};
+        for (; numberOfIndices < maxNumberOfIndices; ++numberOfIndices)
+        {
+            const auto position = readPosition + numberOfIndices;
+            const auto value = loadvalueAt(position, std::memory_order_relaxed);
+            if (value.getCycle() != position.getCycle())
+            {
+                break;
+            }
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) the caller provides maxNumberOfIndices
+            indices[numberOfIndices] = value.getIndex();
+        }
+
+        if (numberOfIndices == 0U)
+        {
+            const auto value = loadvalueAt(readPosition, std::memory_order_relaxed);
+            if (value.isOneCycleBehind(readPosition))
+            {
+                // the queue was empty at value load
+                return 0U;
+            }
+
+            // readPosition is outdated, retry operation
+            readPosition = m_readPosition.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        Index newReadPosition(readPosition + numberOfIndices);
+        if (m_readPosition.compare_exchange_weak(
+                readPosition, newReadPosition, std::memory_order_relaxed, std::memory_order_relaxed))
+        {
+            return numberOfIndices;
+        }
+        // the compare-exchange updated readPosition, retry operation
+    }
+}
+
 template <uint64_t Capacity, typename ValueType>
 inline bool MpmcIndexQueue<Capacity, ValueType>::popIfFull(ValueType& index) noexcept
 {
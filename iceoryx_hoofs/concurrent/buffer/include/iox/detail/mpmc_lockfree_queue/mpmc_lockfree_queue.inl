@@ -20,6 +20,7 @@
 #define IOX_HOOFS_CONCURRENT_BUFFER_MPMC_LOCKFREE_QUEUE_MPMC_LOCKFREE_QUEUE_INL
 
 #include "iox/detail/mpmc_lockfree_queue.hpp"
+#include "iox/algorithm.hpp"
 #include "iox/optional.hpp"
 
 #include <utility>
@@ -127,6 +128,37 @@ inline iox::optional<ElementType> MpmcLockFreeQueue<ElementType, Capacity>::push
     return pushImpl(std::forward<ElementType>(value));
 }
 
+template <typename ElementType, uint64_t Capacity>
+inline uint64_t MpmcLockFreeQueue<ElementType, Capacity>::tryPushMany(const ElementType* const values,
+                                                                     const uint64_t numberOfValues) noexcept
+{
+    uint64_t numberOfPushedValues{0U};
+    while (numberOfPushedValues < numberOfValues)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays) local batch of indices
+        uint64_t indices[MAX_BATCH_SIZE];
+        const uint64_t batchSize{m_freeIndices.popMany(
+            &indices[0], algorithm::minVal(numberOfValues - numberOfPushedValues, MAX_BATCH_SIZE))};
+        if (batchSize == 0U)
+        {
+            break; // detected full queue
+        }
+
+        for (uint64_t i = 0U; i < batchSize; ++i)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) the caller provides numberOfValues
+            new (&m_buffer[indices[i]]) ElementType(values[numberOfPushedValues + i]);
+        }
+        // also used for buffer synchronization
+        m_size.fetch_add(batchSize, std::memory_order_release);
+
+        m_usedIndices.pushMany(&indices[0], batchSize);
+        numberOfPushedValues += batchSize;
+    }
+
+    return numberOfPushedValues;
+}
+
 template <typename ElementType, uint64_t Capacity>
 inline iox::optional<ElementType> MpmcLockFreeQueue<ElementType, Capacity>::pop() noexcept
 {
@@ -144,6 +176,39 @@ inline iox::optional<ElementType> MpmcLockFreeQueue<ElementType, Capacity>::pop(
     return result;
 }
 
+template <typename ElementType, uint64_t Capacity>
+inline uint64_t MpmcLockFreeQueue<ElementType, Capacity>::popMany(ElementType* const values,
+                                                                 const uint64_t maxNumberOfValues) noexcept
+{
+    uint64_t numberOfPoppedValues{0U};
+    while (numberOfPoppedValues < maxNumberOfValues)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays) local batch of indices
+        uint64_t indices[MAX_BATCH_SIZE];
+        const uint64_t batchSize{m_usedIndices.popMany(
+            &indices[0], algorithm::minVal(maxNumberOfValues - numberOfPoppedValues, MAX_BATCH_SIZE))};
+        if (batchSize == 0U)
+        {
+            break; // detected empty queue
+        }
+
+        // also used for buffer synchronization
+        m_size.fetch_sub(batchSize, std::memory_order_acquire);
+        for (uint64_t i = 0U; i < batchSize; ++i)
+        {
+            auto& element = m_buffer[indices[i]];
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) the caller provides maxNumberOfValues
+            values[numberOfPoppedValues + i] = std::move(element);
+            element.~ElementType();
+        }
+
+        m_freeIndices.pushMany(&indices[0], batchSize);
+        numberOfPoppedValues += batchSize;
+    }
+
+    return numberOfPoppedValues;
+}
+
 template <typename ElementType, uint64_t Capacity>
 inline bool MpmcLockFreeQueue<ElementType, Capacity>::empty() const noexcept
 {
@@ -68,10 +68,13 @@ class MpmcResizeableLockFreeQueue : protected MpmcLockFreeQueue<ElementType, Max
     /// @return the maximum capacity
     static constexpr uint64_t maxCapacity() noexcept;
 
+    using Base::MAX_BATCH_SIZE;
     using Base::empty;
     using Base::pop;
+    using Base::popMany;
     using Base::size;
     using Base::tryPush;
+    using Base::tryPushMany;
 
     /// @brief returns the current capacity of the queue
     /// @return the current capacity
@@ -0,0 +1,153 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_HOOFS_CONCURRENT_BUFFER_MPSC_LOCKFREE_QUEUE_HPP
+#define IOX_HOOFS_CONCURRENT_BUFFER_MPSC_LOCKFREE_QUEUE_HPP
+
+#include "iox/atomic.hpp"
+#include "iox/iceoryx_hoofs_deployment.hpp"
+#include "iox/optional.hpp"
+#include "iox/type_traits.hpp"
+#include "iox/uninitialized_array.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace concurrent
+{
+/// @brief Bounded multi producer single consumer queue (i.e. container with FIFO order) of elements of type T with a
+/// maximum capacity MaxCapacity. The capacity can be set to anything between 1 and MaxCapacity.
+/// @details The queue is a ring buffer where each slot has a sequence number which tells whether the slot is free
+/// for or contains the element of a position. A producer claims a position with a single CAS on the write position
+/// and publishes the element by advancing the sequence number of the slot, the consumer claims an element with a
+/// single CAS on the read position. Compared to the MpmcResizeableLockFreeQueue, which needs an index queue for the
+/// free and one for the used indices, this saves several CAS operations and a copy of the index per push and pop.
+/// On overflow, 'push' removes the oldest element with the same CAS on the read position as the consumer. Therefore
+/// the read position must be an atomic even though there is only one consumer.
+/// @note A position which was claimed but not yet published blocks the consumer until it is published, i.e. the
+/// consumer does not overtake a producer which is interrupted between claiming and publishing. In the overflow case a
+/// producer may also have to wait for a producer which claimed an earlier position. 'tryPush' and 'pop' never wait.
+/// @param[in] ElementType type of the stored elements
+/// @param[in] MaxCapacity maximum capacity of the queue
+template <typename ElementType, uint64_t MaxCapacity>
+class MpscLockFreeQueue
+{
+    static_assert(MaxCapacity > 0U, "The MaxCapacity of the MpscLockFreeQueue must be larger than 0");
+
+  public:
+    using element_t = ElementType;
+    static constexpr uint64_t MAX_CAPACITY = MaxCapacity;
+
+    /// @brief creates an empty MpscLockFreeQueue with the capacity MaxCapacity
+    MpscLockFreeQueue() noexcept;
+
+    /// @brief creates an empty MpscLockFreeQueue
+    /// @param[in] initialCapacity of the queue, if it is not between 1 and MaxCapacity, MaxCapacity is used
+    explicit MpscLockFreeQueue(const uint64_t initialCapacity) noexcept;
+
+    ~MpscLockFreeQueue() noexcept;
+
+    // a thread-safe copy or move of a lockfree queue is nontrivial and not required
+    MpscLockFreeQueue(const MpscLockFreeQueue&) = delete;
+    MpscLockFreeQueue(MpscLockFreeQueue&&) = delete;
+    MpscLockFreeQueue& operator=(const MpscLockFreeQueue&) = delete;
+    MpscLockFreeQueue& operator=(MpscLockFreeQueue&&) = delete;
+
+    /// @brief returns the maximum capacity of the queue
+    /// @return the maximum capacity
+    static constexpr uint64_t maxCapacity() noexcept;
+
+    /// @brief returns the current capacity of the queue
+    /// @return the current capacity
+    /// @note threadsafe, lockfree
+    uint64_t capacity() const noexcept;
+
+    /// @brief tries to insert value in FIFO order
+    /// @param[in] value to be inserted is copied into the queue
+    /// @return true if the insertion was successful, false if the queue was full
+    /// @note threadsafe for multiple producers, lockfree
+    bool tryPush(const ElementType& value) noexcept;
+
+    /// @brief inserts value in FIFO order, always succeeds by removing the oldest value when the queue is full
+    /// (overflow)
+    /// @param[in] value to be inserted is copied into the queue
+    /// @return removed value if an overflow occurred, empty optional otherwise
+    /// @note threadsafe for multiple producers
+    optional<ElementType> push(const ElementType& value) noexcept;
+
+    /// @brief tries to remove the oldest value from the queue
+    /// @return the removed value if the queue contained a published value, empty optional otherwise
+    /// @note must only be called by a single consumer, lockfree
+    optional<ElementType> pop() noexcept;
+
+    /// @brief checks whether the queue contains a value which can be popped
+    /// @return true if the queue is empty, false otherwise
+    /// @note threadsafe, lockfree but the result may already be outdated when the function returns
+    bool empty() const noexcept;
+
+    /// @brief returns the number of values in the queue, including values which are currently being pushed
+    /// @return the number of values in the queue
+    /// @note threadsafe, lockfree but the result may already be outdated when the function returns
+    uint64_t size() const noexcept;
+
+    /// @brief Set the capacity to a new capacity between 1 and MaxCapacity. If the queue contains more values than
+    /// the new capacity, the oldest values are removed.
+    /// @param[in] newCapacity capacity to be set
+    /// @param[in] removeHandler is a function which is called with each removed value
+    /// @return true if the capacity was set, false if the new capacity is not between 1 and MaxCapacity
+    /// @note not threadsafe with respect to 'push' and 'tryPush'
+    template <typename Function, typename = std::enable_if_t<is_invocable<Function, ElementType>::value>>
+    bool setCapacity(const uint64_t newCapacity, Function&& removeHandler) noexcept;
+
+    /// @brief Set the capacity to a new capacity between 1 and MaxCapacity. If the queue contains more values than
+    /// the new capacity, the oldest values are discarded.
+    /// @param[in] newCapacity capacity to be set
+    /// @return true if the capacity was set, false if the new capacity is not between 1 and MaxCapacity
+    /// @note not threadsafe with respect to 'push' and 'tryPush'
+    bool setCapacity(const uint64_t newCapacity) noexcept;
+
+  private:
+    // with a single slot, the sequence number of a slot which contains the element of a position is the same as the
+    // one of a slot which is free for the next position; a second slot prevents this ambiguity
+    static constexpr uint64_t NUMBER_OF_SLOTS{(MaxCapacity < 2U) ? 2U : MaxCapacity};
+    static constexpr uint64_t CACHE_LINE_SIZE{build::IOX_CACHE_LINE_SIZE};
+
+    /// @brief removes the value at a position if it is the oldest value and it is published
+    /// @param[in, out] readPosition the expected read position, updated with the actual one on failure
+    /// @return the removed value on success, empty optional otherwise
+    optional<ElementType> tryRemoveAt(uint64_t& readPosition) noexcept;
+
+    /// @brief waits until the slot of a claimed position is free, writes the value and publishes it
+    void writeAt(const uint64_t position, const ElementType& value) noexcept;
+
+    UninitializedArray<ElementType, NUMBER_OF_SLOTS> m_buffer;
+    // NOLINTJUSTIFICATION we need an initialized array here and will not use std::array for now
+    // NOLINTNEXTLINE(*avoid-c-arrays)
+    Atomic<uint64_t> m_sequences[NUMBER_OF_SLOTS];
+    Atomic<uint64_t> m_capacity{MaxCapacity};
+
+    alignas(CACHE_LINE_SIZE) Atomic<uint64_t> m_writePosition{0U};
+    alignas(CACHE_LINE_SIZE) Atomic<uint64_t> m_readPosition{0U};
+};
+
+} // namespace concurrent
+} // namespace iox
+
+#include "iox/detail/mpsc_lockfree_queue.inl"
+
+#endif // IOX_HOOFS_CONCURRENT_BUFFER_MPSC_LOCKFREE_QUEUE_HPP
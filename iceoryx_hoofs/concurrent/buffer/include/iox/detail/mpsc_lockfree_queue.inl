@@ -0,0 +1,276 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_HOOFS_CONCURRENT_BUFFER_MPSC_LOCKFREE_QUEUE_INL
+#define IOX_HOOFS_CONCURRENT_BUFFER_MPSC_LOCKFREE_QUEUE_INL
+
+#include "iox/detail/mpsc_lockfree_queue.hpp"
+
+#include <new>
+#include <thread>
+#include <utility>
+
+namespace iox
+{
+namespace concurrent
+{
+template <typename ElementType, uint64_t MaxCapacity>
+inline MpscLockFreeQueue<ElementType, MaxCapacity>::MpscLockFreeQueue() noexcept
+{
+    for (uint64_t i = 0U; i < NUMBER_OF_SLOTS; ++i)
+    {
+        // the slot 'i' is free for the position 'i'
+        m_sequences[i].store(i, std::memory_order_relaxed);
+    }
+}
+
+template <typename ElementType, uint64_t MaxCapacity>
+inline MpscLockFreeQueue<ElementType, MaxCapacity>::MpscLockFreeQueue(const uint64_t initialCapacity) noexcept
+    : MpscLockFreeQueue()
+{
+    if (initialCapacity > 0U && initialCapacity <= MaxCapacity)
+    {
+        m_capacity.store(initialCapacity, std::memory_order_relaxed);
+    }
+}
+
+template <typename ElementType, uint64_t MaxCapacity>
+inline MpscLockFreeQueue<ElementType, MaxCapacity>::~MpscLockFreeQueue() noexcept
+{
+    // destroy the remaining values
+    while (pop().has_value())
+    {
+    }
+}
+
+template <typename ElementType, uint64_t MaxCapacity>
+inline constexpr uint64_t MpscLockFreeQueue<ElementType, MaxCapacity>::maxCapacity() noexcept
+{
+    return MaxCapacity;
+}
+
+template <typename ElementType, uint64_t MaxCapacity>
+inline uint64_t MpscLockFreeQueue<ElementType, MaxCapacity>::capacity() const noexcept
+{
+    return m_capacity.load(std::memory_order_relaxed);
+}
+
+template <typename ElementType, uint64_t MaxCapacity>
+inline bool MpscLockFreeQueue<ElementType, MaxCapacity>::tryPush(const ElementType& value) noexcept
+{
+    uint64_t writePosition = m_writePosition.load(std::memory_order_relaxed);
+    while (true)
+    {
+        // SYNC POINT READ: m_buffer
+        // matches the release store of the consumer which removed the value of the previous round from the slot
+        const uint64_t sequence = m_sequences[writePosition % NUMBER_OF_SLOTS].load(std::memory_order_acquire);
+        if (sequence == writePosition)
+        {
+            // the read position is not used to access the buffer, therefore memory order relaxed is sufficient
+            if (writePosition >= m_readPosition.load(std::memory_order_relaxed) + capacity())
+            {
+                return false;
+            }
+
+            // on failure 'writePosition' is updated to the position which is claimed next
+            if (m_writePosition.compare_exchange_weak(
+                    writePosition, writePosition + 1U, std::memory_order_relaxed, std::memory_order_relaxed))
+            {
+                writeAt(writePosition, value);
+                return true;
+            }
+        }
+        else if (sequence < writePosition)
+        {
+            // the slot still contains the value of the previous round
+            return false;
+        }
+        else
+        {
+            // another producer claimed the position in the meantime
+            writePosition = m_writePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename ElementType, uint64_t MaxCapacity>
+inline optional<ElementType> MpscLockFreeQueue<ElementType, MaxCapacity>::push(const ElementType& value) noexcept
+{
+    // The position is claimed unconditionally. If the queue is full, the producer is responsible to remove exactly one
+    // value which guarantees that each overflow returns the oldest value and no value is lost.
+    const uint64_t writePosition = m_writePosition.fetch_add(1U, std::memory_order_relaxed);
+    const uint64_t currentCapacity = capacity();
+
+    optional<ElementType> removedValue;
+    if (writePosition >= currentCapacity)
+    {
+        // the claimed position is within the capacity as soon as the value at 'oldestPosition' is removed
+        const uint64_t oldestPosition = writePosition - currentCapacity;
+        uint64_t readPosition = m_readPosition.load(std::memory_order_relaxed);
+        while (readPosition <= oldestPosition)
+        {
+            const uint64_t expectedReadPosition = readPosition;
+            if (!removedValue.has_value())
+            {
+                removedValue = tryRemoveAt(readPosition);
+            }
+            else
+            {
+                readPosition = m_readPosition.load(std::memory_order_relaxed);
+            }
+
+            if (readPosition == expectedReadPosition)
+            {
+                // either the oldest value is not yet published or a producer which claimed an earlier position did
+                // not yet remove its value
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    writeAt(writePosition, value);
+    return removedValue;
+}
+
+template <typename ElementType, uint64_t MaxCapacity>
+inline optional<ElementType> MpscLockFreeQueue<ElementType, MaxCapacity>::pop() noexcept
+{
+    uint64_t readPosition = m_readPosition.load(std::memory_order_relaxed);
+    while (true)
+    {
+        const uint64_t expectedReadPosition = readPosition;
+        auto value = tryRemoveAt(readPosition);
+        // retry only if an overflowing producer removed the oldest value in the meantime
+        if (value.has_value() || readPosition == expectedReadPosition)
+        {
+            return value;
+        }
+    }
+}
+
+template <typename ElementType, uint64_t MaxCapacity>
+inline bool MpscLockFreeQueue<ElementType, MaxCapacity>::empty() const noexcept
+{
+    const uint64_t readPosition = m_readPosition.load(std::memory_order_relaxed);
+    return m_sequences[readPosition % NUMBER_OF_SLOTS].load(std::memory_order_relaxed) != readPosition + 1U;
+}
+
+template <typename ElementType, uint64_t MaxCapacity>
+inline uint64_t MpscLockFreeQueue<ElementType, MaxCapacity>::size() const noexcept
+{
+    // the read position must be loaded first, since the write position is never smaller than the read position this
+    // guarantees a non-negative difference
+    const uint64_t readPosition = m_readPosition.load(std::memory_order_relaxed);
+    const uint64_t writePosition = m_writePosition.load(std::memory_order_relaxed);
+    const uint64_t numberOfValues = writePosition - readPosition;
+
+    // an overflowing producer claims its position before it removes the oldest value
+    const uint64_t currentCapacity = capacity();
+    return (numberOfValues < currentCapacity) ? numberOfValues : currentCapacity;
+}
+
+template <typename ElementType, uint64_t MaxCapacity>
+template <typename Function, typename>
+inline bool MpscLockFreeQueue<ElementType, MaxCapacity>::setCapacity(const uint64_t newCapacity,
+                                                                      Function&& removeHandler) noexcept
+{
+    if (newCapacity == 0U || newCapacity > MaxCapacity)
+    {
+        return false;
+    }
+
+    m_capacity.store(newCapacity, std::memory_order_relaxed);
+
+    // an overflowing producer removes only the value at its claimed position minus the capacity, therefore the
+    // values which exceed the reduced capacity must be removed here
+    while (m_writePosition.load(std::memory_order_relaxed) - m_readPosition.load(std::memory_order_relaxed)
+           > newCapacity)
+    {
+        auto value = pop();
+        if (!value.has_value())
+        {
+            break;
+        }
+        removeHandler(std::move(value.value()));
+    }
+
+    return true;
+}
+
+template <typename ElementType, uint64_t MaxCapacity>
+inline bool MpscLockFreeQueue<ElementType, MaxCapacity>::setCapacity(const uint64_t newCapacity) noexcept
+{
+    return setCapacity(newCapacity, [](const ElementType&) {});
+}
+
+template <typename ElementType, uint64_t MaxCapacity>
+inline optional<ElementType> MpscLockFreeQueue<ElementType, MaxCapacity>::tryRemoveAt(uint64_t& readPosition) noexcept
+{
+    const uint64_t index = readPosition % NUMBER_OF_SLOTS;
+
+    // SYNC POINT READ: m_buffer
+    // matches the release store of the producer which published the value
+    if (m_sequences[index].load(std::memory_order_acquire) != readPosition + 1U)
+    {
+        // either the value is not yet published or it was already removed and 'readPosition' is outdated
+        readPosition = m_readPosition.load(std::memory_order_relaxed);
+        return nullopt;
+    }
+
+    // the buffer is accessed after the acquire load of the sequence, therefore memory order relaxed is sufficient to
+    // decide which thread removes the value
+    if (!m_readPosition.compare_exchange_strong(
+            readPosition, readPosition + 1U, std::memory_order_relaxed, std::memory_order_relaxed))
+    {
+        return nullopt;
+    }
+
+    optional<ElementType> value(std::move(m_buffer[index]));
+    m_buffer[index].~ElementType();
+
+    // SYNC POINT WRITE: m_buffer
+    // the slot is free for the position of the next round
+    m_sequences[index].store(readPosition + NUMBER_OF_SLOTS, std::memory_order_release);
+    ++readPosition;
+
+    return value;
+}
+
+template <typename ElementType, uint64_t MaxCapacity>
+inline void MpscLockFreeQueue<ElementType, MaxCapacity>::writeAt(const uint64_t position,
+                                                                 const ElementType& value) noexcept
+{
+    const uint64_t index = position % NUMBER_OF_SLOTS;
+
+    // SYNC POINT READ: m_buffer
+    // the slot is free as soon as the value of the previous round was removed; this only waits if the remove is still
+    // in progress
+    while (m_sequences[index].load(std::memory_order_acquire) != position)
+    {
+        std::this_thread::yield();
+    }
+
+    new (&m_buffer[index]) ElementType(value);
+
+    // SYNC POINT WRITE: m_buffer
+    m_sequences[index].store(position + 1U, std::memory_order_release);
+}
+
+} // namespace concurrent
+} // namespace iox
+
+#endif // IOX_HOOFS_CONCURRENT_BUFFER_MPSC_LOCKFREE_QUEUE_INL
@@ -19,6 +19,7 @@
 #define IOX_HOOFS_CONCURRENT_BUFFER_SPSC_FIFO_HPP
 
 #include "iox/atomic.hpp"
+#include "iox/iceoryx_hoofs_deployment.hpp"
 #include "iox/optional.hpp"
 #include "iox/uninitialized_array.hpp"
 
@@ -29,6 +30,9 @@ namespace concurrent
 /// @brief single producer single consumer thread safe fifo
 /// @note there is only one push and one pop thread that can work on the FIFO without additional synchronization
 /// mechanisms like transferring the authorization to push to a third thread
+/// @note the positions of the producer and the consumer are placed on separate cache lines, each together with the
+/// last seen position of the other side. The position of the other side is only loaded when the cached one indicates
+/// a full respectively an empty FIFO, which avoids that the cache line of the other side is pulled on every operation.
 template <typename ValueType, uint64_t Capacity>
 class SpscFifo
 {
@@ -65,9 +69,17 @@ class SpscFifo
 
 
   private:
+    static constexpr uint64_t CACHE_LINE_SIZE{build::IOX_CACHE_LINE_SIZE};
+
     UninitializedArray<ValueType, Capacity> m_data;
-    Atomic<uint64_t> m_writePos{0};
-    Atomic<uint64_t> m_readPos{0};
+
+    // producer cache line; 'm_cachedReadPos' is only accessed by the producer
+    alignas(CACHE_LINE_SIZE) Atomic<uint64_t> m_writePos{0};
+    uint64_t m_cachedReadPos{0};
+
+    // consumer cache line; 'm_cachedWritePos' is only accessed by the consumer
+    alignas(CACHE_LINE_SIZE) Atomic<uint64_t> m_readPos{0};
+    uint64_t m_cachedWritePos{0};
 };
 
 } // namespace concurrent
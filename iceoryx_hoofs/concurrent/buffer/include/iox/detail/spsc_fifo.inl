@@ -32,13 +32,19 @@ inline bool SpscFifo<ValueType, Capacity>::push(const ValueType& value) noexcept
     // - the load statement cannot be reordered with writing m_data otherwise there would be observable changes
     auto currentWritePos = m_writePos.load(std::memory_order_relaxed);
 
-    // There is no need to sync the memory (no data is written) but we need the memory order acquire
-    // to enforce the happens-before relationship of the matching store/release on m_readPos in the
-    // pop method
-    auto currentReadPos = m_readPos.load(std::memory_order_acquire);
-    if (is_full(currentReadPos, currentWritePos))
+    // The cached read position was loaded with memory order acquire and can only lag behind the actual one. If the
+    // FIFO is not full with the cached read position, the position to write to was already released by the pop method
+    // and the happens-before relationship was established when the cached read position was loaded.
+    if (is_full(m_cachedReadPos, currentWritePos))
     {
-        return false;
+        // There is no need to sync the memory (no data is written) but we need the memory order acquire
+        // to enforce the happens-before relationship of the matching store/release on m_readPos in the
+        // pop method
+        m_cachedReadPos = m_readPos.load(std::memory_order_acquire);
+        if (is_full(m_cachedReadPos, currentWritePos))
+        {
+            return false;
+        }
     }
     m_data[currentWritePos % Capacity] = value;
 
@@ -96,15 +102,20 @@ inline optional<ValueType> SpscFifo<ValueType, Capacity>::pop() noexcept
     // - the load statement cannot be reordered with the isEmpty check otherwise there would be observable changes
     auto currentReadPos = m_readPos.load(std::memory_order_relaxed);
 
-    bool isEmpty = (currentReadPos ==
-                    // SYNC POINT READ: m_data
-                    // See explanation of the corresponding sync point.
-                    // As a consequence, we are not allowed to use the empty method
-                    // since we have to sync with m_writePos in the push method
-                    m_writePos.load(std::memory_order_acquire));
-    if (isEmpty)
+    // The cached write position can only lag behind the actual one and the values up to it are already synchronized
+    // since it was loaded with memory order acquire. Only if it indicates an empty FIFO, the actual write position
+    // must be loaded.
+    if (currentReadPos == m_cachedWritePos)
     {
-        return nullopt_t();
+        // SYNC POINT READ: m_data
+        // See explanation of the corresponding sync point.
+        // As a consequence, we are not allowed to use the empty method
+        // since we have to sync with m_writePos in the push method
+        m_cachedWritePos = m_writePos.load(std::memory_order_acquire);
+        if (currentReadPos == m_cachedWritePos)
+        {
+            return nullopt_t();
+        }
     }
 
     ValueType out = m_data[currentReadPos % Capacity];
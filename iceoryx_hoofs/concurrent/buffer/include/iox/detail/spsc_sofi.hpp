@@ -20,6 +20,7 @@
 
 #include "iceoryx_platform/platform_correction.hpp"
 #include "iox/atomic.hpp"
+#include "iox/iceoryx_hoofs_deployment.hpp"
 #include "iox/type_traits.hpp"
 #include "iox/uninitialized_array.hpp"
 
@@ -39,6 +40,9 @@ namespace concurrent
 /// SpscSoFi is especially designed to provide fixed capacity storage.
 /// It's an expected behavior that when push/pop are called concurrently and SpscSoFi is full, as
 /// many elements as specified with 'CapacityValue' can be removed
+/// @note The read and the write position are placed on separate cache lines. The producer and the consumer keep the
+/// last seen position of the other side on their own cache line and only load the position of the other side when
+/// the cached one indicates a full respectively an empty SpscSofi.
 /// @param[in] ValueType        DataType to be stored, must be trivially copyable
 /// @param[in] CapacityValue    Capacity of the SpscSofi
 template <class ValueType, uint64_t CapacityValue>
@@ -159,10 +163,18 @@ class SpscSofi
     std::pair<uint64_t, uint64_t> getReadWritePositions() const noexcept;
 
   private:
+    static constexpr uint64_t CACHE_LINE_SIZE{build::IOX_CACHE_LINE_SIZE};
+
     UninitializedArray<ValueType, INTERNAL_SPSC_SOFI_CAPACITY> m_data;
     uint64_t m_size = INTERNAL_SPSC_SOFI_CAPACITY;
-    Atomic<uint64_t> m_readPosition{0};
-    Atomic<uint64_t> m_writePosition{0};
+
+    // consumer cache line; 'm_cachedWritePosition' is only accessed by the consumer
+    alignas(CACHE_LINE_SIZE) Atomic<uint64_t> m_readPosition{0};
+    uint64_t m_cachedWritePosition{0};
+
+    // producer cache line; 'm_cachedReadPosition' is only accessed by the producer
+    alignas(CACHE_LINE_SIZE) Atomic<uint64_t> m_writePosition{0};
+    uint64_t m_cachedReadPosition{0};
 };
 
 } // namespace concurrent
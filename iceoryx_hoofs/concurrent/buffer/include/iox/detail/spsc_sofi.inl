@@ -82,6 +82,8 @@ inline bool SpscSofi<ValueType, CapacityValue>::setCapacity(const uint64_t newSi
 
         m_readPosition.store(0, std::memory_order_release);
         m_writePosition.store(0, std::memory_order_release);
+        m_cachedReadPosition = 0;
+        m_cachedWritePosition = 0;
 
         return true;
     }
@@ -109,9 +111,18 @@ inline bool SpscSofi<ValueType, CapacityValue>::pop(ValueType& valueOut) noexcep
 
     do
     {
-        // SYNC POINT READ: m_data
-        // See explanation of the corresponding synchronization point in push()
-        if (currentReadPosition == m_writePosition.load(std::memory_order_acquire))
+        // The cached write position was loaded with memory order acquire and the producer never moves the write
+        // position backwards, therefore all positions below the cached one are already synchronized. Since the
+        // producer advances the read position in the overflow case, the read position can pass the cached write
+        // position, which also requires a reload.
+        if (currentReadPosition >= m_cachedWritePosition)
+        {
+            // SYNC POINT READ: m_data
+            // See explanation of the corresponding synchronization point in push()
+            m_cachedWritePosition = m_writePosition.load(std::memory_order_acquire);
+        }
+
+        if (currentReadPosition == m_cachedWritePosition)
         {
             nextReadPosition = currentReadPosition;
             popWasSuccessful = false;
@@ -187,13 +198,22 @@ inline bool SpscSofi<ValueType, CapacityValue>::push(const ValueType& valueIn, V
     // 5. The consumer thread missed the chance to pop the element in the blink of an eye
     m_writePosition.store(nextWritePosition, std::memory_order_release);
 
+    // Check if queue is full: since we have an extra element (INTERNAL_CAPACITY_ADD_ON), we need to
+    // check if there is a free position for the *next* write position
+    // The read position only increases, therefore the cached one can only lag behind and if there is a free position
+    // with the cached read position there is also one with the actual read position. This avoids to access the cache
+    // line of the consumer as long as the queue is not close to an overflow.
+    if (nextWritePosition < m_cachedReadPosition + m_size)
+    {
+        return !SOFI_OVERFLOW;
+    }
+
     // Memory order relaxed is enough since:
     // - no synchronization needed when loading
     // - the operation cannot move below without observable changes
     uint64_t currentReadPosition = m_readPosition.load(std::memory_order_relaxed);
+    m_cachedReadPosition = currentReadPosition;
 
-    // Check if queue is full: since we have an extra element (INTERNAL_CAPACITY_ADD_ON), we need to
-    // check if there is a free position for the *next* write position
     if (nextWritePosition < currentReadPosition + m_size)
     {
         return !SOFI_OVERFLOW;
@@ -220,6 +240,8 @@ inline bool SpscSofi<ValueType, CapacityValue>::push(const ValueType& valueIn, V
     if (m_readPosition.compare_exchange_strong(
             currentReadPosition, currentReadPosition + 1U, std::memory_order_acq_rel, std::memory_order_acquire))
     {
+        m_cachedReadPosition = currentReadPosition + 1U;
+
         // Since INTERNAL_SOFI_CAPACITY = CapacityValue + 1, it can happen that we return more
         // elements than the CapacityValue by calling push and pop concurrently (in case of an
         // overflow). This is an inherent behavior with concurrent queues. Scenario example
@@ -251,6 +273,9 @@ inline bool SpscSofi<ValueType, CapacityValue>::push(const ValueType& valueIn, V
         return SOFI_OVERFLOW;
     }
 
+    // on failure 'currentReadPosition' contains the read position which was advanced by the consumer
+    m_cachedReadPosition = currentReadPosition;
+
     return !SOFI_OVERFLOW;
 }
 
@@ -0,0 +1,262 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_HOOFS_CONTAINER_FIXED_CAPACITY_HASH_MAP_INL
+#define IOX_HOOFS_CONTAINER_FIXED_CAPACITY_HASH_MAP_INL
+
+#include "iox/fixed_capacity_hash_map.hpp"
+
+namespace iox
+{
+template <typename Key, typename Value, uint64_t Capacity, typename Hasher>
+template <typename... Targs>
+inline FixedCapacityHashMap<Key, Value, Capacity, Hasher>::Entry::Entry(const uint64_t hash,
+                                                                       const Key& key,
+                                                                       Targs&&... args) noexcept
+    : m_hash(hash)
+    , m_key(key)
+    , m_value(std::forward<Targs>(args)...)
+{
+}
+
+template <typename Key, typename Value, uint64_t Capacity, typename Hasher>
+inline const Key& FixedCapacityHashMap<Key, Value, Capacity, Hasher>::Entry::key() const noexcept
+{
+    return m_key;
+}
+
+template <typename Key, typename Value, uint64_t Capacity, typename Hasher>
+inline Value& FixedCapacityHashMap<Key, Value, Capacity, Hasher>::Entry::value() noexcept
+{
+    return m_value;
+}
+
+template <typename Key, typename Value, uint64_t Capacity, typename Hasher>
+inline const Value& FixedCapacityHashMap<Key, Value, Capacity, Hasher>::Entry::value() const noexcept
+{
+    return m_value;
+}
+
+template <typename Key, typename Value, uint64_t Capacity, typename Hasher>
+inline bool FixedCapacityHashMap<Key, Value, Capacity, Hasher>::insert(const Key& key, const Value& value) noexcept
+{
+    return emplace(key, value);
+}
+
+template <typename Key, typename Value, uint64_t Capacity, typename Hasher>
+template <typename... Targs>
+inline bool FixedCapacityHashMap<Key, Value, Capacity, Hasher>::emplace(const Key& key, Targs&&... args) noexcept
+{
+    const auto hash = hashOf(key);
+    const auto slot = findSlot(hash, key);
+    if (m_slots[slot] != EMPTY_SLOT || full())
+    {
+        return false;
+    }
+
+    IOX_DISCARD_RESULT(m_entries.emplace_back(hash, key, std::forward<Targs>(args)...));
+    m_slots[slot] = static_cast<Slot>(m_entries.size());
+    return true;
+}
+
+template <typename Key, typename Value, uint64_t Capacity, typename Hasher>
+inline bool FixedCapacityHashMap<Key, Value, Capacity, Hasher>::insertOrAssign(const Key& key,
+                                                                             const Value& value) noexcept
+{
+    auto entry = find(key);
+    if (entry != end())
+    {
+        entry->m_value = value;
+        return true;
+    }
+    return emplace(key, value);
+}
+
+template <typename Key, typename Value, uint64_t Capacity, typename Hasher>
+inline bool FixedCapacityHashMap<Key, Value, Capacity, Hasher>::erase(const Key& key) noexcept
+{
+    const auto slot = findSlot(hashOf(key), key);
+    if (m_slots[slot] == EMPTY_SLOT)
+    {
+        return false;
+    }
+
+    const uint64_t entryIndex{static_cast<uint64_t>(m_slots[slot]) - 1U};
+    eraseSlot(slot);
+
+    const uint64_t lastEntryIndex{m_entries.size() - 1U};
+    if (entryIndex != lastEntryIndex)
+    {
+        m_slots[findSlotOfEntry(lastEntryIndex)] = static_cast<Slot>(entryIndex + 1U);
+        m_entries[entryIndex] = std::move(m_entries[lastEntryIndex]);
+    }
+    IOX_DISCARD_RESULT(m_entries.pop_back());
+    return true;
+}
+
+template <typename Key, typename Value, uint64_t Capacity, typename Hasher>
+inline void FixedCapacityHashMap<Key, Value, Capacity, Hasher>::clear() noexcept
+{
+    m_entries.clear();
+    for (auto& slot : m_slots)
+    {
+        slot = EMPTY_SLOT;
+    }
+}
+
+template <typename Key, typename Value, uint64_t Capacity, typename Hasher>
+inline typename FixedCapacityHashMap<Key, Value, Capacity, Hasher>::Iterator
+FixedCapacityHashMap<Key, Value, Capacity, Hasher>::find(const Key& key) noexcept
+{
+    // AXIVION Next Construct AutosarC++19_03-A5.2.3 : const_cast avoids code duplication
+    return const_cast<Iterator>(static_cast<const FixedCapacityHashMap*>(this)->find(key));
+}
+
+template <typename Key, typename Value, uint64_t Capacity, typename Hasher>
+inline typename FixedCapacityHashMap<Key, Value, Capacity, Hasher>::ConstIterator
+FixedCapacityHashMap<Key, Value, Capacity, Hasher>::find(const Key& key) const noexcept
+{
+    const auto slot = m_slots[findSlot(hashOf(key), key)];
+    return (slot == EMPTY_SLOT) ? end() : &m_entries[static_cast<uint64_t>(slot) - 1U];
+}
+
+template <typename Key, typename Value, uint64_t Capacity, typename Hasher>
+inline bool FixedCapacityHashMap<Key, Value, Capacity, Hasher>::contains(const Key& key) const noexcept
+{
+    return find(key) != end();
+}
+
+template <typename Key, typename Value, uint64_t Capacity, typename Hasher>
+inline bool FixedCapacityHashMap<Key, Value, Capacity, Hasher>::empty() const noexcept
+{
+    return m_entries.empty();
+}
+
+template <typename Key, typename Value, uint64_t Capacity, typename Hasher>
+inline bool FixedCapacityHashMap<Key, Value, Capacity, Hasher>::full() const noexcept
+{
+    return m_entries.size() >= Capacity;
+}
+
+template <typename Key, typename Value, uint64_t Capacity, typename Hasher>
+inline uint64_t FixedCapacityHashMap<Key, Value, Capacity, Hasher>::size() const noexcept
+{
+    return m_entries.size();
+}
+
+template <typename Key, typename Value, uint64_t Capacity, typename Hasher>
+inline constexpr uint64_t FixedCapacityHashMap<Key, Value, Capacity, Hasher>::capacity() noexcept
+{
+    return Capacity;
+}
+
+template <typename Key, typename Value, uint64_t Capacity, typename Hasher>
+inline typename FixedCapacityHashMap<Key, Value, Capacity, Hasher>::Iterator
+FixedCapacityHashMap<Key, Value, Capacity, Hasher>::begin() noexcept
+{
+    return m_entries.begin();
+}
+
+template <typename Key, typename Value, uint64_t Capacity, typename Hasher>
+inline typename FixedCapacityHashMap<Key, Value, Capacity, Hasher>::ConstIterator
+FixedCapacityHashMap<Key, Value, Capacity, Hasher>::begin() const noexcept
+{
+    return m_entries.begin();
+}
+
+template <typename Key, typename Value, uint64_t Capacity, typename Hasher>
+inline typename FixedCapacityHashMap<Key, Value, Capacity, Hasher>::Iterator
+FixedCapacityHashMap<Key, Value, Capacity, Hasher>::end() noexcept
+{
+    return m_entries.end();
+}
+
+template <typename Key, typename Value, uint64_t Capacity, typename Hasher>
+inline typename FixedCapacityHashMap<Key, Value, Capacity, Hasher>::ConstIterator
+FixedCapacityHashMap<Key, Value, Capacity, Hasher>::end() const noexcept
+{
+    return m_entries.end();
+}
+
+template <typename Key, typename Value, uint64_t Capacity, typename Hasher>
+inline uint64_t FixedCapacityHashMap<Key, Value, Capacity, Hasher>::hashOf(const Key& key) const noexcept
+{
+    return Hasher()(key);
+}
+
+template <typename Key, typename Value, uint64_t Capacity, typename Hasher>
+inline uint64_t FixedCapacityHashMap<Key, Value, Capacity, Hasher>::homeSlot(const uint64_t hash) const noexcept
+{
+    return hash & SLOT_MASK;
+}
+
+template <typename Key, typename Value, uint64_t Capacity, typename Hasher>
+inline uint64_t FixedCapacityHashMap<Key, Value, Capacity, Hasher>::nextSlot(const uint64_t slot) const noexcept
+{
+    return (slot + 1U) & SLOT_MASK;
+}
+
+template <typename Key, typename Value, uint64_t Capacity, typename Hasher>
+inline uint64_t FixedCapacityHashMap<Key, Value, Capacity, Hasher>::findSlot(const uint64_t hash,
+                                                                           const Key& key) const noexcept
+{
+    // at most half of the slots are in use, therefore the loop always terminates at an empty slot
+    auto slot = homeSlot(hash);
+    while (m_slots[slot] != EMPTY_SLOT)
+    {
+        const auto& entry = m_entries[static_cast<uint64_t>(m_slots[slot]) - 1U];
+        if (entry.m_hash == hash && entry.m_key == key)
+        {
+            break;
+        }
+        slot = nextSlot(slot);
+    }
+    return slot;
+}
+
+template <typename Key, typename Value, uint64_t Capacity, typename Hasher>
+inline uint64_t
+FixedCapacityHashMap<Key, Value, Capacity, Hasher>::findSlotOfEntry(const uint64_t entryIndex) const noexcept
+{
+    auto slot = homeSlot(m_entries[entryIndex].m_hash);
+    while (static_cast<uint64_t>(m_slots[slot]) != entryIndex + 1U)
+    {
+        slot = nextSlot(slot);
+    }
+    return slot;
+}
+
+template <typename Key, typename Value, uint64_t Capacity, typename Hasher>
+inline void FixedCapacityHashMap<Key, Value, Capacity, Hasher>::eraseSlot(uint64_t slot) noexcept
+{
+    for (auto candidate = nextSlot(slot); m_slots[candidate] != EMPTY_SLOT; candidate = nextSlot(candidate))
+    {
+        const auto home = homeSlot(m_entries[static_cast<uint64_t>(m_slots[candidate]) - 1U].m_hash);
+        // the entry can fill the gap if its home slot is not in the cyclic range (slot, candidate]
+        const uint64_t distanceFromHome{(candidate - home) & SLOT_MASK};
+        const uint64_t distanceFromGap{(candidate - slot) & SLOT_MASK};
+        if (distanceFromHome >= distanceFromGap)
+        {
+            m_slots[slot] = m_slots[candidate];
+            slot = candidate;
+        }
+    }
+    m_slots[slot] = EMPTY_SLOT;
+}
+} // namespace iox
+
+#endif // IOX_HOOFS_CONTAINER_FIXED_CAPACITY_HASH_MAP_INL
@@ -0,0 +1,176 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_HOOFS_CONTAINER_FIXED_CAPACITY_HASH_MAP_HPP
+#define IOX_HOOFS_CONTAINER_FIXED_CAPACITY_HASH_MAP_HPP
+
+#include "iox/algorithm.hpp"
+#include "iox/hash.hpp"
+#include "iox/vector.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace iox
+{
+/// @brief A hash map with a fixed capacity which does not allocate heap memory. The entries are stored densely in
+/// insertion order and are looked up with an open addressing table of indices with linear probing. Since the map
+/// contains only indices and no pointers, it is trivially relocatable and can be placed in shared memory when the key
+/// and value types can be placed there, e.g. 'iox::string' keys.
+/// @note The iteration order is the insertion order until an entry is erased; then the last entry is moved to the
+/// position of the erased one. The order does therefore only depend on the sequence of operations but not on the hash
+/// values or the memory location of the map.
+/// @attention Keys must not be modified while they are stored in the map
+/// @tparam Key is the type of the keys; it must be equality comparable with 'operator=='
+/// @tparam Value is the type of the values
+/// @tparam Capacity is the maximum number of entries the map can hold
+/// @tparam Hasher is a function object which returns the 'uint64_t' hash of a key; it must be the same in all processes
+/// which access the map
+template <typename Key, typename Value, uint64_t Capacity, typename Hasher = Hash<Key>>
+class FixedCapacityHashMap
+{
+    static_assert(Capacity > 0U, "The capacity of the FixedCapacityHashMap must be greater than 0!");
+
+  public:
+    class Entry
+    {
+      public:
+        template <typename... Targs>
+        Entry(const uint64_t hash, const Key& key, Targs&&... args) noexcept;
+
+        /// @brief Access to the key of the entry
+        const Key& key() const noexcept;
+
+        /// @brief Access to the value of the entry
+        Value& value() noexcept;
+
+        /// @brief Read-only access to the value of the entry
+        const Value& value() const noexcept;
+
+      private:
+        friend class FixedCapacityHashMap;
+
+        uint64_t m_hash{0U};
+        Key m_key;
+        Value m_value;
+    };
+
+    using Iterator = Entry*;
+    using ConstIterator = const Entry*;
+
+    /// @brief Inserts a new entry by copying the value
+    /// @param[in] key of the new entry
+    /// @param[in] value of the new entry
+    /// @return 'true' if the entry was inserted, 'false' if the key is already contained or the map is full
+    bool insert(const Key& key, const Value& value) noexcept;
+
+    /// @brief Inserts a new entry and constructs the value in-place
+    /// @tparam Targs template parameter pack for the perfectly forwarded arguments
+    /// @param[in] key of the new entry
+    /// @param[in] args arguments which are used by the constructor of the value
+    /// @return 'true' if the entry was inserted, 'false' if the key is already contained or the map is full
+    template <typename... Targs>
+    bool emplace(const Key& key, Targs&&... args) noexcept;
+
+    /// @brief Assigns the value to the entry of the key or inserts a new entry if the key is not yet contained
+    /// @param[in] key of the entry
+    /// @param[in] value of the entry
+    /// @return 'true' if the value was assigned or inserted, 'false' if the map is full
+    bool insertOrAssign(const Key& key, const Value& value) noexcept;
+
+    /// @brief Erases the entry of the key
+    /// @param[in] key of the entry to erase
+    /// @return 'true' if the entry was erased, 'false' if the key is not contained
+    /// @note The last entry is moved to the position of the erased entry, i.e. iterators to the last entry are
+    /// invalidated
+    bool erase(const Key& key) noexcept;
+
+    /// @brief Erases all entries
+    void clear() noexcept;
+
+    /// @brief Looks up the entry of a key
+    /// @param[in] key of the entry
+    /// @return iterator to the entry or 'end' iterator if the key is not contained
+    Iterator find(const Key& key) noexcept;
+
+    /// @brief Looks up the entry of a key
+    /// @param[in] key of the entry
+    /// @return iterator to the entry or 'end' iterator if the key is not contained
+    ConstIterator find(const Key& key) const noexcept;
+
+    /// @brief Checks if the map contains an entry for the key
+    /// @param[in] key of the entry
+    /// @return 'true' if the key is contained, 'false' otherwise
+    bool contains(const Key& key) const noexcept;
+
+    /// @brief Checks if the map is empty
+    /// @return 'true' if the map is empty, 'false' otherwise
+    [[nodiscard]] bool empty() const noexcept;
+
+    /// @brief Checks if the map is full
+    /// @return 'true' if the map is full, 'false' otherwise
+    [[nodiscard]] bool full() const noexcept;
+
+    /// @brief Get the number of entries
+    /// @return the number of entries
+    [[nodiscard]] uint64_t size() const noexcept;
+
+    /// @brief Get the capacity of the map
+    /// @return the capacity of the map
+    [[nodiscard]] static constexpr uint64_t capacity() noexcept;
+
+    Iterator begin() noexcept;
+    ConstIterator begin() const noexcept;
+    Iterator end() noexcept;
+    ConstIterator end() const noexcept;
+
+  private:
+    /// @brief The number of slots in the index table; with at most half of the slots in use, the probe sequences stay
+    /// short and there is always an empty slot which terminates a lookup
+    static constexpr uint64_t SLOT_MASK{[] {
+        uint64_t numberOfSlots{1U};
+        while (numberOfSlots < 2U * Capacity)
+        {
+            numberOfSlots <<= 1U;
+        }
+        return numberOfSlots - 1U;
+    }()};
+
+    /// @brief A slot contains the index of the entry plus one; zero marks an empty slot
+    using Slot = BestFittingType_t<Capacity>;
+    static constexpr Slot EMPTY_SLOT{0U};
+
+    uint64_t hashOf(const Key& key) const noexcept;
+    uint64_t homeSlot(const uint64_t hash) const noexcept;
+    uint64_t nextSlot(const uint64_t slot) const noexcept;
+    /// @brief Finds the slot which refers to the entry with the key or the empty slot where it would be inserted
+    uint64_t findSlot(const uint64_t hash, const Key& key) const noexcept;
+    /// @brief Finds the slot which refers to the entry with the given index
+    uint64_t findSlotOfEntry(const uint64_t entryIndex) const noexcept;
+    /// @brief Empties a slot and moves the following entries of the probe sequence backwards, which keeps the probe
+    /// sequences free of gaps without tombstones
+    void eraseSlot(uint64_t slot) noexcept;
+
+    vector<Entry, Capacity> m_entries;
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays) plain indices keep the map relocatable
+    Slot m_slots[SLOT_MASK + 1U]{};
+};
+} // namespace iox
+
+#include "iox/detail/fixed_capacity_hash_map.inl"
+
+#endif // IOX_HOOFS_CONTAINER_FIXED_CAPACITY_HASH_MAP_HPP
@@ -0,0 +1,163 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_HOOFS_CONTAINER_FIXED_CAPACITY_HASH_SET_HPP
+#define IOX_HOOFS_CONTAINER_FIXED_CAPACITY_HASH_SET_HPP
+
+#include "iox/fixed_capacity_hash_map.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+/// @brief A hash set with a fixed capacity which does not allocate heap memory. It has the same properties as the
+/// 'FixedCapacityHashMap', i.e. it is trivially relocatable and iterates deterministically.
+/// @tparam Key is the type of the keys; it must be equality comparable with 'operator=='
+/// @tparam Capacity is the maximum number of keys the set can hold
+/// @tparam Hasher is a function object which returns the 'uint64_t' hash of a key; it must be the same in all processes
+/// which access the set
+template <typename Key, uint64_t Capacity, typename Hasher = Hash<Key>>
+class FixedCapacityHashSet
+{
+    struct NoValue
+    {
+    };
+    using Map_t = FixedCapacityHashMap<Key, NoValue, Capacity, Hasher>;
+
+  public:
+    class ConstIterator
+    {
+      public:
+        explicit ConstIterator(typename Map_t::ConstIterator entry) noexcept
+            : m_entry(entry)
+        {
+        }
+
+        const Key& operator*() const noexcept
+        {
+            return m_entry->key();
+        }
+
+        const Key* operator->() const noexcept
+        {
+            return &m_entry->key();
+        }
+
+        ConstIterator& operator++() noexcept
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) the entries are stored in an array
+            ++m_entry;
+            return *this;
+        }
+
+        bool operator==(const ConstIterator& rhs) const noexcept
+        {
+            return m_entry == rhs.m_entry;
+        }
+
+        bool operator!=(const ConstIterator& rhs) const noexcept
+        {
+            return m_entry != rhs.m_entry;
+        }
+
+      private:
+        typename Map_t::ConstIterator m_entry;
+    };
+
+    /// @brief Inserts a key
+    /// @param[in] key to insert
+    /// @return 'true' if the key was inserted, 'false' if the key is already contained or the set is full
+    bool insert(const Key& key) noexcept
+    {
+        return m_map.emplace(key);
+    }
+
+    /// @brief Erases a key
+    /// @param[in] key to erase
+    /// @return 'true' if the key was erased, 'false' if the key is not contained
+    /// @note The last key is moved to the position of the erased key, i.e. iterators to the last key are invalidated
+    bool erase(const Key& key) noexcept
+    {
+        return m_map.erase(key);
+    }
+
+    /// @brief Erases all keys
+    void clear() noexcept
+    {
+        m_map.clear();
+    }
+
+    /// @brief Looks up a key
+    /// @param[in] key to look up
+    /// @return iterator to the key or 'end' iterator if the key is not contained
+    ConstIterator find(const Key& key) const noexcept
+    {
+        return ConstIterator(m_map.find(key));
+    }
+
+    /// @brief Checks if the set contains the key
+    /// @param[in] key to look up
+    /// @return 'true' if the key is contained, 'false' otherwise
+    bool contains(const Key& key) const noexcept
+    {
+        return m_map.contains(key);
+    }
+
+    /// @brief Checks if the set is empty
+    /// @return 'true' if the set is empty, 'false' otherwise
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return m_map.empty();
+    }
+
+    /// @brief Checks if the set is full
+    /// @return 'true' if the set is full, 'false' otherwise
+    [[nodiscard]] bool full() const noexcept
+    {
+        return m_map.full();
+    }
+
+    /// @brief Get the number of keys
+    /// @return the number of keys
+    [[nodiscard]] uint64_t size() const noexcept
+    {
+        return m_map.size();
+    }
+
+    /// @brief Get the capacity of the set
+    /// @return the capacity of the set
+    [[nodiscard]] static constexpr uint64_t capacity() noexcept
+    {
+        return Capacity;
+    }
+
+    ConstIterator begin() const noexcept
+    {
+        return ConstIterator(m_map.begin());
+    }
+
+    ConstIterator end() const noexcept
+    {
+        return ConstIterator(m_map.end());
+    }
+
+  private:
+    Map_t m_map;
+};
+} // namespace iox
+
+#endif // IOX_HOOFS_CONTAINER_FIXED_CAPACITY_HASH_SET_HPP
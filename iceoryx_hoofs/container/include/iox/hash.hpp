@@ -0,0 +1,87 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_HOOFS_CONTAINER_HASH_HPP
+#define IOX_HOOFS_CONTAINER_HASH_HPP
+
+#include "iox/string.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace iox
+{
+namespace detail
+{
+/// @brief Mixes the bits of a 64 bit value; this is the finalizer of the 'splitmix64' generator
+constexpr uint64_t mixHashBits(uint64_t value) noexcept
+{
+    value ^= value >> 30U;
+    value *= 0xbf58476d1ce4e5b9U;
+    value ^= value >> 27U;
+    value *= 0x94d049bb133111ebU;
+    value ^= value >> 31U;
+    return value;
+}
+
+/// @brief Calculates the 64 bit FNV-1a hash of a byte sequence
+/// @param[in] data pointer to the first byte
+/// @param[in] size number of bytes
+/// @return the hash value
+inline uint64_t fnv1aHash(const char* const data, const uint64_t size) noexcept
+{
+    constexpr uint64_t FNV_OFFSET_BASIS{0xcbf29ce484222325U};
+    constexpr uint64_t FNV_PRIME{0x100000001b3U};
+
+    uint64_t hash{FNV_OFFSET_BASIS};
+    for (uint64_t i{0U}; i < size; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) size is provided by the caller
+        hash ^= static_cast<uint8_t>(data[i]);
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+} // namespace detail
+
+/// @brief The default hash function of the hoofs containers. In contrast to 'std::hash' it does not depend on the
+/// standard library implementation, i.e. the hash values are the same for all processes which share a container.
+/// @tparam T is the type to hash; integral types, enums and 'iox::string' are supported
+template <typename T, typename = void>
+struct Hash;
+
+template <typename T>
+struct Hash<T, std::enable_if_t<std::is_integral<T>::value || std::is_enum<T>::value>>
+{
+    uint64_t operator()(const T& value) const noexcept
+    {
+        // the value is mixed since integral keys are often consecutive and would otherwise occupy consecutive slots
+        return detail::mixHashBits(static_cast<uint64_t>(value));
+    }
+};
+
+template <uint64_t Capacity>
+struct Hash<string<Capacity>>
+{
+    uint64_t operator()(const string<Capacity>& value) const noexcept
+    {
+        return detail::fnv1aHash(value.c_str(), value.size());
+    }
+};
+} // namespace iox
+
+#endif // IOX_HOOFS_CONTAINER_HASH_HPP
@@ -18,6 +18,7 @@
 #ifndef IOX_HOOFS_MEMORY_POINTER_REPOSITORY_HPP
 #define IOX_HOOFS_MEMORY_POINTER_REPOSITORY_HPP
 
+#include "iox/atomic.hpp"
 #include "iox/optional.hpp"
 #include "iox/vector.hpp"
 
@@ -36,7 +37,9 @@ class PointerRepository final
   private:
     struct Info
     {
-        ptr_t basePtr{nullptr};
+        // the base pointer is published last when an id is registered; since ids can be registered on demand while
+        // other threads resolve relative pointers, it is atomic and the hot path stays a single load
+        concurrent::Atomic<ptr_t> basePtr{nullptr};
         ptr_t endPtr{nullptr};
     };
 
@@ -52,6 +55,10 @@ class PointerRepository final
     /// i.e. its corresponding base ptr is 0
     static constexpr id_t RAW_POINTER_BEHAVIOUR_ID{0};
 
+    /// @brief handler which is called with an id whose base pointer is requested but which is not registered;
+    /// it can register the id on demand, e.g. by mapping the corresponding memory
+    using UnknownIdHandler = void (*)(const id_t id);
+
     /// @brief default constructor
     PointerRepository() noexcept;
     ~PointerRepository() noexcept = default;
@@ -85,9 +92,17 @@ class PointerRepository final
     /// @attention the relative pointers corresponding to this id become unsafe to use
     void unregisterAll() noexcept;
 
+    /// @brief sets the handler which is called when the base pointer of an unregistered id is requested
+    /// @param[in] handler is the handler to call, nullptr disables the on demand registration
+    /// @note the handler must synchronize a concurrent registration of the same id by itself; an id registered by
+    /// the handler is visible to all threads which call getBasePtr afterwards
+    void setUnknownIdHandler(const UnknownIdHandler handler) noexcept;
+
     /// @brief gets the base pointer, i.e. the starting address, associated with id
     /// @param[in] id is the segment id
     /// @return the base pointer associated with the id
+    /// @note if the id is not registered and an UnknownIdHandler is set, the handler is called once before the
+    /// lookup is repeated
     ptr_t getBasePtr(const id_t id) const noexcept;
 
     /// @brief returns the id for a given pointer ptr
@@ -103,7 +118,8 @@ class PointerRepository final
     /// and each needs to initialize it via register calls above
 
     iox::vector<Info, CAPACITY> m_info;
-    uint64_t m_maxRegistered{0U};
+    concurrent::Atomic<uint64_t> m_maxRegistered{0U};
+    UnknownIdHandler m_unknownIdHandler{nullptr};
 
     bool addPointerIfIdIsFree(const id_t id, const ptr_t ptr, const uint64_t size) noexcept;
 };
@@ -176,6 +176,12 @@ inline void RelativePointer<T>::unregisterAll() noexcept
     getRepository().unregisterAll();
 }
 
+template <typename T>
+inline void RelativePointer<T>::setUnknownSegmentHandler(const UnknownSegmentHandler handler) noexcept
+{
+    getRepository().setUnknownIdHandler(handler);
+}
+
 template <typename T>
 // NOLINTJUSTIFICATION NewType size is comparable to an integer, hence pass by value is preferred
 // NOLINTNEXTLINE(performance-unnecessary-value-param)
@@ -43,6 +43,15 @@ void* alignedAlloc(const size_t alignment, const size_t size) noexcept;
 /// @param[in] memory, pointer to the aligned memory
 void alignedFree(void* const memory) noexcept;
 
+/// @brief copies memory with non-temporal stores which bypass the cache, so that copying a large buffer does not
+/// evict the working set of the caller; falls back to std::memcpy on platforms without non-temporal stores
+/// @param[in] destination, start of the memory to copy to; must not overlap with the source
+/// @param[in] source, start of the memory to copy from
+/// @param[in] size, number of bytes to copy
+/// @note the non-temporal stores are completed with a store fence before the function returns, i.e. the copied
+/// memory is published to other threads by a subsequent release store like with std::memcpy
+void streamingCopy(void* const destination, const void* const source, const uint64_t size) noexcept;
+
 /// template recursion stopper for maximum alignment calculation
 template <std::size_t S = 0>
 // AXIVION Next Construct AutosarC++19_03-A2.10.5 : The function is in the 'iox' namespace which prevents easy misuse
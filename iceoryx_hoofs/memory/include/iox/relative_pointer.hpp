@@ -67,6 +67,7 @@ class RelativePointer final
 {
   public:
     using ptr_t = T*;
+    using UnknownSegmentHandler = void (*)(const segment_id_underlying_t id);
     using offset_t = std::uint64_t;
 
     /// @brief Default constructs a RelativePointer as a logical nullptr
@@ -157,6 +158,12 @@ class RelativePointer final
     /// @brief Unregisters all ptr id pairs leading to initial state. This affects all pointer both typed and untyped.
     static void unregisterAll() noexcept;
 
+    /// @brief Sets the handler which is called when the base pointer of an unregistered segment is requested. The
+    /// handler can register the segment on demand, e.g. by mapping the corresponding shared memory.
+    /// @param[in] handler Is the handler which is called with the id of the unregistered segment, nullptr disables
+    /// the on demand registration
+    static void setUnknownSegmentHandler(const UnknownSegmentHandler handler) noexcept;
+
     /// @brief Get the offset from id and ptr
     /// @param[in] id Is the id of the segment and is used to get the base pointer
     /// @param[in] ptr Is the pointer whose offset should be calculated
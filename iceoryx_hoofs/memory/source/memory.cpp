@@ -18,6 +18,11 @@
 #include "iox/memory.hpp"
 
 #include <cstdlib>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 namespace iox
 {
@@ -56,4 +61,62 @@ void alignedFree(void* const memory) noexcept
         std::free(reinterpret_cast<void**>(memory)[-1]);
     }
 }
+
+void streamingCopy(void* const destination, const void* const source, const uint64_t size) noexcept
+{
+#if defined(__SSE2__)
+    constexpr uint64_t VECTOR_SIZE{sizeof(__m128i)};
+    constexpr uint64_t VECTORS_PER_ITERATION{4U};
+
+    auto* dest = static_cast<uint8_t*>(destination);
+    const auto* src = static_cast<const uint8_t*>(source);
+
+    // the non-temporal stores require an aligned destination; the bytes up to the alignment are copied regularly
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto misalignment = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(dest) % VECTOR_SIZE);
+    const uint64_t head = (misalignment == 0U) ? 0U : VECTOR_SIZE - misalignment;
+    if (size < head + VECTOR_SIZE)
+    {
+        std::memcpy(destination, source, size);
+        return;
+    }
+
+    std::memcpy(dest, src, head);
+    uint64_t remaining = size - head;
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic, cppcoreguidelines-pro-type-reinterpret-cast)
+    dest += head;
+    src += head;
+
+    while (remaining >= VECTOR_SIZE * VECTORS_PER_ITERATION)
+    {
+        const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + VECTOR_SIZE));
+        const __m128i v2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 2U * VECTOR_SIZE));
+        const __m128i v3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 3U * VECTOR_SIZE));
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dest), v0);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dest + VECTOR_SIZE), v1);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dest + 2U * VECTOR_SIZE), v2);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dest + 3U * VECTOR_SIZE), v3);
+        dest += VECTOR_SIZE * VECTORS_PER_ITERATION;
+        src += VECTOR_SIZE * VECTORS_PER_ITERATION;
+        remaining -= VECTOR_SIZE * VECTORS_PER_ITERATION;
+    }
+
+    while (remaining >= VECTOR_SIZE)
+    {
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dest), _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+        dest += VECTOR_SIZE;
+        src += VECTOR_SIZE;
+        remaining -= VECTOR_SIZE;
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic, cppcoreguidelines-pro-type-reinterpret-cast)
+
+    // non-temporal stores are weakly ordered and not covered by the release semantic of a subsequent atomic store
+    _mm_sfence();
+
+    std::memcpy(dest, src, remaining);
+#else
+    std::memcpy(destination, source, size);
+#endif
+}
 } // namespace iox
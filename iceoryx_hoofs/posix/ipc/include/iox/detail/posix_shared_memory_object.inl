@@ -0,0 +1,40 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_POSIX_IPC_POSIX_SHARED_MEMORY_OBJECT_INL
+#define IOX_HOOFS_POSIX_IPC_POSIX_SHARED_MEMORY_OBJECT_INL
+
+#include "iox/posix_shared_memory_object.hpp"
+
+namespace iox
+{
+inline constexpr const char* asStringLiteral(const NumaPolicy value) noexcept
+{
+    switch (value)
+    {
+    case NumaPolicy::DEFAULT:
+        return "NumaPolicy::DEFAULT";
+    case NumaPolicy::BIND:
+        return "NumaPolicy::BIND";
+    case NumaPolicy::INTERLEAVE:
+        return "NumaPolicy::INTERLEAVE";
+    }
+
+    return "NumaPolicy::UndefinedValue";
+}
+} // namespace iox
+
+#endif // IOX_HOOFS_POSIX_IPC_POSIX_SHARED_MEMORY_OBJECT_INL
@@ -38,6 +38,7 @@ enum class PosixSharedMemoryObjectError : uint8_t
     MAPPING_SHARED_MEMORY_FAILED,
     UNABLE_TO_VERIFY_MEMORY_SIZE,
     REQUESTED_SIZE_EXCEEDS_ACTUAL_SIZE,
+    UNABLE_TO_APPLY_NUMA_PLACEMENT,
     INTERNAL_LOGIC_FAILURE,
 };
 
@@ -49,6 +50,30 @@ enum class PosixSharedMemoryAllocationError : uint8_t
 
 };
 
+/// @brief Defines how the pages of a shared memory are distributed over the NUMA nodes
+enum class NumaPolicy : uint8_t
+{
+    /// @brief the pages are placed by the kernel, usually on the NUMA node of the thread which touches them first
+    DEFAULT,
+    /// @brief all pages are placed on a single NUMA node
+    BIND,
+    /// @brief the pages are interleaved over all NUMA nodes the process is allowed to allocate memory from
+    INTERLEAVE,
+};
+
+/// @brief Converts the NumaPolicy to a string literal
+/// @param[in] value the NumaPolicy to convert
+/// @return string literal of the NumaPolicy value
+constexpr const char* asStringLiteral(const NumaPolicy value) noexcept;
+
+/// @brief Describes the placement of the pages of a shared memory on the NUMA nodes
+struct NumaPlacement
+{
+    NumaPolicy policy{NumaPolicy::DEFAULT};
+    /// @brief the NUMA node for NumaPolicy::BIND, ignored otherwise
+    uint32_t node{0U};
+};
+
 class PosixSharedMemoryObjectBuilder;
 
 /// @brief Creates a shared memory segment and maps it into the process space.
@@ -78,6 +103,10 @@ class PosixSharedMemoryObject : public FileManagementInterface<PosixSharedMemory
     ///        existing shared memory was opened.
     bool hasOwnership() const noexcept;
 
+    /// @brief Acquires the NUMA node of the first page of the shared memory
+    /// @return the NUMA node or nullopt if the platform does not support NUMA
+    optional<uint32_t> getNumaNode() const noexcept;
+
     friend class PosixSharedMemoryObjectBuilder;
 
   private:
@@ -117,9 +146,16 @@ class PosixSharedMemoryObjectBuilder
     /// @brief Defines the access permissions of the shared memory
     IOX_BUILDER_PARAMETER(access_rights, permissions, perms::none)
 
+    /// @brief Defines on which NUMA nodes the pages of the shared memory are placed. The placement is only applied
+    ///        when the shared memory is created and before it is touched the first time, i.e. it has no effect when
+    ///        an existing shared memory is opened.
+    IOX_BUILDER_PARAMETER(NumaPlacement, numaPlacement, NumaPlacement())
+
   public:
     expected<PosixSharedMemoryObject, PosixSharedMemoryObjectError> create() noexcept;
 };
 } // namespace iox
 
+#include "iox/detail/posix_shared_memory_object.inl"
+
 #endif // IOX_HOOFS_POSIX_ICP_POSIX_SHARED_MEMORY_OBJECT_HPP
@@ -17,10 +17,12 @@
 
 #include "iox/posix_shared_memory_object.hpp"
 #include "iceoryx_platform/fcntl.hpp"
+#include "iceoryx_platform/numa.hpp"
 #include "iceoryx_platform/unistd.hpp"
 #include "iox/attributes.hpp"
 #include "iox/filesystem.hpp"
 #include "iox/logging.hpp"
+#include "iox/posix_call.hpp"
 #include "iox/signal_handler.hpp"
 
 #include <bitset>
@@ -76,7 +78,9 @@ expected<PosixSharedMemoryObject, PosixSharedMemoryObjectError> PosixSharedMemor
                     << m_name << ", sizeInBytes = " << m_memorySizeInBytes
                     << ", access mode = " << asStringLiteral(m_accessMode)
                     << ", open mode = " << asStringLiteral(m_openMode) << ", baseAddressHint = " << logBaseAddressHint
-                    << ", permissions = " << iox::log::oct(m_permissions.value()) << " ]");
+                    << ", permissions = " << iox::log::oct(m_permissions.value())
+                    << ", numa policy = " << asStringLiteral(m_numaPlacement.policy)
+                    << ", numa node = " << m_numaPlacement.node << " ]");
     };
 
     auto sharedMemory = detail::PosixSharedMemoryBuilder()
@@ -132,6 +136,32 @@ expected<PosixSharedMemoryObject, PosixSharedMemoryObjectError> PosixSharedMemor
 
     if (sharedMemory->hasOwnership())
     {
+        // the placement must be applied before the first touch since pages which are already allocated are not moved
+        if (m_numaPlacement.policy != NumaPolicy::DEFAULT)
+        {
+            auto applyNumaPlacement = [&] {
+                auto* baseAddress = memoryMap->getBaseAddress();
+                const auto length = static_cast<size_t>(realSize);
+                if (m_numaPlacement.policy == NumaPolicy::BIND)
+                {
+                    return IOX_POSIX_CALL(iox_numa_bind)(baseAddress, length, m_numaPlacement.node)
+                        .failureReturnValue(-1)
+                        .evaluate();
+                }
+                return IOX_POSIX_CALL(iox_numa_interleave)(baseAddress, length).failureReturnValue(-1).evaluate();
+            };
+
+            auto result = applyNumaPlacement();
+            if (result.has_error())
+            {
+                printErrorDetails();
+                IOX_LOG(Error,
+                        "Unable to apply the NUMA placement to the shared memory since '"
+                            << result.error().getHumanReadableErrnum() << "'");
+                return err(PosixSharedMemoryObjectError::UNABLE_TO_APPLY_NUMA_PLACEMENT);
+            }
+        }
+
         IOX_LOG(Debug, "Trying to reserve " << m_memorySizeInBytes << " bytes in the shared memory [" << m_name << "]");
         if (platform::IOX_SHM_WRITE_ZEROS_ON_CREATION)
         {
@@ -203,4 +233,17 @@ bool PosixSharedMemoryObject::hasOwnership() const noexcept
 {
     return m_sharedMemory.hasOwnership();
 }
+
+optional<uint32_t> PosixSharedMemoryObject::getNumaNode() const noexcept
+{
+    uint32_t node{0U};
+    auto result = IOX_POSIX_CALL(iox_numa_node_of_address)(m_memoryMap.getBaseAddress(), &node)
+                      .failureReturnValue(-1)
+                      .evaluate();
+    if (result.has_error())
+    {
+        return nullopt;
+    }
+    return node;
+}
 } // namespace iox
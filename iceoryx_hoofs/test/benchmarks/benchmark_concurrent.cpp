@@ -0,0 +1,118 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "hoofs_benchmarks.hpp"
+
+#include "iox/detail/mpmc_lockfree_queue/mpmc_index_queue.hpp"
+#include "iox/detail/mpmc_loffli.hpp"
+#include "iox/detail/spsc_sofi.hpp"
+#include "iox/spin_lock.hpp"
+
+#include <memory>
+
+namespace iox
+{
+namespace benchmarks
+{
+namespace
+{
+constexpr uint32_t CAPACITY{1024U};
+} // namespace
+
+void benchmarkMpmcLoFFLi(testing::Benchmark& benchmark, const ThreadCounts& threadCounts) noexcept
+{
+    for (const auto numberOfThreads : threadCounts)
+    {
+        concurrent::MpmcLoFFLi loffli;
+        std::vector<concurrent::MpmcLoFFLi::Index_t> memory(
+            concurrent::MpmcLoFFLi::requiredIndexMemorySize(CAPACITY) / sizeof(concurrent::MpmcLoFFLi::Index_t));
+        loffli.init(memory.data(), CAPACITY);
+
+        runBenchmark(benchmark, "MpmcLoFFLi::pop+push", numberOfThreads, [&](const uint32_t) -> uint64_t {
+            concurrent::MpmcLoFFLi::Index_t index{0U};
+            if (!loffli.pop(index))
+            {
+                return 0U;
+            }
+            loffli.push(index);
+            return 1U;
+        });
+    }
+}
+
+void benchmarkMpmcIndexQueue(testing::Benchmark& benchmark, const ThreadCounts& threadCounts) noexcept
+{
+    using IndexQueue = concurrent::MpmcIndexQueue<CAPACITY>;
+    for (const auto numberOfThreads : threadCounts)
+    {
+        auto queue = std::make_unique<IndexQueue>(IndexQueue::ConstructFull);
+
+        runBenchmark(benchmark, "MpmcIndexQueue::pop+push", numberOfThreads, [&](const uint32_t) -> uint64_t {
+            auto index = queue->pop();
+            if (!index.has_value())
+            {
+                return 0U;
+            }
+            queue->push(index.value());
+            return 1U;
+        });
+    }
+}
+
+void benchmarkSpscSofi(testing::Benchmark& benchmark) noexcept
+{
+    using Sofi = concurrent::SpscSofi<uint64_t, CAPACITY>;
+    auto sofi = std::make_unique<Sofi>();
+
+    // the first thread is the producer, the second one the consumer
+    constexpr uint32_t NUMBER_OF_THREADS{2U};
+    runBenchmark(benchmark, "SpscSofi::push/pop", NUMBER_OF_THREADS, [&](const uint32_t threadIndex) -> uint64_t {
+        uint64_t value{threadIndex};
+        if (threadIndex == 0U)
+        {
+            uint64_t overflowValue{0U};
+            static_cast<void>(sofi->push(value, overflowValue));
+            return 1U;
+        }
+        return sofi->pop(value) ? 1U : 0U;
+    });
+}
+
+void benchmarkSpinLock(testing::Benchmark& benchmark, const ThreadCounts& threadCounts) noexcept
+{
+    for (const auto numberOfThreads : threadCounts)
+    {
+        optional<concurrent::SpinLock> spinLock;
+        concurrent::SpinLockBuilder()
+            .is_inter_process_capable(true)
+            .lock_behavior(LockBehavior::NORMAL)
+            .create(spinLock)
+            .expect("Failed to create the SpinLock");
+        uint64_t counter{0U};
+
+        runBenchmark(benchmark, "SpinLock::lock+unlock", numberOfThreads, [&](const uint32_t) -> uint64_t {
+            spinLock->lock().expect("Failed to lock the SpinLock");
+            ++counter;
+            spinLock->unlock().expect("Failed to unlock the SpinLock");
+            return 1U;
+        });
+        testing::Benchmark::doNotOptimize(counter);
+    }
+}
+
+} // namespace benchmarks
+} // namespace iox
@@ -0,0 +1,95 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "hoofs_benchmarks.hpp"
+
+#include "iox/memory.hpp"
+#include "iox/relative_pointer.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+namespace iox
+{
+namespace benchmarks
+{
+void benchmarkRelativePointer(testing::Benchmark& benchmark, const ThreadCounts& threadCounts) noexcept
+{
+    constexpr uint64_t SEGMENT_SIZE{4096U};
+    constexpr uint64_t OFFSET{128U};
+    alignas(8) static uint8_t segment[SEGMENT_SIZE];
+
+    if (!UntypedRelativePointer::registerPtrWithId(segment_id_t{1U}, &segment[0], SEGMENT_SIZE))
+    {
+        std::cout << "Failed to register the segment for the RelativePointer benchmarks" << std::endl;
+        return;
+    }
+    void* const rawPointer = &segment[OFFSET];
+    const UntypedRelativePointer relativePointer(rawPointer, segment_id_t{1U});
+
+    for (const auto numberOfThreads : threadCounts)
+    {
+        runBenchmark(benchmark, "RelativePointer::get", numberOfThreads, [&](const uint32_t) -> uint64_t {
+            testing::Benchmark::doNotOptimize(relativePointer.get());
+            return 1U;
+        });
+    }
+
+    for (const auto numberOfThreads : threadCounts)
+    {
+        // the construction from a raw pointer searches the segment which contains the pointer
+        runBenchmark(benchmark, "RelativePointer::fromRawPointer", numberOfThreads, [&](const uint32_t) -> uint64_t {
+            const UntypedRelativePointer pointer(rawPointer);
+            testing::Benchmark::doNotOptimize(pointer.getOffset());
+            return 1U;
+        });
+    }
+
+    UntypedRelativePointer::unregisterPtr(segment_id_t{1U});
+}
+
+void benchmarkStreamingCopy(testing::Benchmark& benchmark) noexcept
+{
+    constexpr uint64_t KIBIBYTE{1024U};
+    constexpr uint64_t MIN_SIZE{KIBIBYTE};
+    constexpr uint64_t MAX_SIZE{16U * KIBIBYTE * KIBIBYTE};
+    constexpr uint64_t SIZE_FACTOR{4U};
+
+    std::vector<uint8_t> source(MAX_SIZE, 1U);
+    std::vector<uint8_t> destination(MAX_SIZE, 0U);
+
+    for (uint64_t size = MIN_SIZE; size <= MAX_SIZE; size *= SIZE_FACTOR)
+    {
+        const std::string sizeName = std::to_string(size / KIBIBYTE) + "KiB";
+
+        runBenchmark(benchmark, "memcpy/" + sizeName, 1U, [&](const uint32_t) -> uint64_t {
+            std::memcpy(destination.data(), source.data(), size);
+            testing::Benchmark::doNotOptimize(destination.data());
+            return 1U;
+        });
+
+        runBenchmark(benchmark, "streamingCopy/" + sizeName, 1U, [&](const uint32_t) -> uint64_t {
+            streamingCopy(destination.data(), source.data(), size);
+            testing::Benchmark::doNotOptimize(destination.data());
+            return 1U;
+        });
+    }
+}
+
+} // namespace benchmarks
+} // namespace iox
@@ -0,0 +1,72 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "hoofs_benchmarks.hpp"
+
+#include "iox/unnamed_semaphore.hpp"
+
+namespace iox
+{
+namespace benchmarks
+{
+void benchmarkUnnamedSemaphore(testing::Benchmark& benchmark, const ThreadCounts& threadCounts) noexcept
+{
+    for (const auto numberOfThreads : threadCounts)
+    {
+        optional<UnnamedSemaphore> semaphore;
+        UnnamedSemaphoreBuilder()
+            .initialValue(0U)
+            .isInterProcessCapable(true)
+            .create(semaphore)
+            .expect("Failed to create the semaphore");
+
+        // 'tryWait' instead of 'wait' since another thread could take the token and all threads must be able to
+        // terminate when the benchmark is finished
+        runBenchmark(benchmark, "UnnamedSemaphore::post+tryWait", numberOfThreads, [&](const uint32_t) -> uint64_t {
+            semaphore->post().expect("Failed to post the semaphore");
+            return semaphore->tryWait().expect("Failed to wait on the semaphore") ? 1U : 0U;
+        });
+    }
+
+    // the wake-up latency of a thread which is blocked in 'timedWait'; the threads alternately post the semaphore
+    // of the other thread and wait on their own one
+    optional<UnnamedSemaphore> semaphores[2];
+    for (auto& semaphore : semaphores)
+    {
+        UnnamedSemaphoreBuilder()
+            .initialValue(0U)
+            .isInterProcessCapable(true)
+            .create(semaphore)
+            .expect("Failed to create the semaphore");
+    }
+    semaphores[0]->post().expect("Failed to post the semaphore");
+
+    constexpr uint32_t NUMBER_OF_THREADS{2U};
+    constexpr units::Duration TIMEOUT{units::Duration::fromMilliseconds(10U)};
+    runBenchmark(benchmark, "UnnamedSemaphore::ping-pong", NUMBER_OF_THREADS, [&](const uint32_t index) -> uint64_t {
+        auto waitState = semaphores[index]->timedWait(TIMEOUT).expect("Failed to wait on the semaphore");
+        if (waitState == SemaphoreWaitState::TIMEOUT)
+        {
+            return 0U;
+        }
+        semaphores[1U - index]->post().expect("Failed to post the semaphore");
+        return 1U;
+    });
+}
+
+} // namespace benchmarks
+} // namespace iox
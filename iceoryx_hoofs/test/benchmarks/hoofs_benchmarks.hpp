@@ -0,0 +1,59 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_HOOFS_BENCHMARKS_HOOFS_BENCHMARKS_HPP
+#define IOX_HOOFS_BENCHMARKS_HOOFS_BENCHMARKS_HPP
+
+#include "iceoryx_hoofs/testing/benchmark.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace iox
+{
+namespace benchmarks
+{
+/// @brief The thread counts for which the multi-threaded benchmarks are run
+using ThreadCounts = std::vector<uint32_t>;
+
+/// @brief Runs a benchmark and prints the result if it was selected by the filter
+template <typename Operation>
+void runBenchmark(testing::Benchmark& benchmark,
+                  const std::string& name,
+                  const uint32_t numberOfThreads,
+                  const Operation& operation) noexcept
+{
+    // Not using iceoryx logger due to width requirements
+    benchmark.run(name, numberOfThreads, operation).and_then([](const auto& result) {
+        testing::Benchmark::print(std::cout, result);
+    });
+}
+
+void benchmarkMpmcLoFFLi(testing::Benchmark& benchmark, const ThreadCounts& threadCounts) noexcept;
+void benchmarkMpmcIndexQueue(testing::Benchmark& benchmark, const ThreadCounts& threadCounts) noexcept;
+void benchmarkSpscSofi(testing::Benchmark& benchmark) noexcept;
+void benchmarkSpinLock(testing::Benchmark& benchmark, const ThreadCounts& threadCounts) noexcept;
+void benchmarkUnnamedSemaphore(testing::Benchmark& benchmark, const ThreadCounts& threadCounts) noexcept;
+void benchmarkRelativePointer(testing::Benchmark& benchmark, const ThreadCounts& threadCounts) noexcept;
+void benchmarkStreamingCopy(testing::Benchmark& benchmark) noexcept;
+
+} // namespace benchmarks
+} // namespace iox
+
+#endif // IOX_HOOFS_BENCHMARKS_HOOFS_BENCHMARKS_HPP
@@ -0,0 +1,138 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "hoofs_benchmarks.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+void printUsage(const char* name)
+{
+    std::cout << "Usage: " << name << " [options]\n"
+              << "  --filter <substring>      run only the benchmarks whose name contains the substring\n"
+              << "  --max-threads <n>         run the multi-threaded benchmarks with 1, 2, 4, ... up to n threads\n"
+              << "                            (default: number of CPUs)\n"
+              << "  --samples <n>             number of measured samples per benchmark (default: 20)\n"
+              << "  --warm-up <n>             number of discarded warm-up samples per benchmark (default: 2)\n"
+              << "  --sample-duration <ms>    duration of a sample in milliseconds (default: 50)\n"
+              << "  --no-pinning              do not pin the benchmark threads to CPUs\n"
+              << "  --json <file>             write the results as JSON to the file" << std::endl;
+}
+
+bool parseNumber(const char* value, uint32_t& number, const uint32_t minimum = 1U)
+{
+    char* end{nullptr};
+    const auto parsedNumber = std::strtoul(value, &end, 10);
+    if (*end != '\0' || parsedNumber < minimum || parsedNumber > UINT32_MAX)
+    {
+        return false;
+    }
+    number = static_cast<uint32_t>(parsedNumber);
+    return true;
+}
+
+iox::benchmarks::ThreadCounts threadCountsUpTo(const uint32_t maxThreads)
+{
+    iox::benchmarks::ThreadCounts threadCounts;
+    for (uint32_t numberOfThreads = 1U; numberOfThreads < maxThreads; numberOfThreads *= 2U)
+    {
+        threadCounts.push_back(numberOfThreads);
+    }
+    threadCounts.push_back(maxThreads);
+    return threadCounts;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    iox::testing::BenchmarkConfig config;
+    uint32_t maxThreads{iox::testing::Benchmark::numberOfCpus()};
+    std::string jsonFile;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const bool hasValue = (i + 1 < argc);
+        bool isValid{true};
+        if (std::strcmp(argv[i], "--no-pinning") == 0)
+        {
+            config.pinThreads = false;
+        }
+        else if (std::strcmp(argv[i], "--filter") == 0 && hasValue)
+        {
+            config.filter = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--json") == 0 && hasValue)
+        {
+            jsonFile = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--max-threads") == 0 && hasValue)
+        {
+            isValid = parseNumber(argv[++i], maxThreads);
+        }
+        else if (std::strcmp(argv[i], "--samples") == 0 && hasValue)
+        {
+            isValid = parseNumber(argv[++i], config.samples);
+        }
+        else if (std::strcmp(argv[i], "--warm-up") == 0 && hasValue)
+        {
+            isValid = parseNumber(argv[++i], config.warmUpSamples, 0U);
+        }
+        else if (std::strcmp(argv[i], "--sample-duration") == 0 && hasValue)
+        {
+            uint32_t durationInMs{0U};
+            isValid = parseNumber(argv[++i], durationInMs);
+            config.sampleDuration = std::chrono::milliseconds(durationInMs);
+        }
+        else
+        {
+            isValid = false;
+        }
+
+        if (!isValid)
+        {
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    iox::testing::Benchmark benchmark(config);
+    const auto threadCounts = threadCountsUpTo(maxThreads);
+
+    iox::benchmarks::benchmarkMpmcLoFFLi(benchmark, threadCounts);
+    iox::benchmarks::benchmarkMpmcIndexQueue(benchmark, threadCounts);
+    iox::benchmarks::benchmarkSpscSofi(benchmark);
+    iox::benchmarks::benchmarkSpinLock(benchmark, threadCounts);
+    iox::benchmarks::benchmarkUnnamedSemaphore(benchmark, threadCounts);
+    iox::benchmarks::benchmarkRelativePointer(benchmark, threadCounts);
+    iox::benchmarks::benchmarkStreamingCopy(benchmark);
+
+    if (!jsonFile.empty())
+    {
+        std::ofstream stream(jsonFile);
+        if (!stream)
+        {
+            std::cout << "Failed to open '" << jsonFile << "'" << std::endl;
+            return EXIT_FAILURE;
+        }
+        benchmark.writeJson(stream);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -19,6 +19,8 @@
 
 #include "iox/detail/mpmc_lockfree_queue/mpmc_index_queue.hpp"
 
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -306,4 +308,136 @@ TYPED_TEST(MpmcIndexQueueTest, popIfSizeIsAtLeastCapacityReturnsNothingIfQueueIs
     ASSERT_FALSE(index.has_value());
 }
 
+TYPED_TEST(MpmcIndexQueueTest, popManyReturnsNothingIfQueueIsEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "40130650-d696-4883-a594-cce98cf2a282");
+    using index_t = typename TestFixture::index_t;
+    auto& q = this->queue;
+
+    std::vector<index_t> indices(1U);
+    EXPECT_EQ(q.popMany(indices.data(), 1U), 0U);
+}
+
+TYPED_TEST(MpmcIndexQueueTest, popManyWithZeroIndicesReturnsNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "46e9ede7-bafd-4173-8657-def39ed2ba73");
+    using index_t = typename TestFixture::index_t;
+
+    std::vector<index_t> indices(1U);
+    EXPECT_EQ(this->fullQueue.popMany(indices.data(), 0U), 0U);
+    EXPECT_TRUE(this->fullQueue.popIfSizeIsAtLeast(this->fullQueue.capacity()).has_value());
+}
+
+TYPED_TEST(MpmcIndexQueueTest, popManyReturnsAllIndicesOfFullQueueInFifoOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d1644cd5-02cc-4159-99e8-49a479c48bb2");
+    using index_t = typename TestFixture::index_t;
+    auto& q = this->fullQueue;
+    const auto capacity = q.capacity();
+
+    std::vector<index_t> indices(capacity + 1U);
+    ASSERT_EQ(q.popMany(indices.data(), capacity + 1U), capacity);
+
+    for (uint64_t i = 0U; i < capacity; ++i)
+    {
+        EXPECT_EQ(indices[i], i);
+    }
+    EXPECT_TRUE(q.empty());
+}
+
+TYPED_TEST(MpmcIndexQueueTest, popManyReturnsAtMostTheRequestedNumberOfIndices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "97ecdf5b-124e-4f72-887e-b7602847919a");
+    using index_t = typename TestFixture::index_t;
+    auto& q = this->fullQueue;
+    const auto capacity = q.capacity();
+    const uint64_t numberOfIndices = (capacity + 1U) / 2U;
+
+    std::vector<index_t> indices(capacity);
+    ASSERT_EQ(q.popMany(indices.data(), numberOfIndices), numberOfIndices);
+    ASSERT_EQ(q.popMany(&indices[numberOfIndices], capacity), capacity - numberOfIndices);
+
+    for (uint64_t i = 0U; i < capacity; ++i)
+    {
+        EXPECT_EQ(indices[i], i);
+    }
+}
+
+TYPED_TEST(MpmcIndexQueueTest, pushManyInsertsInFifoOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0f655ae9-7e77-470d-865c-f3fb0cebf090");
+    using index_t = typename TestFixture::index_t;
+    auto& q = this->queue;
+    const auto capacity = q.capacity();
+
+    std::vector<index_t> indices(capacity);
+    for (uint64_t i = 0U; i < capacity; ++i)
+    {
+        indices[i] = static_cast<index_t>(capacity - 1U - i);
+    }
+    q.pushMany(indices.data(), capacity);
+
+    for (uint64_t i = 0U; i < capacity; ++i)
+    {
+        auto index = q.pop();
+        ASSERT_TRUE(index.has_value());
+        EXPECT_EQ(index.value(), capacity - 1U - i);
+    }
+    EXPECT_TRUE(q.empty());
+}
+
+TYPED_TEST(MpmcIndexQueueTest, pushManyUpdatesWritePositionSuchThatFullQueueIsDetected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a7a2fccb-ca84-48de-8aae-bb9db46d4696");
+    using index_t = typename TestFixture::index_t;
+    auto& q = this->fullQueue;
+    const auto capacity = q.capacity();
+
+    std::vector<index_t> indices(capacity);
+    ASSERT_EQ(q.popMany(indices.data(), capacity), capacity);
+    q.pushMany(indices.data(), capacity);
+
+    auto index = q.popIfFull();
+    ASSERT_TRUE(index.has_value());
+    EXPECT_EQ(index.value(), 0U);
+}
+
+TYPED_TEST(MpmcIndexQueueTest, batchAndSingleOperationsCanBeMixed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9a34cd40-26fb-4673-bf3e-9d9e88d0a968");
+    using index_t = typename TestFixture::index_t;
+    auto& q = this->fullQueue;
+    const auto capacity = q.capacity();
+
+    // rotate the queue content several times to wrap around the cycles
+    std::vector<index_t> indices(capacity);
+    for (uint64_t round = 0U; round < 3U * capacity; ++round)
+    {
+        const uint64_t numberOfIndices = 1U + round % capacity;
+        ASSERT_EQ(q.popMany(indices.data(), numberOfIndices), numberOfIndices);
+        if (round % 2U == 0U)
+        {
+            q.pushMany(indices.data(), numberOfIndices);
+        }
+        else
+        {
+            for (uint64_t i = 0U; i < numberOfIndices; ++i)
+            {
+                q.push(indices[i]);
+            }
+        }
+    }
+
+    std::vector<bool> found(capacity, false);
+    for (uint64_t i = 0U; i < capacity; ++i)
+    {
+        auto index = q.pop();
+        ASSERT_TRUE(index.has_value());
+        ASSERT_LT(index.value(), capacity);
+        EXPECT_FALSE(found[index.value()]);
+        found[index.value()] = true;
+    }
+    EXPECT_TRUE(q.empty());
+}
+
 } // namespace
@@ -21,6 +21,9 @@
 #include "iox/detail/mpmc_lockfree_queue.hpp"
 #include "iox/detail/mpmc_resizeable_lockfree_queue.hpp"
 
+#include <type_traits>
+#include <vector>
+
 // We test the common functionality of LockFreeQueue and ResizableLockFreeQueue here
 // in typed tests to reduce code duplication.
 
@@ -373,4 +376,118 @@ TYPED_TEST(MpmcLockFreeQueueTest, checkEmptynessAfterFullQueueWasEmptied)
     EXPECT_EQ(q.size(), 0);
 }
 
+TYPED_TEST(MpmcLockFreeQueueTest, popManyReturnsNothingIfQueueIsEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "97b73c36-5793-45c9-b0b5-2ea9100ce480");
+    using Element_t = typename TestFixture::Queue::element_t;
+    auto& q = this->queue;
+
+    std::vector<Element_t> values(1U);
+    EXPECT_EQ(q.popMany(values.data(), 1U), 0U);
+}
+
+TYPED_TEST(MpmcLockFreeQueueTest, popManyRemovesAllElementsOfFullQueueInFifoOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0ab01f9b-c596-40d2-8837-671f6a71b349");
+    using Element_t = typename TestFixture::Queue::element_t;
+    auto& q = this->queue;
+    auto capacity = q.capacity();
+
+    int start{42};
+    this->fillQueue(start);
+
+    // more than a single batch is requested to test the batching of large requests
+    std::vector<Element_t> values(static_cast<size_t>(capacity + 1U));
+    ASSERT_EQ(q.popMany(values.data(), capacity + 1U), capacity);
+
+    for (uint64_t i = 0U; i < capacity; ++i)
+    {
+        EXPECT_EQ(values[static_cast<size_t>(i)], start + static_cast<int>(i));
+    }
+    EXPECT_TRUE(q.empty());
+    EXPECT_EQ(q.size(), 0U);
+}
+
+TYPED_TEST(MpmcLockFreeQueueTest, popManyRemovesAtMostTheRequestedNumberOfElements)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "29de26e4-e3a3-4656-be26-3b9574917646");
+    using Element_t = typename TestFixture::Queue::element_t;
+    auto& q = this->queue;
+    auto capacity = q.capacity();
+
+    int start{13};
+    this->fillQueue(start);
+
+    std::vector<Element_t> values(1U);
+    ASSERT_EQ(q.popMany(values.data(), 1U), 1U);
+    EXPECT_EQ(values[0], start);
+    EXPECT_EQ(q.size(), capacity - 1U);
+
+    auto x = q.pop();
+    if (capacity > 1U)
+    {
+        ASSERT_TRUE(x.has_value());
+        EXPECT_EQ(x.value(), start + 1);
+    }
+}
+
+TYPED_TEST(MpmcLockFreeQueueTest, tryPushManyInsertsInFifoOrderUntilQueueIsFull)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d59109cc-89cc-4d5a-8db8-cef1d1e63ddd");
+    using Element_t = typename TestFixture::Queue::element_t;
+    if constexpr (!std::is_copy_constructible<Element_t>::value)
+    {
+        GTEST_SKIP() << "tryPushMany requires copyable elements";
+    }
+    else
+    {
+        auto& q = this->queue;
+        auto capacity = q.capacity();
+
+        std::vector<Element_t> values;
+        for (uint64_t i = 0U; i <= capacity; ++i)
+        {
+            values.emplace_back(static_cast<int>(i));
+        }
+
+        EXPECT_EQ(q.tryPushMany(values.data(), capacity + 1U), capacity);
+        EXPECT_EQ(q.size(), capacity);
+        EXPECT_EQ(q.tryPushMany(values.data(), 1U), 0U);
+
+        for (uint64_t i = 0U; i < capacity; ++i)
+        {
+            auto x = q.pop();
+            ASSERT_TRUE(x.has_value());
+            EXPECT_EQ(x.value(), static_cast<int>(i));
+        }
+        EXPECT_TRUE(q.empty());
+    }
+}
+
+TYPED_TEST(MpmcLockFreeQueueTest, tryPushManyIsFollowedByOverflowingPush)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "96354abb-2efd-406e-b5cc-395f0a2fbe50");
+    using Element_t = typename TestFixture::Queue::element_t;
+    if constexpr (!std::is_copy_constructible<Element_t>::value)
+    {
+        GTEST_SKIP() << "tryPushMany requires copyable elements";
+    }
+    else
+    {
+        auto& q = this->queue;
+        auto capacity = q.capacity();
+
+        std::vector<Element_t> values;
+        for (uint64_t i = 0U; i < capacity; ++i)
+        {
+            values.emplace_back(static_cast<int>(i));
+        }
+        ASSERT_EQ(q.tryPushMany(values.data(), capacity), capacity);
+
+        auto evicted = q.push(-1);
+        ASSERT_TRUE(evicted.has_value());
+        EXPECT_EQ(evicted.value(), 0);
+    }
+}
+
 } // namespace
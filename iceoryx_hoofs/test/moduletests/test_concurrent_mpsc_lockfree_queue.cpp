@@ -0,0 +1,206 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "test.hpp"
+
+#include "iox/detail/mpsc_lockfree_queue.hpp"
+
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+
+// use a non-POD type for testing (just a boxed version of int)
+struct Integer
+{
+    // NOLINTNEXTLINE(hicpp-explicit-conversions) required for typed tests
+    Integer(uint64_t value = 0)
+        : value(value)
+    {
+    }
+
+    uint64_t value{0};
+
+    // so that it behaves like an int for comparison purposes
+    // NOLINTNEXTLINE(hicpp-explicit-conversions) required for typed tests
+    operator uint64_t() const
+    {
+        return value;
+    }
+};
+
+template <typename T>
+class MpscLockFreeQueueTest : public ::testing::Test
+{
+  public:
+    void fillQueue(const uint64_t start = 0U)
+    {
+        const auto capacity = sut.capacity();
+        for (uint64_t i = 0U; i < capacity; ++i)
+        {
+            ASSERT_TRUE(sut.tryPush(start + i));
+        }
+    }
+
+    using Queue = T;
+    Queue sut;
+};
+
+template <uint64_t Capacity>
+using IntegerQueue = iox::concurrent::MpscLockFreeQueue<Integer, Capacity>;
+
+template <uint64_t Capacity>
+using IntQueue = iox::concurrent::MpscLockFreeQueue<uint64_t, Capacity>;
+
+typedef ::testing::Types<IntegerQueue<1>, IntegerQueue<11>, IntQueue<10>> TestQueues;
+
+TYPED_TEST_SUITE(MpscLockFreeQueueTest, TestQueues, );
+
+TYPED_TEST(MpscLockFreeQueueTest, InitialCapacityIsMaxCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e4e06b2d-d7f1-4b0f-a31a-b51375a3c5e7");
+    using Queue = typename TestFixture::Queue;
+    EXPECT_THAT(this->sut.capacity(), Eq(Queue::maxCapacity()));
+    EXPECT_TRUE(this->sut.empty());
+    EXPECT_THAT(this->sut.size(), Eq(0U));
+}
+
+TYPED_TEST(MpscLockFreeQueueTest, ConstructWithInvalidCapacityUsesMaxCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "67cdc5d0-c747-42e2-95ba-88a258dbb0cc");
+    using Queue = typename TestFixture::Queue;
+    Queue noCapacity(0U);
+    Queue tooLargeCapacity(Queue::MAX_CAPACITY + 1U);
+    EXPECT_THAT(noCapacity.capacity(), Eq(Queue::maxCapacity()));
+    EXPECT_THAT(tooLargeCapacity.capacity(), Eq(Queue::maxCapacity()));
+}
+
+TYPED_TEST(MpscLockFreeQueueTest, PopReturnsValuesInFifoOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "371fee99-85b0-4582-83bc-51ad2d0bded3");
+    constexpr uint64_t START{73U};
+    this->fillQueue(START);
+    EXPECT_THAT(this->sut.size(), Eq(this->sut.capacity()));
+    EXPECT_FALSE(this->sut.empty());
+
+    for (uint64_t i = 0U; i < this->sut.capacity(); ++i)
+    {
+        auto value = this->sut.pop();
+        ASSERT_TRUE(value.has_value());
+        EXPECT_THAT(static_cast<uint64_t>(value.value()), Eq(START + i));
+    }
+    EXPECT_FALSE(this->sut.pop().has_value());
+    EXPECT_TRUE(this->sut.empty());
+}
+
+TYPED_TEST(MpscLockFreeQueueTest, TryPushFailsWhenFull)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1872a937-168b-400b-8cb1-f3c4d31afdc8");
+    this->fillQueue();
+    EXPECT_FALSE(this->sut.tryPush(1337U));
+    EXPECT_THAT(this->sut.size(), Eq(this->sut.capacity()));
+
+    ASSERT_TRUE(this->sut.pop().has_value());
+    EXPECT_TRUE(this->sut.tryPush(1337U));
+}
+
+TYPED_TEST(MpscLockFreeQueueTest, PushWithoutOverflowReturnsNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "963edbef-a0ba-41e5-b88a-66aacac13b4e");
+    EXPECT_FALSE(this->sut.push(42U).has_value());
+    auto value = this->sut.pop();
+    ASSERT_TRUE(value.has_value());
+    EXPECT_THAT(static_cast<uint64_t>(value.value()), Eq(42U));
+}
+
+TYPED_TEST(MpscLockFreeQueueTest, PushOnFullQueueReturnsOldestValue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "005c054d-a3eb-4820-a6ee-e39268d10347");
+    constexpr uint64_t START{13U};
+    const auto capacity = this->sut.capacity();
+    this->fillQueue(START);
+
+    // overflow several rounds to wrap around the ring multiple times
+    for (uint64_t i = 0U; i < 3U * capacity; ++i)
+    {
+        auto removed = this->sut.push(START + capacity + i);
+        ASSERT_TRUE(removed.has_value());
+        EXPECT_THAT(static_cast<uint64_t>(removed.value()), Eq(START + i));
+    }
+
+    for (uint64_t i = 0U; i < capacity; ++i)
+    {
+        auto value = this->sut.pop();
+        ASSERT_TRUE(value.has_value());
+        EXPECT_THAT(static_cast<uint64_t>(value.value()), Eq(START + 3U * capacity + i));
+    }
+    EXPECT_TRUE(this->sut.empty());
+}
+
+TYPED_TEST(MpscLockFreeQueueTest, SetCapacityToInvalidValueFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7c210eb7-b646-4ed4-af96-c6bb287c8eb8");
+    using Queue = typename TestFixture::Queue;
+    EXPECT_FALSE(this->sut.setCapacity(0U));
+    EXPECT_FALSE(this->sut.setCapacity(Queue::MAX_CAPACITY + 1U));
+    EXPECT_THAT(this->sut.capacity(), Eq(Queue::maxCapacity()));
+}
+
+TYPED_TEST(MpscLockFreeQueueTest, DecreasingCapacityRemovesOldestValues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b2fdb1e1-3030-40d6-a7dd-174ac676d473");
+    const auto maxCapacity = this->sut.capacity();
+    const auto newCapacity = (maxCapacity + 1U) / 2U;
+    this->fillQueue();
+
+    std::vector<uint64_t> removedValues;
+    EXPECT_TRUE(this->sut.setCapacity(newCapacity, [&](Integer&& value) { removedValues.push_back(value); }));
+    EXPECT_THAT(this->sut.capacity(), Eq(newCapacity));
+    EXPECT_THAT(this->sut.size(), Eq(newCapacity));
+
+    ASSERT_THAT(removedValues.size(), Eq(maxCapacity - newCapacity));
+    for (uint64_t i = 0U; i < removedValues.size(); ++i)
+    {
+        EXPECT_THAT(removedValues[i], Eq(i));
+    }
+
+    // the reduced capacity is respected by push and tryPush
+    EXPECT_FALSE(this->sut.tryPush(1337U));
+    auto removed = this->sut.push(1337U);
+    ASSERT_TRUE(removed.has_value());
+    EXPECT_THAT(static_cast<uint64_t>(removed.value()), Eq(maxCapacity - newCapacity));
+}
+
+TYPED_TEST(MpscLockFreeQueueTest, IncreasingCapacityAllowsMoreValues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "28e6308e-232b-435e-b875-621c8fbe32d9");
+    const auto maxCapacity = this->sut.capacity();
+    ASSERT_TRUE(this->sut.setCapacity(1U));
+    ASSERT_TRUE(this->sut.tryPush(0U));
+    EXPECT_FALSE(this->sut.tryPush(1U));
+
+    ASSERT_TRUE(this->sut.setCapacity(maxCapacity));
+    for (uint64_t i = this->sut.size(); i < maxCapacity; ++i)
+    {
+        EXPECT_TRUE(this->sut.tryPush(i));
+    }
+    EXPECT_FALSE(this->sut.tryPush(1337U));
+    EXPECT_THAT(this->sut.size(), Eq(maxCapacity));
+}
+
+} // namespace
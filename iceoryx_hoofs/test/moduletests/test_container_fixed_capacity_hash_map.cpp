@@ -0,0 +1,370 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iox/fixed_capacity_hash_map.hpp"
+#include "iox/string.hpp"
+
+#include "iceoryx_hoofs/testing/lifetime_and_assignment_tracker.hpp"
+#include "test.hpp"
+
+#include <cstring>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::testing;
+
+/// @brief maps all keys to the same hash value to enforce collisions
+struct CollidingHasher
+{
+    uint64_t operator()(const uint64_t) const noexcept
+    {
+        return 0U;
+    }
+};
+
+class FixedCapacityHashMap_test : public Test
+{
+  public:
+    static constexpr uint64_t CAPACITY{16U};
+    using ComplexType = LifetimeAndAssignmentTracker<>;
+    using Sut = FixedCapacityHashMap<uint64_t, uint64_t, CAPACITY>;
+
+    void SetUp() override
+    {
+        ComplexType::stats.reset();
+    }
+
+    void fillSut()
+    {
+        for (uint64_t i = 0U; i < CAPACITY; ++i)
+        {
+            ASSERT_TRUE(sut.insert(i, 2U * i));
+        }
+    }
+
+    Sut sut;
+};
+
+TEST_F(FixedCapacityHashMap_test, NewlyCreatedMapIsEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9fdf1c96-cd52-4d7c-93bc-d6c70b9b906a");
+    EXPECT_TRUE(sut.empty());
+    EXPECT_FALSE(sut.full());
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_THAT(sut.capacity(), Eq(CAPACITY));
+    EXPECT_THAT(sut.begin(), Eq(sut.end()));
+}
+
+TEST_F(FixedCapacityHashMap_test, InsertedEntryCanBeFound)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5bc19add-7e46-42a0-9626-ced4a12074d6");
+    constexpr uint64_t KEY{73U};
+    constexpr uint64_t VALUE{37U};
+
+    EXPECT_TRUE(sut.insert(KEY, VALUE));
+
+    EXPECT_THAT(sut.size(), Eq(1U));
+    EXPECT_TRUE(sut.contains(KEY));
+    auto entry = sut.find(KEY);
+    ASSERT_THAT(entry, Ne(sut.end()));
+    EXPECT_THAT(entry->key(), Eq(KEY));
+    EXPECT_THAT(entry->value(), Eq(VALUE));
+}
+
+TEST_F(FixedCapacityHashMap_test, FindReturnsEndForUnknownKey)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9bb6c07a-1a94-457c-9166-91c3387153b4");
+    ASSERT_TRUE(sut.insert(1U, 2U));
+
+    EXPECT_THAT(sut.find(2U), Eq(sut.end()));
+    EXPECT_FALSE(sut.contains(2U));
+}
+
+TEST_F(FixedCapacityHashMap_test, InsertingExistingKeyFailsAndKeepsValue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1499686b-4f8a-4865-878b-546764ef30b4");
+    ASSERT_TRUE(sut.insert(1U, 2U));
+
+    EXPECT_FALSE(sut.insert(1U, 3U));
+
+    EXPECT_THAT(sut.size(), Eq(1U));
+    EXPECT_THAT(sut.find(1U)->value(), Eq(2U));
+}
+
+TEST_F(FixedCapacityHashMap_test, InsertOrAssignOverwritesExistingValue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6d4c9e65-00b6-49a3-8fef-a5526f2ef5f0");
+    ASSERT_TRUE(sut.insert(1U, 2U));
+
+    EXPECT_TRUE(sut.insertOrAssign(1U, 3U));
+    EXPECT_TRUE(sut.insertOrAssign(4U, 5U));
+
+    EXPECT_THAT(sut.size(), Eq(2U));
+    EXPECT_THAT(sut.find(1U)->value(), Eq(3U));
+    EXPECT_THAT(sut.find(4U)->value(), Eq(5U));
+}
+
+TEST_F(FixedCapacityHashMap_test, InsertingIntoFullMapFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2d8e6831-24f1-4603-ac91-806ae472ef5e");
+    fillSut();
+
+    EXPECT_TRUE(sut.full());
+    EXPECT_FALSE(sut.insert(CAPACITY, 0U));
+    EXPECT_FALSE(sut.insertOrAssign(CAPACITY, 0U));
+    EXPECT_TRUE(sut.insertOrAssign(0U, 42U));
+
+    EXPECT_THAT(sut.size(), Eq(CAPACITY));
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        EXPECT_TRUE(sut.contains(i));
+    }
+}
+
+TEST_F(FixedCapacityHashMap_test, EraseRemovesOnlyTheEntryOfTheKey)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7c9e1bb2-6380-4d00-ae55-6cb9e12e237c");
+    fillSut();
+
+    EXPECT_TRUE(sut.erase(3U));
+    EXPECT_FALSE(sut.erase(3U));
+
+    EXPECT_THAT(sut.size(), Eq(CAPACITY - 1U));
+    EXPECT_FALSE(sut.contains(3U));
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        if (i != 3U)
+        {
+            ASSERT_TRUE(sut.contains(i));
+            EXPECT_THAT(sut.find(i)->value(), Eq(2U * i));
+        }
+    }
+}
+
+TEST_F(FixedCapacityHashMap_test, ClearRemovesAllEntries)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "93e647c4-e633-4bcb-bf53-665c77b5ea4f");
+    fillSut();
+
+    sut.clear();
+
+    EXPECT_TRUE(sut.empty());
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        EXPECT_FALSE(sut.contains(i));
+    }
+    EXPECT_TRUE(sut.insert(1U, 1U));
+}
+
+TEST_F(FixedCapacityHashMap_test, IterationIsInInsertionOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "791b9838-6cad-4f06-bcf7-39ef9279e419");
+    const std::vector<uint64_t> keys{13U, 7U, 1001U, 42U, 0U, 3U};
+    for (const auto key : keys)
+    {
+        ASSERT_TRUE(sut.insert(key, key + 1U));
+    }
+
+    std::vector<uint64_t> iteratedKeys;
+    for (const auto& entry : sut)
+    {
+        iteratedKeys.emplace_back(entry.key());
+        EXPECT_THAT(entry.value(), Eq(entry.key() + 1U));
+    }
+
+    EXPECT_THAT(iteratedKeys, ContainerEq(keys));
+}
+
+TEST_F(FixedCapacityHashMap_test, EraseMovesLastEntryToErasedPosition)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c03c2c42-5c4b-4bd9-a5cc-1558f99f679e");
+    for (const uint64_t key : {1U, 2U, 3U, 4U})
+    {
+        ASSERT_TRUE(sut.insert(key, key));
+    }
+
+    ASSERT_TRUE(sut.erase(2U));
+
+    std::vector<uint64_t> iteratedKeys;
+    for (const auto& entry : sut)
+    {
+        iteratedKeys.emplace_back(entry.key());
+    }
+    EXPECT_THAT(iteratedKeys, ContainerEq(std::vector<uint64_t>{1U, 4U, 3U}));
+}
+
+TEST_F(FixedCapacityHashMap_test, CollidingKeysCanBeInsertedFoundAndErased)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fbe9aa1b-8926-42f3-b89b-ccf2f2b19a22");
+    FixedCapacityHashMap<uint64_t, uint64_t, CAPACITY, CollidingHasher> collidingSut;
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        ASSERT_TRUE(collidingSut.insert(i, i));
+    }
+
+    for (uint64_t i = 0U; i < CAPACITY; i += 2U)
+    {
+        EXPECT_TRUE(collidingSut.erase(i));
+    }
+
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        EXPECT_THAT(collidingSut.contains(i), Eq(i % 2U == 1U));
+    }
+}
+
+TEST_F(FixedCapacityHashMap_test, RandomOperationsBehaveLikeStdMap)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5a3cf65d-0e99-4201-901f-3a42efed3076");
+    constexpr uint64_t NUMBER_OF_OPERATIONS{20000U};
+    constexpr uint64_t KEY_RANGE{2U * CAPACITY};
+    std::mt19937_64 generator{1U};
+    std::map<uint64_t, uint64_t> reference;
+
+    for (uint64_t i = 0U; i < NUMBER_OF_OPERATIONS; ++i)
+    {
+        const uint64_t key{generator() % KEY_RANGE};
+        switch (generator() % 3U)
+        {
+        case 0U:
+        {
+            const bool isInserted = reference.size() < CAPACITY && reference.emplace(key, i).second;
+            ASSERT_THAT(sut.insert(key, i), Eq(isInserted));
+            break;
+        }
+        case 1U:
+            ASSERT_THAT(sut.erase(key), Eq(reference.erase(key) == 1U));
+            break;
+        default:
+        {
+            auto expected = reference.find(key);
+            auto entry = sut.find(key);
+            ASSERT_THAT(entry == sut.end(), Eq(expected == reference.end()));
+            if (entry != sut.end())
+            {
+                EXPECT_THAT(entry->value(), Eq(expected->second));
+            }
+            break;
+        }
+        }
+        ASSERT_THAT(sut.size(), Eq(reference.size()));
+    }
+}
+
+TEST_F(FixedCapacityHashMap_test, StringKeysAreSupported)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7c8ee9f5-62fb-49e4-82e7-ed3161f16107");
+    FixedCapacityHashMap<string<16>, uint64_t, 4U> stringSut;
+
+    EXPECT_TRUE(stringSut.insert("radar", 1U));
+    EXPECT_TRUE(stringSut.insert("lidar", 2U));
+
+    EXPECT_THAT(stringSut.find("radar")->value(), Eq(1U));
+    EXPECT_THAT(stringSut.find("lidar")->value(), Eq(2U));
+    EXPECT_FALSE(stringSut.contains("camera"));
+}
+
+TEST_F(FixedCapacityHashMap_test, EmplaceConstructsValueInPlace)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f50935f0-3498-42e5-aba4-9af594cdba26");
+    FixedCapacityHashMap<uint64_t, ComplexType, CAPACITY> complexSut;
+
+    EXPECT_TRUE(complexSut.emplace(1U, 42U));
+
+    EXPECT_THAT(ComplexType::stats.customCTor, Eq(1U));
+    EXPECT_THAT(ComplexType::stats.copyCTor, Eq(0U));
+    EXPECT_THAT(ComplexType::stats.moveCTor, Eq(0U));
+    EXPECT_THAT(complexSut.find(1U)->value().value, Eq(42U));
+}
+
+TEST_F(FixedCapacityHashMap_test, ValuesAreDestroyedOnEraseAndDestruction)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a2fd2778-4f33-42fe-8b55-9f25975469c3");
+    {
+        FixedCapacityHashMap<uint64_t, ComplexType, CAPACITY> complexSut;
+        ASSERT_TRUE(complexSut.emplace(1U, 1U));
+        ASSERT_TRUE(complexSut.emplace(2U, 2U));
+        ASSERT_TRUE(complexSut.emplace(3U, 3U));
+
+        ASSERT_TRUE(complexSut.erase(1U));
+        EXPECT_THAT(ComplexType::stats.dTor, Eq(1U));
+        EXPECT_THAT(ComplexType::stats.moveAssignment, Eq(1U));
+    }
+    EXPECT_THAT(ComplexType::stats.dTor, Eq(3U));
+}
+
+TEST_F(FixedCapacityHashMap_test, CopiedMapContainsSameEntries)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1887c517-674e-430e-a9ff-d965a06a34fa");
+    fillSut();
+    ASSERT_TRUE(sut.erase(5U));
+
+    Sut copy{sut};
+    ASSERT_TRUE(sut.erase(6U));
+
+    EXPECT_THAT(copy.size(), Eq(CAPACITY - 1U));
+    EXPECT_FALSE(copy.contains(5U));
+    EXPECT_TRUE(copy.contains(6U));
+    EXPECT_TRUE(copy.insert(5U, 0U));
+}
+
+TEST_F(FixedCapacityHashMap_test, MapIsUsableAfterRelocationWithMemcpy)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "51bf7ced-c58b-489e-b46e-d137446431a1");
+    fillSut();
+    ASSERT_TRUE(sut.erase(5U));
+
+    alignas(Sut) uint8_t relocatedMemory[sizeof(Sut)];
+    std::memcpy(&relocatedMemory[0], &sut, sizeof(Sut));
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) emulates a shared memory mapped to another address
+    auto& relocated = *reinterpret_cast<Sut*>(&relocatedMemory[0]);
+
+    EXPECT_THAT(relocated.size(), Eq(CAPACITY - 1U));
+    EXPECT_FALSE(relocated.contains(5U));
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        if (i != 5U)
+        {
+            ASSERT_TRUE(relocated.contains(i));
+            EXPECT_THAT(relocated.find(i)->value(), Eq(2U * i));
+        }
+    }
+    EXPECT_TRUE(relocated.insert(5U, 0U));
+}
+
+TEST(Hash_test, HashOfStringDependsOnlyOnContent)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3b5a02bb-1a8a-4f6f-a239-02363d86cccf");
+    const string<8> shortString{"iceoryx"};
+    const string<100> longString{"iceoryx"};
+
+    EXPECT_THAT(Hash<string<8>>()(shortString), Eq(Hash<string<100>>()(longString)));
+    EXPECT_THAT(Hash<string<8>>()(shortString), Ne(Hash<string<8>>()(string<8>{"iceoryy"})));
+}
+
+TEST(Hash_test, ConsecutiveIntegersHaveDifferentHashes)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1639514d-f68e-4e82-84f4-851dd34700a1");
+    EXPECT_THAT(Hash<uint64_t>()(1U), Ne(Hash<uint64_t>()(2U)));
+    EXPECT_THAT(Hash<uint32_t>()(1U), Eq(Hash<uint64_t>()(1U)));
+}
+} // namespace
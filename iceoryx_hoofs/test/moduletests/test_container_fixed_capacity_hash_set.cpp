@@ -0,0 +1,105 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iox/fixed_capacity_hash_set.hpp"
+#include "iox/string.hpp"
+
+#include "test.hpp"
+
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+
+class FixedCapacityHashSet_test : public Test
+{
+  public:
+    static constexpr uint64_t CAPACITY{8U};
+    FixedCapacityHashSet<string<16>, CAPACITY> sut;
+};
+
+TEST_F(FixedCapacityHashSet_test, NewlyCreatedSetIsEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "095e3954-842e-43b7-ab77-eef9fad00105");
+    EXPECT_TRUE(sut.empty());
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_THAT(sut.capacity(), Eq(CAPACITY));
+    EXPECT_TRUE(sut.begin() == sut.end());
+}
+
+TEST_F(FixedCapacityHashSet_test, InsertedKeyIsContainedOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "196deeba-c9bb-4efa-a892-b5b7b4dfef11");
+    EXPECT_TRUE(sut.insert("fuu"));
+    EXPECT_FALSE(sut.insert("fuu"));
+
+    EXPECT_THAT(sut.size(), Eq(1U));
+    EXPECT_TRUE(sut.contains("fuu"));
+    EXPECT_FALSE(sut.contains("bar"));
+    ASSERT_TRUE(sut.find("fuu") != sut.end());
+    EXPECT_THAT(*sut.find("fuu"), Eq(string<16>("fuu")));
+}
+
+TEST_F(FixedCapacityHashSet_test, InsertingIntoFullSetFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "250dea17-9a59-48c5-9da7-861bcd9ee23d");
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        ASSERT_TRUE(sut.insert(string<16>(TruncateToCapacity, std::to_string(i).c_str())));
+    }
+
+    EXPECT_TRUE(sut.full());
+    EXPECT_FALSE(sut.insert("overflow"));
+}
+
+TEST_F(FixedCapacityHashSet_test, EraseAndClearRemoveKeys)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b127e6ed-24ef-4299-bdab-95661a707976");
+    ASSERT_TRUE(sut.insert("a"));
+    ASSERT_TRUE(sut.insert("b"));
+    ASSERT_TRUE(sut.insert("c"));
+
+    EXPECT_TRUE(sut.erase("a"));
+    EXPECT_FALSE(sut.erase("a"));
+    EXPECT_FALSE(sut.contains("a"));
+    EXPECT_THAT(sut.size(), Eq(2U));
+
+    sut.clear();
+    EXPECT_TRUE(sut.empty());
+    EXPECT_FALSE(sut.contains("b"));
+}
+
+TEST_F(FixedCapacityHashSet_test, IterationIsInInsertionOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "92a79518-a43b-4ce7-9da0-239aa8e4cef4");
+    const std::vector<std::string> keys{"x", "a", "m", "b"};
+    for (const auto& key : keys)
+    {
+        ASSERT_TRUE(sut.insert(string<16>(TruncateToCapacity, key.c_str())));
+    }
+
+    std::vector<std::string> iteratedKeys;
+    for (const auto& key : sut)
+    {
+        iteratedKeys.emplace_back(key.c_str());
+    }
+
+    EXPECT_THAT(iteratedKeys, ContainerEq(keys));
+}
+} // namespace
@@ -21,6 +21,7 @@
 #include <gtest/gtest.h>
 
 #include <cstdint>
+#include <vector>
 
 namespace
 {
@@ -85,4 +86,34 @@ TEST(memory_test, MaxAlignmentWorksAsExpected)
     EXPECT_THAT(alignof(FooBar), Eq(alignof(FuBar)));
     EXPECT_THAT((iox::maxAlignment<FooBar, FuBar>()), Eq(alignof(FooBar)));
 }
+
+TEST(memory_test, StreamingCopyCopiesAllSizesAndAlignments)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c0b08daf-d703-49d1-8ef5-456bc0a53b23");
+    constexpr uint64_t MAX_SIZE{300U};
+    constexpr uint64_t MAX_OFFSET{16U};
+    constexpr uint8_t UNTOUCHED{0xAAU};
+
+    std::vector<uint8_t> source(MAX_SIZE + MAX_OFFSET);
+    for (uint64_t i = 0U; i < source.size(); ++i)
+    {
+        source[i] = static_cast<uint8_t>(i % 251U);
+    }
+
+    for (uint64_t offset = 0U; offset < MAX_OFFSET; ++offset)
+    {
+        for (uint64_t size = 0U; size <= MAX_SIZE; ++size)
+        {
+            std::vector<uint8_t> destination(MAX_SIZE + 2U * MAX_OFFSET, UNTOUCHED);
+            iox::streamingCopy(&destination[offset], &source[MAX_OFFSET - offset], size);
+
+            for (uint64_t i = 0U; i < destination.size(); ++i)
+            {
+                const bool isCopied = (i >= offset) && (i < offset + size);
+                const uint8_t expected = isCopied ? source[MAX_OFFSET - offset + i - offset] : UNTOUCHED;
+                ASSERT_THAT(destination[i], Eq(expected)) << "offset " << offset << ", size " << size;
+            }
+        }
+    }
+}
 } // namespace
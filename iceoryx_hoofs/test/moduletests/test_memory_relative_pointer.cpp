@@ -20,6 +20,9 @@
 
 #include <cstdint>
 #include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace
 {
@@ -485,6 +488,76 @@ TYPED_TEST(RelativePointer_test, DefaultConstructedRelativePtrIsNull)
     EXPECT_FALSE(rp2);
 }
 
+TYPED_TEST(RelativePointer_test, UnknownSegmentHandlerRegistersSegmentOnDemand)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8841d1d5-dfd7-4586-a8c6-38b435c3956b");
+    constexpr uint64_t OFFSET{13U};
+    static void* onDemandMemory{nullptr};
+    static uint64_t numberOfHandlerCalls{0U};
+    onDemandMemory = this->partitionPtr(1U);
+    numberOfHandlerCalls = 0U;
+
+    RelativePointer<TypeParam>::setUnknownSegmentHandler([](const segment_id_underlying_t id) {
+        ++numberOfHandlerCalls;
+        UntypedRelativePointer::registerPtrWithId(segment_id_t{id}, onDemandMemory, SHARED_MEMORY_SIZE);
+    });
+
+    RelativePointer<TypeParam> sut(OFFSET, segment_id_t{7U});
+    EXPECT_EQ(sut.get(), reinterpret_cast<TypeParam*>(this->partitionPtr(1U) + OFFSET));
+    EXPECT_EQ(sut.get(), reinterpret_cast<TypeParam*>(this->partitionPtr(1U) + OFFSET));
+    EXPECT_EQ(numberOfHandlerCalls, 1U);
+
+    RelativePointer<TypeParam>::setUnknownSegmentHandler(nullptr);
+}
+
+TYPED_TEST(RelativePointer_test, ConcurrentlyResolvedUnknownSegmentIsRegisteredOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1c2c722f-2e2a-42d7-a2ef-841146878eeb");
+    constexpr uint64_t OFFSET{29U};
+    constexpr uint32_t NUMBER_OF_THREADS{4U};
+    static void* onDemandMemory{nullptr};
+    static uint64_t numberOfRegistrations{0U};
+    static std::mutex handlerMutex;
+    onDemandMemory = this->partitionPtr(1U);
+    numberOfRegistrations = 0U;
+
+    RelativePointer<TypeParam>::setUnknownSegmentHandler([](const segment_id_underlying_t id) {
+        std::lock_guard<std::mutex> lock(handlerMutex);
+        if (UntypedRelativePointer::registerPtrWithId(segment_id_t{id}, onDemandMemory, SHARED_MEMORY_SIZE))
+        {
+            ++numberOfRegistrations;
+        }
+    });
+
+    std::vector<TypeParam*> resolvedPointers(NUMBER_OF_THREADS, nullptr);
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0U; i < NUMBER_OF_THREADS; ++i)
+    {
+        threads.emplace_back([&resolvedPointers, i] {
+            RelativePointer<TypeParam> sut(OFFSET, segment_id_t{11U});
+            resolvedPointers[i] = sut.get();
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (auto* resolvedPointer : resolvedPointers)
+    {
+        EXPECT_EQ(resolvedPointer, reinterpret_cast<TypeParam*>(this->partitionPtr(1U) + OFFSET));
+    }
+    EXPECT_EQ(numberOfRegistrations, 1U);
+
+    RelativePointer<TypeParam>::setUnknownSegmentHandler(nullptr);
+}
+
+TYPED_TEST(RelativePointer_test, UnregisteredSegmentResolvesToNullBaseWithoutUnknownSegmentHandler)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2d2ffb84-6ad4-4a4f-bf91-c0ec8c16ce7c");
+    EXPECT_EQ(RelativePointer<TypeParam>::getBasePtr(segment_id_t{7U}), nullptr);
+}
+
 // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic, cppcoreguidelines-pro-type-reinterpret-cast)
 
 } // namespace
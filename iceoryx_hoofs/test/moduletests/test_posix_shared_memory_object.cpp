@@ -237,4 +237,94 @@ TEST_F(SharedMemoryObject_Test, SettingPermissionsWorks)
 #endif
 
 
+#if defined(__linux__)
+TEST_F(SharedMemoryObject_Test, BindingToNumaNodePlacesSharedMemoryOnThisNode)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dd163839-7f34-4e95-b26b-e4733fcd7a2e");
+    // the node of the first page is used since it works on single node machines as well as on multi node machines
+    auto defaultPlacement = PosixSharedMemoryObjectBuilder()
+                                .name("shmNuma")
+                                .memorySizeInBytes(8)
+                                .accessMode(iox::AccessMode::ReadWrite)
+                                .openMode(iox::OpenMode::PurgeAndCreate)
+                                .create();
+    ASSERT_FALSE(defaultPlacement.has_error());
+    auto node = defaultPlacement->getNumaNode();
+    if (!node.has_value())
+    {
+        GTEST_SKIP() << "The kernel was built without NUMA support";
+    }
+
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmNumaBind")
+                   .memorySizeInBytes(8192)
+                   .accessMode(iox::AccessMode::ReadWrite)
+                   .openMode(iox::OpenMode::PurgeAndCreate)
+                   .numaPlacement({NumaPolicy::BIND, *node})
+                   .create();
+
+    ASSERT_FALSE(sut.has_error());
+    EXPECT_THAT(sut->getNumaNode(), Eq(node));
+}
+
+TEST_F(SharedMemoryObject_Test, InterleavingSharedMemoryOverNumaNodesWorks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "526c9df5-b1f9-4d0a-b59a-5416ea0af95e");
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmNumaInterleave")
+                   .memorySizeInBytes(8192)
+                   .accessMode(iox::AccessMode::ReadWrite)
+                   .openMode(iox::OpenMode::PurgeAndCreate)
+                   .numaPlacement({NumaPolicy::INTERLEAVE, 0U})
+                   .create();
+
+    if (sut.has_error())
+    {
+        EXPECT_THAT(sut.error(), Eq(PosixSharedMemoryObjectError::UNABLE_TO_APPLY_NUMA_PLACEMENT));
+        GTEST_SKIP() << "The kernel was built without NUMA support";
+    }
+    EXPECT_TRUE(sut->getNumaNode().has_value());
+}
+
+TEST_F(SharedMemoryObject_Test, BindingToNotExistingNumaNodeFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e02bc75f-b467-4a66-b6b8-97bc748d25b4");
+    constexpr uint32_t NOT_EXISTING_NODE{1023U};
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmNumaBind")
+                   .memorySizeInBytes(8192)
+                   .accessMode(iox::AccessMode::ReadWrite)
+                   .openMode(iox::OpenMode::PurgeAndCreate)
+                   .numaPlacement({NumaPolicy::BIND, NOT_EXISTING_NODE})
+                   .create();
+
+    ASSERT_TRUE(sut.has_error());
+    EXPECT_THAT(sut.error(), Eq(PosixSharedMemoryObjectError::UNABLE_TO_APPLY_NUMA_PLACEMENT));
+}
+
+TEST_F(SharedMemoryObject_Test, NumaPlacementIsIgnoredWhenOpeningExistingSharedMemory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "77e99d28-506c-4076-83b8-afafc60d0be4");
+    constexpr uint32_t NOT_EXISTING_NODE{1023U};
+    auto existing = PosixSharedMemoryObjectBuilder()
+                        .name("shmNumaOpen")
+                        .memorySizeInBytes(8192)
+                        .accessMode(iox::AccessMode::ReadWrite)
+                        .openMode(iox::OpenMode::PurgeAndCreate)
+                        .create();
+    ASSERT_FALSE(existing.has_error());
+
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmNumaOpen")
+                   .memorySizeInBytes(8192)
+                   .accessMode(iox::AccessMode::ReadWrite)
+                   .openMode(iox::OpenMode::OpenExisting)
+                   .numaPlacement({NumaPolicy::BIND, NOT_EXISTING_NODE})
+                   .create();
+
+    EXPECT_FALSE(sut.has_error());
+}
+#endif
+
+
 } // namespace
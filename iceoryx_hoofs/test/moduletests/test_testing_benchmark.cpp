@@ -0,0 +1,128 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_hoofs/testing/benchmark.hpp"
+#include "iox/atomic.hpp"
+#include "test.hpp"
+
+#include <sstream>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::testing;
+
+class Benchmark_test : public Test
+{
+  public:
+    static BenchmarkConfig shortConfig()
+    {
+        BenchmarkConfig config;
+        config.warmUpSamples = 1U;
+        config.samples = 5U;
+        config.sampleDuration = std::chrono::milliseconds(2);
+        config.pinThreads = false;
+        return config;
+    }
+
+    iox::concurrent::Atomic<uint64_t> m_counter{0U};
+};
+
+TEST_F(Benchmark_test, RunCountsTheOperationsOfAllThreads)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "aea12935-e49d-4e8b-9e15-bc0cae45ca8f");
+    constexpr uint32_t NUMBER_OF_THREADS{3U};
+    Benchmark sut(shortConfig());
+
+    auto result = sut.run("counter", NUMBER_OF_THREADS, [&](const uint32_t threadIndex) -> uint64_t {
+        EXPECT_THAT(threadIndex, Lt(NUMBER_OF_THREADS));
+        m_counter.fetch_add(1U, std::memory_order_relaxed);
+        return 1U;
+    });
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_THAT(result->name, Eq("counter"));
+    EXPECT_THAT(result->numberOfThreads, Eq(NUMBER_OF_THREADS));
+    EXPECT_THAT(result->numberOfSamples, Eq(5U));
+    EXPECT_THAT(result->numberOfOperations, Gt(0U));
+    // the warm-up samples are not counted
+    EXPECT_THAT(result->numberOfOperations, Le(m_counter.load()));
+    EXPECT_THAT(result->operationsPerSecond, Gt(0.0));
+    EXPECT_FALSE(result->isPinned);
+    EXPECT_THAT(sut.results().size(), Eq(1U));
+}
+
+TEST_F(Benchmark_test, PercentilesAreOrdered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "155dbefc-ef1b-49c0-aafc-0c06f6777f62");
+    Benchmark sut(shortConfig());
+
+    auto result = sut.run("counter", 1U, [&](const uint32_t) -> uint64_t {
+        m_counter.fetch_add(1U, std::memory_order_relaxed);
+        return 1U;
+    });
+
+    ASSERT_TRUE(result.has_value());
+    const auto& statistics = result->nanosecondsPerOperation;
+    EXPECT_THAT(statistics.min, Gt(0.0));
+    EXPECT_THAT(statistics.min, Le(statistics.p50));
+    EXPECT_THAT(statistics.p50, Le(statistics.p90));
+    EXPECT_THAT(statistics.p90, Le(statistics.p99));
+    EXPECT_THAT(statistics.p99, Le(statistics.max));
+    EXPECT_THAT(statistics.mean, Ge(statistics.min));
+    EXPECT_THAT(statistics.mean, Le(statistics.max));
+}
+
+TEST_F(Benchmark_test, BenchmarkWhichDoesNotMatchTheFilterIsNotRun)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "aa20912f-dc80-4159-9eee-0c40c5313775");
+    auto config = shortConfig();
+    config.filter = "Queue";
+    Benchmark sut(config);
+
+    auto skippedResult = sut.run("SpinLock::lock", 1U, [&](const uint32_t) -> uint64_t {
+        m_counter.fetch_add(1U, std::memory_order_relaxed);
+        return 1U;
+    });
+    auto result = sut.run("MpmcIndexQueue::pop", 1U, [&](const uint32_t) -> uint64_t { return 1U; });
+
+    EXPECT_FALSE(skippedResult.has_value());
+    EXPECT_THAT(m_counter.load(), Eq(0U));
+    EXPECT_TRUE(result.has_value());
+    ASSERT_THAT(sut.results().size(), Eq(1U));
+    EXPECT_THAT(sut.results()[0].name, Eq("MpmcIndexQueue::pop"));
+}
+
+TEST_F(Benchmark_test, WriteJsonContainsAllResults)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8c66e7fc-7578-4c90-b699-10b803ce8441");
+    Benchmark sut(shortConfig());
+    sut.run("first \"benchmark\"", 1U, [&](const uint32_t) -> uint64_t { return 1U; });
+    sut.run("second", 2U, [&](const uint32_t) -> uint64_t { return 1U; });
+
+    std::stringstream stream;
+    sut.writeJson(stream);
+    const auto json = stream.str();
+
+    EXPECT_THAT(json, HasSubstr("\"benchmarks\": ["));
+    EXPECT_THAT(json, HasSubstr("\"name\": \"first \\\"benchmark\\\"\""));
+    EXPECT_THAT(json, HasSubstr("\"name\": \"second\""));
+    EXPECT_THAT(json, HasSubstr("\"threads\": 2"));
+    EXPECT_THAT(json, HasSubstr("\"p99\": "));
+}
+
+} // namespace
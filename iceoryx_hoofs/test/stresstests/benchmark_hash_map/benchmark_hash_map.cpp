@@ -0,0 +1,154 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iox/fixed_capacity_hash_map.hpp"
+#include "iox/string.hpp"
+#include "iox/vector.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+
+namespace
+{
+constexpr uint64_t NUMBER_OF_LOOKUPS{1000000U};
+
+using String_t = iox::string<100>;
+
+template <typename Key>
+Key createKey(const uint64_t index);
+
+template <>
+uint64_t createKey<uint64_t>(const uint64_t index)
+{
+    return index * 7919U;
+}
+
+template <>
+String_t createKey<String_t>(const uint64_t index)
+{
+    // a common prefix as in service descriptions makes the string comparison of the linear search more expensive
+    const auto key = "/radar/front/left/" + std::to_string(index);
+    return String_t(iox::TruncateToCapacity, key.c_str());
+}
+
+template <typename Key, uint64_t Capacity>
+struct LinearSearch
+{
+    struct Entry
+    {
+        Key key;
+        uint64_t value;
+    };
+
+    void insert(const Key& key, const uint64_t value)
+    {
+        IOX_DISCARD_RESULT(entries.emplace_back(Entry{key, value}));
+    }
+
+    const uint64_t* find(const Key& key) const
+    {
+        for (const auto& entry : entries)
+        {
+            if (entry.key == key)
+            {
+                return &entry.value;
+            }
+        }
+        return nullptr;
+    }
+
+    iox::vector<Entry, Capacity> entries;
+};
+
+template <typename Key, uint64_t Capacity>
+struct HashMap
+{
+    void insert(const Key& key, const uint64_t value)
+    {
+        IOX_DISCARD_RESULT(map.insert(key, value));
+    }
+
+    const uint64_t* find(const Key& key) const
+    {
+        auto entry = map.find(key);
+        return (entry == map.end()) ? nullptr : &entry->value();
+    }
+
+    iox::FixedCapacityHashMap<Key, uint64_t, Capacity> map;
+};
+
+/// @brief Measures the time of a lookup in a container which is filled to its capacity. Every second lookup is done
+/// with a key which is not contained, since this is the worst case for the linear search.
+template <template <typename, uint64_t> class Container, typename Key, uint64_t Capacity>
+void performBenchmark(const char* containerName, const char* keyName)
+{
+    auto container = std::make_unique<Container<Key, Capacity>>();
+    auto keys = std::make_unique<iox::vector<Key, 2U * Capacity>>();
+    for (uint64_t i = 0U; i < 2U * Capacity; ++i)
+    {
+        IOX_DISCARD_RESULT(keys->emplace_back(createKey<Key>(i)));
+    }
+    for (uint64_t i = 0U; i < Capacity; ++i)
+    {
+        container->insert(keys->at(2U * i), i);
+    }
+
+    uint64_t numberOfHits{0U};
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0U; i < NUMBER_OF_LOOKUPS; ++i)
+    {
+        if (container->find(keys->at(i % keys->size())) != nullptr)
+        {
+            ++numberOfHits;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    const auto nanosecondsPerLookup = static_cast<double>(duration) / static_cast<double>(NUMBER_OF_LOOKUPS);
+
+    // Not using iceoryx logger due to width requirements
+    std::cout << std::setw(20) << containerName << " [ " << std::setw(8) << keyName << " keys, " << std::setw(5)
+              << Capacity << " entries ] " << std::setw(10) << std::fixed << std::setprecision(1)
+              << nanosecondsPerLookup << " ns/lookup (hits: " << numberOfHits << ")" << std::endl;
+}
+
+template <uint64_t Capacity>
+void performBenchmarks()
+{
+    performBenchmark<LinearSearch, uint64_t, Capacity>("vector", "uint64_t");
+    performBenchmark<HashMap, uint64_t, Capacity>("FixedCapacityHashMap", "uint64_t");
+    performBenchmark<LinearSearch, String_t, Capacity>("vector", "string");
+    performBenchmark<HashMap, String_t, Capacity>("FixedCapacityHashMap", "string");
+}
+} // namespace
+
+int main()
+{
+    performBenchmarks<4U>();
+    performBenchmarks<16U>();
+    performBenchmarks<64U>();
+    performBenchmarks<256U>();
+    performBenchmarks<1024U>();
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,151 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iox/atomic.hpp"
+#include "iox/detail/mpmc_lockfree_queue.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+constexpr uint64_t QUEUE_CAPACITY{1024U};
+
+using Queue = iox::concurrent::MpmcLockFreeQueue<uint64_t, QUEUE_CAPACITY>;
+
+/// @brief Moves 'batchSize' values per operation; a batch size of 0 uses the single element 'tryPush' and 'pop'
+uint64_t pushBatch(Queue& queue, const std::vector<uint64_t>& values, const uint64_t batchSize)
+{
+    if (batchSize == 0U)
+    {
+        return queue.tryPush(values[0]) ? 1U : 0U;
+    }
+    return queue.tryPushMany(values.data(), batchSize);
+}
+
+uint64_t popBatch(Queue& queue, std::vector<uint64_t>& values, const uint64_t batchSize)
+{
+    if (batchSize == 0U)
+    {
+        return queue.pop().has_value() ? 1U : 0U;
+    }
+    return queue.popMany(values.data(), batchSize);
+}
+
+/// @brief Measures the throughput of the queue with the same number of producer and consumer threads which push and
+/// pop as fast as possible
+void performBenchmark(const uint64_t batchSize,
+                      const uint64_t numberOfThreads,
+                      const std::chrono::milliseconds duration)
+{
+    auto queue = std::make_unique<Queue>();
+    iox::concurrent::Atomic<bool> keepRunning{true};
+    iox::concurrent::Atomic<uint64_t> numberOfPushes{0U};
+    iox::concurrent::Atomic<uint64_t> numberOfPops{0U};
+
+    std::vector<std::thread> threads;
+    for (uint64_t i = 0U; i < numberOfThreads; ++i)
+    {
+        threads.emplace_back([&] {
+            std::vector<uint64_t> values(std::max(batchSize, uint64_t{1U}), 0U);
+            uint64_t pushes{0U};
+            while (keepRunning.load(std::memory_order_relaxed))
+            {
+                const auto pushed = pushBatch(*queue, values, batchSize);
+                if (pushed == 0U)
+                {
+                    std::this_thread::yield();
+                }
+                pushes += pushed;
+            }
+            numberOfPushes.fetch_add(pushes);
+        });
+        threads.emplace_back([&] {
+            std::vector<uint64_t> values(std::max(batchSize, uint64_t{1U}), 0U);
+            uint64_t pops{0U};
+            while (keepRunning.load(std::memory_order_relaxed))
+            {
+                const auto popped = popBatch(*queue, values, batchSize);
+                if (popped == 0U)
+                {
+                    std::this_thread::yield();
+                }
+                pops += popped;
+            }
+            numberOfPops.fetch_add(pops);
+        });
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::this_thread::sleep_for(duration);
+    keepRunning = false;
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    constexpr double NANOSECS_PER_SEC{1000000000.0};
+    const double seconds =
+        static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count())
+        / NANOSECS_PER_SEC;
+    const auto pushesPerSecond = static_cast<uint64_t>(static_cast<double>(numberOfPushes.load()) / seconds);
+    const auto popsPerSecond = static_cast<uint64_t>(static_cast<double>(numberOfPops.load()) / seconds);
+
+    // Not using iceoryx logger due to width requirements
+    std::cout << "[ " << (batchSize == 0U ? "tryPush/pop        " : "tryPushMany/popMany") << " batch size "
+              << std::setw(3) << std::max(batchSize, uint64_t{1U}) << ", " << std::setw(2) << numberOfThreads
+              << " producers and consumers ] " << std::setw(12) << pushesPerSecond << " (pushes/s) : " << std::setw(12)
+              << popsPerSecond << " (pops/s)" << std::endl;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    std::chrono::milliseconds duration{1000};
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic) access to the command line arguments
+    if (argc > 1)
+    {
+        char* end{nullptr};
+        const auto durationInMs = std::strtoul(argv[1], &end, 10);
+        if (*end != '\0' || durationInMs == 0U)
+        {
+            std::cout << "Usage: " << argv[0] << " [duration in ms]" << std::endl;
+            return EXIT_FAILURE;
+        }
+        duration = std::chrono::milliseconds(durationInMs);
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    for (const uint64_t numberOfThreads : {1U, 4U})
+    {
+        for (const uint64_t batchSize : {0U, 1U, 4U, 16U, 64U})
+        {
+            performBenchmark(batchSize, numberOfThreads, duration);
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
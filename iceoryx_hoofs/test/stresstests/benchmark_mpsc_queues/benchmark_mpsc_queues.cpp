@@ -0,0 +1,149 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iox/atomic.hpp"
+#include "iox/detail/mpmc_resizeable_lockfree_queue.hpp"
+#include "iox/detail/mpsc_lockfree_queue.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+constexpr uint64_t QUEUE_CAPACITY{256U};
+
+using MpmcQueue = iox::concurrent::MpmcResizeableLockFreeQueue<uint64_t, QUEUE_CAPACITY>;
+using MpscQueue = iox::concurrent::MpscLockFreeQueue<uint64_t, QUEUE_CAPACITY>;
+
+enum class PushMode
+{
+    TRY_PUSH,
+    OVERFLOW
+};
+
+template <typename Queue>
+bool push(Queue& queue, const PushMode mode, const uint64_t value)
+{
+    if (mode == PushMode::TRY_PUSH)
+    {
+        return queue.tryPush(value);
+    }
+    queue.push(value);
+    return true;
+}
+
+/// @brief Measures the throughput of a queue with multiple producer threads and one consumer thread. The producers
+/// push as fast as possible and the consumer counts the successfully popped values.
+template <typename Queue>
+void performBenchmark(const char* queueName,
+                      const PushMode mode,
+                      const uint64_t numberOfProducers,
+                      const std::chrono::milliseconds duration)
+{
+    auto queue = std::make_unique<Queue>();
+    iox::concurrent::Atomic<bool> keepRunning{true};
+    iox::concurrent::Atomic<uint64_t> numberOfPushes{0U};
+    uint64_t numberOfPops{0U};
+    uint64_t actualDurationNanoSeconds{0U};
+
+    std::vector<std::thread> producers;
+    for (uint64_t i = 0U; i < numberOfProducers; ++i)
+    {
+        producers.emplace_back([&] {
+            uint64_t pushes{0U};
+            while (keepRunning.load(std::memory_order_relaxed))
+            {
+                if (push(*queue, mode, pushes))
+                {
+                    ++pushes;
+                }
+            }
+            numberOfPushes.fetch_add(pushes);
+        });
+    }
+
+    std::thread consumer([&] {
+        auto start = std::chrono::steady_clock::now();
+        uint64_t pops{0U};
+        while (keepRunning.load(std::memory_order_relaxed))
+        {
+            if (queue->pop().has_value())
+            {
+                ++pops;
+            }
+        }
+        auto end = std::chrono::steady_clock::now();
+        numberOfPops = pops;
+        actualDurationNanoSeconds =
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    });
+
+    std::this_thread::sleep_for(duration);
+    keepRunning = false;
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    consumer.join();
+
+    constexpr double NANOSECS_PER_SEC{1000000000.0};
+    const double seconds = static_cast<double>(actualDurationNanoSeconds) / NANOSECS_PER_SEC;
+    const auto pushesPerSecond = static_cast<uint64_t>(static_cast<double>(numberOfPushes.load()) / seconds);
+    const auto popsPerSecond = static_cast<uint64_t>(static_cast<double>(numberOfPops) / seconds);
+
+    // Not using iceoryx logger due to width requirements
+    std::cout << std::setw(28) << queueName << (mode == PushMode::TRY_PUSH ? " [ tryPush" : " [ push   ")
+              << std::setw(3) << numberOfProducers << " producers ] " << std::setw(12) << pushesPerSecond
+              << " (pushes/s) : " << std::setw(12) << popsPerSecond << " (pops/s)" << std::endl;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    std::chrono::milliseconds duration{1000};
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic) access to the command line arguments
+    if (argc > 1)
+    {
+        char* end{nullptr};
+        const auto durationInMs = std::strtoul(argv[1], &end, 10);
+        if (*end != '\0' || durationInMs == 0U)
+        {
+            std::cout << "Usage: " << argv[0] << " [duration in ms]" << std::endl;
+            return EXIT_FAILURE;
+        }
+        duration = std::chrono::milliseconds(durationInMs);
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    for (const auto mode : {PushMode::TRY_PUSH, PushMode::OVERFLOW})
+    {
+        for (const uint64_t numberOfProducers : {2U, 4U, 8U, 16U})
+        {
+            performBenchmark<MpmcQueue>("MpmcResizeableLockFreeQueue", mode, numberOfProducers, duration);
+            performBenchmark<MpscQueue>("MpscLockFreeQueue", mode, numberOfProducers, duration);
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
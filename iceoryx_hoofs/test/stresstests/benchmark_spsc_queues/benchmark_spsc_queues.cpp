@@ -0,0 +1,222 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iox/atomic.hpp"
+#include "iox/detail/spsc_fifo.hpp"
+#include "iox/detail/spsc_sofi.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#endif
+
+namespace
+{
+constexpr uint64_t QUEUE_CAPACITY{1024U};
+
+using Fifo = iox::concurrent::SpscFifo<uint64_t, QUEUE_CAPACITY>;
+using Sofi = iox::concurrent::SpscSofi<uint64_t, QUEUE_CAPACITY>;
+
+struct CpuPair
+{
+    uint32_t producer{0U};
+    uint32_t consumer{1U};
+};
+
+bool setCpuAffinity(const uint32_t cpu)
+{
+#ifdef __linux__
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) the macro is provided by the platform
+    CPU_SET(cpu, &cpuset);
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset) == 0;
+#else
+    static_cast<void>(cpu);
+    return false;
+#endif
+}
+
+bool push(Fifo& fifo, const uint64_t value)
+{
+    return fifo.push(value);
+}
+
+bool push(Sofi& sofi, const uint64_t value)
+{
+    uint64_t overflowValue{0U};
+    sofi.push(value, overflowValue);
+    return true;
+}
+
+bool pop(Fifo& fifo)
+{
+    return fifo.pop().has_value();
+}
+
+bool pop(Sofi& sofi)
+{
+    uint64_t value{0U};
+    return sofi.pop(value);
+}
+
+/// @brief Measures the throughput of a queue with one producer and one consumer thread which are pinned to the given
+/// CPUs. The producer pushes as fast as possible and the consumer counts the successfully popped values.
+template <typename Queue>
+void performBenchmark(const char* queueName, const CpuPair cpus, const std::chrono::milliseconds duration)
+{
+    auto queue = std::make_unique<Queue>();
+    iox::concurrent::Atomic<bool> keepRunning{true};
+    iox::concurrent::Atomic<bool> isPinned{true};
+    uint64_t numberOfPushes{0U};
+    uint64_t numberOfPops{0U};
+    uint64_t actualDurationNanoSeconds{0U};
+
+    std::thread producer([&] {
+        if (!setCpuAffinity(cpus.producer))
+        {
+            isPinned = false;
+        }
+        uint64_t value{0U};
+        while (keepRunning.load(std::memory_order_relaxed))
+        {
+            if (push(*queue, value))
+            {
+                ++value;
+            }
+        }
+        numberOfPushes = value;
+    });
+
+    std::thread consumer([&] {
+        if (!setCpuAffinity(cpus.consumer))
+        {
+            isPinned = false;
+        }
+        auto start = std::chrono::steady_clock::now();
+        uint64_t pops{0U};
+        while (keepRunning.load(std::memory_order_relaxed))
+        {
+            if (pop(*queue))
+            {
+                ++pops;
+            }
+        }
+        auto end = std::chrono::steady_clock::now();
+        numberOfPops = pops;
+        actualDurationNanoSeconds =
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    });
+
+    std::this_thread::sleep_for(duration);
+    keepRunning = false;
+    producer.join();
+    consumer.join();
+
+    constexpr double NANOSECS_PER_SEC{1000000000.0};
+    const double seconds = static_cast<double>(actualDurationNanoSeconds) / NANOSECS_PER_SEC;
+    const auto popsPerSecond = static_cast<uint64_t>(static_cast<double>(numberOfPops) / seconds);
+
+    // Not using iceoryx logger due to width requirements
+    std::cout << std::setw(10) << queueName << " [ CPU " << std::setw(3) << cpus.producer << " -> CPU " << std::setw(3)
+              << cpus.consumer << (isPinned.load() ? " ] " : " (not pinned) ] ") << std::setw(12) << numberOfPushes
+              << " (pushes) : " << std::setw(12) << numberOfPops << " (pops) : " << std::setw(12) << popsPerSecond
+              << " (pops/s)" << std::endl;
+}
+
+void printUsage(const char* name)
+{
+    std::cout << "Usage: " << name << " [duration in ms] [producer-cpu:consumer-cpu ...]" << std::endl;
+    std::cout << "  Measures the throughput of the SPSC queues for each pair of CPUs, default: 1000 0:1" << std::endl;
+}
+
+bool parseCpuPair(const std::string& argument, CpuPair& cpus)
+{
+    const auto separator = argument.find(':');
+    if (separator == std::string::npos)
+    {
+        return false;
+    }
+    char* end{nullptr};
+    const auto producer = std::strtoul(argument.c_str(), &end, 10);
+    if (end != argument.c_str() + separator)
+    {
+        return false;
+    }
+    const auto consumer = std::strtoul(argument.c_str() + separator + 1, &end, 10);
+    if (*end != '\0' || end == argument.c_str() + separator + 1)
+    {
+        return false;
+    }
+    cpus.producer = static_cast<uint32_t>(producer);
+    cpus.consumer = static_cast<uint32_t>(consumer);
+    return true;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    std::chrono::milliseconds duration{1000};
+    std::vector<CpuPair> cpuPairs;
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic) access to the command line arguments
+    if (argc > 1)
+    {
+        char* end{nullptr};
+        const auto durationInMs = std::strtoul(argv[1], &end, 10);
+        if (*end != '\0' || durationInMs == 0U)
+        {
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        duration = std::chrono::milliseconds(durationInMs);
+    }
+
+    for (int i = 2; i < argc; ++i)
+    {
+        CpuPair cpus;
+        if (!parseCpuPair(argv[i], cpus))
+        {
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        cpuPairs.push_back(cpus);
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    if (cpuPairs.empty())
+    {
+        cpuPairs.push_back(CpuPair());
+    }
+
+    for (const auto& cpus : cpuPairs)
+    {
+        performBenchmark<Fifo>("SpscFifo", cpus, duration);
+        performBenchmark<Sofi>("SpscSofi", cpus, duration);
+    }
+
+    return EXIT_SUCCESS;
+}
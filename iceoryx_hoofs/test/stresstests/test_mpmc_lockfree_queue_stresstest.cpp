@@ -24,6 +24,7 @@ using namespace ::testing;
 
 #include "iceoryx_hoofs/testing/barrier.hpp"
 
+#include <algorithm>
 #include <list>
 #include <numeric>
 #include <random>
@@ -109,6 +110,75 @@ void consume(
 }
 
 
+template <typename Queue>
+//NOLINTNEXTLINE(bugprone-easily-swappable-parameters) This is okay since it is limited to the stress test
+void produceMany(Queue& queue, uint64_t id, uint64_t iterations, uint64_t batchSize)
+{
+    g_barrier.notify();
+
+    std::vector<Data> batch(static_cast<size_t>(batchSize));
+    uint64_t count{0U};
+    while (count < iterations)
+    {
+        const uint64_t numberOfValues = std::min(batchSize, iterations - count);
+        for (uint64_t i = 0U; i < numberOfValues; ++i)
+        {
+            batch[static_cast<size_t>(i)] = Data(id, count + i + 1U);
+        }
+
+        uint64_t numberOfPushedValues{0U};
+        while (numberOfPushedValues < numberOfValues)
+        {
+            numberOfPushedValues += queue.tryPushMany(&batch[static_cast<size_t>(numberOfPushedValues)],
+                                                      numberOfValues - numberOfPushedValues);
+        }
+        count += numberOfValues;
+    }
+}
+
+template <typename Queue>
+//NOLINTBEGIN(bugprone-easily-swappable-parameters) This is okay since it is limited to the stress test
+void consumeMany(Queue& queue,
+                 iox::concurrent::Atomic<bool>& run,
+                 uint64_t expectedFinalCount,
+                 uint64_t maxId,
+                 uint64_t batchSize,
+                 bool& testResult)
+//NOLINTEND(bugprone-easily-swappable-parameters)
+{
+    g_barrier.notify();
+
+    bool error = false;
+
+    std::vector<uint64_t> lastCount(static_cast<size_t>(maxId) + 1U, 0);
+    std::vector<Data> batch(static_cast<size_t>(batchSize));
+
+    while (run || !queue.empty())
+    {
+        const auto numberOfPoppedValues = queue.popMany(batch.data(), batchSize);
+        for (uint64_t i = 0U; i < numberOfPoppedValues; ++i)
+        {
+            const auto& value = batch[static_cast<size_t>(i)];
+            if (lastCount[static_cast<size_t>(value.id)] + 1 != value.count)
+            {
+                error = true;
+            }
+
+            lastCount[static_cast<size_t>(value.id)] = value.count;
+        }
+    }
+
+    for (size_t i = 1; i <= maxId; ++i)
+    {
+        if (lastCount[i] != expectedFinalCount)
+        {
+            error = true;
+        }
+    }
+
+    testResult = !error;
+}
+
 /// remark: a possible rework could try to avoid storing the popped values for check with multiple consumers
 /// since this would allow us to run the test much longer (currently we will exhaust memory
 /// by using the list), but this rework is somewhat nontrivial
@@ -265,6 +335,48 @@ void work(Queue& queue, uint64_t id, iox::concurrent::Atomic<bool>& run)
     }
 }
 
+// pops and pushes back batches of random size
+template <typename Queue>
+void workMany(Queue& queue, uint64_t id, iox::concurrent::Atomic<bool>& run)
+{
+    g_barrier.notify();
+
+    constexpr uint64_t MAX_BATCH_SIZE{16U};
+    std::vector<Data> poppedValues(static_cast<size_t>(MAX_BATCH_SIZE));
+    uint64_t numberOfPoppedValues{0U};
+    std::mt19937 generator(static_cast<std::mt19937::result_type>(id));
+    std::uniform_int_distribution<uint64_t> batchSize(1U, MAX_BATCH_SIZE);
+
+    while (run)
+    {
+        if (numberOfPoppedValues == 0U)
+        {
+            numberOfPoppedValues = queue.popMany(poppedValues.data(), batchSize(generator));
+        }
+        else
+        {
+            for (uint64_t i = 0U; i < numberOfPoppedValues; ++i)
+            {
+                poppedValues[static_cast<size_t>(i)].id = id;
+            }
+            const auto numberOfPushedValues = queue.tryPushMany(poppedValues.data(), numberOfPoppedValues);
+            // keep the values which were not pushed at the front
+            std::move(poppedValues.begin() + static_cast<std::ptrdiff_t>(numberOfPushedValues),
+                      poppedValues.begin() + static_cast<std::ptrdiff_t>(numberOfPoppedValues),
+                      poppedValues.begin());
+            numberOfPoppedValues -= numberOfPushedValues;
+        }
+    }
+
+    // push the remaining items back into the queue
+    uint64_t numberOfPushedValues{0U};
+    while (numberOfPushedValues < numberOfPoppedValues)
+    {
+        numberOfPushedValues += queue.tryPushMany(&poppedValues[static_cast<size_t>(numberOfPushedValues)],
+                                                  numberOfPoppedValues - numberOfPushedValues);
+    }
+}
+
 // randomly chooses between push and pop
 // popProbability essentially controls whether the queue tends to be full or empty on average
 template <typename Queue>
@@ -539,6 +651,108 @@ TYPED_TEST(MpmcLockFreeQueueStressTest, TimedMultiProducerMultiConsumer)
 }
 
 
+///@brief Tests concurrent operation of multiple producers and one consumer which push and pop in batches.
+/// The order of popped elements and completeness (no data loss) is checked.
+TYPED_TEST(MpmcLockFreeQueueStressTest, MultiProducerSingleConsumerWithBatches)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "caa98791-6e99-4f01-8ec7-722370ea2a01");
+    using Queue = typename TestFixture::Queue;
+
+    auto& queue = this->sut;
+    iox::concurrent::Atomic<bool> run{true};
+    bool testResult{false};
+    uint64_t iterations = 1000000U;
+    uint64_t numProducers = 4U;
+
+    std::vector<std::thread> producers;
+
+    std::thread consumer(
+        consumeMany<Queue>, std::ref(queue), std::ref(run), iterations, numProducers, 13U, std::ref(testResult));
+
+    for (uint64_t id = 1U; id <= numProducers; ++id)
+    {
+        producers.emplace_back(produceMany<Queue>, std::ref(queue), id, iterations, 3U + id);
+    }
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    run = false;
+    consumer.join();
+
+    EXPECT_EQ(testResult, true);
+}
+
+///@brief Tests concurrent operation of multiple hybrid producer/consumer threads which pop and push in batches.
+/// The queue is initialized full of distinct (unique) elements and each thread alternates between popping a
+/// batch of random size and pushing it back. Finally it is checked whether the queue still contains all elements
+/// it was initialized with.
+TYPED_TEST(MpmcLockFreeQueueStressTest, TimedMultiProducerMultiConsumerWithBatches)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f5df88a8-8554-4d18-a9fc-9de29009640b");
+    using Queue = typename TestFixture::Queue;
+
+    auto& q = this->sut;
+    std::chrono::seconds runtime(10);
+    uint32_t numThreads = 16U;
+
+    auto capacity = q.capacity();
+
+    g_barrier.reset(numThreads);
+
+    // fill the queue
+    Data d;
+    for (size_t i = 0; i < capacity; ++i)
+    {
+        d.count = i;
+        while (!q.tryPush(d))
+        {
+        }
+    }
+
+    iox::concurrent::Atomic<bool> run{true};
+
+    std::vector<std::thread> threads;
+
+    for (uint64_t id = 1; id <= numThreads; ++id)
+    {
+        threads.emplace_back(workMany<Queue>, std::ref(q), id, std::ref(run));
+    }
+
+    g_barrier.wait();
+    std::this_thread::sleep_for(std::chrono::seconds(runtime));
+
+    run = false;
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // check whether all elements are there, but there is no specific ordering we can expect
+    std::vector<int> count(static_cast<size_t>(capacity), 0);
+    auto popped = q.pop();
+    while (popped.has_value())
+    {
+        count[static_cast<size_t>(popped.value().count)]++;
+        popped = q.pop();
+    }
+
+    bool testResult = true;
+    for (size_t i = 0; i < capacity; ++i)
+    {
+        if (count[i] != 1) // missing or duplicate elements indicate an error
+        {
+            testResult = false;
+            break;
+        }
+    }
+
+    EXPECT_EQ(testResult, true);
+}
+
 ///@brief Tests concurrent operation of multiple hybrid producer/consumer threads
 /// which use potentially overflowing pushes.
 /// The tests initializes a local list of distinct elements for each thread.
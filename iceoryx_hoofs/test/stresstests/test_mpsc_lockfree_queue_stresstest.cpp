@@ -0,0 +1,206 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_hoofs/testing/barrier.hpp"
+#include "iceoryx_hoofs/testing/test.hpp"
+#include "iox/atomic.hpp"
+#include "iox/detail/mpsc_lockfree_queue.hpp"
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+
+struct Data
+{
+    uint64_t id{0U};
+    uint64_t count{0U};
+};
+
+template <typename T>
+class MpscLockFreeQueueStressTest : public ::testing::Test
+{
+  protected:
+    using Queue = T;
+    Queue sut;
+    Barrier barrier;
+};
+
+template <uint64_t Capacity>
+using TestQueue = iox::concurrent::MpscLockFreeQueue<Data, Capacity>;
+
+typedef ::testing::Types<TestQueue<1>, TestQueue<10>, TestQueue<1000>> TestQueues;
+
+TYPED_TEST_SUITE(MpscLockFreeQueueStressTest, TestQueues, );
+
+constexpr uint64_t NUMBER_OF_PRODUCERS{4U};
+constexpr uint64_t ITERATIONS{100000U};
+
+///@brief Tests concurrent operation of multiple producers with 'tryPush' and one consumer.
+/// The order of the popped elements per producer and the completeness (no data loss) is checked.
+TYPED_TEST(MpscLockFreeQueueStressTest, MultiProducerSingleConsumerWithoutOverflow)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "343b38fc-f257-4742-b79a-d01bb8daace3");
+    auto& queue = this->sut;
+    auto& barrier = this->barrier;
+    barrier.reset(NUMBER_OF_PRODUCERS + 1U);
+    iox::concurrent::Atomic<bool> run{true};
+    std::vector<uint64_t> lastCount(NUMBER_OF_PRODUCERS, 0U);
+    bool isOrdered{true};
+
+    std::thread consumer([&] {
+        barrier.notify();
+        while (run || !queue.empty())
+        {
+            auto popped = queue.pop();
+            if (popped.has_value())
+            {
+                auto& last = lastCount[popped->id];
+                isOrdered &= (last + 1U == popped->count);
+                last = popped->count;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    std::vector<std::thread> producers;
+    for (uint64_t id = 0U; id < NUMBER_OF_PRODUCERS; ++id)
+    {
+        producers.emplace_back([&, id] {
+            barrier.notify();
+            barrier.wait();
+            for (uint64_t count = 1U; count <= ITERATIONS; ++count)
+            {
+                while (!queue.tryPush(Data{id, count}))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    run = false;
+    consumer.join();
+
+    EXPECT_TRUE(isOrdered);
+    for (const auto count : lastCount)
+    {
+        EXPECT_THAT(count, Eq(ITERATIONS));
+    }
+}
+
+///@brief Tests concurrent operation of multiple producers with 'push' and one consumer which cannot keep up.
+/// Each element must either be popped, be returned as overflow or remain in the queue exactly once and the consumer
+/// must receive the elements of each producer in order.
+TYPED_TEST(MpscLockFreeQueueStressTest, MultiProducerSingleConsumerWithOverflow)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0c861ba1-75a5-42f5-a40e-04fd98015bd4");
+    auto& queue = this->sut;
+    auto& barrier = this->barrier;
+    barrier.reset(NUMBER_OF_PRODUCERS + 1U);
+    iox::concurrent::Atomic<bool> run{true};
+    std::vector<std::vector<uint64_t>> received(NUMBER_OF_PRODUCERS, std::vector<uint64_t>(ITERATIONS + 1U, 0U));
+    std::vector<std::vector<Data>> overflows(NUMBER_OF_PRODUCERS);
+    std::vector<uint64_t> lastCount(NUMBER_OF_PRODUCERS, 0U);
+    bool isOrdered{true};
+
+    std::thread consumer([&] {
+        barrier.notify();
+        uint64_t iteration{0U};
+        while (run)
+        {
+            // pop only every other iteration to provoke overflows
+            if (++iteration % 2U == 0U)
+            {
+                continue;
+            }
+            auto popped = queue.pop();
+            if (popped.has_value())
+            {
+                auto& last = lastCount[popped->id];
+                isOrdered &= (last < popped->count);
+                last = popped->count;
+                ++received[popped->id][popped->count];
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    std::vector<std::thread> producers;
+    for (uint64_t id = 0U; id < NUMBER_OF_PRODUCERS; ++id)
+    {
+        producers.emplace_back([&, id] {
+            barrier.notify();
+            barrier.wait();
+            for (uint64_t count = 1U; count <= ITERATIONS; ++count)
+            {
+                auto overflow = queue.push(Data{id, count});
+                if (overflow.has_value())
+                {
+                    overflows[id].push_back(overflow.value());
+                }
+            }
+        });
+    }
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    run = false;
+    consumer.join();
+
+    for (auto popped = queue.pop(); popped.has_value(); popped = queue.pop())
+    {
+        ++received[popped->id][popped->count];
+    }
+    uint64_t numberOfOverflows{0U};
+    for (const auto& producerOverflows : overflows)
+    {
+        numberOfOverflows += producerOverflows.size();
+        for (const auto& data : producerOverflows)
+        {
+            ++received[data.id][data.count];
+        }
+    }
+
+    EXPECT_TRUE(isOrdered);
+    EXPECT_THAT(numberOfOverflows, Gt(0U));
+    bool isComplete{true};
+    for (const auto& producerReceived : received)
+    {
+        for (uint64_t count = 1U; count <= ITERATIONS; ++count)
+        {
+            isComplete &= (producerReceived[count] == 1U);
+        }
+    }
+    EXPECT_TRUE(isComplete);
+}
+
+} // namespace
@@ -0,0 +1,210 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_hoofs/testing/benchmark.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <numeric>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace iox
+{
+namespace testing
+{
+namespace
+{
+std::string compilerName()
+{
+#if defined(__clang__)
+    return "clang-" + std::to_string(__clang_major__) + "." + std::to_string(__clang_minor__);
+#elif defined(__GNUC__)
+    return "gcc-" + std::to_string(__GNUC__) + "." + std::to_string(__GNUC_MINOR__);
+#elif defined(_MSC_VER)
+    return "msvc-" + std::to_string(_MSC_VER);
+#else
+    return "unknown";
+#endif
+}
+
+/// @brief nearest-rank percentile of sorted values
+double percentile(const std::vector<double>& sortedValues, const double fraction)
+{
+    if (sortedValues.empty())
+    {
+        return 0.0;
+    }
+    const auto rank = static_cast<uint64_t>(std::ceil(fraction * static_cast<double>(sortedValues.size())));
+    const auto index = (rank == 0U) ? 0U : rank - 1U;
+    return sortedValues[std::min(static_cast<size_t>(index), sortedValues.size() - 1U)];
+}
+
+void writeJsonString(std::ostream& stream, const std::string& value)
+{
+    stream << '"';
+    for (const char c : value)
+    {
+        if (c == '"' || c == '\\')
+        {
+            stream << '\\' << c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20U)
+        {
+            stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<uint32_t>(c) << std::dec
+                   << std::setfill(' ');
+        }
+        else
+        {
+            stream << c;
+        }
+    }
+    stream << '"';
+}
+} // namespace
+
+Benchmark::Benchmark(const BenchmarkConfig& config) noexcept
+    : m_config(config)
+{
+}
+
+const std::vector<BenchmarkResult>& Benchmark::results() const noexcept
+{
+    return m_results;
+}
+
+bool Benchmark::isSelected(const std::string& name) const noexcept
+{
+    return m_config.filter.empty() || name.find(m_config.filter) != std::string::npos;
+}
+
+const BenchmarkResult& Benchmark::addResult(const std::string& name,
+                                            const uint32_t numberOfThreads,
+                                            const std::vector<std::chrono::nanoseconds>& sampleDurations,
+                                            const std::vector<std::vector<uint64_t>>& operationsPerThreadAndSample,
+                                            const bool isPinned) noexcept
+{
+    BenchmarkResult result;
+    result.name = name;
+    result.numberOfThreads = numberOfThreads;
+    result.numberOfSamples = m_config.samples;
+    result.isPinned = isPinned;
+
+    std::vector<double> nanosecondsPerOperation;
+    std::vector<double> operationsPerSecond;
+    for (size_t sample = m_config.warmUpSamples; sample < sampleDurations.size(); ++sample)
+    {
+        uint64_t operations{0U};
+        for (const auto& operationsPerSample : operationsPerThreadAndSample)
+        {
+            operations += operationsPerSample[sample];
+        }
+        result.numberOfOperations += operations;
+
+        const auto nanoseconds = static_cast<double>(sampleDurations[sample].count());
+        // a sample without any operation is accounted as a single operation which took the whole sample
+        const auto operationsOfSample = static_cast<double>(std::max<uint64_t>(operations, 1U));
+        nanosecondsPerOperation.push_back(nanoseconds * static_cast<double>(numberOfThreads) / operationsOfSample);
+        operationsPerSecond.push_back(static_cast<double>(operations) * 1e9 / nanoseconds);
+    }
+
+    std::sort(nanosecondsPerOperation.begin(), nanosecondsPerOperation.end());
+    std::sort(operationsPerSecond.begin(), operationsPerSecond.end());
+
+    if (!nanosecondsPerOperation.empty())
+    {
+        auto& statistics = result.nanosecondsPerOperation;
+        statistics.min = nanosecondsPerOperation.front();
+        statistics.max = nanosecondsPerOperation.back();
+        statistics.mean = std::accumulate(nanosecondsPerOperation.begin(), nanosecondsPerOperation.end(), 0.0)
+                          / static_cast<double>(nanosecondsPerOperation.size());
+        statistics.p50 = percentile(nanosecondsPerOperation, 0.5);
+        statistics.p90 = percentile(nanosecondsPerOperation, 0.9);
+        statistics.p99 = percentile(nanosecondsPerOperation, 0.99);
+        result.operationsPerSecond = percentile(operationsPerSecond, 0.5);
+    }
+
+    m_results.push_back(result);
+    return m_results.back();
+}
+
+void Benchmark::print(std::ostream& stream, const BenchmarkResult& result) noexcept
+{
+    const auto& statistics = result.nanosecondsPerOperation;
+    stream << std::left << std::setw(48) << result.name << std::right << std::setw(3) << result.numberOfThreads
+           << " threads" << (result.isPinned ? " (pinned)" : "         ") << " : " << std::fixed
+           << std::setprecision(0) << std::setw(12) << result.operationsPerSecond << " ops/s : p50 "
+           << std::setprecision(1) << std::setw(9) << statistics.p50 << " ns, p90 " << std::setw(9) << statistics.p90
+           << " ns, p99 " << std::setw(9) << statistics.p99 << " ns" << std::defaultfloat << std::setprecision(6)
+           << std::endl;
+}
+
+void Benchmark::writeJson(std::ostream& stream) const noexcept
+{
+    stream << "{\n  \"context\": {\n    \"compiler\": ";
+    writeJsonString(stream, compilerName());
+    stream << ",\n    \"cpus\": " << numberOfCpus() << ",\n    \"warmUpSamples\": " << m_config.warmUpSamples
+           << ",\n    \"samples\": " << m_config.samples
+           << ",\n    \"sampleDurationMs\": " << m_config.sampleDuration.count()
+           << ",\n    \"pinThreads\": " << (m_config.pinThreads ? "true" : "false") << "\n  },\n  \"benchmarks\": [";
+
+    bool isFirst{true};
+    for (const auto& result : m_results)
+    {
+        const auto& statistics = result.nanosecondsPerOperation;
+        stream << (isFirst ? "\n" : ",\n") << "    {\n      \"name\": ";
+        writeJsonString(stream, result.name);
+        stream << ",\n      \"threads\": " << result.numberOfThreads
+               << ",\n      \"samples\": " << result.numberOfSamples
+               << ",\n      \"operations\": " << result.numberOfOperations
+               << ",\n      \"pinned\": " << (result.isPinned ? "true" : "false")
+               << ",\n      \"operationsPerSecond\": " << result.operationsPerSecond
+               << ",\n      \"nanosecondsPerOperation\": {\"min\": " << statistics.min
+               << ", \"mean\": " << statistics.mean << ", \"p50\": " << statistics.p50
+               << ", \"p90\": " << statistics.p90 << ", \"p99\": " << statistics.p99 << ", \"max\": " << statistics.max
+               << "}\n    }";
+        isFirst = false;
+    }
+    stream << (m_results.empty() ? "]\n}\n" : "\n  ]\n}\n");
+}
+
+uint32_t Benchmark::numberOfCpus() noexcept
+{
+    const auto numberOfCpus = std::thread::hardware_concurrency();
+    return (numberOfCpus == 0U) ? 1U : numberOfCpus;
+}
+
+bool Benchmark::pinCurrentThread(const uint32_t cpu) noexcept
+{
+#ifdef __linux__
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) the macro is provided by the platform
+    CPU_SET(cpu, &cpuset);
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset) == 0;
+#else
+    static_cast<void>(cpu);
+    return false;
+#endif
+}
+
+} // namespace testing
+} // namespace iox
@@ -0,0 +1,144 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_HOOFS_TESTING_BENCHMARK_HPP
+#define IOX_HOOFS_TESTING_BENCHMARK_HPP
+
+#include "iox/atomic.hpp"
+#include "iox/optional.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace iox
+{
+namespace testing
+{
+/// @brief The settings which are shared by all benchmarks of a 'Benchmark' instance
+struct BenchmarkConfig
+{
+    /// @brief The number of samples which are discarded before the measurement starts
+    uint32_t warmUpSamples{2U};
+    /// @brief The number of samples which are used for the statistics
+    uint32_t samples{20U};
+    /// @brief The duration of a single sample
+    std::chrono::milliseconds sampleDuration{50};
+    /// @brief If true, thread 'i' of a benchmark is pinned to CPU 'i % numberOfCpus()'
+    bool pinThreads{true};
+    /// @brief Only the benchmarks whose name contains the filter are run; an empty filter selects all benchmarks
+    std::string filter;
+};
+
+/// @brief The distribution of the time per operation over the samples of a benchmark in nanoseconds
+struct BenchmarkStatistics
+{
+    double min{0.0};
+    double mean{0.0};
+    double p50{0.0};
+    double p90{0.0};
+    double p99{0.0};
+    double max{0.0};
+};
+
+struct BenchmarkResult
+{
+    std::string name;
+    uint32_t numberOfThreads{0U};
+    uint32_t numberOfSamples{0U};
+    /// @brief The operations of all threads during the measured samples
+    uint64_t numberOfOperations{0U};
+    /// @brief The time a single thread spends per operation, i.e. the duration of a sample multiplied with the
+    /// number of threads and divided by the operations of all threads in this sample
+    BenchmarkStatistics nanosecondsPerOperation;
+    /// @brief The median over the samples of the operations of all threads per second
+    double operationsPerSecond{0.0};
+    /// @brief True if all threads were pinned to a CPU
+    bool isPinned{false};
+};
+
+/// @brief A micro-benchmark harness for concurrent primitives. A benchmark runs an operation in a loop on one or
+/// more threads for a number of warm-up and measurement samples and computes the percentiles of the time per
+/// operation over the measured samples. The results are collected and can be written as JSON.
+/// @code
+/// iox::testing::Benchmark benchmark;
+/// iox::concurrent::Atomic<uint64_t> counter{0U};
+/// benchmark.run("Atomic::fetch_add", 4U, [&](const uint32_t) -> uint64_t {
+///     counter.fetch_add(1U, std::memory_order_relaxed);
+///     return 1U;
+/// });
+/// benchmark.writeJson(std::cout);
+/// @endcode
+class Benchmark
+{
+  public:
+    explicit Benchmark(const BenchmarkConfig& config = BenchmarkConfig()) noexcept;
+
+    /// @brief Runs a benchmark. Each thread calls the operation in a loop until all samples are taken.
+    /// @tparam Operation is a callable with the signature 'uint64_t(uint32_t threadIndex)' which returns the
+    /// number of performed operations, e.g. 0 for a failed pop on an empty queue; it is called concurrently by all
+    /// threads and must not block indefinitely
+    /// @param[in] name of the benchmark, which is matched against the filter of the config
+    /// @param[in] numberOfThreads which call the operation concurrently, must be at least 1
+    /// @param[in] operation which is benchmarked
+    /// @return the result of the benchmark or 'nullopt' if it was not selected by the filter
+    template <typename Operation>
+    optional<BenchmarkResult>
+    run(const std::string& name, const uint32_t numberOfThreads, const Operation& operation) noexcept;
+
+    /// @brief Returns the results of all benchmarks which were run so far
+    const std::vector<BenchmarkResult>& results() const noexcept;
+
+    /// @brief Prints the result of a benchmark as a single line
+    static void print(std::ostream& stream, const BenchmarkResult& result) noexcept;
+
+    /// @brief Writes the context of the benchmarks and all results as a JSON document
+    void writeJson(std::ostream& stream) const noexcept;
+
+    /// @brief Returns the number of CPUs which are available for the benchmark threads
+    static uint32_t numberOfCpus() noexcept;
+
+    /// @brief Pins the calling thread to the given CPU
+    /// @return true if the thread was pinned, false if it failed or is not supported by the platform
+    static bool pinCurrentThread(const uint32_t cpu) noexcept;
+
+    /// @brief Prevents the compiler from optimizing away the computation of the given value
+    template <typename T>
+    static void doNotOptimize(const T& value) noexcept;
+
+  private:
+    bool isSelected(const std::string& name) const noexcept;
+
+    const BenchmarkResult& addResult(const std::string& name,
+                                     const uint32_t numberOfThreads,
+                                     const std::vector<std::chrono::nanoseconds>& sampleDurations,
+                                     const std::vector<std::vector<uint64_t>>& operationsPerThreadAndSample,
+                                     const bool isPinned) noexcept;
+
+  private:
+    BenchmarkConfig m_config;
+    std::vector<BenchmarkResult> m_results;
+};
+
+} // namespace testing
+} // namespace iox
+
+#include "iceoryx_hoofs/testing/benchmark.inl"
+
+#endif // IOX_HOOFS_TESTING_BENCHMARK_HPP
@@ -0,0 +1,121 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_HOOFS_TESTING_BENCHMARK_INL
+#define IOX_HOOFS_TESTING_BENCHMARK_INL
+
+#include "iceoryx_hoofs/testing/benchmark.hpp"
+
+#include <atomic>
+#include <thread>
+
+namespace iox
+{
+namespace testing
+{
+template <typename Operation>
+inline optional<BenchmarkResult>
+Benchmark::run(const std::string& name, const uint32_t numberOfThreads, const Operation& operation) noexcept
+{
+    if (!isSelected(name) || numberOfThreads == 0U)
+    {
+        return nullopt;
+    }
+
+    const uint32_t numberOfSamples = m_config.warmUpSamples + m_config.samples;
+    // every thread writes only its own row, the rows are read after the threads are joined
+    std::vector<std::vector<uint64_t>> operations(numberOfThreads, std::vector<uint64_t>(numberOfSamples, 0U));
+    std::vector<std::chrono::nanoseconds> sampleDurations(numberOfSamples);
+
+    concurrent::Atomic<uint32_t> currentSample{0U};
+    concurrent::Atomic<uint32_t> numberOfReadyThreads{0U};
+    concurrent::Atomic<bool> isStarted{false};
+    concurrent::Atomic<bool> isPinned{m_config.pinThreads};
+
+    std::vector<std::thread> threads;
+    threads.reserve(numberOfThreads);
+    for (uint32_t threadIndex = 0U; threadIndex < numberOfThreads; ++threadIndex)
+    {
+        threads.emplace_back([&, threadIndex] {
+            if (m_config.pinThreads && !pinCurrentThread(threadIndex % numberOfCpus()))
+            {
+                isPinned = false;
+            }
+
+            numberOfReadyThreads.fetch_add(1U);
+            while (!isStarted.load(std::memory_order_acquire))
+            {
+                std::this_thread::yield();
+            }
+
+            auto& operationsPerSample = operations[threadIndex];
+            uint32_t sample{0U};
+            uint64_t count{0U};
+            while (sample < numberOfSamples)
+            {
+                count += operation(threadIndex);
+
+                const auto latestSample = currentSample.load(std::memory_order_relaxed);
+                if (latestSample != sample)
+                {
+                    operationsPerSample[sample] = count;
+                    count = 0U;
+                    sample = latestSample;
+                }
+            }
+        });
+    }
+
+    while (numberOfReadyThreads.load() < numberOfThreads)
+    {
+        std::this_thread::yield();
+    }
+    isStarted.store(true, std::memory_order_release);
+
+    for (uint32_t sample = 0U; sample < numberOfSamples; ++sample)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        std::this_thread::sleep_for(m_config.sampleDuration);
+        const auto end = std::chrono::steady_clock::now();
+        sampleDurations[sample] = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        currentSample.store(sample + 1U, std::memory_order_relaxed);
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    return addResult(name, numberOfThreads, sampleDurations, operations, isPinned.load());
+}
+
+template <typename T>
+inline void Benchmark::doNotOptimize(const T& value) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static const volatile T* sink{nullptr};
+    sink = &value;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+} // namespace testing
+} // namespace iox
+
+#endif // IOX_HOOFS_TESTING_BENCHMARK_INL
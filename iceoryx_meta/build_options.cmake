@@ -25,10 +25,12 @@ option(BUILD_STRICT "Build is performed with '-Werror'" OFF)
 option(BUILD_TEST "Build all tests" OFF)
 option(CCACHE "Use ccache when it's available" ON)
 option(COVERAGE "Build iceoryx with gcov flags" OFF)
+option(DOMAIN_BRIDGE "Builds the iox-domain-bridge gateway between iceoryx domains" OFF)
 option(DOWNLOAD_TOML_LIB "Download cpptoml via the CMake ExternalProject module" ON)
 option(EXAMPLES "Build all iceoryx examples" OFF)
 option(INTROSPECTION "Builds the introspection client which requires the ncurses library with an activated terminfo feature" OFF)
 option(ONE_TO_MANY_ONLY "Restricts communication to 1:n pattern" OFF)
+option(RECORD_REPLAY "Builds the iox-record and iox-replay tools" OFF)
 set(IOX_PLATFORM_PATH "" CACHE PATH "Overrides integrated platform detection and uses provided custom path")
 option(ROUDI_ENVIRONMENT "Build RouDi Environment for testing, is enabled when building tests" OFF)
 option(ADDRESS_SANITIZER "Build with address sanitizer" OFF)
@@ -46,6 +48,8 @@ if(BUILD_ALL)
   set(EXAMPLES ON)
   set(BUILD_TEST ON)
   set(INTROSPECTION ON)
+  set(RECORD_REPLAY ON)
+  set(DOMAIN_BRIDGE ON)
   set(BINDING_C ON)
 endif()
 
@@ -85,11 +89,13 @@ function(show_config_options)
   message("          BUILD_TEST...........................: " ${BUILD_TEST} ${BUILD_TEST_HINT})
   message("          CCACHE...............................: " ${CCACHE} ${CCACHE_HINT})
   message("          COVERAGE.............................: " ${COVERAGE})
+  message("          DOMAIN_BRIDGE........................: " ${DOMAIN_BRIDGE})
   message("          DOWNLOAD_TOML_LIB....................: " ${DOWNLOAD_TOML_LIB})
   message("          EXAMPLES.............................: " ${EXAMPLES})
   message("          INTROSPECTION........................: " ${INTROSPECTION})
   message("          ONE_TO_MANY_ONLY ....................: " ${ONE_TO_MANY_ONLY})
   message("          IOX_PLATFORM_PATH....................: " ${IOX_PLATFORM_PATH})
+  message("          RECORD_REPLAY........................: " ${RECORD_REPLAY})
   message("          ROUDI_ENVIRONMENT....................: " ${ROUDI_ENVIRONMENT} ${ROUDI_ENV_HINT})
   message("          ADDRESS_SANITIZER....................: " ${ADDRESS_SANITIZER})
   message("          THREAD_SANITIZER.....................: " ${THREAD_SANITIZER})
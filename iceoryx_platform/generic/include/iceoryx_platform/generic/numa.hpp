@@ -0,0 +1,53 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_HOOFS_GENERIC_PLATFORM_NUMA_HPP
+#define IOX_HOOFS_GENERIC_PLATFORM_NUMA_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+// NOTE: The functions can be individually overwritten by setting the corresponding 'IOX_PLATFORM_OVERRIDE_*' define in
+// the respective platform specific 'override/*.h' header
+//
+// The functions are implemented with the 'mbind' and 'get_mempolicy' syscalls on Linux. On all other platforms they
+// fail with 'ENOSYS'.
+
+/// @brief Binds the pages of a memory range to a single NUMA node. Pages which are already allocated are not moved,
+/// i.e. the function must be called before the memory is touched the first time.
+/// @param[in] addr the page aligned start address of the memory range
+/// @param[in] length of the memory range in bytes
+/// @param[in] node the NUMA node to bind the memory to
+/// @return 0 on success or -1 on error with the errno set to indicate the error
+int iox_numa_bind(void* addr, size_t length, uint32_t node);
+
+/// @brief Interleaves the pages of a memory range over all NUMA nodes the process is allowed to allocate memory from.
+/// Pages which are already allocated are not moved, i.e. the function must be called before the memory is touched the
+/// first time.
+/// @param[in] addr the page aligned start address of the memory range
+/// @param[in] length of the memory range in bytes
+/// @return 0 on success or -1 on error with the errno set to indicate the error
+int iox_numa_interleave(void* addr, size_t length);
+
+/// @brief Acquires the NUMA node the page of an address is allocated on. The page is allocated if this did not yet
+/// happen.
+/// @param[in] addr the address to query
+/// @param[out] node the NUMA node of the page
+/// @return 0 on success or -1 on error with the errno set to indicate the error
+int iox_numa_node_of_address(const void* addr, uint32_t* node);
+
+#endif // IOX_HOOFS_GENERIC_PLATFORM_NUMA_HPP
@@ -0,0 +1,27 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_PLATFORM_NUMA_HPP
+#define IOX_PLATFORM_NUMA_HPP
+
+#if __has_include("iceoryx_platform/override/numa.hpp")
+#include "iceoryx_platform/override/numa.hpp"
+#else
+#include "iceoryx_platform/generic/numa.hpp"
+#endif // __has_include
+
+#endif // IOX_PLATFORM_NUMA_HPP
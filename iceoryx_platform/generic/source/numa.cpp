@@ -0,0 +1,125 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_platform/numa.hpp"
+
+#include <cerrno>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#ifndef IOX_PLATFORM_OVERRIDE_NUMA_ALL
+
+#if defined(__linux__)
+namespace
+{
+// the values are defined in 'linux/mempolicy.h' which is not available without the kernel headers
+constexpr int MPOL_BIND_MODE{2};
+constexpr int MPOL_INTERLEAVE_MODE{3};
+constexpr unsigned long MPOL_F_NODE_FLAG{1UL << 0U};
+constexpr unsigned long MPOL_F_ADDR_FLAG{1UL << 1U};
+constexpr unsigned long MPOL_F_MEMS_ALLOWED_FLAG{1UL << 2U};
+
+constexpr uint32_t BITS_PER_MASK_ENTRY{sizeof(unsigned long) * 8U};
+// large enough for the default 'CONFIG_NODES_SHIFT' of all distributions
+constexpr uint32_t MAX_NUMBER_OF_NODES{1024U};
+constexpr uint32_t NODE_MASK_ENTRIES{MAX_NUMBER_OF_NODES / BITS_PER_MASK_ENTRY};
+
+int mbind(void* addr, size_t length, int mode, const unsigned long* nodeMask)
+{
+    // the kernel expects the number of bits plus one
+    return static_cast<int>(syscall(SYS_mbind, addr, length, mode, nodeMask, MAX_NUMBER_OF_NODES + 1U, 0U));
+}
+} // namespace
+#endif
+
+#ifndef IOX_PLATFORM_OVERRIDE_NUMA_BIND
+int iox_numa_bind(void* addr, size_t length, uint32_t node)
+{
+#if defined(__linux__)
+    if (node >= MAX_NUMBER_OF_NODES)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    // NOLINTJUSTIFICATION the node mask is a C interface of the kernel
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    unsigned long nodeMask[NODE_MASK_ENTRIES]{};
+    nodeMask[node / BITS_PER_MASK_ENTRY] = 1UL << (node % BITS_PER_MASK_ENTRY);
+    return mbind(addr, length, MPOL_BIND_MODE, &nodeMask[0]);
+#else
+    static_cast<void>(addr);
+    static_cast<void>(length);
+    static_cast<void>(node);
+    errno = ENOSYS;
+    return -1;
+#endif
+}
+#endif
+
+#ifndef IOX_PLATFORM_OVERRIDE_NUMA_INTERLEAVE
+int iox_numa_interleave(void* addr, size_t length)
+{
+#if defined(__linux__)
+    // NOLINTJUSTIFICATION the node mask is a C interface of the kernel
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    unsigned long allowedNodes[NODE_MASK_ENTRIES]{};
+    int mode{0};
+    if (syscall(SYS_get_mempolicy,
+                &mode,
+                &allowedNodes[0],
+                MAX_NUMBER_OF_NODES + 1U,
+                nullptr,
+                MPOL_F_MEMS_ALLOWED_FLAG)
+        != 0)
+    {
+        return -1;
+    }
+    return mbind(addr, length, MPOL_INTERLEAVE_MODE, &allowedNodes[0]);
+#else
+    static_cast<void>(addr);
+    static_cast<void>(length);
+    errno = ENOSYS;
+    return -1;
+#endif
+}
+#endif
+
+#ifndef IOX_PLATFORM_OVERRIDE_NUMA_NODE_OF_ADDRESS
+int iox_numa_node_of_address(const void* addr, uint32_t* node)
+{
+#if defined(__linux__)
+    int nodeOfAddress{0};
+    if (syscall(SYS_get_mempolicy, &nodeOfAddress, nullptr, 0U, addr, MPOL_F_NODE_FLAG | MPOL_F_ADDR_FLAG) != 0)
+    {
+        return -1;
+    }
+    *node = static_cast<uint32_t>(nodeOfAddress);
+    return 0;
+#else
+    static_cast<void>(addr);
+    static_cast<void>(node);
+    errno = ENOSYS;
+    return -1;
+#endif
+}
+#endif
+
+#endif // IOX_PLATFORM_OVERRIDE_NUMA_ALL
@@ -35,7 +35,9 @@ inline expected<unique_ptr<Listener>, ListenerBuilderError> ListenerBuilder::cre
     {
         return err(ListenerBuilderError::OUT_OF_RESOURCES);
     }
-    return ok(unique_ptr<Listener>{new (std::nothrow) Listener{*condition_variable_data}, [&](auto* const listener) {
+    const popo::WaitStrategy wait_strategy{m_spin_duration, m_relax_cpu_while_spinning};
+    return ok(unique_ptr<Listener>{new (std::nothrow) Listener{*condition_variable_data, wait_strategy},
+                                   [&](auto* const listener) {
                                        // NOLINTNEXTLINE(cppcoreguidelines-owning-memory) raw pointer is required by the unique_ptr API
                                        delete listener;
                                    }});
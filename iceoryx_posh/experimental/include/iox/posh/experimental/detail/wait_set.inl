@@ -35,11 +35,12 @@ inline expected<unique_ptr<WaitSet<Capacity>>, WaitSetBuilderError> WaitSetBuild
     {
         return err(WaitSetBuilderError::OUT_OF_RESOURCES);
     }
-    return ok(unique_ptr<WaitSet<Capacity>>{new (std::nothrow) WaitSet<Capacity>{*condition_variable_data},
-                                            [&](auto* const ws) {
-                                                // NOLINTNEXTLINE(cppcoreguidelines-owning-memory) raw pointer is required by the unique_ptr API
-                                                delete ws;
-                                            }});
+    const popo::WaitStrategy wait_strategy{m_spin_duration, m_relax_cpu_while_spinning};
+    return ok(unique_ptr<WaitSet<Capacity>>{
+        new (std::nothrow) WaitSet<Capacity>{*condition_variable_data, wait_strategy}, [&](auto* const ws) {
+            // NOLINTNEXTLINE(cppcoreguidelines-owning-memory) raw pointer is required by the unique_ptr API
+            delete ws;
+        }});
 }
 
 } // namespace iox::posh::experimental
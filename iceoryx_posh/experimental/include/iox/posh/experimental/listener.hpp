@@ -39,6 +39,13 @@ enum class ListenerBuilderError : uint8_t
 /// @brief A builder for the listener
 class ListenerBuilder
 {
+  public:
+    /// @brief The time the notifications are polled before the waiting thread blocks, zero disables polling
+    IOX_BUILDER_PARAMETER(units::Duration, spin_duration, units::Duration::zero())
+
+    /// @brief Indicates whether a cpu relax hint is emitted in each poll iteration
+    IOX_BUILDER_PARAMETER(bool, relax_cpu_while_spinning, true)
+
   public:
     /// @brief Creates a listener
     /// @return a 'listener' on success and a 'ListenerBuilderError' on failure
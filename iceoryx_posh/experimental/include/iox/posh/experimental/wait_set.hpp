@@ -38,6 +38,13 @@ enum class WaitSetBuilderError : uint8_t
 /// @brief A builder for the waitset
 class WaitSetBuilder
 {
+  public:
+    /// @brief The time the notifications are polled before the waiting thread blocks, zero disables polling
+    IOX_BUILDER_PARAMETER(units::Duration, spin_duration, units::Duration::zero())
+
+    /// @brief Indicates whether a cpu relax hint is emitted in each poll iteration
+    IOX_BUILDER_PARAMETER(bool, relax_cpu_while_spinning, true)
+
   public:
     /// @brief Creates a waitset
     /// @tparam Capacity the amount of events/states which can be attached to the waitset
@@ -61,12 +61,14 @@ enum class Interfaces : uint16_t
     MTA,
     /// @brief Robot Operating System 1
     ROS1,
+    /// @brief Bridge between iceoryx domains on the same host
+    DOMAIN_BRIDGE,
     /// @brief End of enum
     INTERFACE_END
 };
 
 constexpr const char* INTERFACE_NAMES[] = {
-    "INTERNAL", "ESOC", "SOMEIP", "AMQP", "MQTT", "DDS", "SIGNAL", "MTA", "ROS1", "END"};
+    "INTERNAL", "ESOC", "SOMEIP", "AMQP", "MQTT", "DDS", "SIGNAL", "MTA", "ROS1", "DOMAIN_BRIDGE", "END"};
 
 /// @brief Scope of a service description
 enum class Scope : uint16_t
@@ -32,6 +32,7 @@
 #include "iox/string.hpp"
 #include "iox/vector.hpp"
 
+#include <chrono>
 #include <thread>
 
 namespace iox
@@ -137,6 +138,13 @@ class GatewayGeneric : public gateway_t
     ///
     expected<void, GatewayError> discardChannel(const capro::ServiceDescription& service) noexcept;
 
+    ///
+    /// @brief waitForNextForwarding Called by the forwarding thread after each forwarding cycle. The default
+    /// implementation sleeps until the deadline, gateways which are notified about new data can return earlier.
+    /// @param deadline The end of the forwarding period of the current cycle.
+    ///
+    virtual void waitForNextForwarding(const std::chrono::steady_clock::time_point deadline) noexcept;
+
   private:
     ConcurrentChannelVector m_channels;
 
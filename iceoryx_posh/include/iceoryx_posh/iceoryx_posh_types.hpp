@@ -116,6 +116,13 @@ constexpr uint32_t MAX_NUMBER_OF_EVENTS_PER_LISTENER = MAX_NUMBER_OF_NOTIFIERS;
 // Memory
 constexpr uint32_t MAX_NUMBER_OF_MEMPOOLS = build::IOX_MAX_NUMBER_OF_MEMPOOLS;
 constexpr uint32_t MAX_SHM_SEGMENTS = build::IOX_MAX_SHM_SEGMENTS;
+/// @note every overflow segment contains a single mempool which extends a size class of a payload segment
+constexpr uint32_t MAX_NUMBER_OF_OVERFLOW_SEGMENTS_PER_SEGMENT = 8U;
+constexpr uint32_t DEFAULT_OVERFLOW_THRESHOLD_PERCENT = 80U;
+/// @note a chained message consists of a head chunk and up to this number of continuation chunks
+constexpr uint32_t MAX_NUMBER_OF_CONTINUATION_CHUNKS = 1024U;
+/// @note each publisher with a chunk quota occupies one slot per segment until all its chunks are released
+constexpr uint32_t MAX_NUMBER_OF_CHUNK_QUOTAS_PER_SEGMENT = MAX_PUBLISHERS;
 
 constexpr uint32_t MAX_NUMBER_OF_MEMORY_PROVIDER = 8U;
 constexpr uint32_t MAX_NUMBER_OF_MEMORY_BLOCKS_PER_MEMORY_PROVIDER = 64U;
@@ -290,17 +297,24 @@ constexpr units::Duration PROCESS_DEFAULT_TERMINATION_DELAY = 0_s;
 constexpr units::Duration PROCESS_DEFAULT_KILL_DELAY = 45_s;
 constexpr units::Duration PROCESS_TERMINATED_CHECK_INTERVAL = 250_ms;
 constexpr units::Duration DISCOVERY_INTERVAL = 100_ms;
+/// @brief the number of threads RouDi uses to process the requests of the runtimes concurrently
+constexpr uint32_t DEFAULT_RUNTIME_MESSAGE_WORKER_COUNT{4U};
+constexpr uint32_t MAX_RUNTIME_MESSAGE_WORKER_COUNT{64U};
 
 /// @brief Controls process alive monitoring. Upon timeout, a monitored process is removed
 /// and its resources are made available. The process can then start and register itself again.
 /// Contrarily, unmonitored processes can be restarted but registration will fail.
 /// Once Runlevel Management is extended, it will detect absent processes. Those processes can register again.
-/// ON - all processes are monitored
+/// ON - all processes are monitored; on Linux the termination of a process is detected immediately with a pidfd,
+/// processes which cannot be monitored with a pidfd fall back to the heartbeat
 /// OFF - no process is monitored
+/// HEARTBEAT - all processes are monitored with a periodic heartbeat; required if the applications run in a different
+/// pid namespace than RouDi
 enum class MonitoringMode
 {
     ON,
-    OFF
+    OFF,
+    HEARTBEAT
 };
 
 iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const MonitoringMode& mode) noexcept;
@@ -309,6 +323,30 @@ iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const Monitoring
 namespace mepoo
 {
 using SequenceNumber_t = std::uint64_t;
+
+/// @brief The name of a payload segment, which is the name of its writer group
+using SegmentName_t = string<platform::MAX_GROUP_NAME_LENGTH>;
+
+/// @brief The kind of traffic a payload segment is intended for; publishers can select their segment by it
+enum class TrafficClass : uint8_t
+{
+    UNSPECIFIED,
+    /// @brief small samples which need a low latency, e.g. control messages
+    LATENCY_CRITICAL,
+    /// @brief large samples, e.g. camera frames or point clouds
+    BULK
+};
+
+/// @brief Converts the TrafficClass to a string literal
+/// @param[in] value to convert to a string literal
+/// @return pointer to a string literal
+inline constexpr const char* asStringLiteral(const TrafficClass value) noexcept;
+
+/// @brief Convenience stream operator to easily use the 'asStringLiteral' function with iox::log::LogStream
+/// @param[in] stream sink to write the message to
+/// @param[in] value to convert to a string literal
+/// @return the reference to 'stream' which was provided as input parameter
+inline log::LogStream& operator<<(log::LogStream& stream, const TrafficClass value) noexcept;
 } // namespace mepoo
 
 namespace runtime
@@ -62,6 +62,9 @@ inline iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const Mon
     case MonitoringMode::ON:
         logstream << "MonitoringMode::ON";
         break;
+    case MonitoringMode::HEARTBEAT:
+        logstream << "MonitoringMode::HEARTBEAT";
+        break;
     default:
         logstream << "MonitoringMode::UNDEFINED";
         break;
@@ -70,6 +73,30 @@ inline iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const Mon
 }
 } // namespace roudi
 
+namespace mepoo
+{
+inline constexpr const char* asStringLiteral(const TrafficClass value) noexcept
+{
+    switch (value)
+    {
+    case TrafficClass::UNSPECIFIED:
+        return "TrafficClass::UNSPECIFIED";
+    case TrafficClass::LATENCY_CRITICAL:
+        return "TrafficClass::LATENCY_CRITICAL";
+    case TrafficClass::BULK:
+        return "TrafficClass::BULK";
+    }
+
+    return "TrafficClass::UndefinedValue";
+}
+
+inline log::LogStream& operator<<(log::LogStream& stream, const TrafficClass value) noexcept
+{
+    stream << asStringLiteral(value);
+    return stream;
+}
+} // namespace mepoo
+
 } // namespace iox
 
 #endif // IOX_POSH_ICEORYX_POSH_TYPES_INL
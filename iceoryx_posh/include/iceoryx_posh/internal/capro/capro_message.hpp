@@ -96,6 +96,10 @@ class CaproMessage
     ServiceDescription m_serviceDescription;
     void* m_chunkQueueData{nullptr};
     uint64_t m_historyCapacity{0u};
+    /// @brief SUB/UNSUB of a subscriber which reads only the latest chunk of the publisher instead of using a queue
+    bool m_latestValueOnly{false};
+    /// @brief ACK/STOP_OFFER of a publisher which refers to the slot with its latest chunk
+    void* m_latestChunkSlot{nullptr};
 };
 
 } // namespace capro
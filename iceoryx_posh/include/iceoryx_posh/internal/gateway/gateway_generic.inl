@@ -161,6 +161,13 @@ GatewayGeneric<channel_t, gateway_t>::discardChannel(const capro::ServiceDescrip
     }
 }
 
+template <typename channel_t, typename gateway_t>
+inline void GatewayGeneric<channel_t, gateway_t>::waitForNextForwarding(
+    const std::chrono::steady_clock::time_point deadline) noexcept
+{
+    std::this_thread::sleep_until(deadline);
+}
+
 // ================================================== Private ================================================== //
 
 template <typename channel_t, typename gateway_t>
@@ -185,7 +192,7 @@ inline void GatewayGeneric<channel_t, gateway_t>::forwardingLoop() noexcept
     {
         auto startTime = std::chrono::steady_clock::now();
         forEachChannel([this](channel_t channel) { this->forward(channel); });
-        std::this_thread::sleep_until(startTime + std::chrono::milliseconds(m_forwardingPeriod.toMilliseconds()));
+        waitForNextForwarding(startTime + std::chrono::milliseconds(m_forwardingPeriod.toMilliseconds()));
     };
 }
 
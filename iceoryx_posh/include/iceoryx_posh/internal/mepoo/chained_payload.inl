@@ -0,0 +1,166 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_MEPOO_CHAINED_PAYLOAD_INL
+#define IOX_POSH_MEPOO_CHAINED_PAYLOAD_INL
+
+#include "iceoryx_posh/internal/mepoo/chunk_management.hpp"
+#include "iceoryx_posh/mepoo/chained_payload.hpp"
+#include "iox/algorithm.hpp"
+#include "iox/assertions.hpp"
+
+#include <cstring>
+
+namespace iox
+{
+namespace mepoo
+{
+template <typename ByteType>
+inline ChainedPayloadView<ByteType>::Iterator::Iterator(const ChainedPayloadView& view, const uint32_t index) noexcept
+    : m_view(&view)
+    , m_index(index)
+{
+}
+
+template <typename ByteType>
+inline typename ChainedPayloadView<ByteType>::Segment_t
+ChainedPayloadView<ByteType>::Iterator::operator*() const noexcept
+{
+    return m_view->segment(m_index);
+}
+
+template <typename ByteType>
+inline typename ChainedPayloadView<ByteType>::Iterator& ChainedPayloadView<ByteType>::Iterator::operator++() noexcept
+{
+    ++m_index;
+    return *this;
+}
+
+template <typename ByteType>
+inline bool ChainedPayloadView<ByteType>::Iterator::operator==(const Iterator& rhs) const noexcept
+{
+    return m_view == rhs.m_view && m_index == rhs.m_index;
+}
+
+template <typename ByteType>
+inline bool ChainedPayloadView<ByteType>::Iterator::operator!=(const Iterator& rhs) const noexcept
+{
+    return !(*this == rhs);
+}
+
+template <typename ByteType>
+inline ChainedPayloadView<ByteType>::ChainedPayloadView(ChunkHeader_t* const headChunkHeader) noexcept
+    : m_headChunkHeader(headChunkHeader)
+{
+}
+
+template <typename ByteType>
+inline optional<ChainedPayloadView<ByteType>>
+ChainedPayloadView<ByteType>::fromUserPayload(UserPayload_t* const userPayload) noexcept
+{
+    auto* chunkHeader = ChunkHeader::fromUserPayload(userPayload);
+    if (chunkHeader == nullptr || chunkHeader->userHeaderId() != ChunkHeader::CHAINED_CHUNK_USER_HEADER)
+    {
+        return nullopt;
+    }
+    return ChainedPayloadView(chunkHeader);
+}
+
+template <typename ByteType>
+inline const ChainedChunkHeader& ChainedPayloadView<ByteType>::chainedChunkHeader() const noexcept
+{
+    return *static_cast<const ChainedChunkHeader*>(m_headChunkHeader->userHeader());
+}
+
+template <typename ByteType>
+inline uint32_t ChainedPayloadView<ByteType>::numberOfSegments() const noexcept
+{
+    return 1U + chainedChunkHeader().m_numberOfContinuationChunks;
+}
+
+template <typename ByteType>
+inline uint64_t ChainedPayloadView<ByteType>::size() const noexcept
+{
+    return chainedChunkHeader().m_userPayloadSize;
+}
+
+template <typename ByteType>
+inline typename ChainedPayloadView<ByteType>::Segment_t
+ChainedPayloadView<ByteType>::segment(const uint32_t index) const noexcept
+{
+    IOX_ENFORCE(index < numberOfSegments(), "Access to a segment of a chained message out of bounds!");
+
+    ChunkHeader_t* chunkHeader = m_headChunkHeader;
+    if (index > 0U)
+    {
+        chunkHeader = chainedChunkHeader().continuationChunks()[index - 1U]->m_chunkHeader.get();
+    }
+    return Segment_t(static_cast<ByteType*>(chunkHeader->userPayload()), chunkHeader->userPayloadSize());
+}
+
+template <typename ByteType>
+inline typename ChainedPayloadView<ByteType>::Iterator ChainedPayloadView<ByteType>::begin() const noexcept
+{
+    return Iterator(*this, 0U);
+}
+
+template <typename ByteType>
+inline typename ChainedPayloadView<ByteType>::Iterator ChainedPayloadView<ByteType>::end() const noexcept
+{
+    return Iterator(*this, numberOfSegments());
+}
+
+template <typename ByteType>
+inline uint64_t ChainedPayloadView<ByteType>::copyTo(void* const destination,
+                                                     const uint64_t destinationSize) const noexcept
+{
+    uint64_t copiedBytes{0U};
+    for (const auto segment : *this)
+    {
+        const uint64_t bytesToCopy = algorithm::minVal(segment.size(), destinationSize - copiedBytes);
+        std::memcpy(static_cast<uint8_t*>(destination) + copiedBytes, segment.data(), bytesToCopy);
+        copiedBytes += bytesToCopy;
+        if (copiedBytes == destinationSize)
+        {
+            break;
+        }
+    }
+    return copiedBytes;
+}
+
+template <typename ByteType>
+template <typename T, typename>
+inline uint64_t ChainedPayloadView<ByteType>::copyFrom(const void* const source,
+                                                       const uint64_t sourceSize) const noexcept
+{
+    uint64_t copiedBytes{0U};
+    for (const auto segment : *this)
+    {
+        const uint64_t bytesToCopy = algorithm::minVal(segment.size(), sourceSize - copiedBytes);
+        std::memcpy(segment.data(), static_cast<const uint8_t*>(source) + copiedBytes, bytesToCopy);
+        copiedBytes += bytesToCopy;
+        if (copiedBytes == sourceSize)
+        {
+            break;
+        }
+    }
+    return copiedBytes;
+}
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_CHAINED_PAYLOAD_INL
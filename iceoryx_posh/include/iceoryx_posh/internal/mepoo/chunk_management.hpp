@@ -28,6 +28,7 @@ namespace iox
 namespace mepoo
 {
 class MemPool;
+class ChunkQuota;
 struct ChunkHeader;
 
 struct ChunkManagement
@@ -45,6 +46,11 @@ struct ChunkManagement
 
     iox::RelativePointer<MemPool> m_mempool;
     iox::RelativePointer<MemPool> m_chunkManagementPool;
+
+    /// @brief the ChunkQuota the chunk is accounted to, nullptr if the chunk was acquired without a ChunkQuota
+    iox::RelativePointer<ChunkQuota> m_chunkQuota;
+    uint32_t m_memPoolIndex{0U};
+    bool m_isReservedChunk{false};
 };
 } // namespace mepoo
 } // namespace iox
@@ -0,0 +1,132 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_MEPOO_CHUNK_QUOTA_HPP
+#define IOX_POSH_MEPOO_CHUNK_QUOTA_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iox/atomic.hpp"
+#include "iox/relative_pointer.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+class MemPool;
+
+/// @brief Settings for the chunk quota of a publisher
+struct ChunkQuotaSettings
+{
+    /// @brief the maximum number of chunks of each mempool which the publisher can hold concurrently, including the
+    /// chunks which are still held by subscribers; 0 means no limit
+    uint32_t m_maxChunksPerMemPool{0U};
+    /// @brief the user-payload size which selects the mempool in which the chunks are reserved
+    uint64_t m_reservedUserPayloadSize{0U};
+    /// @brief the number of chunks which are reserved exclusively for the publisher
+    uint32_t m_reservedChunks{0U};
+};
+
+/// @brief Usage of a chunk quota
+struct ChunkQuotaInfo
+{
+    uint32_t m_chunksInUse{0U};
+    uint32_t m_reservedChunks{0U};
+    uint32_t m_reservedChunksInUse{0U};
+    uint64_t m_numberOfExceededRequests{0U};
+};
+
+/// @brief Accounts the chunks of a publisher per mempool of a MemoryManager in order to limit the chunks the
+/// publisher can hold and to provide chunks which were reserved for the publisher. The ChunkQuota lives in the
+/// MemoryManager and is referenced by the publisher and by each chunk which was acquired with it, since the chunks can
+/// outlive the publisher. The reservation is returned to the mempool when the last reference is dropped.
+/// @note the acquisition is done by a single publisher, which is not thread-safe anyway, while the chunks can be
+/// released concurrently by any process; therefore atomic counters are sufficient
+class ChunkQuota
+{
+  public:
+    ChunkQuota() noexcept = default;
+
+    ChunkQuota(const ChunkQuota&) = delete;
+    ChunkQuota(ChunkQuota&&) = delete;
+    ChunkQuota& operator=(const ChunkQuota&) = delete;
+    ChunkQuota& operator=(ChunkQuota&&) = delete;
+    ~ChunkQuota() noexcept = default;
+
+    /// @brief Takes an unused ChunkQuota into use
+    /// @param[in] maxChunksPerMemPool is the limit of chunks per mempool, 0 means no limit
+    /// @return true if the ChunkQuota was unused, false otherwise
+    bool tryActivate(const uint32_t maxChunksPerMemPool) noexcept;
+
+    /// @brief Reserves chunks of a mempool for the owner of the ChunkQuota; must only be called once after activation
+    /// @param[in] memPool to reserve the chunks from
+    /// @param[in] memPoolIndex of the mempool in the MemoryManager
+    /// @param[in] numberOfChunks to reserve
+    /// @return true if the chunks were reserved, false otherwise
+    bool reserve(MemPool& memPool, const uint32_t memPoolIndex, const uint32_t numberOfChunks) noexcept;
+
+    /// @brief Drops the reference of the owner; the ChunkQuota becomes unused once all chunks are released
+    void deactivate() noexcept;
+
+    /// @brief Checks whether another chunk of a mempool can be acquired
+    /// @param[in] memPoolIndex of the mempool
+    /// @param[in] maxChunksPerMemPool is an additional limit, e.g. from the MePooConfig; 0 means no limit
+    /// @return true if the chunk can be acquired, false if a limit would be exceeded
+    bool isWithinLimit(const uint32_t memPoolIndex, const uint32_t maxChunksPerMemPool) const noexcept;
+
+    /// @brief Records a request which was rejected since it exceeded a limit
+    void recordExceededRequest() noexcept;
+
+    /// @brief Takes one of the unused reserved chunks
+    /// @param[in] memPoolIndex of the mempool from which a chunk is requested
+    /// @return true if a reserved chunk must be acquired from the mempool, false if the chunk must be acquired from the
+    /// unreserved chunks
+    bool tryTakeReservedChunk(const uint32_t memPoolIndex) noexcept;
+
+    /// @brief Returns a reserved chunk which was taken with 'tryTakeReservedChunk' but could not be acquired
+    void returnReservedChunk() noexcept;
+
+    /// @brief Records a chunk acquired from a mempool
+    /// @param[in] memPoolIndex of the mempool
+    void recordAcquisition(const uint32_t memPoolIndex) noexcept;
+
+    /// @brief Records a chunk released to a mempool; this might make the ChunkQuota unused
+    /// @param[in] memPoolIndex of the mempool
+    /// @param[in] isReservedChunk whether the chunk was acquired with 'tryTakeReservedChunk'
+    void recordRelease(const uint32_t memPoolIndex, const bool isReservedChunk) noexcept;
+
+    /// @brief Returns the usage of the ChunkQuota
+    ChunkQuotaInfo getInfo() const noexcept;
+
+  private:
+    void dropReference() noexcept;
+
+    // the owner and each chunk in use hold a reference; 0 means the ChunkQuota is unused
+    concurrent::Atomic<uint32_t> m_references{0U};
+    uint32_t m_maxChunksPerMemPool{0U};
+    uint32_t m_reservedMemPoolIndex{0U};
+    uint32_t m_reservedChunks{0U};
+    RelativePointer<MemPool> m_reservedMemPool;
+    concurrent::Atomic<uint32_t> m_reservedChunksInUse{0U};
+    concurrent::Atomic<uint64_t> m_numberOfExceededRequests{0U};
+    concurrent::Atomic<uint32_t> m_chunksInUse[MAX_NUMBER_OF_MEMPOOLS];
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_CHUNK_QUOTA_HPP
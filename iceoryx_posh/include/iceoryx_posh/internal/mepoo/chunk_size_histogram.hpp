@@ -0,0 +1,104 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_MEPOO_CHUNK_SIZE_HISTOGRAM_HPP
+#define IOX_POSH_MEPOO_CHUNK_SIZE_HISTOGRAM_HPP
+
+#include "iox/atomic.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+struct ChunkHeader;
+
+/// @brief Statistics of a single size class of the ChunkSizeHistogram
+struct ChunkSizeClassInfo
+{
+    /// @brief the largest required chunk size which falls into the size class
+    uint64_t m_chunkSize{0U};
+    uint64_t m_numRequests{0U};
+    uint32_t m_chunksInUse{0U};
+    uint32_t m_peakChunksInUse{0U};
+};
+
+/// @brief Records the required chunk sizes of the chunks acquired from a MemoryManager in logarithmic size classes
+/// together with the peak number of chunks which were concurrently in use per size class. The histogram lives in
+/// shared memory and is updated lock-free by all processes. Since the values are only statistics, relaxed atomics
+/// are sufficient.
+/// @details Required chunk sizes up to MIN_CHUNK_SIZE fall into the first size class. Above, each power of two is
+/// split into SUB_CLASSES_PER_POWER_OF_TWO equally sized classes, which limits the overestimation of a size class to
+/// 25%. Sizes beyond the largest size class are accounted to the largest size class.
+class ChunkSizeHistogram
+{
+  public:
+    static constexpr uint64_t MIN_CHUNK_SIZE{64U};
+    static constexpr uint32_t SUB_CLASSES_PER_POWER_OF_TWO{4U};
+    static constexpr uint32_t NUMBER_OF_SIZE_CLASSES{1U + (34U - 6U) * SUB_CLASSES_PER_POWER_OF_TWO};
+
+    ChunkSizeHistogram() noexcept = default;
+
+    ChunkSizeHistogram(const ChunkSizeHistogram&) = delete;
+    ChunkSizeHistogram(ChunkSizeHistogram&&) = delete;
+    ChunkSizeHistogram& operator=(const ChunkSizeHistogram&) = delete;
+    ChunkSizeHistogram& operator=(ChunkSizeHistogram&&) = delete;
+    ~ChunkSizeHistogram() noexcept = default;
+
+    /// @brief Records the acquisition of a chunk
+    /// @param[in] requiredChunkSize of the request, see ChunkSettings::requiredChunkSize
+    void recordAcquisition(const uint64_t requiredChunkSize) noexcept;
+
+    /// @brief Records the release of a chunk which was recorded by 'recordAcquisition'
+    /// @param[in] chunkHeader of the released chunk which is used to recalculate the required chunk size
+    void recordRelease(const ChunkHeader& chunkHeader) noexcept;
+
+    /// @brief Returns the statistics of a size class
+    /// @param[in] sizeClass index of the size class, must be smaller than NUMBER_OF_SIZE_CLASSES
+    /// @return the ChunkSizeClassInfo of the size class
+    ChunkSizeClassInfo getSizeClassInfo(const uint32_t sizeClass) const noexcept;
+
+    /// @brief Determines the size class of a required chunk size
+    /// @param[in] requiredChunkSize to classify
+    /// @return the index of the size class
+    static uint32_t sizeClass(const uint64_t requiredChunkSize) noexcept;
+
+    /// @brief Returns the largest required chunk size which falls into a size class
+    /// @param[in] sizeClass index of the size class
+    /// @return the upper bound of the size class
+    static uint64_t sizeClassUpperBound(const uint32_t sizeClass) noexcept;
+
+    /// @brief Calculates the required chunk size of an already acquired chunk
+    /// @param[in] chunkHeader of the chunk
+    /// @return the required chunk size the chunk was requested with
+    static uint64_t requiredChunkSize(const ChunkHeader& chunkHeader) noexcept;
+
+  private:
+    struct SizeClass
+    {
+        concurrent::Atomic<uint64_t> m_numRequests{0U};
+        concurrent::Atomic<uint32_t> m_chunksInUse{0U};
+        concurrent::Atomic<uint32_t> m_peakChunksInUse{0U};
+    };
+
+    SizeClass m_sizeClasses[NUMBER_OF_SIZE_CLASSES];
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_CHUNK_SIZE_HISTOGRAM_HPP
@@ -0,0 +1,69 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_MEPOO_LATEST_CHUNK_SLOT_HPP
+#define IOX_POSH_MEPOO_LATEST_CHUNK_SLOT_HPP
+
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
+#include "iox/atomic.hpp"
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief A slot in shared memory which holds a reference to the most recent chunk of a single writer. An arbitrary
+/// number of readers can concurrently acquire a reference to the stored chunk without any locks and without the writer
+/// having to know about them. Readers only take part in the reference counting of the chunk they acquire.
+/// @note There must be only one writer at a time, i.e. 'store' and 'clear' must not be called concurrently.
+class LatestChunkSlot
+{
+  public:
+    LatestChunkSlot() noexcept = default;
+
+    LatestChunkSlot(const LatestChunkSlot&) = delete;
+    LatestChunkSlot(LatestChunkSlot&&) = delete;
+    LatestChunkSlot& operator=(const LatestChunkSlot&) = delete;
+    LatestChunkSlot& operator=(LatestChunkSlot&&) = delete;
+
+    /// @brief the stored chunk is not released since the slot might be located in a segment which is not mapped
+    /// anymore; use 'clear' to release the chunk
+    ~LatestChunkSlot() noexcept = default;
+
+    /// @brief Replaces the stored chunk with the provided one and releases the reference to the previous chunk
+    /// @param[in] chunk to store; an empty SharedChunk clears the slot
+    void store(const SharedChunk& chunk) noexcept;
+
+    /// @brief Releases the reference to the stored chunk and leaves the slot empty
+    void clear() noexcept;
+
+    /// @brief Acquires a reference to the stored chunk. Can be called concurrently by multiple readers and concurrently
+    /// to 'store' and 'clear'
+    /// @return the stored chunk or an empty SharedChunk if the slot is empty
+    SharedChunk tryAcquire() noexcept;
+
+    /// @brief Checks if there is currently a chunk stored
+    /// @return true if the slot is empty, otherwise false
+    bool isEmpty() const noexcept;
+
+  private:
+    concurrent::Atomic<ShmSafeUnmanagedChunk> m_chunk;
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_LATEST_CHUNK_SLOT_HPP
@@ -18,6 +18,7 @@
 #ifndef IOX_POSH_MEPOO_MEM_POOL_HPP
 #define IOX_POSH_MEPOO_MEM_POOL_HPP
 
+#include "iceoryx_posh/internal/mepoo/chunk_size_histogram.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iox/algorithm.hpp"
 #include "iox/atomic.hpp"
@@ -37,12 +38,14 @@ struct MemPoolInfo
     MemPoolInfo(const uint32_t usedChunks,
                 const uint32_t minFreeChunks,
                 const uint32_t numChunks,
-                const uint64_t chunkSize) noexcept;
+                const uint64_t chunkSize,
+                const uint32_t reservedChunks = 0U) noexcept;
 
     uint32_t m_usedChunks{0};
     uint32_t m_minFreeChunks{0};
     uint32_t m_numChunks{0};
     uint64_t m_chunkSize{0};
+    uint32_t m_reservedChunks{0};
 };
 
 class MemPool
@@ -61,15 +64,56 @@ class MemPool
     MemPool& operator=(const MemPool&) = delete;
     MemPool& operator=(MemPool&&) = delete;
 
+    /// @brief Acquires a chunk which is not reserved
+    /// @return the chunk or nullptr if all chunks are either in use or reserved
     void* getChunk() noexcept;
+
+    /// @brief Acquires one of the chunks which were reserved with 'reserveChunks'
+    /// @return the chunk or nullptr if the MemPool is exhausted, which cannot happen if the caller does not acquire
+    /// more chunks than it reserved
+    void* getReservedChunk() noexcept;
+
     uint64_t getChunkSize() const noexcept;
     uint32_t getChunkCount() const noexcept;
+
+    /// @brief Checks whether a chunk is located in the memory of this MemPool
+    /// @param[in] chunk to check
+    /// @return true if the chunk is one of the chunks of this MemPool, otherwise false
+    bool containsChunk(const void* const chunk) const noexcept;
     uint32_t getUsedChunks() const noexcept;
     uint32_t getMinFree() const noexcept;
     MemPoolInfo getInfo() const noexcept;
 
+    /// @brief Releases a chunk which was acquired with 'getChunk'
+    /// @param[in] chunk to release
     void freeChunk(const void* chunk) noexcept;
 
+    /// @brief Releases a chunk which was acquired with 'getReservedChunk'; the chunk stays reserved
+    /// @param[in] chunk to release
+    void freeReservedChunk(const void* chunk) noexcept;
+
+    /// @brief Reserves chunks which can only be acquired with 'getReservedChunk'. Together with the chunks in use
+    /// which were acquired with 'getChunk', the reserved chunks cannot exceed the number of chunks of the MemPool.
+    /// @param[in] numberOfChunks to reserve
+    /// @return true if the chunks were reserved, false if there are not enough unreserved chunks available
+    bool reserveChunks(const uint32_t numberOfChunks) noexcept;
+
+    /// @brief Returns chunks which were reserved with 'reserveChunks'; the returned chunks must not be in use
+    /// @param[in] numberOfChunks to return
+    void unreserveChunks(const uint32_t numberOfChunks) noexcept;
+
+    /// @brief Returns the number of reserved chunks
+    uint32_t getReservedChunks() const noexcept;
+
+    /// @brief Sets the histogram in which the releases of the chunks of this MemPool are recorded
+    /// @param[in] chunkSizeHistogram must be located in the same shared memory as the MemPool; nullptr disables the
+    /// recording
+    void setChunkSizeHistogram(ChunkSizeHistogram* const chunkSizeHistogram) noexcept;
+
+    /// @brief Returns the histogram in which the releases of the chunks of this MemPool are recorded
+    /// @return the ChunkSizeHistogram or nullptr if none is set
+    ChunkSizeHistogram* getChunkSizeHistogram() const noexcept;
+
     /// @brief Converts an index to a chunk in the MemPool to a pointer
     /// @param[in] index of the chunk
     /// @param[in] chunkSize is the size of the chunk
@@ -86,6 +130,8 @@ class MemPool
     pointerToIndex(const void* const chunk, const uint64_t chunkSize, const void* const rawMemoryBase) noexcept;
 
   private:
+    void* popChunk() noexcept;
+    void pushChunk(const void* chunk) noexcept;
     void adjustMinFree() noexcept;
     bool isMultipleOfAlignment(const uint64_t value) const noexcept;
 
@@ -99,7 +145,14 @@ class MemPool
     concurrent::Atomic<uint32_t> m_usedChunks{0U};
     concurrent::Atomic<uint32_t> m_minFree{0U};
 
+    // the number of chunks which can be acquired with 'getChunk', i.e. the chunks which are neither reserved nor
+    // in use by 'getChunk'; reserved chunks are acquired and released without touching this counter
+    concurrent::Atomic<uint32_t> m_unreservedChunks{0U};
+    concurrent::Atomic<uint32_t> m_reservedChunks{0U};
+
     freeList_t m_freeIndices;
+
+    RelativePointer<ChunkSizeHistogram> m_chunkSizeHistogram;
 };
 
 } // namespace mepoo
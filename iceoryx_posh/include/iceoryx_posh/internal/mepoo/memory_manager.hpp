@@ -19,13 +19,18 @@
 #define IOX_POSH_MEPOO_MEMORY_MANAGER_HPP
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_quota.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_size_histogram.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_settings.hpp"
 #include "iox/algorithm.hpp"
+#include "iox/atomic.hpp"
 #include "iox/bump_allocator.hpp"
 #include "iox/expected.hpp"
 #include "iox/memory.hpp"
+#include "iox/optional.hpp"
+#include "iox/relative_pointer.hpp"
 #include "iox/vector.hpp"
 
 #include <cstdint>
@@ -55,6 +60,7 @@ class MemoryManager
         NO_MEMPOOLS_AVAILABLE,
         NO_MEMPOOL_FOR_REQUESTED_CHUNK_SIZE,
         MEMPOOL_OUT_OF_CHUNKS,
+        CHUNK_QUOTA_EXCEEDED,
     };
 
     MemoryManager() noexcept = default;
@@ -70,8 +76,35 @@ class MemoryManager
 
     /// @brief Obtains a chunk from the mempools
     /// @param[in] chunkSettings for the requested chunk
+    /// @param[in] chunkQuota the chunk is accounted to; nullptr if the chunk is not subject to a quota
     /// @return a SharedChunk if successful, otherwise a MemoryManager::Error
-    expected<SharedChunk, Error> getChunk(const ChunkSettings& chunkSettings) noexcept;
+    expected<SharedChunk, Error> getChunk(const ChunkSettings& chunkSettings,
+                                          ChunkQuota* const chunkQuota = nullptr) noexcept;
+
+    /// @brief Obtains a chained message whose user-payload is split over a head chunk and continuation chunks from
+    /// the mempools; this allows user-payloads which exceed the chunk size of the largest mempool
+    /// @param[in] userPayloadSize of the whole chained message
+    /// @param[in] userPayloadAlignment of each segment of the user-payload
+    /// @param[in] chunkQuota all chunks of the message are accounted to; nullptr if they are not subject to a quota
+    /// @return the SharedChunk of the head chunk if successful, otherwise a MemoryManager::Error
+    /// @note the user-header of the head chunk is a ChainedChunkHeader; the head chunk owns the continuation chunks
+    /// and releases them when it is freed
+    expected<SharedChunk, Error> getChainedChunk(const uint64_t userPayloadSize,
+                                                 const uint32_t userPayloadAlignment,
+                                                 ChunkQuota* const chunkQuota = nullptr) noexcept;
+
+    /// @brief Acquires a ChunkQuota for a publisher which limits the chunks the publisher can hold per mempool and
+    /// reserves chunks exclusively for the publisher
+    /// @param[in] chunkQuotaSettings of the publisher
+    /// @return the ChunkQuota or nullptr if neither the settings nor the MePooConfig require one or if all
+    /// MAX_NUMBER_OF_CHUNK_QUOTAS_PER_SEGMENT chunk quotas are in use
+    /// @note if the reservation cannot be satisfied, the ChunkQuota is acquired without reservation
+    ChunkQuota* acquireChunkQuota(const ChunkQuotaSettings& chunkQuotaSettings) noexcept;
+
+    /// @brief Releases a ChunkQuota acquired with 'acquireChunkQuota'; the reserved chunks are returned to the mempool
+    /// once the chunks which are accounted to the ChunkQuota are released
+    /// @param[in] chunkQuota to release
+    static void releaseChunkQuota(ChunkQuota& chunkQuota) noexcept;
 
     /// @brief Release a chunk back to the mempools
     /// @param[in] chunkManagement Management for the chunk
@@ -81,6 +114,46 @@ class MemoryManager
 
     MemPoolInfo getMemPoolInfo(const uint32_t index) const noexcept;
 
+    /// @brief Returns the accumulated info of all overflow mempools which extend a mempool
+    /// @param[in] index of the extended mempool
+    /// @return the MemPoolInfo with the sum of the used, minimal free and total chunks of all overflow mempools
+    MemPoolInfo getOverflowMemPoolInfo(const uint32_t index) const noexcept;
+
+    /// @brief Returns the number of overflow mempools which extend a mempool
+    /// @param[in] index of the extended mempool
+    /// @return the number of overflow mempools
+    uint32_t getNumberOfOverflowMemPools(const uint32_t index) const noexcept;
+
+    /// @brief Searches for a mempool which crossed the overflow threshold of the MePooConfig and can still be
+    /// extended by an overflow mempool
+    /// @return the index of the mempool if there is one, otherwise nullopt
+    optional<uint32_t> getMemPoolIndexRequiringOverflow() const noexcept;
+
+    /// @brief Calculates the memory which is required for an overflow mempool
+    /// @param[in] index of the mempool to extend
+    /// @return the required memory size, 0 if the mempool cannot be extended
+    uint64_t requiredOverflowMemorySize(const uint32_t index) const noexcept;
+
+    /// @brief Extends a mempool by an overflow mempool with the overflow chunk count of the MePooConfig. Contrary to
+    /// the configured mempools this is possible while chunks are acquired and released concurrently. The chunks,
+    /// their chunk management and all internal data structures of the overflow mempool are placed in the memory of
+    /// the provided allocator.
+    /// @param[in] index of the mempool to extend
+    /// @param[in] overflowAllocator provides at least 'requiredOverflowMemorySize' bytes which must stay valid as
+    /// long as the MemoryManager exists
+    /// @return true if the overflow mempool was added, false if the mempool cannot be extended
+    bool addOverflowMemPool(const uint32_t index, BumpAllocator& overflowAllocator) noexcept;
+
+    /// @brief Returns the histogram of the required chunk sizes of all chunks acquired with 'getChunk'
+    /// @return the ChunkSizeHistogram of this MemoryManager
+    const ChunkSizeHistogram& getChunkSizeHistogram() const noexcept;
+
+    /// @brief Checks whether a chunk was acquired from the mempools of this MemoryManager, i.e. whether it is located
+    /// in the payload segment the MemoryManager manages
+    /// @param[in] chunkHeader of the chunk to check
+    /// @return true if the chunk belongs to one of the mempools or overflow mempools, otherwise false
+    bool containsChunk(const ChunkHeader* const chunkHeader) const noexcept;
+
     static uint64_t requiredChunkMemorySize(const MePooConfig& mePooConfig) noexcept;
     static uint64_t requiredManagementMemorySize(const MePooConfig& mePooConfig) noexcept;
     static uint64_t requiredFullMemorySize(const MePooConfig& mePooConfig) noexcept;
@@ -94,13 +167,34 @@ class MemoryManager
                     const greater_or_equal<uint64_t, MemPool::CHUNK_MEMORY_ALIGNMENT> chunkPayloadSize,
                     const greater_or_equal<uint32_t, 1> numberOfChunks) noexcept;
     void generateChunkManagementPool(BumpAllocator& managementAllocator) noexcept;
+    void* getOverflowChunk(const uint32_t index, MemPool*& memPool, MemPool*& chunkManagementPool) noexcept;
 
   private:
+    struct OverflowMemPool
+    {
+        uint32_t m_index{0U};
+        RelativePointer<MemPool> m_memPool;
+        RelativePointer<MemPool> m_chunkManagementPool;
+    };
+
     bool m_denyAddMemPool{false};
     uint32_t m_totalNumberOfChunks{0};
+    uint32_t m_overflowThresholdPercent{DEFAULT_OVERFLOW_THRESHOLD_PERCENT};
 
     vector<MemPool, MAX_NUMBER_OF_MEMPOOLS> m_memPoolVector;
     vector<MemPool, 1> m_chunkManagementPool;
+    vector<uint32_t, MAX_NUMBER_OF_MEMPOOLS> m_overflowChunkCounts;
+    vector<uint32_t, MAX_NUMBER_OF_MEMPOOLS> m_maxChunksPerPublisher;
+    bool m_hasMaxChunksPerPublisher{false};
+
+    // the overflow mempools are added concurrently to the users of the MemoryManager; an entry is only accessed after
+    // it was published by incrementing m_numberOfOverflowMemPools
+    OverflowMemPool m_overflowMemPools[MAX_NUMBER_OF_OVERFLOW_SEGMENTS_PER_SEGMENT];
+    concurrent::Atomic<uint32_t> m_numberOfOverflowMemPools{0U};
+
+    ChunkSizeHistogram m_chunkSizeHistogram;
+
+    ChunkQuota m_chunkQuotas[MAX_NUMBER_OF_CHUNK_QUOTAS_PER_SEGMENT];
 };
 
 /// @brief Converts the MemoryManager::Error to a string literal
@@ -22,11 +22,14 @@
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/atomic.hpp"
 #include "iox/bump_allocator.hpp"
 #include "iox/detail/posix_acl.hpp"
 #include "iox/filesystem.hpp"
+#include "iox/optional.hpp"
 #include "iox/posix_group.hpp"
 #include "iox/posix_shared_memory_object.hpp"
+#include "iox/vector.hpp"
 
 namespace iox
 {
@@ -36,12 +39,22 @@ template <typename SharedMemoryObjectType = PosixSharedMemoryObject, typename Me
 class MePooSegment
 {
   public:
+    /// @brief describes a shared memory segment which was created at runtime to extend a mempool of the segment
+    struct OverflowSegment
+    {
+        ShmName_t m_sharedMemoryName{""};
+        uint64_t m_segmentSize{0U};
+        uint64_t m_segmentId{0U};
+    };
+
     MePooSegment(const MePooConfig& mempoolConfig,
                  const DomainId domainId,
                  BumpAllocator& managementAllocator,
                  const PosixGroup& readerGroup,
                  const PosixGroup& writerGroup,
-                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo()) noexcept;
+                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo(),
+                 const NumaPlacement& numaPlacement = NumaPlacement(),
+                 const TrafficClass trafficClass = TrafficClass::UNSPECIFIED) noexcept;
 
     PosixGroup getWriterGroup() const noexcept;
     PosixGroup getReaderGroup() const noexcept;
@@ -52,20 +65,58 @@ class MePooSegment
 
     uint64_t getSegmentSize() const noexcept;
 
+    /// @brief Returns the NUMA placement of the segment which is also applied to its overflow segments
+    /// @return the configured NumaPlacement
+    NumaPlacement getNumaPlacement() const noexcept;
+
+    /// @brief Returns the NUMA node the first page of the segment was placed on when the segment was created
+    /// @return the NUMA node or nullopt if the platform does not support NUMA
+    optional<uint32_t> getNumaNode() const noexcept;
+
+    /// @brief Returns the traffic class by which publishers can select the segment
+    /// @return the configured TrafficClass
+    TrafficClass getTrafficClass() const noexcept;
+
+    /// @brief Creates an overflow segment for a mempool which crossed the overflow threshold of the MePooConfig. The
+    /// overflow segment gets an own segment id and is mapped by the applications when they access it the first time.
+    /// @return true if an overflow segment was created, false if none was required or the creation failed
+    bool createOverflowSegmentIfRequired() noexcept;
+
+    /// @brief Returns the number of overflow segments which were created so far
+    /// @return the number of overflow segments
+    uint32_t getNumberOfOverflowSegments() const noexcept;
+
+    /// @brief Searches for an overflow segment of this segment
+    /// @param[in] segmentId of the overflow segment
+    /// @return the OverflowSegment if one with the segment id exists, otherwise nullopt
+    optional<OverflowSegment> getOverflowSegment(const uint64_t segmentId) const noexcept;
+
   protected:
     SharedMemoryObjectType createSharedMemoryObject(const MePooConfig& mempoolConfig,
                                                     const DomainId domainId,
                                                     const PosixGroup& writerGroup) noexcept;
 
+    bool applyAccessRights(SharedMemoryObjectType& sharedMemoryObject) const noexcept;
+
   protected:
     PosixGroup m_readerGroup;
     PosixGroup m_writerGroup;
+    DomainId m_domainId;
     uint64_t m_segmentId{0};
     uint64_t m_segmentSize{0};
     iox::mepoo::MemoryInfo m_memoryInfo;
+    NumaPlacement m_numaPlacement;
+    optional<uint32_t> m_numaNode;
+    TrafficClass m_trafficClass{TrafficClass::UNSPECIFIED};
     SharedMemoryObjectType m_sharedMemoryObject;
     MemoryManagerType m_memoryManager;
 
+    // the shared memory objects are only accessed by RouDi while the OverflowSegments are read concurrently by the
+    // applications; an entry is only accessed after it was published by incrementing m_numberOfOverflowSegments
+    vector<SharedMemoryObjectType, MAX_NUMBER_OF_OVERFLOW_SEGMENTS_PER_SEGMENT> m_overflowSharedMemoryObjects;
+    OverflowSegment m_overflowSegments[MAX_NUMBER_OF_OVERFLOW_SEGMENTS_PER_SEGMENT];
+    concurrent::Atomic<uint32_t> m_numberOfOverflowSegments{0U};
+
     static constexpr access_rights SEGMENT_PERMISSIONS =
         perms::owner_read | perms::owner_write | perms::group_read | perms::group_write;
 };
@@ -27,6 +27,7 @@
 #include "iox/detail/convert.hpp"
 #include "iox/logging.hpp"
 #include "iox/relative_pointer.hpp"
+#include "iox/std_string_support.hpp"
 
 namespace iox
 {
@@ -42,31 +43,43 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
     BumpAllocator& managementAllocator,
     const PosixGroup& readerGroup,
     const PosixGroup& writerGroup,
-    const iox::mepoo::MemoryInfo& memoryInfo) noexcept
+    const iox::mepoo::MemoryInfo& memoryInfo,
+    const NumaPlacement& numaPlacement,
+    const TrafficClass trafficClass) noexcept
     : m_readerGroup(readerGroup)
     , m_writerGroup(writerGroup)
+    , m_domainId(domainId)
     , m_memoryInfo(memoryInfo)
+    , m_numaPlacement(numaPlacement)
+    , m_trafficClass(trafficClass)
     , m_sharedMemoryObject(createSharedMemoryObject(mempoolConfig, domainId, writerGroup))
+{
+    if (!applyAccessRights(m_sharedMemoryObject))
+    {
+        IOX_REPORT_FATAL(PoshError::MEPOO__SEGMENT_COULD_NOT_APPLY_POSIX_RIGHTS_TO_SHARED_MEMORY);
+    }
+
+    BumpAllocator allocator(m_sharedMemoryObject.getBaseAddress(),
+                            m_sharedMemoryObject.get_size().expect("Failed to get SHM size."));
+    m_memoryManager.configureMemoryManager(mempoolConfig, managementAllocator, allocator);
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline bool MePooSegment<SharedMemoryObjectType, MemoryManagerType>::applyAccessRights(
+    SharedMemoryObjectType& sharedMemoryObject) const noexcept
 {
     using namespace detail;
     PosixAcl acl;
-    if (!(readerGroup == writerGroup))
+    if (!(m_readerGroup == m_writerGroup))
     {
-        acl.addGroupPermission(PosixAcl::Permission::READ, readerGroup.getName());
+        acl.addGroupPermission(PosixAcl::Permission::READ, m_readerGroup.getName());
     }
-    acl.addGroupPermission(PosixAcl::Permission::READWRITE, writerGroup.getName());
+    acl.addGroupPermission(PosixAcl::Permission::READWRITE, m_writerGroup.getName());
     acl.addPermissionEntry(PosixAcl::Category::USER, PosixAcl::Permission::READWRITE);
     acl.addPermissionEntry(PosixAcl::Category::GROUP, PosixAcl::Permission::READWRITE);
     acl.addPermissionEntry(PosixAcl::Category::OTHERS, PosixAcl::Permission::NONE);
 
-    if (!acl.writePermissionsToFile(m_sharedMemoryObject.getFileHandle()))
-    {
-        IOX_REPORT_FATAL(PoshError::MEPOO__SEGMENT_COULD_NOT_APPLY_POSIX_RIGHTS_TO_SHARED_MEMORY);
-    }
-
-    BumpAllocator allocator(m_sharedMemoryObject.getBaseAddress(),
-                            m_sharedMemoryObject.get_size().expect("Failed to get SHM size."));
-    m_memoryManager.configureMemoryManager(mempoolConfig, managementAllocator, allocator);
+    return acl.writePermissionsToFile(sharedMemoryObject.getFileHandle());
 }
 
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
@@ -94,6 +107,7 @@ inline SharedMemoryObjectType MePooSegment<SharedMemoryObjectType, MemoryManager
             .accessMode(AccessMode::ReadWrite)
             .openMode(OpenMode::PurgeAndCreate)
             .permissions(SEGMENT_PERMISSIONS)
+            .numaPlacement(m_numaPlacement)
             .create()
             .and_then([this](auto& sharedMemoryObject) {
                 auto maybeSegmentId = iox::UntypedRelativePointer::registerPtr(
@@ -105,11 +119,19 @@ inline SharedMemoryObjectType MePooSegment<SharedMemoryObjectType, MemoryManager
                 }
                 this->m_segmentId = static_cast<uint64_t>(maybeSegmentId.value());
                 this->m_segmentSize = sharedMemoryObject.get_size().expect("Failed to get SHM size.");
+                this->m_numaNode = sharedMemoryObject.getNumaNode();
 
                 IOX_LOG(Debug,
                         "Roudi registered payload data segment " << iox::log::hex(sharedMemoryObject.getBaseAddress())
                                                                  << " with size " << m_segmentSize << " to id "
                                                                  << m_segmentId);
+                if (m_numaPlacement.policy != NumaPolicy::DEFAULT && m_numaNode.has_value())
+                {
+                    IOX_LOG(Info,
+                            "Applied " << asStringLiteral(m_numaPlacement.policy)
+                                       << " to the payload data segment with id " << m_segmentId
+                                       << "; its first page is on NUMA node " << m_numaNode.value());
+                }
             })
             .or_else([](auto&) { IOX_REPORT_FATAL(PoshError::MEPOO__SEGMENT_UNABLE_TO_CREATE_SHARED_MEMORY_OBJECT); })
             .value());
@@ -145,6 +167,121 @@ inline uint64_t MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getSegm
     return m_segmentSize;
 }
 
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline NumaPlacement MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getNumaPlacement() const noexcept
+{
+    return m_numaPlacement;
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline optional<uint32_t> MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getNumaNode() const noexcept
+{
+    return m_numaNode;
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline TrafficClass MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getTrafficClass() const noexcept
+{
+    return m_trafficClass;
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline bool MePooSegment<SharedMemoryObjectType, MemoryManagerType>::createOverflowSegmentIfRequired() noexcept
+{
+    const auto maybeIndex = m_memoryManager.getMemPoolIndexRequiringOverflow();
+    if (!maybeIndex.has_value())
+    {
+        return false;
+    }
+    const auto index = maybeIndex.value();
+    const auto numberOfOverflowSegments = m_numberOfOverflowSegments.load(std::memory_order_relaxed);
+
+    const std::string overflowName{into<std::string>(m_writerGroup.getName()) + "_overflow_"
+                                   + convert::toString(numberOfOverflowSegments)};
+    using PosixShmName_t = detail::PosixSharedMemory::Name_t;
+    PosixShmName_t shmName = iceoryxResourcePrefix(m_domainId, ResourceType::USER_DEFINED);
+    if (overflowName.size() > ShmName_t::capacity() || shmName.size() + overflowName.size() > PosixShmName_t::capacity())
+    {
+        IOX_LOG(Error,
+                "The overflow segment with the name '" << overflowName
+                                                       << "' would exceed the maximum allowed size when used with the '"
+                                                       << shmName << "' prefix!");
+        return false;
+    }
+    const ShmName_t overflowShmName(TruncateToCapacity, overflowName.c_str(), overflowName.size());
+    shmName.append(TruncateToCapacity, overflowShmName);
+
+    auto maybeSharedMemoryObject = typename SharedMemoryObjectType::Builder()
+                                       .name(shmName)
+                                       .memorySizeInBytes(m_memoryManager.requiredOverflowMemorySize(index))
+                                       .accessMode(AccessMode::ReadWrite)
+                                       .openMode(OpenMode::PurgeAndCreate)
+                                       .permissions(SEGMENT_PERMISSIONS)
+                                       .numaPlacement(m_numaPlacement)
+                                       .create();
+    if (maybeSharedMemoryObject.has_error())
+    {
+        IOX_LOG(Error, "Unable to create the overflow segment '" << shmName << "'!");
+        return false;
+    }
+    auto& sharedMemoryObject = maybeSharedMemoryObject.value();
+
+    if (!applyAccessRights(sharedMemoryObject))
+    {
+        IOX_LOG(Error, "Unable to apply the access rights to the overflow segment '" << shmName << "'!");
+        return false;
+    }
+
+    const auto segmentSize = sharedMemoryObject.get_size().expect("Failed to get SHM size.");
+    auto maybeSegmentId = UntypedRelativePointer::registerPtr(sharedMemoryObject.getBaseAddress(), segmentSize);
+    if (!maybeSegmentId.has_value())
+    {
+        IOX_LOG(Error, "No segment id left for the overflow segment '" << shmName << "'!");
+        return false;
+    }
+
+    auto& overflowSegment = m_overflowSegments[numberOfOverflowSegments];
+    overflowSegment.m_sharedMemoryName = overflowShmName;
+    overflowSegment.m_segmentSize = segmentSize;
+    overflowSegment.m_segmentId = static_cast<uint64_t>(maybeSegmentId.value());
+
+    // the overflow segment must be visible before the MemoryManager hands out the first chunk of it
+    m_numberOfOverflowSegments.store(numberOfOverflowSegments + 1U, std::memory_order_release);
+
+    BumpAllocator allocator(sharedMemoryObject.getBaseAddress(), segmentSize);
+    m_overflowSharedMemoryObjects.emplace_back(std::move(sharedMemoryObject));
+    if (!m_memoryManager.addOverflowMemPool(index, allocator))
+    {
+        return false;
+    }
+
+    IOX_LOG(Info,
+            "Created overflow segment '" << shmName << "' with id " << overflowSegment.m_segmentId << " and size "
+                                         << segmentSize << " for the mempool with index " << index);
+    return true;
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline uint32_t MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getNumberOfOverflowSegments() const noexcept
+{
+    return m_numberOfOverflowSegments.load(std::memory_order_acquire);
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline optional<typename MePooSegment<SharedMemoryObjectType, MemoryManagerType>::OverflowSegment>
+MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getOverflowSegment(const uint64_t segmentId) const noexcept
+{
+    const auto numberOfOverflowSegments = m_numberOfOverflowSegments.load(std::memory_order_acquire);
+    for (uint32_t i = 0U; i < numberOfOverflowSegments; ++i)
+    {
+        if (m_overflowSegments[i].m_segmentId == segmentId)
+        {
+            return m_overflowSegments[i];
+        }
+    }
+    return nullopt;
+}
+
 } // namespace mepoo
 } // namespace iox
 
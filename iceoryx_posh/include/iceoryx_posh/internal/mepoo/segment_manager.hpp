@@ -86,7 +86,28 @@ class SegmentManager
     using SegmentMappingContainer = vector<SegmentMapping, MAX_SHM_SEGMENTS>;
 
     SegmentMappingContainer getSegmentMappings(const PosixUser& user) noexcept;
-    SegmentUserInformation getSegmentInformationWithWriteAccessForUser(const PosixUser& user) noexcept;
+
+    /// @brief Selects the writable segment from which the ports of a user allocate their chunks
+    /// @param[in] user which wants to write to the segment
+    /// @param[in] segmentName of the segment, i.e. the name of its writer group; an empty name selects the segment by
+    /// the traffic class
+    /// @param[in] trafficClass of the segment; if none of the writable segments of the user has it, the first writable
+    /// segment is selected
+    /// @return the SegmentUserInformation of the selected segment, without a memory manager if there is none
+    SegmentUserInformation
+    getSegmentInformationWithWriteAccessForUser(const PosixUser& user,
+                                                const SegmentName_t& segmentName = SegmentName_t(),
+                                                const TrafficClass trafficClass = TrafficClass::UNSPECIFIED) noexcept;
+
+    /// @brief Searches for an overflow segment which was created at runtime and which the user has access to
+    /// @param[in] user which wants to map the overflow segment
+    /// @param[in] segmentId of the overflow segment
+    /// @return the SegmentMapping of the overflow segment, nullopt if it does not exist or the user has no access
+    optional<SegmentMapping> getOverflowSegmentMapping(const PosixUser& user, const uint64_t segmentId) noexcept;
+
+    /// @brief Creates the overflow segments for all mempools which crossed their overflow threshold
+    /// @note this is called cyclically by RouDi
+    void createOverflowSegmentsIfRequired() noexcept;
 
     static uint64_t requiredManagementMemorySize(const SegmentConfig& config) noexcept;
     static uint64_t requiredChunkMemorySize(const SegmentConfig& config) noexcept;
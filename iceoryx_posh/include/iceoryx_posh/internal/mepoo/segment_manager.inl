@@ -23,6 +23,8 @@
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iox/assertions.hpp"
 
+#include <algorithm>
+
 namespace iox
 {
 namespace mepoo
@@ -58,7 +60,9 @@ inline void SegmentManager<SegmentType>::createSegment(const SegmentConfig::Segm
                                     *m_managementAllocator,
                                     readerGroup,
                                     writerGroup,
-                                    segmentEntry.m_memoryInfo);
+                                    segmentEntry.m_memoryInfo,
+                                    segmentEntry.m_numaPlacement,
+                                    segmentEntry.m_trafficClass);
 }
 
 template <typename SegmentType>
@@ -69,28 +73,17 @@ SegmentManager<SegmentType>::getSegmentMappings(const PosixUser& user) noexcept
     auto groupContainer = user.getGroups();
 
     SegmentManager::SegmentMappingContainer mappingContainer;
-    bool foundInWriterGroup = false;
 
-    // with the groups we can get all the segments (read or write) for the user
+    // with the groups we can get all the segments (read or write) for the user; a user in several writer groups can
+    // write to several segments and each of its publishers selects one of them
     for (const auto& groupID : groupContainer)
     {
         for (const auto& segment : m_segmentContainer)
         {
             if (segment.getWriterGroup() == groupID)
             {
-                // a user is allowed to be only in one writer group, as we currently only support one memory manager per
-                // process
-                if (!foundInWriterGroup)
-                {
-                    mappingContainer.emplace_back(
-                        segment.getWriterGroup().getName(), segment.getSegmentSize(), true, segment.getSegmentId());
-                    foundInWriterGroup = true;
-                }
-                else
-                {
-                    IOX_REPORT_FATAL(PoshError::MEPOO__USER_WITH_MORE_THAN_ONE_WRITE_SEGMENT);
-                    return SegmentManager::SegmentMappingContainer();
-                }
+                mappingContainer.emplace_back(
+                    segment.getWriterGroup().getName(), segment.getSegmentSize(), true, segment.getSegmentId());
             }
         }
     }
@@ -116,29 +109,111 @@ SegmentManager<SegmentType>::getSegmentMappings(const PosixUser& user) noexcept
 
 template <typename SegmentType>
 inline typename SegmentManager<SegmentType>::SegmentUserInformation
-SegmentManager<SegmentType>::getSegmentInformationWithWriteAccessForUser(const PosixUser& user) noexcept
+SegmentManager<SegmentType>::getSegmentInformationWithWriteAccessForUser(const PosixUser& user,
+                                                                         const SegmentName_t& segmentName,
+                                                                         const TrafficClass trafficClass) noexcept
 {
     auto groupContainer = user.getGroups();
 
-    SegmentUserInformation segmentInfo{nullopt_t(), 0u};
+    SegmentType* firstWritableSegment{nullptr};
+    SegmentType* selectedSegment{nullptr};
 
-    // with the groups we can search for the writable segment of this user
-    for (const auto& groupID : groupContainer)
+    // with the groups we can search for the writable segments of this user
+    for (auto& segment : m_segmentContainer)
     {
-        for (auto& segment : m_segmentContainer)
+        const bool isWritable =
+            std::any_of(groupContainer.begin(), groupContainer.end(), [&](const PosixGroup& groupID) {
+                return segment.getWriterGroup() == groupID;
+            });
+        if (!isWritable)
         {
-            if (segment.getWriterGroup() == groupID)
+            continue;
+        }
+
+        if (!segmentName.empty())
+        {
+            if (segment.getWriterGroup().getName() == segmentName)
             {
-                segmentInfo.m_memoryManager = segment.getMemoryManager();
-                segmentInfo.m_segmentID = segment.getSegmentId();
-                return segmentInfo;
+                selectedSegment = &segment;
+                break;
             }
+            continue;
+        }
+
+        if (firstWritableSegment == nullptr)
+        {
+            firstWritableSegment = &segment;
         }
+        if (trafficClass == TrafficClass::UNSPECIFIED || segment.getTrafficClass() == trafficClass)
+        {
+            selectedSegment = &segment;
+            break;
+        }
+    }
+
+    if (selectedSegment == nullptr && segmentName.empty() && firstWritableSegment != nullptr)
+    {
+        IOX_LOG(Debug,
+                "No writable segment with " << trafficClass << " found, falling back to the segment with id "
+                                            << firstWritableSegment->getSegmentId());
+        selectedSegment = firstWritableSegment;
+    }
+
+    SegmentUserInformation segmentInfo{nullopt_t(), 0u};
+    if (selectedSegment != nullptr)
+    {
+        segmentInfo.m_memoryManager = selectedSegment->getMemoryManager();
+        segmentInfo.m_segmentID = selectedSegment->getSegmentId();
     }
 
     return segmentInfo;
 }
 
+template <typename SegmentType>
+inline optional<typename SegmentManager<SegmentType>::SegmentMapping>
+SegmentManager<SegmentType>::getOverflowSegmentMapping(const PosixUser& user, const uint64_t segmentId) noexcept
+{
+    auto groupContainer = user.getGroups();
+
+    for (const auto& segment : m_segmentContainer)
+    {
+        auto overflowSegment = segment.getOverflowSegment(segmentId);
+        if (!overflowSegment.has_value())
+        {
+            continue;
+        }
+
+        bool isReader{false};
+        bool isWriter{false};
+        for (const auto& groupID : groupContainer)
+        {
+            isReader |= (segment.getReaderGroup() == groupID);
+            isWriter |= (segment.getWriterGroup() == groupID);
+        }
+
+        if (!isReader && !isWriter)
+        {
+            return nullopt;
+        }
+
+        return SegmentMapping(overflowSegment->m_sharedMemoryName,
+                              overflowSegment->m_segmentSize,
+                              isWriter,
+                              overflowSegment->m_segmentId);
+    }
+
+    return nullopt;
+}
+
+template <typename SegmentType>
+inline void SegmentManager<SegmentType>::createOverflowSegmentsIfRequired() noexcept
+{
+    for (auto& segment : m_segmentContainer)
+    {
+        IOX_DISCARD_RESULT(segment.createOverflowSegmentIfRequired());
+    }
+}
+
 template <typename SegmentType>
 uint64_t SegmentManager<SegmentType>::requiredManagementMemorySize(const SegmentConfig& config) noexcept
 {
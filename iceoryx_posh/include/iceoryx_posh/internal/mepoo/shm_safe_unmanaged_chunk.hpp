@@ -41,6 +41,13 @@ class ShmSafeUnmanagedChunk
     /// @brief Creates a SharedChunk with incrementing the chunk reference counter and does not invalidate itself
     SharedChunk cloneToSharedChunk() noexcept;
 
+    /// @brief Creates a SharedChunk with incrementing the chunk reference counter but only if the reference counter is
+    /// not already zero, i.e. the chunk was not yet released by its last owner. Does not invalidate itself.
+    /// @return the SharedChunk if the reference could be acquired, an empty SharedChunk otherwise
+    /// @note This is intended for readers which might race with the last owner of the chunk. The caller must verify
+    /// afterwards that the chunk is still the one it was looking for since the chunk might have been recycled.
+    SharedChunk tryCloneToSharedChunk() noexcept;
+
     /// @brief Checks if the underlying RelativePointerData to the chunk is logically a nullptr
     /// @return true if logically a nullptr otherwise false
     bool isLogicalNullptr() const noexcept;
@@ -59,6 +66,14 @@ class ShmSafeUnmanagedChunk
     /// @return true if neither logically a nullptr nor other owner chunk owners present, otherwise false
     bool isNotLogicalNullptrAndHasNoOtherOwners() const noexcept;
 
+    /// @brief Checks if both objects refer to the same chunk
+    /// @return true if both refer to the same chunk or are both logically a nullptr, otherwise false
+    bool operator==(const ShmSafeUnmanagedChunk& rhs) const noexcept;
+
+    /// @brief Checks if both objects refer to different chunks
+    /// @return true if both refer to different chunks, otherwise false
+    bool operator!=(const ShmSafeUnmanagedChunk& rhs) const noexcept;
+
   private:
     RelativePointerData m_chunkManagement;
 };
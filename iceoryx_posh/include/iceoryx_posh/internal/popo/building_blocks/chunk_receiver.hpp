@@ -22,6 +22,7 @@
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iox/expected.hpp"
 #include "iox/not_null.hpp"
+#include "iox/optional.hpp"
 
 namespace iox
 {
@@ -78,10 +79,22 @@ class ChunkReceiver : public ChunkQueuePopper<typename ChunkReceiverDataType::Ch
     /// or if there are no new chunks in the underlying queue
     expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGet() noexcept;
 
+    /// @brief Takes over a chunk which was not received via the queue, e.g. the latest chunk of a publisher. Like with
+    /// tryGet, the ownership of the SharedChunk remains in the ChunkReceiver and the chunk must be released with release
+    /// @param[in] chunk to take over
+    /// @return chunk header of the chunk, ChunkReceiveResult on error
+    expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryTakeOver(mepoo::SharedChunk chunk) noexcept;
+
     /// @brief Release a chunk that was obtained with get
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void release(const mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Hands over a chunk that was obtained with get to the caller, e.g. to reuse it for sending. This is the
+    /// counterpart of tryTakeOver, the ChunkReceiver does not own the chunk afterwards
+    /// @param[in] chunkHeader, pointer to the ChunkHeader to hand over
+    /// @return the SharedChunk of the chunk or nullopt if the chunk was not obtained from this ChunkReceiver
+    optional<mepoo::SharedChunk> handOver(const mepoo::ChunkHeader* const chunkHeader) noexcept;
+
     /// @brief Release all the chunks that are currently held. Caution: Only call this if the user process is no more
     /// running E.g. This cleans up chunks that were held by a user process that died unexpectetly, for avoiding lost
     /// chunks in the system
@@ -76,23 +76,28 @@ inline expected<const mepoo::ChunkHeader*, ChunkReceiveResult> ChunkReceiver<Chu
 
     if (popRet.has_value())
     {
-        auto sharedChunk = *popRet;
-
-        // if the application holds too many chunks, don't provide more
-        if (getMembers()->m_chunksInUse.insert(sharedChunk))
-        {
-            return ok(const_cast<const mepoo::ChunkHeader*>(sharedChunk.getChunkHeader()));
-        }
-        else
-        {
-            // release the chunk
-            sharedChunk = nullptr;
-            return err(ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
-        }
+        return tryTakeOver(*popRet);
     }
     return err(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
 }
 
+template <typename ChunkReceiverDataType>
+inline expected<const mepoo::ChunkHeader*, ChunkReceiveResult>
+ChunkReceiver<ChunkReceiverDataType>::tryTakeOver(mepoo::SharedChunk chunk) noexcept
+{
+    // if the application holds too many chunks, don't provide more
+    if (getMembers()->m_chunksInUse.insert(chunk))
+    {
+        return ok(const_cast<const mepoo::ChunkHeader*>(chunk.getChunkHeader()));
+    }
+    else
+    {
+        // release the chunk
+        chunk = nullptr;
+        return err(ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
+    }
+}
+
 template <typename ChunkReceiverDataType>
 inline void ChunkReceiver<ChunkReceiverDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
@@ -104,6 +109,19 @@ inline void ChunkReceiver<ChunkReceiverDataType>::release(const mepoo::ChunkHead
     }
 }
 
+template <typename ChunkReceiverDataType>
+inline optional<mepoo::SharedChunk>
+ChunkReceiver<ChunkReceiverDataType>::handOver(const mepoo::ChunkHeader* const chunkHeader) noexcept
+{
+    mepoo::SharedChunk chunk(nullptr);
+    if (!getMembers()->m_chunksInUse.remove(chunkHeader, chunk))
+    {
+        IOX_REPORT(PoshError::POPO__CHUNK_RECEIVER_INVALID_CHUNK_TO_RELEASE_FROM_USER, iox::er::RUNTIME_ERROR);
+        return nullopt;
+    }
+    return chunk;
+}
+
 template <typename ChunkReceiverDataType>
 inline void ChunkReceiver<ChunkReceiverDataType>::releaseAll() noexcept
 {
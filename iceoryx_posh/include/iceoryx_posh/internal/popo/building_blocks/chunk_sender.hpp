@@ -41,6 +41,7 @@ enum class AllocationError
     TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL,
     INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER,
     INVALID_PARAMETER_FOR_REQUEST_HEADER,
+    CHUNK_QUOTA_EXCEEDED,
 };
 } // namespace popo
 
@@ -104,6 +105,28 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
                                                                const uint32_t userHeaderSize,
                                                                const uint32_t userHeaderAlignment) noexcept;
 
+    /// @brief allocate a chained message whose user-payload may exceed the chunk size of the largest mempool; like
+    /// with 'tryAllocate' the ownership remains in the ChunkSender
+    /// @param[in] originId, the unique id of the entity which requested this allocate
+    /// @param[in] userPayloadSize, size of the user-payload of the whole chained message
+    /// @param[in] userPayloadAlignment, alignment of each segment of the user-payload
+    /// @return on success pointer to the ChunkHeader of the head chunk, error if not
+    expected<mepoo::ChunkHeader*, AllocationError> tryAllocateChained(const UniquePortId originId,
+                                                                      const uint64_t userPayloadSize,
+                                                                      const uint32_t userPayloadAlignment) noexcept;
+
+    /// @brief Reuses a chunk which is owned by the caller, e.g. a received chunk, for a new user-payload instead of
+    /// allocating a new one; like with 'tryAllocate' the ownership of the reused chunk remains in the ChunkSender
+    /// @param[in] originId, the unique id of the entity which requested this allocate
+    /// @param[in] chunk to reuse; it is only reused if it was acquired from the mempools of this ChunkSender, i.e.
+    /// the ChunkSender has write access, if it is not the head of a chained message and if the new user-payload fits
+    /// @param[in] chunkSettings of the new user-payload and user-header
+    /// @return on success pointer to the ChunkHeader of the reused chunk, nullopt if the chunk cannot be reused
+    /// @note the user-header and user-payload of the chunk are overwritten
+    optional<mepoo::ChunkHeader*> tryReuse(const UniquePortId originId,
+                                           const mepoo::SharedChunk& chunk,
+                                           const mepoo::ChunkSettings& chunkSettings) noexcept;
+
     /// @brief Release an allocated chunk without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void release(const mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -138,6 +161,18 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// chunks in the system
     void releaseAll() noexcept;
 
+    /// @brief Registers a reader which acquires the latest chunk directly from the slot of the ChunkSender instead of
+    /// receiving the chunks via a queue. As long as there are such readers, every sent chunk is stored in the slot.
+    /// @return reference to the slot which holds the latest chunk
+    /// @note The slot is filled with the next chunk which is sent after the reader was registered
+    mepoo::LatestChunkSlot& addLatestValueReader() noexcept;
+
+    /// @brief Unregisters a reader which was registered with addLatestValueReader
+    void removeLatestValueReader() noexcept;
+
+    /// @brief Unregisters all readers which were registered with addLatestValueReader
+    void removeAllLatestValueReaders() noexcept;
+
   private:
     /// @brief Get the SharedChunk from the provided ChunkHeader and do all that is required to send the chunk
     /// @param[in] chunkHeader of the chunk that shall be send
@@ -145,6 +180,10 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// @return true if there was a matching chunk with this header, false if not
     bool getChunkReadyForSend(const mepoo::ChunkHeader* const chunkHeader, mepoo::SharedChunk& chunk) noexcept;
 
+    /// @brief Stores the chunk in the latest chunk slot if there are latest value readers or clears the slot if not
+    /// @param[in] chunk which was sent last
+    void updateLatestChunk(const mepoo::SharedChunk& chunk) noexcept;
+
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 };
@@ -36,6 +36,8 @@ from<mepoo::MemoryManager::Error, popo::AllocationError>(const mepoo::MemoryMana
         return popo::AllocationError::NO_MEMPOOLS_AVAILABLE;
     case mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS:
         return popo::AllocationError::RUNNING_OUT_OF_CHUNKS;
+    case mepoo::MemoryManager::Error::CHUNK_QUOTA_EXCEEDED:
+        return popo::AllocationError::CHUNK_QUOTA_EXCEEDED;
     }
     return popo::AllocationError::UNDEFINED_ERROR;
 }
@@ -58,6 +60,8 @@ inline constexpr const char* asStringLiteral(const AllocationError value) noexce
         return "AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER";
     case AllocationError::INVALID_PARAMETER_FOR_REQUEST_HEADER:
         return "AllocationError::INVALID_PARAMETER_FOR_REQUEST_HEADER";
+    case AllocationError::CHUNK_QUOTA_EXCEEDED:
+        return "AllocationError::CHUNK_QUOTA_EXCEEDED";
     }
 
     return "[Undefined AllocationError]";
@@ -106,6 +110,7 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     //   - there is a valid chunk
     //   - there is no other owner
     //   - the new user-payload still fits in it
+    //   - it is not the head of a chained message which would lose its continuation chunks
     const auto chunkSettingsResult =
         mepoo::ChunkSettings::create(userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
     if (chunkSettingsResult.has_error())
@@ -119,6 +124,11 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     auto& lastChunkUnmanaged = getMembers()->m_lastChunkUnmanaged;
     mepoo::ChunkHeader* lastChunkChunkHeader =
         lastChunkUnmanaged.isNotLogicalNullptrAndHasNoOtherOwners() ? lastChunkUnmanaged.getChunkHeader() : nullptr;
+    if (lastChunkChunkHeader
+        && lastChunkChunkHeader->userHeaderId() == mepoo::ChunkHeader::CHAINED_CHUNK_USER_HEADER)
+    {
+        lastChunkChunkHeader = nullptr;
+    }
 
     if (lastChunkChunkHeader && (lastChunkChunkHeader->chunkSize() >= requiredChunkSize))
     {
@@ -140,7 +150,7 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     {
         // BEGIN of critical section, chunk will be lost if the process terminates in this section
         // get a new chunk
-        auto getChunkResult = getMembers()->m_memoryMgr->getChunk(chunkSettings);
+        auto getChunkResult = getMembers()->m_memoryMgr->getChunk(chunkSettings, getMembers()->m_chunkQuota.get());
 
         if (getChunkResult.has_error())
         {
@@ -166,6 +176,70 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     }
 }
 
+template <typename ChunkSenderDataType>
+inline expected<mepoo::ChunkHeader*, AllocationError> ChunkSender<ChunkSenderDataType>::tryAllocateChained(
+    const UniquePortId originId, const uint64_t userPayloadSize, const uint32_t userPayloadAlignment) noexcept
+{
+    if (mepoo::ChunkSettings::create(0U, userPayloadAlignment, 0U, 1U).has_error())
+    {
+        return err(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
+    }
+
+    // BEGIN of critical section, chunks will be lost if the process terminates in this section
+    auto getChunkResult = getMembers()->m_memoryMgr->getChainedChunk(
+        userPayloadSize, userPayloadAlignment, getMembers()->m_chunkQuota.get());
+
+    if (getChunkResult.has_error())
+    {
+        return err(into<AllocationError>(getChunkResult.error()));
+    }
+
+    auto& chunk = getChunkResult.value();
+
+    if (getMembers()->m_chunksInUse.insert(chunk))
+    {
+        // END of critical section
+        chunk.getChunkHeader()->setOriginId(originId);
+        return ok(chunk.getChunkHeader());
+    }
+    else
+    {
+        // release the allocated head chunk and with it the continuation chunks
+        chunk = nullptr;
+        return err(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
+    }
+}
+
+template <typename ChunkSenderDataType>
+inline optional<mepoo::ChunkHeader*>
+ChunkSender<ChunkSenderDataType>::tryReuse(const UniquePortId originId,
+                                           const mepoo::SharedChunk& chunk,
+                                           const mepoo::ChunkSettings& chunkSettings) noexcept
+{
+    // reuse the chunk only if:
+    //   - it is located in the payload segment this ChunkSender writes to
+    //   - it is not the head of a chained message which would lose its continuation chunks
+    //   - the new user-payload still fits in it
+    auto* chunkHeader = chunk.getChunkHeader();
+    if (chunkHeader == nullptr || !getMembers()->m_memoryMgr->containsChunk(chunkHeader)
+        || chunkHeader->userHeaderId() == mepoo::ChunkHeader::CHAINED_CHUNK_USER_HEADER
+        || chunkHeader->chunkSize() < chunkSettings.requiredChunkSize())
+    {
+        return nullopt;
+    }
+
+    if (!getMembers()->m_chunksInUse.insert(chunk))
+    {
+        return nullopt;
+    }
+
+    auto chunkSize = chunkHeader->chunkSize();
+    chunkHeader->~ChunkHeader();
+    new (chunkHeader) mepoo::ChunkHeader(chunkSize, chunkSettings);
+    chunkHeader->setOriginId(originId);
+    return chunkHeader;
+}
+
 template <typename ChunkSenderDataType>
 inline void ChunkSender<ChunkSenderDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
@@ -186,6 +260,7 @@ inline uint64_t ChunkSender<ChunkSenderDataType>::send(mepoo::ChunkHeader* const
     if (getChunkReadyForSend(chunkHeader, chunk))
     {
         numberOfReceiverTheChunkWasDelivered = this->deliverToAllStoredQueues(chunk);
+        updateLatestChunk(chunk);
 
         getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
         getMembers()->m_lastChunkUnmanaged = chunk;
@@ -224,6 +299,7 @@ inline void ChunkSender<ChunkSenderDataType>::pushToHistory(mepoo::ChunkHeader*
     if (getChunkReadyForSend(chunkHeader, chunk))
     {
         this->addToHistoryWithoutDelivery(chunk);
+        updateLatestChunk(chunk);
 
         getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
         getMembers()->m_lastChunkUnmanaged = chunk;
@@ -250,6 +326,33 @@ inline void ChunkSender<ChunkSenderDataType>::releaseAll() noexcept
     getMembers()->m_chunksInUse.cleanup();
     this->cleanup();
     getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+    getMembers()->m_latestChunk.clear();
+}
+
+template <typename ChunkSenderDataType>
+inline mepoo::LatestChunkSlot& ChunkSender<ChunkSenderDataType>::addLatestValueReader() noexcept
+{
+    getMembers()->m_latestValueReaderCount.fetch_add(1U, std::memory_order_relaxed);
+    return getMembers()->m_latestChunk;
+}
+
+template <typename ChunkSenderDataType>
+inline void ChunkSender<ChunkSenderDataType>::removeLatestValueReader() noexcept
+{
+    auto& readerCount = getMembers()->m_latestValueReaderCount;
+    auto currentReaderCount = readerCount.load(std::memory_order_relaxed);
+    // the readers might already be removed with removeAllLatestValueReaders
+    while (currentReaderCount > 0U
+           && !readerCount.compare_exchange_weak(
+               currentReaderCount, currentReaderCount - 1U, std::memory_order_relaxed, std::memory_order_relaxed))
+    {
+    }
+}
+
+template <typename ChunkSenderDataType>
+inline void ChunkSender<ChunkSenderDataType>::removeAllLatestValueReaders() noexcept
+{
+    getMembers()->m_latestValueReaderCount.store(0U, std::memory_order_relaxed);
 }
 
 template <typename ChunkSenderDataType>
@@ -268,6 +371,22 @@ inline bool ChunkSender<ChunkSenderDataType>::getChunkReadyForSend(const mepoo::
     }
 }
 
+template <typename ChunkSenderDataType>
+inline void ChunkSender<ChunkSenderDataType>::updateLatestChunk(const mepoo::SharedChunk& chunk) noexcept
+{
+    auto& latestChunk = getMembers()->m_latestChunk;
+    if (getMembers()->m_latestValueReaderCount.load(std::memory_order_relaxed) > 0U)
+    {
+        // the reference held by the slot also prevents the in-place reuse of the last chunk in tryAllocate, which
+        // would otherwise overwrite a chunk the readers might acquire
+        latestChunk.store(chunk);
+    }
+    else if (!latestChunk.isEmpty())
+    {
+        latestChunk.clear();
+    }
+}
+
 } // namespace popo
 } // namespace iox
 
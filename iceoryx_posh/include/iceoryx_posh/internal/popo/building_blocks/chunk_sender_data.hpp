@@ -18,12 +18,15 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_SENDER_DATA_HPP
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/latest_chunk_slot.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
 #include "iceoryx_posh/internal/popo/used_chunk_list.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
+#include "iox/atomic.hpp"
 #include "iox/not_null.hpp"
+#include "iox/optional.hpp"
 #include "iox/relative_pointer.hpp"
 
 namespace iox
@@ -36,7 +39,14 @@ struct ChunkSenderData : public ChunkDistributorDataType
     explicit ChunkSenderData(not_null<mepoo::MemoryManager* const> memoryManager,
                              const ConsumerTooSlowPolicy consumerTooSlowPolicy,
                              const uint64_t historyCapacity = 0U,
-                             const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
+                             const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo(),
+                             const optional<mepoo::ChunkQuotaSettings>& chunkQuotaSettings = nullopt) noexcept;
+
+    ChunkSenderData(const ChunkSenderData&) = delete;
+    ChunkSenderData(ChunkSenderData&&) = delete;
+    ChunkSenderData& operator=(const ChunkSenderData&) = delete;
+    ChunkSenderData& operator=(ChunkSenderData&&) = delete;
+    ~ChunkSenderData() noexcept;
 
     using ChunkDistributorData_t = ChunkDistributorDataType;
 
@@ -45,6 +55,9 @@ struct ChunkSenderData : public ChunkDistributorDataType
     UsedChunkList<MaxChunksAllocatedSimultaneously> m_chunksInUse;
     mepoo::SequenceNumber_t m_sequenceNumber{0U};
     mepoo::ShmSafeUnmanagedChunk m_lastChunkUnmanaged;
+    mepoo::LatestChunkSlot m_latestChunk;
+    concurrent::Atomic<uint64_t> m_latestValueReaderCount{0U};
+    RelativePointer<mepoo::ChunkQuota> m_chunkQuota;
 };
 
 } // namespace popo
@@ -26,11 +26,26 @@ inline ChunkSenderData<MaxChunksAllocatedSimultaneously, ChunkDistributorDataTyp
     not_null<mepoo::MemoryManager* const> memoryManager,
     const ConsumerTooSlowPolicy consumerTooSlowPolicy,
     const uint64_t historyCapacity,
-    const mepoo::MemoryInfo& memoryInfo) noexcept
+    const mepoo::MemoryInfo& memoryInfo,
+    const optional<mepoo::ChunkQuotaSettings>& chunkQuotaSettings) noexcept
     : ChunkDistributorDataType(consumerTooSlowPolicy, historyCapacity)
     , m_memoryMgr(memoryManager)
     , m_memoryInfo(memoryInfo)
 {
+    if (chunkQuotaSettings.has_value())
+    {
+        m_chunkQuota = m_memoryMgr->acquireChunkQuota(chunkQuotaSettings.value());
+    }
+}
+
+template <uint32_t MaxChunksAllocatedSimultaneously, typename ChunkDistributorDataType>
+inline ChunkSenderData<MaxChunksAllocatedSimultaneously, ChunkDistributorDataType>::~ChunkSenderData() noexcept
+{
+    // the chunks which are still in use keep the chunk quota alive until they are released
+    if (m_chunkQuota)
+    {
+        mepoo::MemoryManager::releaseChunkQuota(*m_chunkQuota.get());
+    }
 }
 
 } // namespace popo
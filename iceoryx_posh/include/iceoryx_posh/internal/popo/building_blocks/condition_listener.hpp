@@ -18,7 +18,9 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CONDITION_LISTENER_HPP
 
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/timer_queue.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
+#include "iceoryx_posh/popo/wait_strategy.hpp"
 #include "iox/algorithm.hpp"
 #include "iox/atomic.hpp"
 
@@ -32,7 +34,10 @@ class ConditionListener
   public:
     using NotificationVector_t = vector<BestFittingType_t<MAX_NUMBER_OF_NOTIFIERS>, MAX_NUMBER_OF_NOTIFIERS>;
 
-    explicit ConditionListener(ConditionVariableData& condVarData) noexcept;
+    /// @brief Creates a ConditionListener
+    /// @param[in] condVarData the condition variable to wait on
+    /// @param[in] waitStrategy defines whether the notification flags are polled before wait() and timedWait() block
+    explicit ConditionListener(ConditionVariableData& condVarData, const WaitStrategy& waitStrategy = {}) noexcept;
     ~ConditionListener() noexcept = default;
     ConditionListener(const ConditionListener& rhs) = delete;
     ConditionListener(ConditionListener&& rhs) noexcept = delete;
@@ -65,6 +70,23 @@ class ConditionListener
     /// @return a sorted vector of active notifications
     NotificationVector_t timedWait(const units::Duration& timeToWait) noexcept;
 
+    /// @brief Starts the timer of the notification with the given index. When the timer expires the notification is
+    ///        activated like it is done by a ConditionNotifier. A thread which waits in wait() or timedWait() is
+    ///        woken up to take the new deadline into account. A running timer is restarted.
+    /// @param[in] index the index of the notification
+    /// @param[in] period the time between two expirations, or until the expiration of a one shot timer
+    /// @param[in] mode defines whether the timer expires once or periodically
+    void startTimer(const uint64_t index, const units::Duration period, const TimerMode mode) noexcept;
+
+    /// @brief Stops the timer of the notification with the given index
+    /// @param[in] index the index of the notification
+    void stopTimer(const uint64_t index) noexcept;
+
+    /// @brief Checks whether the timer of the notification with the given index is running
+    /// @param[in] index the index of the notification
+    /// @return true if the timer is running, otherwise false
+    bool isTimerRunning(const uint64_t index) const noexcept;
+
   protected:
     const ConditionVariableData* getMembers() volatile const noexcept;
     ConditionVariableData* getMembers() volatile noexcept;
@@ -73,10 +95,13 @@ class ConditionListener
     void resetUnchecked(const uint64_t index) noexcept;
     void resetSemaphore() noexcept;
 
-    NotificationVector_t waitImpl(const function_ref<bool()> waitCall) noexcept;
+    NotificationVector_t waitImpl(const function_ref<bool()> waitCall, const units::Duration spinDuration) noexcept;
+    void spin(const units::Duration spinDuration) noexcept;
 
   private:
     ConditionVariableData* m_condVarDataPtr{nullptr};
+    WaitStrategy m_waitStrategy;
+    TimerQueue m_timerQueue;
     concurrent::Atomic<bool> m_toBeDestroyed{false};
 };
 
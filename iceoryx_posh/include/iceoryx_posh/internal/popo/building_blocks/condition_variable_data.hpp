@@ -44,6 +44,8 @@ struct ConditionVariableData
     concurrent::Atomic<bool> m_toBeDestroyed{false};
     concurrent::Atomic<bool> m_activeNotifications[MAX_NUMBER_OF_NOTIFIERS];
     concurrent::Atomic<bool> m_wasNotified{false};
+    /// @brief set while the ConditionListener polls the notification flags, the notifiers skip the semaphore post
+    concurrent::Atomic<bool> m_isSpinning{false};
 };
 
 } // namespace popo
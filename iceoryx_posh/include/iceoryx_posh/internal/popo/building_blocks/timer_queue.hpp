@@ -0,0 +1,112 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_TIMER_QUEUE_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_TIMER_QUEUE_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iox/duration.hpp"
+#include "iox/function_ref.hpp"
+#include "iox/optional.hpp"
+
+#include <cstdint>
+#include <mutex>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Defines whether a timer expires once or periodically
+enum class TimerMode : uint8_t
+{
+    ONE_SHOT,
+    PERIODIC
+};
+
+/// @brief The TimerQueue stores the deadlines of the timers which are attached to a WaitSet or Listener. The index of
+///        a timer is the index of its notification in the ConditionVariableData. The running timers are ordered by
+///        their deadline in a binary min-heap, therefore the next expiration is found in constant time and starting,
+///        stopping and expiring a timer is done in logarithmic time.
+/// @note The TimerQueue is process local and thread-safe.
+class TimerQueue
+{
+  public:
+    static constexpr uint64_t CAPACITY = MAX_NUMBER_OF_NOTIFIERS;
+
+    TimerQueue() noexcept = default;
+    ~TimerQueue() noexcept = default;
+    TimerQueue(const TimerQueue&) = delete;
+    TimerQueue(TimerQueue&&) = delete;
+    TimerQueue& operator=(const TimerQueue&) = delete;
+    TimerQueue& operator=(TimerQueue&&) = delete;
+
+    /// @brief Starts the timer with the given index. The first expiration is one period after the call. If the timer
+    ///        is already running it is restarted.
+    /// @param[in] index the index of the timer, must be smaller than CAPACITY
+    /// @param[in] period the time between two expirations, or until the expiration of a one shot timer
+    /// @param[in] mode defines whether the timer expires once or periodically
+    void start(const uint64_t index, const units::Duration period, const TimerMode mode) noexcept;
+
+    /// @brief Stops the timer with the given index, does nothing if it is not running
+    /// @param[in] index the index of the timer
+    void stop(const uint64_t index) noexcept;
+
+    /// @brief Checks whether the timer with the given index is running
+    /// @param[in] index the index of the timer
+    /// @return true if the timer is running, otherwise false
+    bool isRunning(const uint64_t index) const noexcept;
+
+    /// @brief Returns the time until the next timer expires
+    /// @return the time until the next expiration or nullopt if no timer is running
+    optional<units::Duration> timeUntilNextExpiration() const noexcept;
+
+    /// @brief Calls onExpiration with the index of every expired timer. A periodic timer is restarted with a deadline
+    ///        one period after the previous one, so it does not drift. When the deadlines of several periods have
+    ///        passed, the timer expires once and the missed deadlines are skipped. A one shot timer is stopped.
+    /// @param[in] onExpiration is called with the index of each expired timer while the queue is locked
+    void expire(const function_ref<void(uint64_t)> onExpiration) noexcept;
+
+  private:
+    struct Timer_t
+    {
+        uint64_t deadline{0U};
+        uint64_t period{0U};
+        uint64_t heapPosition{0U};
+        TimerMode mode{TimerMode::ONE_SHOT};
+        bool isRunning{false};
+    };
+
+    static uint64_t nanosecondsSinceEpoch() noexcept;
+
+    void removeUnchecked(const uint64_t index) noexcept;
+    void insertUnchecked(const uint64_t index) noexcept;
+    void siftUp(uint64_t position) noexcept;
+    void siftDown(uint64_t position) noexcept;
+    void swapHeapPositions(const uint64_t lhs, const uint64_t rhs) noexcept;
+    bool isEarlier(const uint64_t lhsPosition, const uint64_t rhsPosition) const noexcept;
+
+  private:
+    mutable std::mutex m_mutex;
+    Timer_t m_timers[CAPACITY];
+    uint64_t m_heap[CAPACITY]{};
+    uint64_t m_heapSize{0U};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_TIMER_QUEUE_HPP
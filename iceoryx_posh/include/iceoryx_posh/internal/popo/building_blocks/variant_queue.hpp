@@ -19,7 +19,7 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_VARIANT_QUEUE_HPP
 
 #include "iox/assertions.hpp"
-#include "iox/detail/mpmc_resizeable_lockfree_queue.hpp"
+#include "iox/detail/mpsc_lockfree_queue.hpp"
 #include "iox/detail/spsc_fifo.hpp"
 #include "iox/detail/spsc_sofi.hpp"
 #include "iox/optional.hpp"
@@ -45,9 +45,8 @@ enum class VariantQueueTypes : uint64_t
     SoFi_MultiProducerSingleConsumer = 3
 };
 
-// remark: we need to consider to support the non-resizable queue as well
-//         since it should have performance benefits if resize is not actually needed
-//         for now we just use the most general variant, which allows resizing
+// remark: the multi producer queues are only popped by a single consumer, therefore the MpscLockFreeQueue is used
+//         instead of the more expensive MpmcResizeableLockFreeQueue
 
 /// @brief wrapper of multiple fifo's
 /// @param[in] ValueType type which should be stored
@@ -73,8 +72,8 @@ class VariantQueue
   public:
     using fifo_t = variant<concurrent::SpscFifo<ValueType, Capacity>,
                            concurrent::SpscSofi<ValueType, Capacity>,
-                           concurrent::MpmcResizeableLockFreeQueue<ValueType, Capacity>,
-                           concurrent::MpmcResizeableLockFreeQueue<ValueType, Capacity>>;
+                           concurrent::MpscLockFreeQueue<ValueType, Capacity>,
+                           concurrent::MpscLockFreeQueue<ValueType, Capacity>>;
 
     /// @brief Constructor of a VariantQueue
     /// @param[in] type type of the underlying queue
@@ -105,7 +104,7 @@ class VariantQueue
     /// @return true if setting the new capacity succeeded, false otherwise
     /// @pre it is important that no pop or push calls occur during
     ///         this call
-    /// @note depending on the internal queue used, concurrent pushes and pops are possible
+    /// @note depending on the internal queue used, concurrent pops are possible
     ///       (for FiFo_MultiProducerSingleConsumer and SoFi_MultiProducerSingleConsumer)
     /// @concurrent not thread safe
     bool setCapacity(const uint64_t newCapacity) noexcept;
@@ -41,6 +41,7 @@ Listener::attachEvent(T& eventOrigin, const NotificationCallback<T, ContextDataT
         .and_then([&](auto& eventId) {
             NotificationAttorney::enableEvent(
                 eventOrigin, TriggerHandle(*m_conditionVariableData, {*this, &Listener::removeTrigger}, eventId));
+            NotificationAttorney::enableTimer(eventOrigin, m_conditionListener);
         });
 }
 
@@ -65,6 +66,7 @@ inline expected<void, ListenerError> Listener::attachEvent(
                 eventOrigin,
                 TriggerHandle(*m_conditionVariableData, {*this, &Listener::removeTrigger}, eventId),
                 eventType);
+            NotificationAttorney::enableTimer(eventOrigin, m_conditionListener);
         });
 }
 
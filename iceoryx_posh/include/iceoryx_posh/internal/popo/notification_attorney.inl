@@ -52,6 +52,11 @@ NotificationAttorney::getCallbackForIsStateConditionSatisfied(T& eventOrigin, Ta
     return eventOrigin.getCallbackForIsStateConditionSatisfied(std::forward<Targs>(args)...);
 }
 
+template <typename T>
+inline void NotificationAttorney::enableTimer(T&, ConditionListener&) noexcept
+{
+}
+
 template <typename T>
 inline function<void(uint64_t)> NotificationAttorney::getInvalidateTriggerMethod(T& eventOrigin) noexcept
 {
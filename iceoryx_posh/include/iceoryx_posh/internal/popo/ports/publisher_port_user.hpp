@@ -61,6 +61,14 @@ class PublisherPortUser : public BasePort
                                                                     const uint32_t userHeaderSize = 0U,
                                                                     const uint32_t userHeaderAlignment = 1U) noexcept;
 
+    /// @brief Allocate a chained message whose user-payload may exceed the chunk size of the largest mempool, the
+    /// ownership of the SharedChunk remains in the PublisherPortUser
+    /// @param[in] userPayloadSize, size of the user-payload of the whole chained message
+    /// @param[in] userPayloadAlignment, alignment of each segment of the user-payload
+    /// @return on success pointer to the ChunkHeader of the head chunk, error if not
+    expected<mepoo::ChunkHeader*, AllocationError>
+    tryAllocateChainedChunk(const uint64_t userPayloadSize, const uint32_t userPayloadAlignment) noexcept;
+
     /// @brief Free an allocated chunk without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to free
     void releaseChunk(mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -138,6 +138,18 @@ class ServerPortUser : public BasePort
                                                                 const uint64_t userPayloadSize,
                                                                 const uint32_t userPayloadAlignment) noexcept;
 
+    /// @brief Allocate a response in the chunk of the request it belongs to. The chunk is reused if it is located in
+    /// the payload segment the server writes to and the response fits into it, otherwise the response is allocated
+    /// like with 'allocateResponse'. The request is released in any case and must not be accessed afterwards.
+    /// @param[in] requestHeader, the request header for the corresponding response
+    /// @param[in] userPayloadSize, size of the user user-paylaod without additional headers
+    /// @param[in] userPayloadAlignment, alignment of the user user-paylaod without additional headers
+    /// @return on success pointer to a ResponseHeader which can be used to access the chunk-header, user-header and
+    /// user-payload fields, error if not
+    expected<ResponseHeader*, AllocationError> allocateResponseInPlace(const RequestHeader* const requestHeader,
+                                                                       const uint64_t userPayloadSize,
+                                                                       const uint32_t userPayloadAlignment) noexcept;
+
     /// @brief Releases an allocated response without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to free
     void releaseResponse(const ResponseHeader* const responseHeader) noexcept;
@@ -24,6 +24,7 @@
 #include "iceoryx_posh/internal/popo/ports/pub_sub_port_types.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
 #include "iox/atomic.hpp"
+#include "iox/detail/relative_pointer_data.hpp"
 
 namespace iox
 {
@@ -51,6 +52,12 @@ struct SubscriberPortData : public BasePortData
 
     concurrent::Atomic<bool> m_subscribeRequested{false};
     concurrent::Atomic<SubscribeState> m_subscriptionState{SubscribeState::NOT_SUBSCRIBED};
+
+    /// @brief the LatestChunkSlot of the publisher if the subscriber reads only the latest chunk
+    concurrent::Atomic<RelativePointerData> m_latestChunkSlot{RelativePointerData()};
+    /// @brief identifies the latest chunk which was already provided to the user
+    UniquePortId m_latestChunkOriginId{InvalidPortId};
+    uint64_t m_latestChunkSequenceNumber{0U};
 };
 
 } // namespace popo
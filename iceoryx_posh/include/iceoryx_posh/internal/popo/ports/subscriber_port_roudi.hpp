@@ -68,6 +68,22 @@ class SubscriberPortRouDi : public BasePort
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
+    /// @brief creates a SUB or UNSUB CaPro message for this subscriber
+    /// @param[in] type of the CaPro message, either SUB or UNSUB
+    /// @return the CaPro message
+    capro::CaproMessage createSubscriptionMessage(const capro::CaproMessageType type) noexcept;
+
+    /// @brief stores the LatestChunkSlot which was provided by a publisher with an ACK, if any
+    /// @param[in] caProMessage which was received from the publisher
+    void updateLatestChunkSlot(const capro::CaproMessage& caProMessage) noexcept;
+
+    /// @brief removes the LatestChunkSlot if it is provided by the publisher which sent the CaPro message
+    /// @param[in] caProMessage which was received from the publisher
+    void removeLatestChunkSlot(const capro::CaproMessage& caProMessage) noexcept;
+
+    /// @brief removes the LatestChunkSlot unconditionally
+    void removeLatestChunkSlot() noexcept;
+
     ChunkReceiver<SubscriberPortData::ChunkReceiverData_t> m_chunkReceiver;
 };
 
@@ -62,7 +62,8 @@ class SubscriberPortUser : public BasePort
     SubscribeState getSubscriptionState() const noexcept;
 
     /// @brief Tries to get the next chunk from the queue. If there is a new one, the ChunkHeader of the oldest chunk in
-    /// the queue is returned (FiFo queue)
+    /// the queue is returned (FiFo queue). With the 'latestValueOnly' option the latest chunk of the publisher is
+    /// returned if it was not already returned before.
     /// @return New chunk header, ChunkReceiveResult on error
     /// or if there are no new chunks in the underlying queue
     expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGetChunk() noexcept;
@@ -96,6 +97,13 @@ class SubscriberPortUser : public BasePort
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
+    /// @brief acquires the latest chunk from the slot of the publisher if the subscriber uses 'latestValueOnly'
+    /// @return the latest chunk or an empty SharedChunk if there is none
+    mepoo::SharedChunk tryAcquireLatestChunk() const noexcept;
+
+    /// @brief checks if the latest chunk was not yet provided to the user
+    bool isNewLatestChunk(const mepoo::SharedChunk& chunk) const noexcept;
+
     ChunkReceiver<SubscriberPortData::ChunkReceiverData_t> m_chunkReceiver;
 };
 
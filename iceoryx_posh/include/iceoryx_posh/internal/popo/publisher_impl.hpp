@@ -57,6 +57,15 @@ class PublisherImpl : public BasePublisherType, private PublisherInterface<T, H>
     template <typename... Args>
     expected<Sample<T, H>, AllocationError> loan(Args&&... args) noexcept;
 
+    ///
+    /// @brief loanUninitialized Get a sample from loaned shared memory and default-initialize the data.
+    /// @return An instance of the sample that resides in shared memory or an error if unable ot allocate memory to
+    /// loan.
+    /// @details In contrast to 'loan()', which value-initializes and therefore zeroes a trivial type, the memory of a
+    /// trivial type is not touched. This avoids writing a large sample twice when it is overwritten completely anyway.
+    ///
+    expected<Sample<T, H>, AllocationError> loanUninitialized() noexcept;
+
     ///
     /// @brief publish Publishes the given sample and then releases its loan.
     /// @param sample The sample to publish.
@@ -69,6 +78,16 @@ class PublisherImpl : public BasePublisherType, private PublisherInterface<T, H>
     /// @return Error if unable to allocate memory to loan.
     ///
     expected<void, AllocationError> publishCopyOf(const T& val) noexcept;
+
+    ///
+    /// @brief publishStreamingCopyOf Copy the provided value with non-temporal stores into a loaned shared memory chunk
+    /// and publish it.
+    /// @param val Value to copy, must be trivially copyable.
+    /// @return Error if unable to allocate memory to loan.
+    /// @details The copy bypasses the cache and does not evict the working set of the publisher. This pays off for
+    /// large samples like images; for small samples 'publishCopyOf' is faster.
+    ///
+    expected<void, AllocationError> publishStreamingCopyOf(const T& val) noexcept;
     ///
     /// @brief publishResultOf Loan a sample from memory, execute the provided callable to write to it, then publish it.
     /// @param c Callable with the signature void(T*, ArgTypes...) that write's it's result to T*.
@@ -20,8 +20,10 @@
 #define IOX_POSH_POPO_TYPED_PUBLISHER_IMPL_INL
 
 #include "iceoryx_posh/internal/popo/publisher_impl.hpp"
+#include "iox/memory.hpp"
 
 #include <cstdint>
+#include <type_traits>
 
 namespace iox
 {
@@ -47,6 +49,13 @@ inline expected<Sample<T, H>, AllocationError> PublisherImpl<T, H, BasePublisher
     return loanSample().and_then([&](auto& sample) { new (sample.get()) T(std::forward<Args>(args)...); });
 }
 
+template <typename T, typename H, typename BasePublisherType>
+inline expected<Sample<T, H>, AllocationError> PublisherImpl<T, H, BasePublisherType>::loanUninitialized() noexcept
+{
+    // default-initialization, the memory of a trivial type is not touched
+    return loanSample().and_then([](auto& sample) { new (sample.get()) T; });
+}
+
 template <typename T, typename H, typename BasePublisherType>
 template <typename Callable, typename... ArgTypes>
 inline expected<void, AllocationError>
@@ -74,6 +83,19 @@ inline expected<void, AllocationError> PublisherImpl<T, H, BasePublisherType>::p
     });
 }
 
+template <typename T, typename H, typename BasePublisherType>
+inline expected<void, AllocationError>
+PublisherImpl<T, H, BasePublisherType>::publishStreamingCopyOf(const T& val) noexcept
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Publisher<T>::publishStreamingCopyOf requires a trivially copyable T since it copies the bytes");
+
+    return loanSample().and_then([&](auto& sample) {
+        streamingCopy(sample.get(), &val, sizeof(T));
+        sample.publish();
+    });
+}
+
 template <typename T, typename H, typename BasePublisherType>
 inline expected<Sample<T, H>, AllocationError> PublisherImpl<T, H, BasePublisherType>::loanSample() noexcept
 {
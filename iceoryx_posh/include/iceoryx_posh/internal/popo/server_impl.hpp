@@ -66,6 +66,18 @@ class ServerImpl : public BaseServerT, private RpcInterface<Response<Res>, Serve
     template <typename... Args>
     expected<Response<Res>, AllocationError> loan(const Request<const Req>& request, Args&&... args) noexcept;
 
+    /// @brief Get a Response in the shared memory of the given Request and construct the data with the given arguments.
+    /// The chunk of the Request is reused when it is located in the shared memory the server writes to and the
+    /// Response fits into it, which saves an allocation and a release. Otherwise the Response is loaned like with
+    /// 'loan' and the Request is released.
+    /// @param[in] request The request to which the Response belongs to; it is consumed in any case
+    /// @param[in] args Arguments used to construct the data. They must not refer to the data of the Request since it
+    /// might be overwritten by the Response.
+    /// @return An instance of the Response that resides in shared memory or an error if unable to allocate memory to
+    /// loan.
+    template <typename... Args>
+    expected<Response<Res>, AllocationError> loanInPlace(Request<const Req>&& request, Args&&... args) noexcept;
+
     /// @brief Sends the given Response and then releases its loan.
     /// @param response to send.
     /// @return Error if sending was not successful
@@ -79,6 +91,7 @@ class ServerImpl : public BaseServerT, private RpcInterface<Response<Res>, Serve
 
   private:
     expected<Response<Res>, AllocationError> loanUninitialized(const Request<const Req>& request) noexcept;
+    Response<Res> toResponse(ResponseHeader* const responseHeader) noexcept;
 };
 } // namespace popo
 } // namespace iox
@@ -69,13 +69,18 @@ ServerImpl<Req, Res, BaseServerT>::loanUninitialized(const Request<const Req>& r
     {
         return err(result.error());
     }
-    auto responseHeader = result.value();
+    return ok(toResponse(result.value()));
+}
+
+template <typename Req, typename Res, typename BaseServerT>
+Response<Res> ServerImpl<Req, Res, BaseServerT>::toResponse(ResponseHeader* const responseHeader) noexcept
+{
     auto payload = mepoo::ChunkHeader::fromUserHeader(responseHeader)->userPayload();
     auto response = unique_ptr<Res>(static_cast<Res*>(payload), [this](Res* payload) {
         auto* responseHeader = iox::popo::ResponseHeader::fromPayload(payload);
         this->port().releaseResponse(responseHeader);
     });
-    return ok(Response<Res>{std::move(response), *this});
+    return Response<Res>{std::move(response), *this};
 }
 
 template <typename Req, typename Res, typename BaseServerT>
@@ -87,6 +92,23 @@ expected<Response<Res>, AllocationError> ServerImpl<Req, Res, BaseServerT>::loan
         [&](auto& response) { new (response.get()) Res(std::forward<Args>(args)...); }));
 }
 
+template <typename Req, typename Res, typename BaseServerT>
+template <typename... Args>
+expected<Response<Res>, AllocationError>
+ServerImpl<Req, Res, BaseServerT>::loanInPlace(Request<const Req>&& request, Args&&... args) noexcept
+{
+    // take the ownership of the chunk from the Request to transfer it to 'allocateResponseInPlace'
+    const auto* requestHeader = RequestHeader::fromPayload(request.release());
+    auto result = port().allocateResponseInPlace(requestHeader, sizeof(Res), alignof(Res));
+    if (result.has_error())
+    {
+        return err(result.error());
+    }
+    auto response = toResponse(result.value());
+    new (response.get()) Res(std::forward<Args>(args)...);
+    return ok(std::move(response));
+}
+
 template <typename Req, typename Res, typename BaseServerT>
 expected<void, ServerSendError> ServerImpl<Req, Res, BaseServerT>::send(Response<Res>&& response) noexcept
 {
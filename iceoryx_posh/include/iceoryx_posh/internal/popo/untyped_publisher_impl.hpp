@@ -48,6 +48,7 @@ class UntypedPublisherImpl : public BasePublisherType
     /// @return A pointer to the user-payload of a chunk of memory with the requested size or
     ///         an AllocationError if no chunk could be loaned.
     /// @note An AllocationError occurs if no chunk is available in the shared memory.
+    /// @note The user-payload is not initialized.
     ///
     expected<void*, AllocationError>
     loan(const uint64_t userPayloadSize,
@@ -55,6 +56,20 @@ class UntypedPublisherImpl : public BasePublisherType
          const uint32_t userHeaderSize = iox::CHUNK_NO_USER_HEADER_SIZE,
          const uint32_t userHeaderAlignment = iox::CHUNK_NO_USER_HEADER_ALIGNMENT) noexcept;
 
+    ///
+    /// @brief Get a chained message from loaned shared memory whose user-payload may exceed the chunk size of the
+    ///        largest mempool. The user-payload is split into segments which can be accessed with a
+    ///        mepoo::ChainedPayload created from the returned pointer.
+    /// @param userPayloadSize The user-payload size of the whole chained message.
+    /// @param userPayloadAlignment The user-payload alignment of each segment.
+    /// @return A pointer to the user-payload of the head chunk of the chained message or
+    ///         an AllocationError if the chained message could not be loaned.
+    /// @note A chained message cannot have a custom user-header. It is published and released like a single chunk.
+    ///
+    expected<void*, AllocationError>
+    loanChained(const uint64_t userPayloadSize,
+                const uint32_t userPayloadAlignment = iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT) noexcept;
+
     ///
     /// @brief Publish the provided memory chunk.
     /// @param userPayload Pointer to the user-payload of the allocated shared memory chunk.
@@ -62,6 +77,20 @@ class UntypedPublisherImpl : public BasePublisherType
     ///
     void publish(void* const userPayload) noexcept;
 
+    ///
+    /// @brief Copy the provided user-payload with non-temporal stores into a loaned chunk and publish it.
+    /// @param userPayload Pointer to the user-payload to copy.
+    /// @param userPayloadSize The size of the user-payload to copy.
+    /// @param userPayloadAlignment The user-payload alignment of the chunk.
+    /// @return Error if no chunk could be loaned.
+    /// @details The copy bypasses the cache and does not evict the working set of the publisher. This pays off for
+    /// large user-payloads like images; for small ones a 'loan' with a regular copy is faster.
+    ///
+    expected<void, AllocationError> publishStreamingCopyOf(
+        const void* const userPayload,
+        const uint64_t userPayloadSize,
+        const uint32_t userPayloadAlignment = iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT) noexcept;
+
     ///
     /// @brief Releases the ownership of the chunk provided by the user-payload pointer.
     /// @param userPayload pointer to the user-payload of the chunk to be released
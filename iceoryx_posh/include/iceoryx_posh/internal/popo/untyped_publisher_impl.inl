@@ -19,6 +19,7 @@
 #define IOX_POSH_POPO_UNTYPED_PUBLISHER_IMPL_INL
 
 #include "iceoryx_posh/internal/popo/untyped_publisher_impl.hpp"
+#include "iox/memory.hpp"
 
 namespace iox
 {
@@ -44,6 +45,18 @@ inline void UntypedPublisherImpl<BasePublisherType>::publish(void* const userPay
     port().sendChunk(chunkHeader);
 }
 
+template <typename BasePublisherType>
+inline expected<void, AllocationError>
+UntypedPublisherImpl<BasePublisherType>::publishStreamingCopyOf(const void* const userPayload,
+                                                                const uint64_t userPayloadSize,
+                                                                const uint32_t userPayloadAlignment) noexcept
+{
+    return loan(userPayloadSize, userPayloadAlignment).and_then([&](auto& chunk) {
+        streamingCopy(chunk, userPayload, userPayloadSize);
+        publish(chunk);
+    });
+}
+
 template <typename BasePublisherType>
 inline expected<void*, AllocationError>
 UntypedPublisherImpl<BasePublisherType>::loan(const uint64_t userPayloadSize,
@@ -62,6 +75,22 @@ UntypedPublisherImpl<BasePublisherType>::loan(const uint64_t userPayloadSize,
     }
 }
 
+template <typename BasePublisherType>
+inline expected<void*, AllocationError>
+UntypedPublisherImpl<BasePublisherType>::loanChained(const uint64_t userPayloadSize,
+                                                     const uint32_t userPayloadAlignment) noexcept
+{
+    auto result = port().tryAllocateChainedChunk(userPayloadSize, userPayloadAlignment);
+    if (result.has_error())
+    {
+        return err(result.error());
+    }
+    else
+    {
+        return ok(result.value()->userPayload());
+    }
+}
+
 template <typename BasePublisherType>
 inline void UntypedPublisherImpl<BasePublisherType>::release(void* const userPayload) noexcept
 {
@@ -65,6 +65,20 @@ class UntypedServerImpl : public BaseServerT
                                           const uint64_t payloadSize,
                                           const uint32_t payloadAlignment) noexcept;
 
+    /// @brief Get a response chunk in the shared memory of the given request chunk. The request chunk is reused when
+    /// it is located in the shared memory the server writes to and the response fits into it, which saves an
+    /// allocation and a release. Otherwise a response chunk is loaned like with 'loan' and the request chunk is
+    /// released.
+    /// @param requestPayload pointer to the payload of the request chunk; it is released in any case and must not be
+    ///        accessed afterwards since its memory might be overwritten by the response
+    /// @param payloadSize The expected payload size of the chunk.
+    /// @param payloadAlignment The expected payload alignment of the chunk.
+    /// @return A pointer to the payload of a chunk of memory with the requested size or
+    ///         an AllocationError if no chunk could be loaned.
+    expected<void*, AllocationError> loanInPlace(const void* const requestPayload,
+                                                 const uint64_t payloadSize,
+                                                 const uint32_t payloadAlignment) noexcept;
+
     /// @brief Sends the provided memory chunk as response to the client.
     /// @param responsePayload Pointer to the payload of the allocated shared memory chunk.
     /// @return Error if sending was not successful
@@ -78,6 +78,21 @@ expected<void*, AllocationError> UntypedServerImpl<BaseServerT>::loan(const Requ
     return ok(mepoo::ChunkHeader::fromUserHeader(allocationResult.value())->userPayload());
 }
 
+template <typename BaseServerT>
+expected<void*, AllocationError> UntypedServerImpl<BaseServerT>::loanInPlace(const void* const requestPayload,
+                                                                             const uint64_t payloadSize,
+                                                                             const uint32_t payloadAlignment) noexcept
+{
+    const auto* requestHeader = RequestHeader::fromPayload(requestPayload);
+    auto allocationResult = port().allocateResponseInPlace(requestHeader, payloadSize, payloadAlignment);
+    if (allocationResult.has_error())
+    {
+        return err(allocationResult.error());
+    }
+
+    return ok(mepoo::ChunkHeader::fromUserHeader(allocationResult.value())->userPayload());
+}
+
 template <typename BaseServerT>
 expected<void, ServerSendError> UntypedServerImpl<BaseServerT>::send(void* const responsePayload) noexcept
 {
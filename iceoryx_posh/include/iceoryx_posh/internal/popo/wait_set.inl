@@ -78,9 +78,15 @@ inline WaitSet<Capacity>::WaitSet() noexcept
 }
 
 template <uint64_t Capacity>
-inline WaitSet<Capacity>::WaitSet(ConditionVariableData& condVarData) noexcept
+inline WaitSet<Capacity>::WaitSet(const WaitStrategy& waitStrategy) noexcept
+    : WaitSet(*runtime::PoshRuntime::getInstance().getMiddlewareConditionVariable(), waitStrategy)
+{
+}
+
+template <uint64_t Capacity>
+inline WaitSet<Capacity>::WaitSet(ConditionVariableData& condVarData, const WaitStrategy& waitStrategy) noexcept
     : m_conditionVariableDataPtr(&condVarData)
-    , m_conditionListener(condVarData)
+    , m_conditionListener(condVarData, waitStrategy)
 {
     for (uint64_t i = 0U; i < Capacity; ++i)
     {
@@ -175,6 +181,7 @@ WaitSet<Capacity>::attachEvent(T& eventOrigin,
                 eventOrigin,
                 TriggerHandle(*m_conditionVariableDataPtr, {*this, &WaitSet::removeTrigger}, uniqueId),
                 eventType);
+            NotificationAttorney::enableTimer(eventOrigin, m_conditionListener);
         });
 }
 
@@ -200,6 +207,7 @@ inline expected<void, WaitSetError> WaitSet<Capacity>::attachEvent(
         .and_then([&](auto& uniqueId) {
             NotificationAttorney::enableEvent(
                 eventOrigin, TriggerHandle(*m_conditionVariableDataPtr, {*this, &WaitSet::removeTrigger}, uniqueId));
+            NotificationAttorney::enableTimer(eventOrigin, m_conditionListener);
         });
 }
 
@@ -85,6 +85,13 @@ class MemPoolIntrospection
     /// @brief copy data fro internal struct into interface struct
     void copyMemPoolInfo(const MemoryManager& memoryManager, MemPoolInfoContainer& dest) noexcept;
 
+    /// @brief copy the requested size classes of the chunk size histogram into the interface struct
+    void copyChunkSizeHistogram(const MemoryManager& memoryManager, ChunkSizeHistogramContainer& dest) noexcept;
+
+    /// @brief copy the NUMA placement of a segment into the interface struct
+    template <typename Segment>
+    void copyNumaPlacement(const Segment& segment, MemPoolIntrospectionInfo& dest) noexcept;
+
   private:
     units::Duration m_sendInterval{units::Duration::fromSeconds(1U)};
     concurrent::detail::PeriodicTask<function<void()>> m_publishingTask{
@@ -110,6 +110,7 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
                                        PosixGroup::getGroupOfCurrentProcess(),
                                        id);
             copyMemPoolInfo(*m_rouDiInternalMemoryManager, memPoolIntrospectionInfo.m_mempoolInfo);
+            copyChunkSizeHistogram(*m_rouDiInternalMemoryManager, memPoolIntrospectionInfo.m_chunkSizeHistogram);
             ++id;
 
             // User shm segments
@@ -121,6 +122,10 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
                     prepareIntrospectionSample(
                         memPoolIntrospectionInfo, segment.getReaderGroup(), segment.getWriterGroup(), id);
                     copyMemPoolInfo(segment.getMemoryManager(), memPoolIntrospectionInfo.m_mempoolInfo);
+                    copyChunkSizeHistogram(segment.getMemoryManager(),
+                                           memPoolIntrospectionInfo.m_chunkSizeHistogram);
+                    copyNumaPlacement(segment, memPoolIntrospectionInfo);
+                    memPoolIntrospectionInfo.m_trafficClass = segment.getTrafficClass();
                 }
                 else
                 {
@@ -147,6 +152,17 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
     }
 }
 
+template <typename MemoryManager, typename SegmentManager, typename PublisherPort>
+template <typename Segment>
+inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::copyNumaPlacement(
+    const Segment& segment, MemPoolIntrospectionInfo& dest) noexcept
+{
+    dest.m_numaPlacement = segment.getNumaPlacement();
+    const auto numaNode = segment.getNumaNode();
+    dest.m_hasNumaNode = numaNode.has_value();
+    dest.m_numaNode = numaNode.value_or(0U);
+}
+
 // copy data fro internal struct into interface struct
 template <typename MemoryManager, typename SegmentManager, typename PublisherPort>
 inline void
@@ -158,12 +174,50 @@ MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::copyMemPoolI
     for (uint32_t i = 0U; i < numOfMemPools; ++i)
     {
         auto src = memoryManager.getMemPoolInfo(i);
+        auto overflow = memoryManager.getOverflowMemPoolInfo(i);
         auto& dst = dest[i];
-        dst.m_usedChunks = src.m_usedChunks;
-        dst.m_minFreeChunks = src.m_minFreeChunks;
-        dst.m_numChunks = src.m_numChunks;
+        dst.m_usedChunks = src.m_usedChunks + overflow.m_usedChunks;
+        dst.m_minFreeChunks = src.m_minFreeChunks + overflow.m_minFreeChunks;
+        dst.m_numChunks = src.m_numChunks + overflow.m_numChunks;
         dst.m_chunkSize = src.m_chunkSize;
         dst.m_chunkPayloadSize = src.m_chunkSize - sizeof(mepoo::ChunkHeader);
+        dst.m_reservedChunks = src.m_reservedChunks;
+        dst.m_numOverflowSegments = memoryManager.getNumberOfOverflowMemPools(i);
+    }
+}
+
+template <typename MemoryManager, typename SegmentManager, typename PublisherPort>
+inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::copyChunkSizeHistogram(
+    const MemoryManager& memoryManager, ChunkSizeHistogramContainer& dest) noexcept
+{
+    dest.clear();
+    const auto& chunkSizeHistogram = memoryManager.getChunkSizeHistogram();
+    for (uint32_t i = 0U; i < mepoo::ChunkSizeHistogram::NUMBER_OF_SIZE_CLASSES; ++i)
+    {
+        const auto src = chunkSizeHistogram.getSizeClassInfo(i);
+        if (src.m_numRequests == 0U)
+        {
+            continue;
+        }
+
+        if (dest.size() == dest.capacity())
+        {
+            // a segment cannot have more mempools anyway; merging into the largest size class keeps the statistics
+            // a safe upper bound for the sizing of the mempools
+            auto& largest = dest.back();
+            largest.m_chunkSize = src.m_chunkSize;
+            largest.m_numRequests += src.m_numRequests;
+            largest.m_chunksInUse += src.m_chunksInUse;
+            largest.m_peakChunksInUse += src.m_peakChunksInUse;
+            continue;
+        }
+
+        ChunkSizeClassInfo dst;
+        dst.m_chunkSize = src.m_chunkSize;
+        dst.m_numRequests = src.m_numRequests;
+        dst.m_chunksInUse = src.m_chunksInUse;
+        dst.m_peakChunksInUse = src.m_peakChunksInUse;
+        dest.emplace_back(dst);
     }
 }
 
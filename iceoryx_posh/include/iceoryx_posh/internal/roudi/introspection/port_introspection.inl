@@ -593,10 +593,41 @@ PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(PortInt
 
 template <typename PublisherPort, typename SubscriberPort>
 inline void
-PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(PortThroughputIntrospectionTopic& topic
-                                                                         [[maybe_unused]]) noexcept
+PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(
+    PortThroughputIntrospectionTopic& topic) noexcept
 {
-    /// @todo iox-#402 re-add port throughput
+    /// @todo iox-#402 re-add port throughput; currently only the chunk quota usage is provided
+    auto& throughputList = topic.m_throughputList;
+
+    std::lock_guard<std::mutex> lock(m_mutex); // we need to lock the internal data structs
+
+    for (auto& pub : m_publisherMap)
+    {
+        for (auto& pair : pub.second)
+        {
+            auto publisherIndex = pair.second;
+            if (publisherIndex >= 0)
+            {
+                auto publisherInfo = m_publisherContainer.iter_from_index(publisherIndex);
+                PortThroughputData throughputData;
+                PublisherPort port(publisherInfo->portData);
+                throughputData.m_publisherPortID = static_cast<uint64_t>(port.getUniqueID());
+
+                const auto& chunkQuota = publisherInfo->portData->m_chunkSenderData.m_chunkQuota;
+                if (chunkQuota)
+                {
+                    const auto chunkQuotaInfo = chunkQuota->getInfo();
+                    throughputData.m_hasChunkQuota = true;
+                    throughputData.m_chunksInUse = chunkQuotaInfo.m_chunksInUse;
+                    throughputData.m_reservedChunks = chunkQuotaInfo.m_reservedChunks;
+                    throughputData.m_reservedChunksInUse = chunkQuotaInfo.m_reservedChunksInUse;
+                    throughputData.m_numberOfQuotaExceededRequests = chunkQuotaInfo.m_numberOfExceededRequests;
+                }
+
+                throughputList.emplace_back(throughputData);
+            }
+        }
+    }
 }
 
 template <typename PublisherPort, typename SubscriberPort>
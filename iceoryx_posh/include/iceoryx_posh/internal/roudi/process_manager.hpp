@@ -21,6 +21,7 @@
 #include "iceoryx_posh/internal/roudi/introspection/process_introspection.hpp"
 #include "iceoryx_posh/internal/roudi/port_manager.hpp"
 #include "iceoryx_posh/internal/roudi/process.hpp"
+#include "iceoryx_posh/internal/roudi/process_termination_monitor.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_user.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/roudi/heartbeat_pool.hpp"
@@ -69,7 +70,8 @@ class ProcessManager : public ProcessManagerInterface
     /// @param [in] name of the process which wants to register
     /// @param [in] pid is the host system process id
     /// @param [in] user is the posix user id to which the process belongs
-    /// @param [in] isMonitored indicates if the process should be monitored for being alive
+    /// @param [in] isMonitored indicates if the process should be monitored for being alive; with an enabled
+    /// ProcessTerminationMonitor the process is monitored with a pidfd and otherwise with a heartbeat
     /// @param [in] transmissionTimestamp is an ID for the application to check for the expected response
     /// @param [in] sessionId is an ID generated by RouDi to prevent sending outdated IPC channel transmission
     /// @param [in] versionInfo Version of iceoryx used
@@ -82,6 +84,13 @@ class ProcessManager : public ProcessManagerInterface
                          const uint64_t sessionId,
                          const version::VersionInfo& versionInfo) noexcept;
 
+    /// @brief Monitors processes with the ProcessTerminationMonitor instead of a heartbeat when supported by the
+    /// platform. Must be called before the first process is registered.
+    /// @param [in] onTermination is called from the thread of the ProcessTerminationMonitor whenever monitored
+    /// processes terminated; their resources are released with the next call to 'run'
+    void
+    enableProcessTerminationMonitor(const ProcessTerminationMonitor::TerminationCallback_t& onTermination) noexcept;
+
     /// @brief Unregisters a process at the ProcessManager
     /// @param [in] name of the process which wants to unregister
     /// @return true if known process was unregistered, false if process is unknown
@@ -160,6 +169,7 @@ class ProcessManager : public ProcessManagerInterface
     optional<Process*> findProcess(const RuntimeName_t& name) noexcept;
 
     void monitorProcesses() noexcept;
+    void removeTerminatedProcesses() noexcept;
     void discoveryUpdate() noexcept override;
 
     /// @param [in] name of the process; this is equal to the IPC channel name, which is used for communication
@@ -231,6 +241,8 @@ class ProcessManager : public ProcessManagerInterface
     ProcessIntrospectionType* m_processIntrospection{nullptr};
     version::CompatibilityCheckLevel m_compatibilityCheckLevel;
     HeartbeatPool* m_heartbeatPool;
+    // last member, to stop the monitoring thread before the other members are destroyed
+    optional<ProcessTerminationMonitor> m_terminationMonitor;
 };
 
 } // namespace roudi
@@ -0,0 +1,103 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_ROUDI_PROCESS_TERMINATION_MONITOR_HPP
+#define IOX_POSH_ROUDI_PROCESS_TERMINATION_MONITOR_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iox/atomic.hpp"
+#include "iox/function.hpp"
+#include "iox/vector.hpp"
+
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Detects the termination of registered processes without polling. On Linux a pidfd is opened for each
+/// process and a thread waits for all of them with epoll. The pidfd becomes readable as soon as the process has
+/// terminated, independent of whether it exited gracefully or crashed.
+/// @note The pids are interpreted in the pid namespace of RouDi. If the applications run in a different pid
+/// namespace, e.g. in a container, the heartbeat based monitoring must be used instead.
+class ProcessTerminationMonitor
+{
+  public:
+    using TerminationCallback_t = function<void()>;
+    using TerminatedProcesses_t = vector<uint32_t, MAX_PROCESS_NUMBER>;
+
+    /// @brief Creates the monitor and starts the thread which waits for the termination of the processes
+    /// @param[in] onTermination is called from the monitoring thread whenever processes terminated; the terminated
+    /// processes can then be acquired with 'takeTerminatedProcesses'
+    explicit ProcessTerminationMonitor(const TerminationCallback_t& onTermination) noexcept;
+
+    ProcessTerminationMonitor(const ProcessTerminationMonitor&) = delete;
+    ProcessTerminationMonitor(ProcessTerminationMonitor&&) = delete;
+    ProcessTerminationMonitor& operator=(const ProcessTerminationMonitor&) = delete;
+    ProcessTerminationMonitor& operator=(ProcessTerminationMonitor&&) = delete;
+
+    /// @brief Stops the monitoring thread and closes all pidfds
+    ~ProcessTerminationMonitor() noexcept;
+
+    /// @brief Returns whether the platform supports the termination monitoring. If not, all calls to 'addProcess'
+    /// fail and the processes must be monitored with a heartbeat.
+    bool isSupported() const noexcept;
+
+    /// @brief Starts the monitoring of a process
+    /// @param[in] pid of the process
+    /// @return true if the process is monitored, false if the monitoring is not supported, the process is already
+    /// monitored or the pidfd could not be opened, e.g. because the process does not exist in the pid namespace of
+    /// RouDi
+    bool addProcess(const uint32_t pid) noexcept;
+
+    /// @brief Stops the monitoring of a process, e.g. because it unregistered; a termination of the process which was
+    /// not yet acquired with 'takeTerminatedProcesses' is discarded
+    /// @param[in] pid of the process
+    void removeProcess(const uint32_t pid) noexcept;
+
+    /// @brief Acquires the processes which terminated since the last call; they are no longer monitored
+    /// @return the pids of the terminated processes
+    TerminatedProcesses_t takeTerminatedProcesses() noexcept;
+
+  private:
+    struct MonitoredProcess
+    {
+        uint32_t m_pid{0U};
+        int32_t m_pidFd{-1};
+    };
+
+    void run() noexcept;
+    void handleTermination(const uint32_t pid) noexcept;
+    void closePidFd(const MonitoredProcess& process) noexcept;
+
+    static constexpr int32_t INVALID_FD{-1};
+
+    TerminationCallback_t m_onTermination;
+    int32_t m_epollFd{INVALID_FD};
+    int32_t m_shutdownFd{INVALID_FD};
+    std::mutex m_mutex;
+    vector<MonitoredProcess, MAX_PROCESS_NUMBER> m_monitoredProcesses;
+    TerminatedProcesses_t m_terminatedProcesses;
+    std::thread m_thread;
+};
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_PROCESS_TERMINATION_MONITOR_HPP
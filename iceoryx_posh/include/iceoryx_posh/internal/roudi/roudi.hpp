@@ -21,6 +21,7 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/roudi/introspection/mempool_introspection.hpp"
 #include "iceoryx_posh/internal/roudi/process_manager.hpp"
+#include "iceoryx_posh/internal/roudi/runtime_message_dispatcher.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_creator.hpp"
 #include "iceoryx_posh/popo/user_trigger.hpp"
 #include "iceoryx_posh/roudi/memory/roudi_memory_interface.hpp"
@@ -69,6 +70,9 @@ class RouDi
     ///
     /// @note Intentionally not virtual to be able to call it in derived class
     void shutdown() noexcept;
+    /// @brief Processes a message of a runtime
+    /// @note Called concurrently for messages of different runtimes from the worker threads of the
+    /// RuntimeMessageDispatcher; the messages of a single runtime are processed in order
     virtual void processMessage(const runtime::IpcMessage& message,
                                 const iox::runtime::IpcMessageType& cmd,
                                 const RuntimeName_t& runtimeName) noexcept;
@@ -109,6 +113,7 @@ class RouDi
     concurrent::Atomic<bool> m_runHandleRuntimeMessageThread;
 
     popo::UserTrigger m_discoveryLoopTrigger;
+    popo::UserTrigger m_processTerminationTrigger;
     optional<UnnamedSemaphore> m_discoveryFinishedSemaphore;
 
     const units::Duration m_runtimeMessagesThreadTimeout{100_ms};
@@ -0,0 +1,103 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_ROUDI_RUNTIME_MESSAGE_DISPATCHER_HPP
+#define IOX_POSH_ROUDI_RUNTIME_MESSAGE_DISPATCHER_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_interface_base.hpp"
+#include "iox/function.hpp"
+#include "iox/vector.hpp"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Processes the messages of the runtimes with a fixed number of worker threads. All messages of a runtime are
+/// processed by the same worker in the order they were dispatched, while the messages of different runtimes are
+/// processed concurrently.
+class RuntimeMessageDispatcher
+{
+  public:
+    using MessageHandler_t =
+        function<void(const runtime::IpcMessage&, const runtime::IpcMessageType&, const RuntimeName_t&)>;
+
+    /// @brief Creates the dispatcher and starts the worker threads
+    /// @param[in] numberOfWorkers is the number of worker threads; it is limited to the range
+    /// [1, MAX_RUNTIME_MESSAGE_WORKER_COUNT]
+    /// @param[in] handler is called from the worker threads for each dispatched message
+    RuntimeMessageDispatcher(const uint32_t numberOfWorkers, const MessageHandler_t& handler) noexcept;
+
+    RuntimeMessageDispatcher(const RuntimeMessageDispatcher&) = delete;
+    RuntimeMessageDispatcher(RuntimeMessageDispatcher&&) = delete;
+    RuntimeMessageDispatcher& operator=(const RuntimeMessageDispatcher&) = delete;
+    RuntimeMessageDispatcher& operator=(RuntimeMessageDispatcher&&) = delete;
+
+    /// @brief Stops the worker threads after they finished the message they are currently processing; messages which
+    /// were not yet processed are discarded
+    ~RuntimeMessageDispatcher() noexcept;
+
+    /// @brief Hands a message over to the worker which is responsible for the runtime
+    /// @param[in] message to process
+    /// @param[in] cmd is the type of the message
+    /// @param[in] runtimeName is the name of the runtime which sent the message
+    void dispatch(runtime::IpcMessage&& message,
+                  const runtime::IpcMessageType cmd,
+                  const RuntimeName_t& runtimeName) noexcept;
+
+    /// @brief Returns the number of worker threads
+    uint32_t numberOfWorkers() const noexcept;
+
+    /// @brief Determines the worker which processes the messages of a runtime
+    /// @param[in] runtimeName is the name of the runtime
+    /// @param[in] numberOfWorkers is the number of worker threads
+    /// @return the index of the worker
+    static uint32_t workerIndex(const RuntimeName_t& runtimeName, const uint32_t numberOfWorkers) noexcept;
+
+  private:
+    struct Request
+    {
+        runtime::IpcMessage m_message;
+        runtime::IpcMessageType m_cmd{runtime::IpcMessageType::NOTYPE};
+        RuntimeName_t m_runtimeName;
+    };
+
+    struct Worker
+    {
+        std::mutex m_mutex;
+        std::condition_variable m_wakeup;
+        std::deque<Request> m_requests;
+        bool m_keepRunning{true};
+        std::thread m_thread;
+    };
+
+    void run(Worker& worker) noexcept;
+
+    MessageHandler_t m_handler;
+    vector<Worker, MAX_RUNTIME_MESSAGE_WORKER_COUNT> m_workers;
+};
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_RUNTIME_MESSAGE_DISPATCHER_HPP
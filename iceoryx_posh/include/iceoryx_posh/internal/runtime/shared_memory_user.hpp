@@ -38,6 +38,8 @@ enum class SharedMemoryUserError
 };
 
 /// @brief shared memory setup for the management segment user side
+/// @note Only the management segment and the writable payload segment are mapped when the SharedMemoryUser is
+/// created. The read-only payload segments are mapped the first time a relative pointer into them is resolved.
 class SharedMemoryUser
 {
   private:
@@ -67,10 +69,20 @@ class SharedMemoryUser
     SharedMemoryUser& operator=(const SharedMemoryUser&) = delete;
 
   private:
+    struct OnDemandSegments;
+
     SharedMemoryUser(ShmVector_t&& payloadShm) noexcept;
 
     static void destroy(ShmVector_t& shmSegments) noexcept;
 
+    /// @brief the read-only payload segments and the overflow segments are mapped on demand; since the pointer
+    /// repository is process wide the state for mapping them is process wide as well
+    static OnDemandSegments& onDemandSegments() noexcept;
+
+    /// @brief is called when a relative pointer of an unknown segment is resolved and maps the segment if it is a
+    /// payload or overflow segment the user has access to
+    static void mapSegmentOnDemand(const segment_id_underlying_t segmentId) noexcept;
+
     static expected<void, SharedMemoryUserError> openShmSegment(ShmVector_t& shmSegments,
                                                                 const DomainId domainId,
                                                                 const uint64_t segmentId,
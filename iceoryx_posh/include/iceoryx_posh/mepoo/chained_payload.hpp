@@ -0,0 +1,144 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_MEPOO_CHAINED_PAYLOAD_HPP
+#define IOX_POSH_MEPOO_CHAINED_PAYLOAD_HPP
+
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iox/optional.hpp"
+#include "iox/relative_pointer.hpp"
+#include "iox/span.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace iox
+{
+namespace mepoo
+{
+struct ChunkManagement;
+
+/// @brief The user-header of the head chunk of a chained message. It is followed by one relative pointer to the
+/// ChunkManagement of each continuation chunk. The head chunk owns the continuation chunks, i.e. they are released
+/// together with the head chunk.
+/// @note A chained message consists of the head chunk and the continuation chunks. It is delivered as a single chunk
+/// and therefore occupies only one queue entry, but its user-payload is split into segments, one per chunk.
+struct ChainedChunkHeader
+{
+    using ContinuationChunk_t = RelativePointer<ChunkManagement>;
+
+    /// @brief Calculates the size of the user-header for a chained message
+    /// @param[in] numberOfContinuationChunks of the chained message
+    /// @return the user-header size
+    static constexpr uint32_t requiredUserHeaderSize(const uint32_t numberOfContinuationChunks) noexcept
+    {
+        return static_cast<uint32_t>(sizeof(ChainedChunkHeader)
+                                     + numberOfContinuationChunks * sizeof(ContinuationChunk_t));
+    }
+
+    /// @brief Get the continuation chunks which are placed directly after the ChainedChunkHeader
+    /// @return pointer to the first of the m_numberOfContinuationChunks continuation chunks
+    ContinuationChunk_t* continuationChunks() noexcept;
+
+    /// @brief Get the continuation chunks which are placed directly after the ChainedChunkHeader
+    /// @return const pointer to the first of the m_numberOfContinuationChunks continuation chunks
+    const ContinuationChunk_t* continuationChunks() const noexcept;
+
+    uint64_t m_userPayloadSize{0U};
+    uint32_t m_numberOfContinuationChunks{0U};
+};
+
+static_assert(sizeof(ChainedChunkHeader) % alignof(ChainedChunkHeader::ContinuationChunk_t) == 0U,
+              "The continuation chunks must be aligned when placed after the ChainedChunkHeader");
+
+/// @brief Access to the user-payload of a chained message as a sequence of segments. The first segment is the
+/// user-payload of the head chunk, the following segments are the user-payloads of the continuation chunks.
+/// @tparam ByteType is either 'uint8_t' for the publisher side or 'const uint8_t' for the subscriber side
+template <typename ByteType>
+class ChainedPayloadView
+{
+    static_assert(std::is_same<std::remove_const_t<ByteType>, uint8_t>::value, "ByteType must be (const) uint8_t");
+
+  public:
+    using Segment_t = span<ByteType>;
+    using UserPayload_t = std::conditional_t<std::is_const<ByteType>::value, const void, void>;
+    using ChunkHeader_t = std::conditional_t<std::is_const<ByteType>::value, const ChunkHeader, ChunkHeader>;
+
+    class Iterator
+    {
+      public:
+        Iterator(const ChainedPayloadView& view, const uint32_t index) noexcept;
+        Segment_t operator*() const noexcept;
+        Iterator& operator++() noexcept;
+        bool operator==(const Iterator& rhs) const noexcept;
+        bool operator!=(const Iterator& rhs) const noexcept;
+
+      private:
+        const ChainedPayloadView* m_view{nullptr};
+        uint32_t m_index{0U};
+    };
+
+    /// @brief Creates the view of a chained message from the user-payload of its head chunk
+    /// @param[in] userPayload of the head chunk, as provided by 'loanChained' or 'take'
+    /// @return the view or 'nullopt' if the user-payload does not belong to the head chunk of a chained message
+    static optional<ChainedPayloadView> fromUserPayload(UserPayload_t* const userPayload) noexcept;
+
+    /// @brief The number of segments, i.e. the head chunk and all continuation chunks
+    uint32_t numberOfSegments() const noexcept;
+
+    /// @brief The size of the user-payload of the whole chained message
+    uint64_t size() const noexcept;
+
+    /// @brief Access to a segment of the user-payload
+    /// @param[in] index of the segment, must be smaller than 'numberOfSegments'
+    /// @return the span of the segment
+    Segment_t segment(const uint32_t index) const noexcept;
+
+    Iterator begin() const noexcept;
+    Iterator end() const noexcept;
+
+    /// @brief Gathers the user-payload into contiguous memory
+    /// @param[in] destination to copy the user-payload into
+    /// @param[in] destinationSize of the memory, at most this number of bytes is copied
+    /// @return the number of copied bytes
+    uint64_t copyTo(void* const destination, const uint64_t destinationSize) const noexcept;
+
+    /// @brief Scatters contiguous memory into the segments of the user-payload
+    /// @param[in] source to copy the user-payload from
+    /// @param[in] sourceSize of the memory, at most 'size' bytes are copied
+    /// @return the number of copied bytes
+    template <typename T = ByteType, typename = std::enable_if_t<!std::is_const<T>::value>>
+    uint64_t copyFrom(const void* const source, const uint64_t sourceSize) const noexcept;
+
+  private:
+    explicit ChainedPayloadView(ChunkHeader_t* const headChunkHeader) noexcept;
+
+    const ChainedChunkHeader& chainedChunkHeader() const noexcept;
+
+    ChunkHeader_t* m_headChunkHeader{nullptr};
+};
+
+/// @brief Publisher side view of a chained message
+using ChainedPayload = ChainedPayloadView<uint8_t>;
+/// @brief Subscriber side view of a chained message
+using ConstChainedPayload = ChainedPayloadView<const uint8_t>;
+
+} // namespace mepoo
+} // namespace iox
+
+#include "iceoryx_posh/internal/mepoo/chained_payload.inl"
+
+#endif // IOX_POSH_MEPOO_CHAINED_PAYLOAD_HPP
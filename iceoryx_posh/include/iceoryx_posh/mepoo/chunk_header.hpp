@@ -67,6 +67,8 @@ struct ChunkHeader
     static constexpr uint16_t NO_USER_HEADER{0x0000};
     /// @brief User-Header id for an unknown user-header
     static constexpr uint16_t UNKNOWN_USER_HEADER{0xFFFF};
+    /// @brief User-Header id of the head chunk of a chained message; the user-header is a ChainedChunkHeader
+    static constexpr uint16_t CHAINED_CHUNK_USER_HEADER{0xFFFE};
 
     /// @brief The ChunkHeader version is used to detect incompatibilities for record&replay functionality
     /// @return the ChunkHeader version
@@ -143,9 +145,12 @@ struct ChunkHeader
   private:
     template <typename T>
     friend class popo::ChunkSender;
+    friend class MemoryManager;
 
     void setOriginId(const popo::UniquePortId originId) noexcept;
 
+    void setUserHeaderId(const uint16_t userHeaderId) noexcept;
+
     void setSequenceNumber(const uint64_t sequenceNumber) noexcept;
 
     uint64_t overflowSafeUsedSizeOfChunk() const noexcept;
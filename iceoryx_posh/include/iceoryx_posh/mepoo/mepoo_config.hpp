@@ -35,18 +35,32 @@ struct MePooConfig
     struct Entry
     {
         /// @brief set the size and count of memory chunks
-        Entry(uint64_t size, uint32_t chunkCount) noexcept
+        /// @param[in] overflowChunkCount number of chunks of an overflow segment which is created at runtime when the
+        /// mempool runs low on chunks; 0 disables the dynamic growth of this mempool
+        /// @param[in] maxChunksPerPublisher number of chunks of this mempool a single publisher can hold concurrently;
+        /// 0 means no limit
+        Entry(uint64_t size,
+              uint32_t chunkCount,
+              uint32_t overflowChunkCount = 0U,
+              uint32_t maxChunksPerPublisher = 0U) noexcept
             : m_size(size)
             , m_chunkCount(chunkCount)
+            , m_overflowChunkCount(overflowChunkCount)
+            , m_maxChunksPerPublisher(maxChunksPerPublisher)
         {
         }
         uint64_t m_size{0};
         uint32_t m_chunkCount{0};
+        uint32_t m_overflowChunkCount{0};
+        uint32_t m_maxChunksPerPublisher{0};
     };
 
     using MePooConfigContainerType = vector<Entry, MAX_NUMBER_OF_MEMPOOLS>;
     MePooConfigContainerType m_mempoolConfig;
 
+    /// @brief percentage of chunks in use of a size class at which an overflow segment is created
+    uint32_t m_overflowThresholdPercent{DEFAULT_OVERFLOW_THRESHOLD_PERCENT};
+
     /// @brief Default constructor to set the configuration for memory pools
     MePooConfig() noexcept = default;
 
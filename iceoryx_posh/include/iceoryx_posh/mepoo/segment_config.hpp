@@ -21,6 +21,7 @@
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iox/posix_group.hpp"
+#include "iox/posix_shared_memory_object.hpp"
 #include "iox/vector.hpp"
 
 namespace iox
@@ -34,11 +35,15 @@ struct SegmentConfig
         SegmentEntry(const PosixGroup::groupName_t& readerGroup,
                      const PosixGroup::groupName_t& writerGroup,
                      const MePooConfig& memPoolConfig,
-                     iox::mepoo::MemoryInfo memoryInfo = iox::mepoo::MemoryInfo()) noexcept
+                     iox::mepoo::MemoryInfo memoryInfo = iox::mepoo::MemoryInfo(),
+                     const NumaPlacement& numaPlacement = NumaPlacement(),
+                     const TrafficClass trafficClass = TrafficClass::UNSPECIFIED) noexcept
             : m_readerGroup(readerGroup)
             , m_writerGroup(writerGroup)
             , m_mempoolConfig(memPoolConfig)
             , m_memoryInfo(memoryInfo)
+            , m_numaPlacement(numaPlacement)
+            , m_trafficClass(trafficClass)
 
         {
         }
@@ -47,6 +52,10 @@ struct SegmentConfig
         PosixGroup::groupName_t m_writerGroup;
         MePooConfig m_mempoolConfig;
         iox::mepoo::MemoryInfo m_memoryInfo;
+        /// @brief the NUMA placement of the segment and its overflow segments
+        NumaPlacement m_numaPlacement;
+        /// @brief the traffic class by which publishers can select the segment
+        TrafficClass m_trafficClass;
     };
 
     vector<SegmentEntry, MAX_SHM_SEGMENTS> m_sharedMemorySegments;
@@ -22,6 +22,7 @@
 #include "iceoryx_posh/popo/notification_attorney.hpp"
 #include "iceoryx_posh/popo/notification_callback.hpp"
 #include "iceoryx_posh/popo/trigger_handle.hpp"
+#include "iceoryx_posh/popo/wait_strategy.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iox/atomic.hpp"
 #include "iox/detail/mpmc_loffli.hpp"
@@ -108,6 +109,10 @@ class Listener
 {
   public:
     Listener() noexcept;
+
+    /// @brief Creates a Listener whose thread waits with the provided strategy
+    /// @param[in] waitStrategy defines whether the notifications are polled before the thread blocks
+    explicit Listener(const WaitStrategy& waitStrategy) noexcept;
     Listener(const Listener&) = delete;
     Listener(Listener&&) = delete;
     ~Listener() noexcept;
@@ -174,7 +179,7 @@ class Listener
 
   protected:
     friend class iox::posh::experimental::ListenerBuilder;
-    Listener(ConditionVariableData& conditionVariableData) noexcept;
+    Listener(ConditionVariableData& conditionVariableData, const WaitStrategy& waitStrategy = {}) noexcept;
 
   private:
     class Event_t;
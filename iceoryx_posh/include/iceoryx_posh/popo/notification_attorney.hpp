@@ -26,6 +26,9 @@ namespace iox
 {
 namespace popo
 {
+class ConditionListener;
+class Timer;
+
 /// @brief Class which allows accessing private methods to
 ///         friends of NotificationAttorney. Used for example by the WaitSet.
 ///         Implements the Client-Attorney Pattern.
@@ -48,6 +51,13 @@ class NotificationAttorney
     template <typename T, typename... Targs>
     static void disableState(T& stateOrigin, Targs&&... args) noexcept;
 
+    /// @brief Hands over the ConditionListener of a WaitSet/Listener to an event origin which needs it to track
+    ///        deadlines. Does nothing for all event origins except the Timer.
+    template <typename T>
+    static void enableTimer(T& eventOrigin, ConditionListener& conditionListener) noexcept;
+
+    static void enableTimer(Timer& timer, ConditionListener& conditionListener) noexcept;
+
     template <typename T>
     static function<void(uint64_t)> getInvalidateTriggerMethod(T& eventOrigin) noexcept;
 
@@ -45,6 +45,25 @@ struct PublisherOptions
     /// @brief The option whether the publisher should block when the subscriber queue is full
     ConsumerTooSlowPolicy subscriberTooSlowPolicy{ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
 
+    /// @brief The maximum number of chunks of each mempool which the publisher can hold concurrently, including the
+    /// chunks which are still held by subscribers; 0 means no limit
+    uint32_t maxChunksPerMemPool{0U};
+
+    /// @brief The user-payload size which selects the mempool in which 'reservedChunks' are reserved
+    uint64_t reservedUserPayloadSize{0U};
+
+    /// @brief The number of chunks which are reserved exclusively for the publisher and cannot be exhausted by others
+    uint32_t reservedChunks{0U};
+
+    /// @brief The name of the writable segment the publisher allocates its chunks from, which is the name of the
+    /// writer group of the segment; the publisher cannot be created if the user has no write access to it. An empty
+    /// name selects the segment by 'trafficClass'.
+    mepoo::SegmentName_t segmentName{""};
+
+    /// @brief The traffic class of the writable segment the publisher allocates its chunks from; if none of the
+    /// writable segments of the user has this traffic class, the first writable segment is used
+    mepoo::TrafficClass trafficClass{mepoo::TrafficClass::UNSPECIFIED};
+
     /// @brief serialization of the PublisherOptions
     Serialization serialize() const noexcept;
     /// @brief deserialization of the PublisherOptions
@@ -52,6 +52,13 @@ struct SubscriberOptions
     ///        i.e. require historyCapacity > 0 to be eligible to be connected
     bool requiresPublisherHistorySupport{false};
 
+    /// @brief The option whether the subscriber reads only the latest chunk of the publisher instead of using a queue.
+    /// The publisher provides its latest chunk without notifications and without a per-subscriber cost, therefore the
+    /// subscriber is not signaled by a WaitSet or Listener. A chunk is returned only once, i.e. 'take' fails until the
+    /// publisher sent a new chunk. The latest chunk becomes available with the first publish after the subscription.
+    /// @note With multiple publishers the subscriber reads from the one which accepted the subscription last
+    bool latestValueOnly{false};
+
     /// @brief serialization of the SubscriberOptions
     Serialization serialize() const noexcept;
     /// @brief deserialization of the SubscriberOptions
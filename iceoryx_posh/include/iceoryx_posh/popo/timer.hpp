@@ -0,0 +1,109 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_POPO_TIMER_HPP
+#define IOX_POSH_POPO_TIMER_HPP
+
+#include "iceoryx_posh/internal/popo/building_blocks/timer_queue.hpp"
+#include "iceoryx_posh/popo/trigger_handle.hpp"
+#include "iox/duration.hpp"
+
+#include <mutex>
+
+namespace iox
+{
+namespace popo
+{
+class ConditionListener;
+
+/// @brief A timer which notifies a WaitSet or Listener when it expires. The deadlines are tracked by the WaitSet or
+///        Listener the timer is attached to, i.e. no additional thread is required and the wait is bounded by the
+///        next expiration.
+/// @code
+///   popo::Timer timer(100_ms);
+///   waitset.attachEvent(timer);
+///   timer.start();
+///   auto notifications = waitset.wait(); // returns every 100ms
+/// @endcode
+class Timer
+{
+  public:
+    /// @brief Creates a stopped timer
+    /// @param[in] period the time between two expirations, or until the expiration of a one shot timer; must be
+    ///            greater than zero
+    /// @param[in] mode defines whether the timer expires once or periodically
+    explicit Timer(const units::Duration period, const TimerMode mode = TimerMode::PERIODIC) noexcept;
+    ~Timer() noexcept;
+
+    Timer(const Timer&) = delete;
+    Timer(Timer&&) = delete;
+    Timer& operator=(const Timer&) = delete;
+    Timer& operator=(Timer&&) = delete;
+
+    /// @brief Starts the timer. The first expiration is one period after the call, a running timer is restarted.
+    ///        A timer which is started before it is attached begins to run when it is attached.
+    void start() noexcept;
+
+    /// @brief Stops the timer
+    void stop() noexcept;
+
+    /// @brief Checks whether the timer is started
+    /// @return true if the timer is started and not yet expired as one shot timer, otherwise false
+    bool isRunning() const noexcept;
+
+    /// @brief Returns the period of the timer
+    units::Duration getPeriod() const noexcept;
+
+    /// @brief Returns the mode of the timer
+    TimerMode getMode() const noexcept;
+
+    friend class NotificationAttorney;
+
+  private:
+    /// @brief Only usable by the WaitSet/Listener, not for public use. Invalidates the internal triggerHandle.
+    /// @param[in] uniqueTriggerId the id of the corresponding trigger
+    void invalidateTrigger(const uint64_t uniqueTriggerId) noexcept;
+
+    /// @brief Only usable by the WaitSet/Listener, not for public use. Attaches the triggerHandle to the internal
+    ///        trigger.
+    /// @param[in] triggerHandle rvalue reference to the triggerHandle. This class takes the ownership of that handle.
+    void enableEvent(TriggerHandle&& triggerHandle) noexcept;
+
+    /// @brief Only usable by the WaitSet/Listener, not for public use. Hands over the ConditionListener which tracks
+    ///        the deadlines of the timer.
+    /// @param[in] conditionListener the ConditionListener of the WaitSet/Listener the timer is attached to
+    void enableTimer(ConditionListener& conditionListener) noexcept;
+
+    /// @brief Only usable by the WaitSet/Listener, not for public use. Stops the timer and resets the internal
+    ///        triggerHandle.
+    void disableEvent() noexcept;
+
+    void stopAndDetachUnchecked() noexcept;
+
+  private:
+    units::Duration m_period;
+    TimerMode m_mode;
+    mutable std::recursive_mutex m_mutex;
+    bool m_isStartRequested{false};
+    ConditionListener* m_conditionListener{nullptr};
+    TriggerHandle m_trigger;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_TIMER_HPP
@@ -26,6 +26,7 @@
 #include "iceoryx_posh/popo/notification_info.hpp"
 #include "iceoryx_posh/popo/trigger.hpp"
 #include "iceoryx_posh/popo/trigger_handle.hpp"
+#include "iceoryx_posh/popo/wait_strategy.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iox/algorithm.hpp"
 #include "iox/assertions.hpp"
@@ -66,6 +67,10 @@ class WaitSet
     using NotificationInfoVector = vector<const NotificationInfo*, CAPACITY>;
 
     WaitSet() noexcept;
+
+    /// @brief Creates a WaitSet which waits with the provided strategy
+    /// @param[in] waitStrategy defines whether the notifications are polled before wait() and timedWait() block
+    explicit WaitSet(const WaitStrategy& waitStrategy) noexcept;
     ~WaitSet() noexcept;
 
     /// @brief all the Trigger have a pointer pointing to this waitset for cleanup
@@ -214,7 +219,7 @@ class WaitSet
 
   protected:
     friend class iox::posh::experimental::WaitSetBuilder;
-    explicit WaitSet(ConditionVariableData& condVarData) noexcept;
+    explicit WaitSet(ConditionVariableData& condVarData, const WaitStrategy& waitStrategy = {}) noexcept;
 
   private:
     enum class NoStateEnumUsed : StateEnumIdentifier
@@ -0,0 +1,45 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_POPO_WAIT_STRATEGY_HPP
+#define IOX_POSH_POPO_WAIT_STRATEGY_HPP
+
+#include "iox/duration.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Defines how a WaitSet or a Listener waits for notifications. By default the waiting thread blocks right
+///        away on the semaphore of the condition variable. With a spin duration the notification flags are polled
+///        for the given time before the thread blocks. This removes the wakeup latency of the semaphore for
+///        notifications which arrive while polling, at the cost of a busy cpu. Notifiers do not post the semaphore
+///        while the waiter is polling.
+struct WaitStrategy
+{
+    /// @brief The time the notification flags are polled before the thread blocks, zero disables polling
+    units::Duration spinDuration{units::Duration::zero()};
+
+    /// @brief Emits a cpu relax hint ('pause' on x86, 'yield' on arm) in each poll iteration to reduce the power
+    ///        consumption and the pressure on a sibling hyper-thread
+    bool relaxCpu{true};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_WAIT_STRATEGY_HPP
@@ -21,6 +21,7 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/popo/publisher_options.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
+#include "iox/posix_shared_memory_object.hpp"
 #include "iox/vector.hpp"
 
 namespace iox
@@ -43,11 +44,31 @@ struct MemPoolInfo
     uint32_t m_numChunks{0};
     uint64_t m_chunkSize{0};
     uint64_t m_chunkPayloadSize{0};
+    /// @brief number of chunks which are reserved for publishers with a chunk quota
+    uint32_t m_reservedChunks{0};
+    /// @brief number of overflow segments created at runtime; their chunks are included in the counters above
+    uint32_t m_numOverflowSegments{0};
 };
 
 /// @brief container for MemPoolInfo structs of all available mempools.
 using MemPoolInfoContainer = vector<MemPoolInfo, MAX_NUMBER_OF_MEMPOOLS>;
 
+/// @brief struct for the storage of the statistics of the chunk requests with a required chunk size in the range of a
+/// size class of the chunk size histogram
+struct ChunkSizeClassInfo
+{
+    /// @brief the largest required chunk size, including the ChunkHeader, which falls into the size class
+    uint64_t m_chunkSize{0};
+    uint64_t m_numRequests{0};
+    uint32_t m_chunksInUse{0};
+    uint32_t m_peakChunksInUse{0};
+};
+
+/// @brief container for the requested size classes of a segment, ordered by increasing chunk size. Since a segment
+/// cannot have more mempools than MAX_NUMBER_OF_MEMPOOLS, the capacity is limited accordingly; if more size classes
+/// were requested, the largest ones are merged.
+using ChunkSizeHistogramContainer = vector<ChunkSizeClassInfo, MAX_NUMBER_OF_MEMPOOLS>;
+
 /// @brief the topic for the mempool introspection that a user can subscribe to
 struct MemPoolIntrospectionInfo
 {
@@ -56,6 +77,15 @@ struct MemPoolIntrospectionInfo
     GroupName_t m_writerGroupName;
     GroupName_t m_readerGroupName;
     MemPoolInfoContainer m_mempoolInfo;
+    ChunkSizeHistogramContainer m_chunkSizeHistogram;
+    /// @brief the NUMA placement which was configured for the segment
+    NumaPlacement m_numaPlacement;
+    /// @brief true if m_numaNode is valid, false if the platform does not support NUMA
+    bool m_hasNumaNode{false};
+    /// @brief the NUMA node the first page of the segment was placed on
+    uint32_t m_numaNode{0};
+    /// @brief the traffic class by which publishers can select the segment
+    mepoo::TrafficClass m_trafficClass{mepoo::TrafficClass::UNSPECIFIED};
 };
 
 /// @brief container for MemPoolInfo structs of all available mempools.
@@ -105,6 +135,14 @@ struct PortThroughputData
     double m_chunksPerMinute{0};
     uint64_t m_lastSendIntervalInNanoseconds{0};
     bool m_isField{false};
+    /// @brief whether the publisher is subject to a chunk quota; the following counters are only valid if it is
+    bool m_hasChunkQuota{false};
+    /// @brief number of chunks of all mempools which are accounted to the publisher, including the ones held by
+    /// subscribers
+    uint32_t m_chunksInUse{0};
+    uint32_t m_reservedChunks{0};
+    uint32_t m_reservedChunksInUse{0};
+    uint64_t m_numberOfQuotaExceededRequests{0};
 };
 
 /// @brief the topic for the port throughput that a user can subscribe to
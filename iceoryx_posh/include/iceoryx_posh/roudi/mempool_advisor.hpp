@@ -0,0 +1,43 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_MEMPOOL_ADVISOR_HPP
+#define IOX_POSH_ROUDI_MEMPOOL_ADVISOR_HPP
+
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_posh/roudi/introspection_types.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+constexpr uint32_t DEFAULT_MEMPOOL_ADVISOR_HEADROOM_PERCENT{25U};
+
+/// @brief Derives the mempool configuration with the minimal memory footprint which would have served all chunk
+/// requests recorded in the chunk size histogram of a segment. Each requested size class gets its own mempool with the
+/// largest chunk-payload size of the size class and the peak number of concurrently used chunks plus the headroom.
+/// @param[in] chunkSizeHistogram of the segment as published by the mempool introspection
+/// @param[in] headroomPercent additional chunks in percent of the observed peak usage; at least one chunk per mempool
+/// @return the advised MePooConfig with the mempools ordered by increasing size; empty if no chunks were requested
+mepoo::MePooConfig adviseMePooConfig(const ChunkSizeHistogramContainer& chunkSizeHistogram,
+                                     const uint32_t headroomPercent) noexcept;
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_MEMPOOL_ADVISOR_HPP
@@ -46,6 +46,8 @@ enum class RouDiConfigFileParseError
     MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED,
     MEMPOOL_WITHOUT_CHUNK_SIZE,
     MEMPOOL_WITHOUT_CHUNK_COUNT,
+    SEGMENT_WITH_CONFLICTING_NUMA_PLACEMENT,
+    SEGMENT_WITH_INVALID_TRAFFIC_CLASS,
     EXCEPTION_IN_PARSER
 };
 
@@ -58,6 +60,8 @@ constexpr const char* ROUDI_CONFIG_FILE_PARSE_ERROR_STRINGS[] = {"FILE_OPEN_FAIL
                                                                  "MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED",
                                                                  "MEMPOOL_WITHOUT_CHUNK_SIZE",
                                                                  "MEMPOOL_WITHOUT_CHUNK_COUNT",
+                                                                 "SEGMENT_WITH_CONFLICTING_NUMA_PLACEMENT",
+                                                                 "SEGMENT_WITH_INVALID_TRAFFIC_CLASS",
                                                                  "EXCEPTION_IN_PARSER"};
 
 /// @brief Base class for a config file provider.
@@ -68,6 +68,19 @@ class PoshRuntime
     /// @return active runtime
     static PoshRuntime& initRuntime(const RuntimeName_t& name) noexcept;
 
+    /// @brief creates the runtime with given name and registers it with the RouDi daemon of the given domain
+    ///
+    /// @param[in] name used for registering the process with the RouDi daemon.
+    ///            Must be a valid platform-independent file name, see
+    ///            iox::isValidPathEntry
+    /// @param[in] domainId of the RouDi daemon to register with
+    ///
+    /// @note The domain ID is an experimental feature and is only taken into account when iceoryx is compiled
+    ///       with the 'IOX_EXPERIMENTAL_POSH' cmake option. It is ignored by custom runtime factories.
+    ///
+    /// @return active runtime
+    static PoshRuntime& initRuntime(const RuntimeName_t& name, const DomainId domainId) noexcept;
+
     /// @brief provides an object to extend the lifetime of the runtime
     /// @details While the PoshRuntime has static lifetime, it may not live long enough
     ///          when other static variables depend, possibly indirectly, on the PoshRuntime.
@@ -0,0 +1,34 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/mepoo/chained_payload.hpp"
+
+namespace iox
+{
+namespace mepoo
+{
+ChainedChunkHeader::ContinuationChunk_t* ChainedChunkHeader::continuationChunks() noexcept
+{
+    return reinterpret_cast<ContinuationChunk_t*>(this + 1U);
+}
+
+const ChainedChunkHeader::ContinuationChunk_t* ChainedChunkHeader::continuationChunks() const noexcept
+{
+    return reinterpret_cast<const ContinuationChunk_t*>(this + 1U);
+}
+
+} // namespace mepoo
+} // namespace iox
@@ -216,6 +216,11 @@ uint64_t ChunkHeader::sequenceNumber() const noexcept
     return m_sequenceNumber;
 }
 
+void ChunkHeader::setUserHeaderId(const uint16_t userHeaderId) noexcept
+{
+    m_userHeaderId = userHeaderId;
+}
+
 void ChunkHeader::setSequenceNumber(const uint64_t sequenceNumber) noexcept
 {
     m_sequenceNumber = sequenceNumber;
@@ -0,0 +1,135 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/mepoo/chunk_quota.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+
+namespace iox
+{
+namespace mepoo
+{
+bool ChunkQuota::tryActivate(const uint32_t maxChunksPerMemPool) noexcept
+{
+    uint32_t unused{0U};
+    if (!m_references.compare_exchange_strong(unused, 1U, std::memory_order_acquire, std::memory_order_relaxed))
+    {
+        return false;
+    }
+
+    m_maxChunksPerMemPool = maxChunksPerMemPool;
+    m_reservedMemPoolIndex = 0U;
+    m_reservedChunks = 0U;
+    m_reservedMemPool = nullptr;
+    m_reservedChunksInUse.store(0U, std::memory_order_relaxed);
+    m_numberOfExceededRequests.store(0U, std::memory_order_relaxed);
+    for (auto& chunksInUse : m_chunksInUse)
+    {
+        chunksInUse.store(0U, std::memory_order_relaxed);
+    }
+    return true;
+}
+
+bool ChunkQuota::reserve(MemPool& memPool, const uint32_t memPoolIndex, const uint32_t numberOfChunks) noexcept
+{
+    if (memPoolIndex >= MAX_NUMBER_OF_MEMPOOLS || !memPool.reserveChunks(numberOfChunks))
+    {
+        return false;
+    }
+
+    m_reservedMemPoolIndex = memPoolIndex;
+    m_reservedChunks = numberOfChunks;
+    m_reservedMemPool = &memPool;
+    return true;
+}
+
+void ChunkQuota::deactivate() noexcept
+{
+    dropReference();
+}
+
+bool ChunkQuota::isWithinLimit(const uint32_t memPoolIndex, const uint32_t maxChunksPerMemPool) const noexcept
+{
+    const auto chunksInUse = m_chunksInUse[memPoolIndex].load(std::memory_order_relaxed);
+    return (m_maxChunksPerMemPool == 0U || chunksInUse < m_maxChunksPerMemPool)
+           && (maxChunksPerMemPool == 0U || chunksInUse < maxChunksPerMemPool);
+}
+
+void ChunkQuota::recordExceededRequest() noexcept
+{
+    m_numberOfExceededRequests.fetch_add(1U, std::memory_order_relaxed);
+}
+
+bool ChunkQuota::tryTakeReservedChunk(const uint32_t memPoolIndex) noexcept
+{
+    if (m_reservedChunks == 0U || memPoolIndex != m_reservedMemPoolIndex
+        || m_reservedChunksInUse.load(std::memory_order_relaxed) >= m_reservedChunks)
+    {
+        return false;
+    }
+
+    // the releases only decrement the counter and there is only one acquirer, therefore the check above stays valid
+    m_reservedChunksInUse.fetch_add(1U, std::memory_order_relaxed);
+    return true;
+}
+
+void ChunkQuota::returnReservedChunk() noexcept
+{
+    m_reservedChunksInUse.fetch_sub(1U, std::memory_order_relaxed);
+}
+
+void ChunkQuota::recordAcquisition(const uint32_t memPoolIndex) noexcept
+{
+    m_references.fetch_add(1U, std::memory_order_relaxed);
+    m_chunksInUse[memPoolIndex].fetch_add(1U, std::memory_order_relaxed);
+}
+
+void ChunkQuota::recordRelease(const uint32_t memPoolIndex, const bool isReservedChunk) noexcept
+{
+    m_chunksInUse[memPoolIndex].fetch_sub(1U, std::memory_order_relaxed);
+    if (isReservedChunk)
+    {
+        m_reservedChunksInUse.fetch_sub(1U, std::memory_order_relaxed);
+    }
+    dropReference();
+}
+
+ChunkQuotaInfo ChunkQuota::getInfo() const noexcept
+{
+    ChunkQuotaInfo info;
+    for (const auto& chunksInUse : m_chunksInUse)
+    {
+        info.m_chunksInUse += chunksInUse.load(std::memory_order_relaxed);
+    }
+    info.m_reservedChunks = m_reservedChunks;
+    info.m_reservedChunksInUse = m_reservedChunksInUse.load(std::memory_order_relaxed);
+    info.m_numberOfExceededRequests = m_numberOfExceededRequests.load(std::memory_order_relaxed);
+    return info;
+}
+
+void ChunkQuota::dropReference() noexcept
+{
+    // the reservation must be read before the reference is dropped since the ChunkQuota can be reused afterwards
+    auto* reservedMemPool = m_reservedMemPool.get();
+    const auto reservedChunks = m_reservedChunks;
+    if (m_references.fetch_sub(1U, std::memory_order_acq_rel) == 1U && reservedMemPool != nullptr)
+    {
+        reservedMemPool->unreserveChunks(reservedChunks);
+    }
+}
+
+} // namespace mepoo
+} // namespace iox
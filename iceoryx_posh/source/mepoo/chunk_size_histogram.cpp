@@ -0,0 +1,128 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/chunk_size_histogram.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/mepoo/chunk_settings.hpp"
+
+namespace iox
+{
+namespace mepoo
+{
+namespace
+{
+uint32_t floorLog2(uint64_t value) noexcept
+{
+    uint32_t result{0U};
+    for (uint32_t shift = 32U; shift > 0U; shift /= 2U)
+    {
+        if ((value >> shift) != 0U)
+        {
+            value >>= shift;
+            result += shift;
+        }
+    }
+    return result;
+}
+
+constexpr uint32_t MIN_CHUNK_SIZE_LOG2{6U};
+static_assert((1U << MIN_CHUNK_SIZE_LOG2) == ChunkSizeHistogram::MIN_CHUNK_SIZE, "MIN_CHUNK_SIZE must be 2^6");
+constexpr uint32_t SUB_CLASSES_LOG2{2U};
+static_assert((1U << SUB_CLASSES_LOG2) == ChunkSizeHistogram::SUB_CLASSES_PER_POWER_OF_TWO,
+              "SUB_CLASSES_PER_POWER_OF_TWO must be 2^2");
+} // namespace
+
+void ChunkSizeHistogram::recordAcquisition(const uint64_t requiredChunkSize) noexcept
+{
+    auto& sizeClass = m_sizeClasses[ChunkSizeHistogram::sizeClass(requiredChunkSize)];
+    sizeClass.m_numRequests.fetch_add(1U, std::memory_order_relaxed);
+    const auto chunksInUse = sizeClass.m_chunksInUse.fetch_add(1U, std::memory_order_relaxed) + 1U;
+
+    auto peakChunksInUse = sizeClass.m_peakChunksInUse.load(std::memory_order_relaxed);
+    while (peakChunksInUse < chunksInUse
+           && !sizeClass.m_peakChunksInUse.compare_exchange_weak(
+               peakChunksInUse, chunksInUse, std::memory_order_relaxed, std::memory_order_relaxed))
+    {
+    }
+}
+
+void ChunkSizeHistogram::recordRelease(const ChunkHeader& chunkHeader) noexcept
+{
+    auto& sizeClass = m_sizeClasses[ChunkSizeHistogram::sizeClass(requiredChunkSize(chunkHeader))];
+    sizeClass.m_chunksInUse.fetch_sub(1U, std::memory_order_relaxed);
+}
+
+ChunkSizeClassInfo ChunkSizeHistogram::getSizeClassInfo(const uint32_t sizeClass) const noexcept
+{
+    if (sizeClass >= NUMBER_OF_SIZE_CLASSES)
+    {
+        return ChunkSizeClassInfo();
+    }
+
+    const auto& entry = m_sizeClasses[sizeClass];
+    ChunkSizeClassInfo info;
+    info.m_chunkSize = sizeClassUpperBound(sizeClass);
+    info.m_numRequests = entry.m_numRequests.load(std::memory_order_relaxed);
+    info.m_chunksInUse = entry.m_chunksInUse.load(std::memory_order_relaxed);
+    info.m_peakChunksInUse = entry.m_peakChunksInUse.load(std::memory_order_relaxed);
+    return info;
+}
+
+uint32_t ChunkSizeHistogram::sizeClass(const uint64_t requiredChunkSize) noexcept
+{
+    if (requiredChunkSize <= MIN_CHUNK_SIZE)
+    {
+        return 0U;
+    }
+
+    // the upper bound of a size class belongs to the size class, therefore the classification is done with the
+    // predecessor; e.g. with 4 sub classes the range (64, 128] is split into (64, 80], (80, 96], (96, 112], (112, 128]
+    const uint64_t value = requiredChunkSize - 1U;
+    const uint32_t log2 = floorLog2(value);
+    const auto subClass =
+        static_cast<uint32_t>((value >> (log2 - SUB_CLASSES_LOG2)) & (SUB_CLASSES_PER_POWER_OF_TWO - 1U));
+    const uint32_t index = 1U + (log2 - MIN_CHUNK_SIZE_LOG2) * SUB_CLASSES_PER_POWER_OF_TWO + subClass;
+
+    return (index < NUMBER_OF_SIZE_CLASSES) ? index : NUMBER_OF_SIZE_CLASSES - 1U;
+}
+
+uint64_t ChunkSizeHistogram::sizeClassUpperBound(const uint32_t sizeClass) noexcept
+{
+    if (sizeClass == 0U)
+    {
+        return MIN_CHUNK_SIZE;
+    }
+
+    const uint32_t log2 = MIN_CHUNK_SIZE_LOG2 + (sizeClass - 1U) / SUB_CLASSES_PER_POWER_OF_TWO;
+    const uint64_t subClass = (sizeClass - 1U) % SUB_CLASSES_PER_POWER_OF_TWO;
+    return (SUB_CLASSES_PER_POWER_OF_TWO + subClass + 1U) << (log2 - SUB_CLASSES_LOG2);
+}
+
+uint64_t ChunkSizeHistogram::requiredChunkSize(const ChunkHeader& chunkHeader) noexcept
+{
+    // the user-header alignment does not contribute to the required chunk size and is not stored in the ChunkHeader;
+    // an alignment of 1 is always valid
+    constexpr uint32_t USER_HEADER_ALIGNMENT{1U};
+    auto chunkSettings = ChunkSettings::create(chunkHeader.userPayloadSize(),
+                                               chunkHeader.userPayloadAlignment(),
+                                               chunkHeader.userHeaderSize(),
+                                               USER_HEADER_ALIGNMENT);
+    // the chunk was acquired with these settings, the fallback is only a safeguard against a corrupted ChunkHeader
+    return chunkSettings.has_value() ? chunkSettings.value().requiredChunkSize() : chunkHeader.usedSizeOfChunk();
+}
+
+} // namespace mepoo
+} // namespace iox
@@ -0,0 +1,67 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/latest_chunk_slot.hpp"
+
+namespace iox
+{
+namespace mepoo
+{
+void LatestChunkSlot::store(const SharedChunk& chunk) noexcept
+{
+    // the copy of the SharedChunk is the reference which is owned by the slot
+    ShmSafeUnmanagedChunk newChunk{chunk};
+    auto previousChunk = m_chunk.exchange(newChunk, std::memory_order_acq_rel);
+    // d'tor of the SharedChunk releases the reference the slot held to the previous chunk
+    previousChunk.releaseToSharedChunk();
+}
+
+void LatestChunkSlot::clear() noexcept
+{
+    store(SharedChunk());
+}
+
+SharedChunk LatestChunkSlot::tryAcquire() noexcept
+{
+    auto observedChunk = m_chunk.load(std::memory_order_acquire);
+    while (!observedChunk.isLogicalNullptr())
+    {
+        // the chunk is only resurrected if the slot still holds a reference; if the writer already released it, the
+        // reference counter is zero and a new value is stored in the slot
+        auto chunk = observedChunk.tryCloneToSharedChunk();
+
+        auto currentChunk = m_chunk.load(std::memory_order_acquire);
+        if (chunk && (currentChunk == observedChunk))
+        {
+            // the slot still holds a reference to the chunk, therefore the acquired reference is for the stored chunk
+            // and not for a recycled one
+            return chunk;
+        }
+
+        // d'tor of the SharedChunk releases the reference to the outdated chunk
+        observedChunk = currentChunk;
+    }
+
+    return SharedChunk();
+}
+
+bool LatestChunkSlot::isEmpty() const noexcept
+{
+    return m_chunk.load(std::memory_order_relaxed).isLogicalNullptr();
+}
+
+} // namespace mepoo
+} // namespace iox
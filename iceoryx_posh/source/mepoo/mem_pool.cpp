@@ -30,11 +30,13 @@ namespace mepoo
 MemPoolInfo::MemPoolInfo(const uint32_t usedChunks,
                          const uint32_t minFreeChunks,
                          const uint32_t numChunks,
-                         const uint64_t chunkSize) noexcept
+                         const uint64_t chunkSize,
+                         const uint32_t reservedChunks) noexcept
     : m_usedChunks(usedChunks)
     , m_minFreeChunks(minFreeChunks)
     , m_numChunks(numChunks)
     , m_chunkSize(chunkSize)
+    , m_reservedChunks(reservedChunks)
 {
 }
 
@@ -47,6 +49,7 @@ MemPool::MemPool(const greater_or_equal<uint64_t, CHUNK_MEMORY_ALIGNMENT> chunkS
     : m_chunkSize(chunkSize)
     , m_numberOfChunks(numberOfChunks)
     , m_minFree(numberOfChunks)
+    , m_unreservedChunks(numberOfChunks)
 {
     if (isMultipleOfAlignment(chunkSize))
     {
@@ -84,6 +87,36 @@ void MemPool::adjustMinFree() noexcept
 }
 
 void* MemPool::getChunk() noexcept
+{
+    auto unreservedChunks = m_unreservedChunks.load(std::memory_order_relaxed);
+    do
+    {
+        if (unreservedChunks == 0U)
+        {
+            IOX_LOG(Warn,
+                    "Mempool [m_chunkSize = " << m_chunkSize << ", numberOfChunks = " << m_numberOfChunks
+                                              << ", used_chunks = " << m_usedChunks.load()
+                                              << ", reserved_chunks = " << m_reservedChunks.load()
+                                              << " ] has no more space left");
+            return nullptr;
+        }
+    } while (!m_unreservedChunks.compare_exchange_weak(
+        unreservedChunks, unreservedChunks - 1U, std::memory_order_relaxed, std::memory_order_relaxed));
+
+    auto* chunk = popChunk();
+    if (chunk == nullptr)
+    {
+        m_unreservedChunks.fetch_add(1U, std::memory_order_relaxed);
+    }
+    return chunk;
+}
+
+void* MemPool::getReservedChunk() noexcept
+{
+    return popChunk();
+}
+
+void* MemPool::popChunk() noexcept
 {
     uint32_t index{0U};
     if (!m_freeIndices.pop(index))
@@ -127,6 +160,46 @@ MemPool::pointerToIndex(const void* const chunk, const uint64_t chunkSize, const
 }
 
 void MemPool::freeChunk(const void* chunk) noexcept
+{
+    pushChunk(chunk);
+    m_unreservedChunks.fetch_add(1U, std::memory_order_relaxed);
+}
+
+void MemPool::freeReservedChunk(const void* chunk) noexcept
+{
+    pushChunk(chunk);
+}
+
+bool MemPool::reserveChunks(const uint32_t numberOfChunks) noexcept
+{
+    auto unreservedChunks = m_unreservedChunks.load(std::memory_order_relaxed);
+    do
+    {
+        if (unreservedChunks < numberOfChunks)
+        {
+            return false;
+        }
+    } while (!m_unreservedChunks.compare_exchange_weak(unreservedChunks,
+                                                       unreservedChunks - numberOfChunks,
+                                                       std::memory_order_relaxed,
+                                                       std::memory_order_relaxed));
+
+    m_reservedChunks.fetch_add(numberOfChunks, std::memory_order_relaxed);
+    return true;
+}
+
+void MemPool::unreserveChunks(const uint32_t numberOfChunks) noexcept
+{
+    m_reservedChunks.fetch_sub(numberOfChunks, std::memory_order_relaxed);
+    m_unreservedChunks.fetch_add(numberOfChunks, std::memory_order_relaxed);
+}
+
+uint32_t MemPool::getReservedChunks() const noexcept
+{
+    return m_reservedChunks.load(std::memory_order_relaxed);
+}
+
+void MemPool::pushChunk(const void* chunk) noexcept
 {
     const auto memPoolStartAddress = m_rawMemory.get();
     const auto offsetToLastChunk = m_chunkSize * (m_numberOfChunks - 1U);
@@ -167,6 +240,13 @@ uint32_t MemPool::getChunkCount() const noexcept
     return m_numberOfChunks;
 }
 
+bool MemPool::containsChunk(const void* const chunk) const noexcept
+{
+    const auto chunkAddress = reinterpret_cast<uint64_t>(chunk);
+    const auto memPoolStartAddress = reinterpret_cast<uint64_t>(m_rawMemory.get());
+    return chunkAddress >= memPoolStartAddress && chunkAddress - memPoolStartAddress < m_chunkSize * m_numberOfChunks;
+}
+
 uint32_t MemPool::getUsedChunks() const noexcept
 {
     return m_usedChunks.load(std::memory_order_relaxed);
@@ -177,12 +257,23 @@ uint32_t MemPool::getMinFree() const noexcept
     return m_minFree.load(std::memory_order_relaxed);
 }
 
+void MemPool::setChunkSizeHistogram(ChunkSizeHistogram* const chunkSizeHistogram) noexcept
+{
+    m_chunkSizeHistogram = chunkSizeHistogram;
+}
+
+ChunkSizeHistogram* MemPool::getChunkSizeHistogram() const noexcept
+{
+    return m_chunkSizeHistogram.get();
+}
+
 MemPoolInfo MemPool::getInfo() const noexcept
 {
     return {m_usedChunks.load(std::memory_order_relaxed),
             m_minFree.load(std::memory_order_relaxed),
             m_numberOfChunks,
-            m_chunkSize};
+            m_chunkSize,
+            m_reservedChunks.load(std::memory_order_relaxed)};
 }
 
 } // namespace mepoo
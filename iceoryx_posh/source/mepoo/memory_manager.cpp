@@ -19,6 +19,7 @@
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iceoryx_posh/mepoo/chained_payload.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iox/logging.hpp"
@@ -65,6 +66,7 @@ void MemoryManager::addMemPool(BumpAllocator& managementAllocator,
     }
 
     m_memPoolVector.emplace_back(adjustedChunkSize, numberOfChunks, managementAllocator, chunkMemoryAllocator);
+    m_memPoolVector.back().setChunkSizeHistogram(&m_chunkSizeHistogram);
     m_totalNumberOfChunks += numberOfChunks;
 }
 
@@ -89,6 +91,143 @@ MemPoolInfo MemoryManager::getMemPoolInfo(const uint32_t index) const noexcept
     return m_memPoolVector[index].getInfo();
 }
 
+MemPoolInfo MemoryManager::getOverflowMemPoolInfo(const uint32_t index) const noexcept
+{
+    if (index >= m_memPoolVector.size())
+    {
+        return {0, 0, 0, 0};
+    }
+
+    MemPoolInfo info{0, 0, 0, m_memPoolVector[index].getChunkSize()};
+    const auto numberOfOverflowMemPools = m_numberOfOverflowMemPools.load(std::memory_order_acquire);
+    for (uint32_t i = 0U; i < numberOfOverflowMemPools; ++i)
+    {
+        const auto& overflowMemPool = m_overflowMemPools[i];
+        if (overflowMemPool.m_index == index)
+        {
+            const auto overflowInfo = overflowMemPool.m_memPool->getInfo();
+            info.m_usedChunks += overflowInfo.m_usedChunks;
+            info.m_minFreeChunks += overflowInfo.m_minFreeChunks;
+            info.m_numChunks += overflowInfo.m_numChunks;
+        }
+    }
+    return info;
+}
+
+uint32_t MemoryManager::getNumberOfOverflowMemPools(const uint32_t index) const noexcept
+{
+    uint32_t numberOfMemPools{0U};
+    const auto numberOfOverflowMemPools = m_numberOfOverflowMemPools.load(std::memory_order_acquire);
+    for (uint32_t i = 0U; i < numberOfOverflowMemPools; ++i)
+    {
+        if (m_overflowMemPools[i].m_index == index)
+        {
+            ++numberOfMemPools;
+        }
+    }
+    return numberOfMemPools;
+}
+
+optional<uint32_t> MemoryManager::getMemPoolIndexRequiringOverflow() const noexcept
+{
+    if (m_numberOfOverflowMemPools.load(std::memory_order_relaxed) >= MAX_NUMBER_OF_OVERFLOW_SEGMENTS_PER_SEGMENT)
+    {
+        return nullopt;
+    }
+
+    for (uint32_t index = 0U; index < m_memPoolVector.size(); ++index)
+    {
+        if (m_overflowChunkCounts[index] == 0U)
+        {
+            continue;
+        }
+
+        const auto info = m_memPoolVector[index].getInfo();
+        const auto overflowInfo = getOverflowMemPoolInfo(index);
+        const uint64_t usedChunks = static_cast<uint64_t>(info.m_usedChunks) + overflowInfo.m_usedChunks;
+        const uint64_t numberOfChunks = static_cast<uint64_t>(info.m_numChunks) + overflowInfo.m_numChunks;
+        if (usedChunks * 100U >= numberOfChunks * m_overflowThresholdPercent)
+        {
+            return index;
+        }
+    }
+    return nullopt;
+}
+
+uint64_t MemoryManager::requiredOverflowMemorySize(const uint32_t index) const noexcept
+{
+    if (index >= m_memPoolVector.size() || m_overflowChunkCounts[index] == 0U)
+    {
+        return 0U;
+    }
+
+    const uint64_t numberOfChunks{m_overflowChunkCounts[index]};
+    const uint64_t memPoolSize = align(static_cast<uint64_t>(sizeof(MemPool)), MemPool::CHUNK_MEMORY_ALIGNMENT);
+    const uint64_t indexMemorySize =
+        align(MemPool::freeList_t::requiredIndexMemorySize(numberOfChunks), MemPool::CHUNK_MEMORY_ALIGNMENT);
+
+    // the mempool for the chunks and the one for their chunk management
+    return 2U * (memPoolSize + indexMemorySize)
+           + align(numberOfChunks * m_memPoolVector[index].getChunkSize(), MemPool::CHUNK_MEMORY_ALIGNMENT)
+           + align(numberOfChunks * sizeof(ChunkManagement), MemPool::CHUNK_MEMORY_ALIGNMENT);
+}
+
+bool MemoryManager::addOverflowMemPool(const uint32_t index, BumpAllocator& overflowAllocator) noexcept
+{
+    const auto numberOfOverflowMemPools = m_numberOfOverflowMemPools.load(std::memory_order_relaxed);
+    if (index >= m_memPoolVector.size() || m_overflowChunkCounts[index] == 0U
+        || numberOfOverflowMemPools >= MAX_NUMBER_OF_OVERFLOW_SEGMENTS_PER_SEGMENT)
+    {
+        return false;
+    }
+
+    const auto numberOfChunks = m_overflowChunkCounts[index];
+    auto memPoolMemory = overflowAllocator.allocate(sizeof(MemPool), alignof(MemPool));
+    auto chunkManagementPoolMemory = overflowAllocator.allocate(sizeof(MemPool), alignof(MemPool));
+    if (memPoolMemory.has_error() || chunkManagementPoolMemory.has_error())
+    {
+        IOX_LOG(Error, "Not enough memory for the overflow mempool with " << numberOfChunks << " chunks!");
+        return false;
+    }
+
+    auto& overflowMemPool = m_overflowMemPools[numberOfOverflowMemPools];
+    overflowMemPool.m_index = index;
+    overflowMemPool.m_memPool = new (memPoolMemory.value())
+        MemPool(m_memPoolVector[index].getChunkSize(), numberOfChunks, overflowAllocator, overflowAllocator);
+    overflowMemPool.m_memPool->setChunkSizeHistogram(&m_chunkSizeHistogram);
+    overflowMemPool.m_chunkManagementPool = new (chunkManagementPoolMemory.value())
+        MemPool(sizeof(ChunkManagement), numberOfChunks, overflowAllocator, overflowAllocator);
+
+    m_numberOfOverflowMemPools.store(numberOfOverflowMemPools + 1U, std::memory_order_release);
+    return true;
+}
+
+const ChunkSizeHistogram& MemoryManager::getChunkSizeHistogram() const noexcept
+{
+    return m_chunkSizeHistogram;
+}
+
+bool MemoryManager::containsChunk(const ChunkHeader* const chunkHeader) const noexcept
+{
+    for (const auto& memPool : m_memPoolVector)
+    {
+        if (memPool.containsChunk(chunkHeader))
+        {
+            return true;
+        }
+    }
+
+    const auto numberOfOverflowMemPools = m_numberOfOverflowMemPools.load(std::memory_order_acquire);
+    for (uint32_t i = 0U; i < numberOfOverflowMemPools; ++i)
+    {
+        if (m_overflowMemPools[i].m_memPool->containsChunk(chunkHeader))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 uint64_t MemoryManager::sizeWithChunkHeaderStruct(const MaxChunkPayloadSize_t size) noexcept
 {
     return size + sizeof(ChunkHeader);
@@ -139,27 +278,71 @@ void MemoryManager::configureMemoryManager(const MePooConfig& mePooConfig,
     for (auto entry : mePooConfig.m_mempoolConfig)
     {
         addMemPool(managementAllocator, chunkMemoryAllocator, entry.m_size, entry.m_chunkCount);
+        m_overflowChunkCounts.emplace_back(entry.m_overflowChunkCount);
+        m_maxChunksPerPublisher.emplace_back(entry.m_maxChunksPerPublisher);
+        m_hasMaxChunksPerPublisher = m_hasMaxChunksPerPublisher || entry.m_maxChunksPerPublisher != 0U;
     }
+    m_overflowThresholdPercent = mePooConfig.m_overflowThresholdPercent;
 
     generateChunkManagementPool(managementAllocator);
 }
 
-expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
+expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkSettings& chunkSettings,
+                                                                    ChunkQuota* const chunkQuota) noexcept
 {
     void* chunk{nullptr};
     MemPool* memPoolPointer{nullptr};
+    MemPool* chunkManagementPoolPointer{nullptr};
     const auto requiredChunkSize = chunkSettings.requiredChunkSize();
 
     uint64_t aquiredChunkSize = 0U;
+    uint32_t memPoolIndex{0U};
+    bool isReservedChunk{false};
 
-    for (auto& memPool : m_memPoolVector)
+    for (uint32_t index = 0U; index < m_memPoolVector.size(); ++index)
     {
+        auto& memPool = m_memPoolVector[index];
         uint64_t chunkSizeOfMemPool = memPool.getChunkSize();
         if (chunkSizeOfMemPool >= requiredChunkSize)
         {
-            chunk = memPool.getChunk();
             memPoolPointer = &memPool;
+            chunkManagementPoolPointer = &m_chunkManagementPool.front();
             aquiredChunkSize = chunkSizeOfMemPool;
+            memPoolIndex = index;
+
+            if (chunkQuota != nullptr)
+            {
+                if (!chunkQuota->isWithinLimit(index, m_maxChunksPerPublisher[index]))
+                {
+                    chunkQuota->recordExceededRequest();
+                    IOX_LOG(Warn,
+                            "The chunk quota of the publisher for the mempool with a chunk size of "
+                                << chunkSizeOfMemPool << " is exhausted!");
+                    return err(Error::CHUNK_QUOTA_EXCEEDED);
+                }
+
+                if (chunkQuota->tryTakeReservedChunk(index))
+                {
+                    chunk = memPool.getReservedChunk();
+                    isReservedChunk = chunk != nullptr;
+                    if (!isReservedChunk)
+                    {
+                        chunkQuota->returnReservedChunk();
+                    }
+                }
+            }
+
+            const bool isExtended = m_overflowChunkCounts[index] != 0U
+                                    && m_numberOfOverflowMemPools.load(std::memory_order_relaxed) != 0U;
+            // an exhausted but extended mempool is skipped to not flood the log with the warnings of the mempool
+            if (chunk == nullptr && (!isExtended || memPool.getUsedChunks() < memPool.getChunkCount()))
+            {
+                chunk = memPool.getChunk();
+            }
+            if (chunk == nullptr && isExtended)
+            {
+                chunk = getOverflowChunk(index, memPoolPointer, chunkManagementPoolPointer);
+            }
             break;
         }
     }
@@ -201,23 +384,254 @@ expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkS
     else
     {
         auto chunkHeader = new (chunk) ChunkHeader(aquiredChunkSize, chunkSettings);
-        auto chunkManagement = new (m_chunkManagementPool.front().getChunk())
-            ChunkManagement(chunkHeader, memPoolPointer, &m_chunkManagementPool.front());
+        auto chunkManagement = new (chunkManagementPoolPointer->getChunk())
+            ChunkManagement(chunkHeader, memPoolPointer, chunkManagementPoolPointer);
+        if (chunkQuota != nullptr)
+        {
+            chunkManagement->m_chunkQuota = chunkQuota;
+            chunkManagement->m_memPoolIndex = memPoolIndex;
+            chunkManagement->m_isReservedChunk = isReservedChunk;
+            chunkQuota->recordAcquisition(memPoolIndex);
+        }
+        m_chunkSizeHistogram.recordAcquisition(requiredChunkSize);
         return ok(SharedChunk(chunkManagement));
     }
 }
 
+expected<SharedChunk, MemoryManager::Error> MemoryManager::getChainedChunk(const uint64_t userPayloadSize,
+                                                                           const uint32_t userPayloadAlignment,
+                                                                           ChunkQuota* const chunkQuota) noexcept
+{
+    if (m_memPoolVector.empty())
+    {
+        IOX_LOG(Error, "There are no mempools available!");
+
+        IOX_REPORT(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_CHUNK_WITHOUT_MEMPOOL, iox::er::RUNTIME_ERROR);
+        return err(Error::NO_MEMPOOLS_AVAILABLE);
+    }
+
+    // the user-payload capacity of a chunk of the largest mempool depends on its user-header; since the required chunk
+    // size grows linearly with the user-payload size, it is the difference to the required size of an empty chunk
+    const uint64_t largestChunkSize = m_memPoolVector.back().getChunkSize();
+    auto userPayloadCapacity = [&](const uint32_t userHeaderSize) -> optional<uint64_t> {
+        const uint32_t userHeaderAlignment = userHeaderSize == 0U ? 1U : alignof(ChainedChunkHeader);
+        auto chunkSettings = ChunkSettings::create(0U, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
+        if (chunkSettings.has_error() || chunkSettings->requiredChunkSize() > largestChunkSize)
+        {
+            return nullopt;
+        }
+        return largestChunkSize - chunkSettings->requiredChunkSize();
+    };
+
+    // the head chunk might be completely occupied by the ChainedChunkHeader if the chunks are small compared to the
+    // number of required continuation chunks
+    const uint64_t continuationCapacity = userPayloadCapacity(0U).value_or(0U);
+    optional<uint32_t> numberOfContinuationChunks;
+    for (uint32_t n = 0U; n <= MAX_NUMBER_OF_CONTINUATION_CHUNKS && continuationCapacity > 0U; ++n)
+    {
+        const auto headCapacity = userPayloadCapacity(ChainedChunkHeader::requiredUserHeaderSize(n));
+        if (!headCapacity.has_value())
+        {
+            break;
+        }
+        if (headCapacity.value() + n * continuationCapacity >= userPayloadSize)
+        {
+            numberOfContinuationChunks.emplace(n);
+            break;
+        }
+    }
+
+    if (!numberOfContinuationChunks.has_value())
+    {
+        IOX_LOG(Error,
+                "Could not split a chained message with a user-payload size of "
+                    << userPayloadSize << " into at most " << MAX_NUMBER_OF_CONTINUATION_CHUNKS
+                    << " continuation chunks of the largest mempool with a chunk size of " << largestChunkSize);
+
+        IOX_REPORT(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_CHUNK_IS_TOO_LARGE, iox::er::RUNTIME_ERROR);
+        return err(Error::NO_MEMPOOL_FOR_REQUESTED_CHUNK_SIZE);
+    }
+
+    const uint32_t userHeaderSize = ChainedChunkHeader::requiredUserHeaderSize(numberOfContinuationChunks.value());
+    const uint64_t headUserPayloadSize =
+        algorithm::minVal(userPayloadSize, userPayloadCapacity(userHeaderSize).value_or(0U));
+    auto headChunkSettings =
+        ChunkSettings::create(headUserPayloadSize, userPayloadAlignment, userHeaderSize, alignof(ChainedChunkHeader));
+    if (headChunkSettings.has_error())
+    {
+        return err(Error::NO_MEMPOOL_FOR_REQUESTED_CHUNK_SIZE);
+    }
+
+    auto headChunk = getChunk(headChunkSettings.value(), chunkQuota);
+    if (headChunk.has_error())
+    {
+        return headChunk;
+    }
+
+    auto* headChunkHeader = headChunk->getChunkHeader();
+    headChunkHeader->setUserHeaderId(ChunkHeader::CHAINED_CHUNK_USER_HEADER);
+    auto* chainedChunkHeader = new (headChunkHeader->userHeader()) ChainedChunkHeader();
+    chainedChunkHeader->m_userPayloadSize = userPayloadSize;
+
+    // the continuation chunks are added one after another to the head chunk; if one of them cannot be acquired, the
+    // already acquired ones are released together with the head chunk
+    uint64_t remainingUserPayloadSize = userPayloadSize - headUserPayloadSize;
+    while (remainingUserPayloadSize > 0U)
+    {
+        const uint64_t continuationUserPayloadSize = algorithm::minVal(remainingUserPayloadSize, continuationCapacity);
+        auto continuationChunkSettings =
+            ChunkSettings::create(continuationUserPayloadSize, userPayloadAlignment, 0U, 1U);
+        if (continuationChunkSettings.has_error())
+        {
+            return err(Error::NO_MEMPOOL_FOR_REQUESTED_CHUNK_SIZE);
+        }
+
+        auto continuationChunk = getChunk(continuationChunkSettings.value(), chunkQuota);
+        if (continuationChunk.has_error())
+        {
+            return err(continuationChunk.error());
+        }
+
+        new (&chainedChunkHeader->continuationChunks()[chainedChunkHeader->m_numberOfContinuationChunks])
+            ChainedChunkHeader::ContinuationChunk_t(continuationChunk->release());
+        ++chainedChunkHeader->m_numberOfContinuationChunks;
+        remainingUserPayloadSize -= continuationUserPayloadSize;
+    }
+
+    return headChunk;
+}
+
+ChunkQuota* MemoryManager::acquireChunkQuota(const ChunkQuotaSettings& chunkQuotaSettings) noexcept
+{
+    const bool requiresReservation =
+        chunkQuotaSettings.m_reservedChunks != 0U && chunkQuotaSettings.m_reservedUserPayloadSize != 0U;
+    if (chunkQuotaSettings.m_maxChunksPerMemPool == 0U && !requiresReservation && !m_hasMaxChunksPerPublisher)
+    {
+        return nullptr;
+    }
+
+    ChunkQuota* chunkQuota{nullptr};
+    for (auto& candidate : m_chunkQuotas)
+    {
+        if (candidate.tryActivate(chunkQuotaSettings.m_maxChunksPerMemPool))
+        {
+            chunkQuota = &candidate;
+            break;
+        }
+    }
+
+    if (chunkQuota == nullptr)
+    {
+        IOX_LOG(Warn,
+                "All " << MAX_NUMBER_OF_CHUNK_QUOTAS_PER_SEGMENT
+                       << " chunk quotas are in use! The publisher is not subject to a chunk quota.");
+        return nullptr;
+    }
+
+    if (requiresReservation)
+    {
+        bool isReserved{false};
+        auto chunkSettings =
+            ChunkSettings::create(chunkQuotaSettings.m_reservedUserPayloadSize, CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+        for (uint32_t index = 0U; chunkSettings.has_value() && index < m_memPoolVector.size(); ++index)
+        {
+            auto& memPool = m_memPoolVector[index];
+            if (memPool.getChunkSize() >= chunkSettings->requiredChunkSize())
+            {
+                isReserved = chunkQuota->reserve(memPool, index, chunkQuotaSettings.m_reservedChunks);
+                break;
+            }
+        }
+
+        if (!isReserved)
+        {
+            IOX_LOG(Warn,
+                    "Could not reserve " << chunkQuotaSettings.m_reservedChunks
+                                         << " chunks with a user-payload size of "
+                                         << chunkQuotaSettings.m_reservedUserPayloadSize
+                                         << "! The publisher continues without reserved chunks.");
+        }
+    }
+
+    return chunkQuota;
+}
+
+void MemoryManager::releaseChunkQuota(ChunkQuota& chunkQuota) noexcept
+{
+    chunkQuota.deactivate();
+}
+
+void* MemoryManager::getOverflowChunk(const uint32_t index, MemPool*& memPool, MemPool*& chunkManagementPool) noexcept
+{
+    const auto numberOfOverflowMemPools = m_numberOfOverflowMemPools.load(std::memory_order_acquire);
+    for (uint32_t i = 0U; i < numberOfOverflowMemPools; ++i)
+    {
+        auto& overflowMemPool = m_overflowMemPools[i];
+        if (overflowMemPool.m_index != index)
+        {
+            continue;
+        }
+
+        auto* overflowPool = overflowMemPool.m_memPool.get();
+        if (overflowPool->getUsedChunks() < overflowPool->getChunkCount())
+        {
+            auto* chunk = overflowPool->getChunk();
+            if (chunk != nullptr)
+            {
+                memPool = overflowPool;
+                chunkManagementPool = overflowMemPool.m_chunkManagementPool.get();
+                return chunk;
+            }
+        }
+    }
+    return nullptr;
+}
+
 void MemoryManager::freeChunk(ChunkManagement& chunkManagement) noexcept
 {
+    if (chunkManagement.m_chunkHeader->userHeaderId() == ChunkHeader::CHAINED_CHUNK_USER_HEADER)
+    {
+        // the head chunk of a chained message owns the continuation chunks
+        auto* chainedChunkHeader = static_cast<ChainedChunkHeader*>(chunkManagement.m_chunkHeader->userHeader());
+        for (uint32_t i = 0U; i < chainedChunkHeader->m_numberOfContinuationChunks; ++i)
+        {
+            SharedChunk continuationChunk(chainedChunkHeader->continuationChunks()[i].get());
+        }
+    }
+
     const auto* chunkHeader = static_cast<void*>(chunkManagement.m_chunkHeader.get());
     const auto mempool = chunkManagement.m_mempool;
+    auto* chunkQuota = chunkManagement.m_chunkQuota.get();
+    const auto memPoolIndex = chunkManagement.m_memPoolIndex;
+    const auto isReservedChunk = chunkManagement.m_isReservedChunk;
+
+    auto* chunkSizeHistogram = mempool->getChunkSizeHistogram();
+    if (chunkSizeHistogram != nullptr)
+    {
+        // the required chunk size is recalculated from the ChunkHeader, therefore this must happen before the chunk
+        // is freed
+        chunkSizeHistogram->recordRelease(*chunkManagement.m_chunkHeader);
+    }
 
     // Here the chunk management must be freed before the chunk itself to maintain
     // the invariant that there are always at least as many chunk management chunks available as payload chunks
     chunkManagement.m_chunkManagementPool->freeChunk(&chunkManagement);
     // NOTE: chunkManagement is a dangling reference from here on out
 
-    mempool->freeChunk(chunkHeader);
+    if (isReservedChunk)
+    {
+        mempool->freeReservedChunk(chunkHeader);
+    }
+    else
+    {
+        mempool->freeChunk(chunkHeader);
+    }
+
+    // the reservation of the chunk quota might be returned to the mempool, therefore the chunk must be freed before
+    if (chunkQuota != nullptr)
+    {
+        chunkQuota->recordRelease(memPoolIndex, isReservedChunk);
+    }
 }
 
 std::ostream& operator<<(std::ostream& stream, const MemoryManager::Error value) noexcept
@@ -17,6 +17,7 @@
 
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iox/algorithm.hpp"
 #include "iox/logging.hpp"
 
 namespace iox
@@ -74,10 +75,15 @@ MePooConfig& MePooConfig::optimize() noexcept
             }
             newEntry.m_size = entry.m_size;
             newEntry.m_chunkCount = entry.m_chunkCount;
+            newEntry.m_overflowChunkCount = entry.m_overflowChunkCount;
+            newEntry.m_maxChunksPerPublisher = entry.m_maxChunksPerPublisher;
         }
         else
         {
             newEntry.m_chunkCount += entry.m_chunkCount;
+            newEntry.m_overflowChunkCount = algorithm::maxVal(newEntry.m_overflowChunkCount, entry.m_overflowChunkCount);
+            newEntry.m_maxChunksPerPublisher =
+                algorithm::maxVal(newEntry.m_maxChunksPerPublisher, entry.m_maxChunksPerPublisher);
         }
     }
 
@@ -83,6 +83,29 @@ SharedChunk ShmSafeUnmanagedChunk::cloneToSharedChunk() noexcept
     return SharedChunk(chunkMgmt.get());
 }
 
+SharedChunk ShmSafeUnmanagedChunk::tryCloneToSharedChunk() noexcept
+{
+    if (m_chunkManagement.isLogicalNullptr())
+    {
+        return SharedChunk();
+    }
+    auto chunkMgmt =
+        RelativePointer<mepoo::ChunkManagement>(m_chunkManagement.offset(), segment_id_t{m_chunkManagement.id()});
+    auto& referenceCounter = chunkMgmt->m_referenceCounter;
+    auto currentReferences = referenceCounter.load(std::memory_order_relaxed);
+    do
+    {
+        // the last owner already released the chunk; it must not be resurrected
+        if (currentReferences == 0U)
+        {
+            return SharedChunk();
+        }
+    } while (!referenceCounter.compare_exchange_weak(
+        currentReferences, currentReferences + 1U, std::memory_order_acquire, std::memory_order_relaxed));
+
+    return SharedChunk(chunkMgmt.get());
+}
+
 bool ShmSafeUnmanagedChunk::isLogicalNullptr() const noexcept
 {
     return m_chunkManagement.isLogicalNullptr();
@@ -116,5 +139,16 @@ bool ShmSafeUnmanagedChunk::isNotLogicalNullptrAndHasNoOtherOwners() const noexc
     return chunkMgmt->m_referenceCounter.load(std::memory_order_relaxed) == 1U;
 }
 
+bool ShmSafeUnmanagedChunk::operator==(const ShmSafeUnmanagedChunk& rhs) const noexcept
+{
+    return m_chunkManagement.id() == rhs.m_chunkManagement.id()
+           && m_chunkManagement.offset() == rhs.m_chunkManagement.offset();
+}
+
+bool ShmSafeUnmanagedChunk::operator!=(const ShmSafeUnmanagedChunk& rhs) const noexcept
+{
+    return !(*this == rhs);
+}
+
 } // namespace mepoo
 } // namespace iox
@@ -17,13 +17,31 @@
 
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iox/deadline_timer.hpp"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
 
 namespace iox
 {
 namespace popo
 {
-ConditionListener::ConditionListener(ConditionVariableData& condVarData) noexcept
+namespace
+{
+void relaxCpu() noexcept
+{
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+} // namespace
+
+ConditionListener::ConditionListener(ConditionVariableData& condVarData, const WaitStrategy& waitStrategy) noexcept
     : m_condVarDataPtr(&condVarData)
+    , m_waitStrategy(waitStrategy)
 {
 }
 
@@ -57,39 +75,69 @@ bool ConditionListener::wasNotified() const noexcept
 
 ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
 {
-    return waitImpl([this]() -> bool {
-        if (this->getMembers()->m_semaphore->wait().has_error())
-        {
-            IOX_REPORT_FATAL(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT);
-            return false;
-        }
-        return true;
-    });
+    return waitImpl(
+        [this]() -> bool {
+            // with a running timer the semaphore is only waited for until the next expiration
+            const auto timeUntilNextExpiration = m_timerQueue.timeUntilNextExpiration();
+            const bool hasError =
+                timeUntilNextExpiration.has_value()
+                    ? this->getMembers()->m_semaphore->timedWait(timeUntilNextExpiration.value()).has_error()
+                    : this->getMembers()->m_semaphore->wait().has_error();
+            if (hasError)
+            {
+                IOX_REPORT_FATAL(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT);
+                return false;
+            }
+            return true;
+        },
+        m_waitStrategy.spinDuration);
 }
 
 ConditionListener::NotificationVector_t ConditionListener::timedWait(const units::Duration& timeToWait) noexcept
 {
-    return waitImpl([this, timeToWait]() -> bool {
-        if (this->getMembers()->m_semaphore->timedWait(timeToWait).has_error())
-        {
-            IOX_REPORT_FATAL(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT);
-        }
-        return false;
-    });
+    // the time spent polling and the expirations of timers are deducted from the time the semaphore is waited for
+    const deadline_timer timeout{timeToWait};
+    const auto spinDuration = algorithm::minVal(m_waitStrategy.spinDuration, timeToWait);
+    return waitImpl(
+        [this, &timeout]() -> bool {
+            auto remainingTimeToWait = timeout.remainingTime();
+            bool doContinueWaiting = false;
+            const auto timeUntilNextExpiration = m_timerQueue.timeUntilNextExpiration();
+            if (timeUntilNextExpiration.has_value() && timeUntilNextExpiration.value() < remainingTimeToWait)
+            {
+                remainingTimeToWait = timeUntilNextExpiration.value();
+                doContinueWaiting = true;
+            }
+
+            if (this->getMembers()->m_semaphore->timedWait(remainingTimeToWait).has_error())
+            {
+                IOX_REPORT_FATAL(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT);
+                return false;
+            }
+            return doContinueWaiting;
+        },
+        spinDuration);
 }
 
-ConditionListener::NotificationVector_t ConditionListener::waitImpl(const function_ref<bool()> waitCall) noexcept
+ConditionListener::NotificationVector_t ConditionListener::waitImpl(const function_ref<bool()> waitCall,
+                                                                    const units::Duration spinDuration) noexcept
 {
     using Type_t = iox::BestFittingType_t<iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
     NotificationVector_t activeNotifications;
 
     resetSemaphore();
     bool doReturnAfterNotificationCollection = false;
+    bool doSpin = spinDuration > units::Duration::zero();
     while (!m_toBeDestroyed.load(std::memory_order_relaxed))
     {
+        m_timerQueue.expire([this](const uint64_t index) {
+            getMembers()->m_activeNotifications[index].store(true, std::memory_order_relaxed);
+        });
+
         for (Type_t i = 0U; i < MAX_NUMBER_OF_NOTIFIERS; i++)
         {
-            if (getMembers()->m_activeNotifications[i].load(std::memory_order_relaxed))
+            // seq_cst pairs with the ConditionNotifier, see spin()
+            if (getMembers()->m_activeNotifications[i].load(std::memory_order_seq_cst))
             {
                 resetUnchecked(i);
                 activeNotifications.emplace_back(i);
@@ -100,12 +148,60 @@ ConditionListener::NotificationVector_t ConditionListener::waitImpl(const functi
             return activeNotifications;
         }
 
+        if (doSpin)
+        {
+            doSpin = false;
+            // polling ends with the next timer expiration
+            const auto timeUntilNextExpiration = m_timerQueue.timeUntilNextExpiration();
+            spin(timeUntilNextExpiration.has_value() ? algorithm::minVal(spinDuration, timeUntilNextExpiration.value())
+                                                     : spinDuration);
+            continue;
+        }
+
         doReturnAfterNotificationCollection = !waitCall();
     }
 
     return activeNotifications;
 }
 
+void ConditionListener::spin(const units::Duration spinDuration) noexcept
+{
+    // A notifier which observes m_isSpinning does not post the semaphore. Since m_isSpinning is cleared before the
+    // notifications are collected again, a notification which skipped the post is always collected.
+    getMembers()->m_isSpinning.store(true, std::memory_order_seq_cst);
+
+    deadline_timer spinTimer{spinDuration};
+    while (!m_toBeDestroyed.load(std::memory_order_relaxed)
+           && !getMembers()->m_wasNotified.load(std::memory_order_relaxed) && !spinTimer.hasExpired())
+    {
+        if (m_waitStrategy.relaxCpu)
+        {
+            relaxCpu();
+        }
+    }
+
+    getMembers()->m_isSpinning.store(false, std::memory_order_seq_cst);
+}
+
+void ConditionListener::startTimer(const uint64_t index,
+                                   const units::Duration period,
+                                   const TimerMode mode) noexcept
+{
+    m_timerQueue.start(index, period, mode);
+    getMembers()->m_semaphore->post().or_else(
+        [](auto) { IOX_REPORT_FATAL(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_START_TIMER); });
+}
+
+void ConditionListener::stopTimer(const uint64_t index) noexcept
+{
+    m_timerQueue.stop(index);
+}
+
+bool ConditionListener::isTimerRunning(const uint64_t index) const noexcept
+{
+    return m_timerQueue.isRunning(index);
+}
+
 void ConditionListener::resetUnchecked(const uint64_t index) noexcept
 {
     getMembers()->m_activeNotifications[index].store(false, std::memory_order_relaxed);
@@ -38,8 +38,14 @@ ConditionNotifier::ConditionNotifier(ConditionVariableData& condVarDataRef, cons
 
 void ConditionNotifier::notify() noexcept
 {
-    getMembers()->m_activeNotifications[m_notificationIndex].store(true, std::memory_order_release);
+    // seq_cst pairs with the ConditionListener which clears m_isSpinning and then collects the notifications;
+    // either the listener sees this notification or the notifier sees that the listener stopped spinning
+    getMembers()->m_activeNotifications[m_notificationIndex].store(true, std::memory_order_seq_cst);
     getMembers()->m_wasNotified.store(true, std::memory_order_relaxed);
+    if (getMembers()->m_isSpinning.load(std::memory_order_seq_cst))
+    {
+        return;
+    }
     getMembers()->m_semaphore->post().or_else(
         [](auto) { IOX_REPORT_FATAL(PoshError::POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY); });
 }
@@ -0,0 +1,195 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/popo/building_blocks/timer_queue.hpp"
+#include "iceoryx_platform/time.hpp"
+#include "iox/assertions.hpp"
+#include "iox/posix_call.hpp"
+
+#include <utility>
+
+namespace iox
+{
+namespace popo
+{
+void TimerQueue::start(const uint64_t index, const units::Duration period, const TimerMode mode) noexcept
+{
+    IOX_ENFORCE(index < CAPACITY, "The timer index is out of range");
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_timers[index].isRunning)
+    {
+        removeUnchecked(index);
+    }
+
+    auto& timer = m_timers[index];
+    timer.period = period.toNanoseconds();
+    timer.deadline = nanosecondsSinceEpoch() + timer.period;
+    timer.mode = mode;
+    insertUnchecked(index);
+}
+
+void TimerQueue::stop(const uint64_t index) noexcept
+{
+    IOX_ENFORCE(index < CAPACITY, "The timer index is out of range");
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_timers[index].isRunning)
+    {
+        removeUnchecked(index);
+    }
+}
+
+bool TimerQueue::isRunning(const uint64_t index) const noexcept
+{
+    IOX_ENFORCE(index < CAPACITY, "The timer index is out of range");
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_timers[index].isRunning;
+}
+
+optional<units::Duration> TimerQueue::timeUntilNextExpiration() const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_heapSize == 0U)
+    {
+        return nullopt;
+    }
+
+    const auto deadline = m_timers[m_heap[0U]].deadline;
+    const auto now = nanosecondsSinceEpoch();
+    return units::Duration::fromNanoseconds((deadline > now) ? deadline - now : 0U);
+}
+
+void TimerQueue::expire(const function_ref<void(uint64_t)> onExpiration) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const auto now = nanosecondsSinceEpoch();
+    while (m_heapSize > 0U && m_timers[m_heap[0U]].deadline <= now)
+    {
+        const auto index = m_heap[0U];
+        auto& timer = m_timers[index];
+
+        if (timer.mode == TimerMode::PERIODIC && timer.period > 0U)
+        {
+            // the next deadline is derived from the previous one and not from now to avoid a drift
+            const auto missedPeriods = (now - timer.deadline) / timer.period;
+            timer.deadline += (missedPeriods + 1U) * timer.period;
+            siftDown(0U);
+        }
+        else
+        {
+            removeUnchecked(index);
+        }
+
+        onExpiration(index);
+    }
+}
+
+uint64_t TimerQueue::nanosecondsSinceEpoch() noexcept
+{
+    struct timespec timepoint
+    {
+    };
+
+    IOX_ENFORCE(
+        !IOX_POSIX_CALL(iox_clock_gettime)(CLOCK_MONOTONIC, &timepoint).failureReturnValue(-1).evaluate().has_error(),
+        "An error which should never happen occured during 'iox_clock_gettime'!");
+
+    return units::Duration(timepoint).toNanoseconds();
+}
+
+void TimerQueue::insertUnchecked(const uint64_t index) noexcept
+{
+    m_timers[index].isRunning = true;
+    m_timers[index].heapPosition = m_heapSize;
+    m_heap[m_heapSize] = index;
+    ++m_heapSize;
+    siftUp(m_heapSize - 1U);
+}
+
+void TimerQueue::removeUnchecked(const uint64_t index) noexcept
+{
+    const auto position = m_timers[index].heapPosition;
+    m_timers[index].isRunning = false;
+
+    --m_heapSize;
+    if (position == m_heapSize)
+    {
+        return;
+    }
+
+    swapHeapPositions(position, m_heapSize);
+    siftUp(position);
+    siftDown(position);
+}
+
+void TimerQueue::siftUp(uint64_t position) noexcept
+{
+    while (position > 0U)
+    {
+        const auto parent = (position - 1U) / 2U;
+        if (!isEarlier(position, parent))
+        {
+            return;
+        }
+        swapHeapPositions(position, parent);
+        position = parent;
+    }
+}
+
+void TimerQueue::siftDown(uint64_t position) noexcept
+{
+    while (true)
+    {
+        const auto left = 2U * position + 1U;
+        const auto right = left + 1U;
+        auto earliest = position;
+
+        if (left < m_heapSize && isEarlier(left, earliest))
+        {
+            earliest = left;
+        }
+        if (right < m_heapSize && isEarlier(right, earliest))
+        {
+            earliest = right;
+        }
+        if (earliest == position)
+        {
+            return;
+        }
+        swapHeapPositions(position, earliest);
+        position = earliest;
+    }
+}
+
+void TimerQueue::swapHeapPositions(const uint64_t lhs, const uint64_t rhs) noexcept
+{
+    std::swap(m_heap[lhs], m_heap[rhs]);
+    m_timers[m_heap[lhs]].heapPosition = lhs;
+    m_timers[m_heap[rhs]].heapPosition = rhs;
+}
+
+bool TimerQueue::isEarlier(const uint64_t lhsPosition, const uint64_t rhsPosition) const noexcept
+{
+    return m_timers[m_heap[lhsPosition]].deadline < m_timers[m_heap[rhsPosition]].deadline;
+}
+
+} // namespace popo
+} // namespace iox
@@ -26,9 +26,14 @@ Listener::Listener() noexcept
 {
 }
 
-Listener::Listener(ConditionVariableData& conditionVariable) noexcept
+Listener::Listener(const WaitStrategy& waitStrategy) noexcept
+    : Listener(*runtime::PoshRuntime::getInstance().getMiddlewareConditionVariable(), waitStrategy)
+{
+}
+
+Listener::Listener(ConditionVariableData& conditionVariable, const WaitStrategy& waitStrategy) noexcept
     : m_conditionVariableData(&conditionVariable)
-    , m_conditionListener(conditionVariable)
+    , m_conditionListener(conditionVariable, waitStrategy)
 {
     m_thread = std::thread(&Listener::threadLoop, this);
 }
@@ -28,8 +28,13 @@ PublisherPortData::PublisherPortData(const capro::ServiceDescription& serviceDes
                                      const PublisherOptions& publisherOptions,
                                      const mepoo::MemoryInfo& memoryInfo) noexcept
     : BasePortData(serviceDescription, runtimeName, uniqueRouDiId)
-    , m_chunkSenderData(
-          memoryManager, publisherOptions.subscriberTooSlowPolicy, publisherOptions.historyCapacity, memoryInfo)
+    , m_chunkSenderData(memoryManager,
+                        publisherOptions.subscriberTooSlowPolicy,
+                        publisherOptions.historyCapacity,
+                        memoryInfo,
+                        mepoo::ChunkQuotaSettings{publisherOptions.maxChunksPerMemPool,
+                                                  publisherOptions.reservedUserPayloadSize,
+                                                  publisherOptions.reservedChunks})
     , m_options{publisherOptions}
     , m_offeringRequested(publisherOptions.offerOnCreate)
 {
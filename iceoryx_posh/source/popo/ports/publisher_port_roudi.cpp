@@ -68,9 +68,11 @@ optional<capro::CaproMessage> PublisherPortRouDi::tryGetCaProMessage() noexcept
 
         // remove all the subscribers (represented by their chunk queues)
         m_chunkSender.removeAllQueues();
+        m_chunkSender.removeAllLatestValueReaders();
 
         capro::CaproMessage caproMessage(capro::CaproMessageType::STOP_OFFER, this->getCaProServiceDescription());
         caproMessage.m_serviceType = capro::CaproServiceType::PUBLISHER;
+        caproMessage.m_latestChunkSlot = static_cast<void*>(&getMembers()->m_chunkSenderData.m_latestChunk);
 
         return make_optional<capro::CaproMessage>(caproMessage);
     }
@@ -89,7 +91,17 @@ PublisherPortRouDi::dispatchCaProMessageAndGetPossibleResponse(const capro::Capr
 
     if (getMembers()->m_offered.load(std::memory_order_relaxed))
     {
-        if (capro::CaproMessageType::SUB == caProMessage.m_type)
+        if ((capro::CaproMessageType::SUB == caProMessage.m_type) && caProMessage.m_latestValueOnly)
+        {
+            responseMessage.m_type = capro::CaproMessageType::ACK;
+            responseMessage.m_latestChunkSlot = static_cast<void*>(&m_chunkSender.addLatestValueReader());
+        }
+        else if ((capro::CaproMessageType::UNSUB == caProMessage.m_type) && caProMessage.m_latestValueOnly)
+        {
+            m_chunkSender.removeLatestValueReader();
+            responseMessage.m_type = capro::CaproMessageType::ACK;
+        }
+        else if (capro::CaproMessageType::SUB == caProMessage.m_type)
         {
             const auto ret = m_chunkSender.tryAddQueue(
                 static_cast<PublisherPortData::ChunkQueueData_t*>(caProMessage.m_chunkQueueData),
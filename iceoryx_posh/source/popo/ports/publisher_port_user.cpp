@@ -48,6 +48,12 @@ PublisherPortUser::tryAllocateChunk(const uint64_t userPayloadSize,
         getUniqueID(), userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
 }
 
+expected<mepoo::ChunkHeader*, AllocationError>
+PublisherPortUser::tryAllocateChainedChunk(const uint64_t userPayloadSize, const uint32_t userPayloadAlignment) noexcept
+{
+    return m_chunkSender.tryAllocateChained(getUniqueID(), userPayloadSize, userPayloadAlignment);
+}
+
 void PublisherPortUser::releaseChunk(mepoo::ChunkHeader* const chunkHeader) noexcept
 {
     m_chunkSender.release(chunkHeader);
@@ -110,6 +110,47 @@ ServerPortUser::allocateResponse(const RequestHeader* const requestHeader,
     return ok(responseHeader);
 }
 
+expected<ResponseHeader*, AllocationError>
+ServerPortUser::allocateResponseInPlace(const RequestHeader* const requestHeader,
+                                        const uint64_t userPayloadSize,
+                                        const uint32_t userPayloadAlignment) noexcept
+{
+    if (requestHeader == nullptr)
+    {
+        return err(AllocationError::INVALID_PARAMETER_FOR_REQUEST_HEADER);
+    }
+
+    // the request is released when 'requestChunk' goes out of scope if its chunk is not reused
+    auto requestChunk = m_chunkReceiver.handOver(requestHeader->getChunkHeader());
+    if (!requestChunk.has_value())
+    {
+        return err(AllocationError::INVALID_PARAMETER_FOR_REQUEST_HEADER);
+    }
+
+    auto chunkSettingsResult = mepoo::ChunkSettings::create(
+        userPayloadSize, userPayloadAlignment, sizeof(ResponseHeader), alignof(ResponseHeader));
+    if (chunkSettingsResult.has_error())
+    {
+        return err(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
+    }
+
+    // the response header overwrites the request header, therefore the addressing of the client is copied beforehand
+    const UniqueId uniqueClientQueueId = requestHeader->m_uniqueClientQueueId;
+    const uint32_t lastKnownClientQueueIndex = requestHeader->m_lastKnownClientQueueIndex;
+    const int64_t sequenceId = requestHeader->getSequenceId();
+
+    auto reusedChunk = m_chunkSender.tryReuse(getUniqueID(), requestChunk.value(), chunkSettingsResult.value());
+    if (!reusedChunk.has_value())
+    {
+        return allocateResponse(requestHeader, userPayloadSize, userPayloadAlignment);
+    }
+
+    auto* responseHeader = new (reusedChunk.value()->userHeader())
+        ResponseHeader(uniqueClientQueueId, lastKnownClientQueueIndex, sequenceId);
+
+    return ok(responseHeader);
+}
+
 void ServerPortUser::releaseResponse(const ResponseHeader* const responseHeader) noexcept
 {
     if (responseHeader != nullptr)
@@ -38,18 +38,16 @@ optional<capro::CaproMessage> SubscriberPortMultiProducer::tryGetCaProMessage()
     {
         getMembers()->m_subscriptionState.store(SubscribeState::SUBSCRIBED, std::memory_order_relaxed);
 
-        capro::CaproMessage caproMessage(capro::CaproMessageType::SUB, BasePort::getMembers()->m_serviceDescription);
-        caproMessage.m_chunkQueueData = static_cast<void*>(&getMembers()->m_chunkReceiverData);
-        caproMessage.m_historyCapacity = getMembers()->m_options.historyRequest;
+        auto caproMessage = createSubscriptionMessage(capro::CaproMessageType::SUB);
 
         return make_optional<capro::CaproMessage>(caproMessage);
     }
     else if (!currentSubscribeRequest && (SubscribeState::SUBSCRIBED == currentSubscriptionState))
     {
         getMembers()->m_subscriptionState.store(SubscribeState::NOT_SUBSCRIBED, std::memory_order_relaxed);
+        removeLatestChunkSlot();
 
-        capro::CaproMessage caproMessage(capro::CaproMessageType::UNSUB, BasePort::getMembers()->m_serviceDescription);
-        caproMessage.m_chunkQueueData = static_cast<void*>(&getMembers()->m_chunkReceiverData);
+        auto caproMessage = createSubscriptionMessage(capro::CaproMessageType::UNSUB);
 
         return make_optional<capro::CaproMessage>(caproMessage);
     }
@@ -68,9 +66,7 @@ optional<capro::CaproMessage> SubscriberPortMultiProducer::dispatchCaProMessageA
     if ((capro::CaproMessageType::OFFER == caProMessage.m_type)
         && (SubscribeState::SUBSCRIBED == currentSubscriptionState))
     {
-        capro::CaproMessage caproMessage(capro::CaproMessageType::SUB, BasePort::getMembers()->m_serviceDescription);
-        caproMessage.m_chunkQueueData = static_cast<void*>(&getMembers()->m_chunkReceiverData);
-        caproMessage.m_historyCapacity = getMembers()->m_options.historyRequest;
+        auto caproMessage = createSubscriptionMessage(capro::CaproMessageType::SUB);
 
         return make_optional<capro::CaproMessage>(caproMessage);
     }
@@ -81,8 +77,19 @@ optional<capro::CaproMessage> SubscriberPortMultiProducer::dispatchCaProMessageA
         return nullopt_t();
     }
     else if ((capro::CaproMessageType::ACK == caProMessage.m_type)
-             || (capro::CaproMessageType::NACK == caProMessage.m_type)
-             || (capro::CaproMessageType::STOP_OFFER == caProMessage.m_type))
+             && (SubscribeState::SUBSCRIBED == currentSubscriptionState))
+    {
+        // the subscription state is not tracked per publisher, only a latest chunk slot needs to be taken over
+        updateLatestChunkSlot(caProMessage);
+        return nullopt_t();
+    }
+    else if (capro::CaproMessageType::STOP_OFFER == caProMessage.m_type)
+    {
+        removeLatestChunkSlot(caProMessage);
+        return nullopt_t();
+    }
+    else if ((capro::CaproMessageType::ACK == caProMessage.m_type)
+             || (capro::CaproMessageType::NACK == caProMessage.m_type))
     {
         // we ignore all these messages for multi-producer
         return nullopt_t();
@@ -16,6 +16,8 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_roudi.hpp"
+#include "iceoryx_posh/internal/mepoo/latest_chunk_slot.hpp"
+#include "iox/relative_pointer.hpp"
 
 namespace iox
 {
@@ -47,5 +49,53 @@ void SubscriberPortRouDi::releaseAllChunks() noexcept
     m_chunkReceiver.releaseAll();
 }
 
+capro::CaproMessage SubscriberPortRouDi::createSubscriptionMessage(const capro::CaproMessageType type) noexcept
+{
+    capro::CaproMessage caproMessage(type, BasePort::getMembers()->m_serviceDescription);
+    // the chunk queue identifies the subscriber even if it is not used with 'latestValueOnly'
+    caproMessage.m_chunkQueueData = static_cast<void*>(&getMembers()->m_chunkReceiverData);
+    caproMessage.m_latestValueOnly = getMembers()->m_options.latestValueOnly;
+    if (capro::CaproMessageType::SUB == type)
+    {
+        caproMessage.m_historyCapacity = getMembers()->m_options.historyRequest;
+    }
+    return caproMessage;
+}
+
+void SubscriberPortRouDi::updateLatestChunkSlot(const capro::CaproMessage& caProMessage) noexcept
+{
+    if (caProMessage.m_latestChunkSlot == nullptr || !getMembers()->m_options.latestValueOnly)
+    {
+        return;
+    }
+
+    RelativePointer<mepoo::LatestChunkSlot> latestChunkSlot{
+        static_cast<mepoo::LatestChunkSlot*>(caProMessage.m_latestChunkSlot)};
+    getMembers()->m_latestChunkSlot.store(
+        RelativePointerData(static_cast<RelativePointerData::identifier_t>(latestChunkSlot.getId()),
+                            latestChunkSlot.getOffset()),
+        std::memory_order_release);
+}
+
+void SubscriberPortRouDi::removeLatestChunkSlot(const capro::CaproMessage& caProMessage) noexcept
+{
+    auto storedSlot = getMembers()->m_latestChunkSlot.load(std::memory_order_relaxed);
+    if (storedSlot.isLogicalNullptr() || caProMessage.m_latestChunkSlot == nullptr)
+    {
+        return;
+    }
+
+    RelativePointer<mepoo::LatestChunkSlot> latestChunkSlot{storedSlot.offset(), segment_id_t{storedSlot.id()}};
+    if (latestChunkSlot.get() == caProMessage.m_latestChunkSlot)
+    {
+        removeLatestChunkSlot();
+    }
+}
+
+void SubscriberPortRouDi::removeLatestChunkSlot() noexcept
+{
+    getMembers()->m_latestChunkSlot.store(RelativePointerData(), std::memory_order_release);
+}
+
 } // namespace popo
 } // namespace iox
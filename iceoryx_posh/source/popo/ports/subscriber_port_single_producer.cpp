@@ -38,9 +38,7 @@ optional<capro::CaproMessage> SubscriberPortSingleProducer::tryGetCaProMessage()
     {
         getMembers()->m_subscriptionState.store(SubscribeState::SUBSCRIBE_REQUESTED, std::memory_order_relaxed);
 
-        capro::CaproMessage caproMessage(capro::CaproMessageType::SUB, BasePort::getMembers()->m_serviceDescription);
-        caproMessage.m_chunkQueueData = static_cast<void*>(&getMembers()->m_chunkReceiverData);
-        caproMessage.m_historyCapacity = getMembers()->m_options.historyRequest;
+        auto caproMessage = createSubscriptionMessage(capro::CaproMessageType::SUB);
 
         return make_optional<capro::CaproMessage>(caproMessage);
     }
@@ -48,8 +46,7 @@ optional<capro::CaproMessage> SubscriberPortSingleProducer::tryGetCaProMessage()
     {
         getMembers()->m_subscriptionState.store(SubscribeState::UNSUBSCRIBE_REQUESTED, std::memory_order_relaxed);
 
-        capro::CaproMessage caproMessage(capro::CaproMessageType::UNSUB, BasePort::getMembers()->m_serviceDescription);
-        caproMessage.m_chunkQueueData = static_cast<void*>(&getMembers()->m_chunkReceiverData);
+        auto caproMessage = createSubscriptionMessage(capro::CaproMessageType::UNSUB);
 
         return make_optional<capro::CaproMessage>(caproMessage);
     }
@@ -75,9 +72,7 @@ optional<capro::CaproMessage> SubscriberPortSingleProducer::dispatchCaProMessage
     {
         getMembers()->m_subscriptionState.store(SubscribeState::SUBSCRIBE_REQUESTED, std::memory_order_relaxed);
 
-        capro::CaproMessage caproMessage(capro::CaproMessageType::SUB, BasePort::getMembers()->m_serviceDescription);
-        caproMessage.m_chunkQueueData = static_cast<void*>(&getMembers()->m_chunkReceiverData);
-        caproMessage.m_historyCapacity = getMembers()->m_options.historyRequest;
+        auto caproMessage = createSubscriptionMessage(capro::CaproMessageType::SUB);
 
         return make_optional<capro::CaproMessage>(caproMessage);
     }
@@ -85,6 +80,7 @@ optional<capro::CaproMessage> SubscriberPortSingleProducer::dispatchCaProMessage
              && (SubscribeState::SUBSCRIBED == currentSubscriptionState))
     {
         getMembers()->m_subscriptionState.store(SubscribeState::WAIT_FOR_OFFER, std::memory_order_relaxed);
+        removeLatestChunkSlot();
 
         return nullopt_t();
     }
@@ -92,10 +88,12 @@ optional<capro::CaproMessage> SubscriberPortSingleProducer::dispatchCaProMessage
     {
         if (SubscribeState::SUBSCRIBE_REQUESTED == currentSubscriptionState)
         {
+            updateLatestChunkSlot(caProMessage);
             getMembers()->m_subscriptionState.store(SubscribeState::SUBSCRIBED, std::memory_order_relaxed);
         }
         else if (SubscribeState::UNSUBSCRIBE_REQUESTED == currentSubscriptionState)
         {
+            removeLatestChunkSlot();
             getMembers()->m_subscriptionState.store(SubscribeState::NOT_SUBSCRIBED, std::memory_order_relaxed);
         }
         else
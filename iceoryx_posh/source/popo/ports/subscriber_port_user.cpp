@@ -16,6 +16,8 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
+#include "iceoryx_posh/internal/mepoo/latest_chunk_slot.hpp"
+#include "iox/relative_pointer.hpp"
 
 namespace iox
 {
@@ -65,7 +67,43 @@ SubscribeState SubscriberPortUser::getSubscriptionState() const noexcept
 
 expected<const mepoo::ChunkHeader*, ChunkReceiveResult> SubscriberPortUser::tryGetChunk() noexcept
 {
-    return m_chunkReceiver.tryGet();
+    if (!getMembers()->m_options.latestValueOnly)
+    {
+        return m_chunkReceiver.tryGet();
+    }
+
+    auto chunk = tryAcquireLatestChunk();
+    if (!isNewLatestChunk(chunk))
+    {
+        return err(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+    }
+
+    getMembers()->m_latestChunkOriginId = chunk.getChunkHeader()->originId();
+    getMembers()->m_latestChunkSequenceNumber = chunk.getChunkHeader()->sequenceNumber();
+    return m_chunkReceiver.tryTakeOver(chunk);
+}
+
+mepoo::SharedChunk SubscriberPortUser::tryAcquireLatestChunk() const noexcept
+{
+    const auto latestChunkSlot = getMembers()->m_latestChunkSlot.load(std::memory_order_acquire);
+    if (latestChunkSlot.isLogicalNullptr())
+    {
+        return mepoo::SharedChunk();
+    }
+
+    RelativePointer<mepoo::LatestChunkSlot> slot{latestChunkSlot.offset(), segment_id_t{latestChunkSlot.id()}};
+    return slot->tryAcquire();
+}
+
+bool SubscriberPortUser::isNewLatestChunk(const mepoo::SharedChunk& chunk) const noexcept
+{
+    if (!chunk)
+    {
+        return false;
+    }
+    const auto* chunkHeader = chunk.getChunkHeader();
+    return (chunkHeader->originId() != getMembers()->m_latestChunkOriginId)
+           || (chunkHeader->sequenceNumber() != getMembers()->m_latestChunkSequenceNumber);
 }
 
 void SubscriberPortUser::releaseChunk(const mepoo::ChunkHeader* const chunkHeader) noexcept
@@ -80,6 +118,10 @@ void SubscriberPortUser::releaseQueuedChunks() noexcept
 
 bool SubscriberPortUser::hasNewChunks() const noexcept
 {
+    if (getMembers()->m_options.latestValueOnly)
+    {
+        return isNewLatestChunk(tryAcquireLatestChunk());
+    }
     return !m_chunkReceiver.empty();
 }
 
@@ -26,28 +26,42 @@ Serialization PublisherOptions::serialize() const noexcept
     return Serialization::create(historyCapacity,
                                  nodeName,
                                  offerOnCreate,
-                                 static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(subscriberTooSlowPolicy));
+                                 static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(subscriberTooSlowPolicy),
+                                 maxChunksPerMemPool,
+                                 reservedUserPayloadSize,
+                                 reservedChunks,
+                                 segmentName,
+                                 static_cast<std::underlying_type_t<mepoo::TrafficClass>>(trafficClass));
 }
 
 expected<PublisherOptions, Serialization::Error> PublisherOptions::deserialize(const Serialization& serialized) noexcept
 {
     using ConsumerTooSlowPolicyUT = std::underlying_type_t<ConsumerTooSlowPolicy>;
+    using TrafficClassUT = std::underlying_type_t<mepoo::TrafficClass>;
 
     PublisherOptions publisherOptions;
     ConsumerTooSlowPolicyUT subscriberTooSlowPolicy{};
+    TrafficClassUT trafficClass{};
 
     auto deserializationSuccessful = serialized.extract(publisherOptions.historyCapacity,
                                                         publisherOptions.nodeName,
                                                         publisherOptions.offerOnCreate,
-                                                        subscriberTooSlowPolicy);
+                                                        subscriberTooSlowPolicy,
+                                                        publisherOptions.maxChunksPerMemPool,
+                                                        publisherOptions.reservedUserPayloadSize,
+                                                        publisherOptions.reservedChunks,
+                                                        publisherOptions.segmentName,
+                                                        trafficClass);
 
     if (!deserializationSuccessful
-        || subscriberTooSlowPolicy > static_cast<ConsumerTooSlowPolicyUT>(ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA))
+        || subscriberTooSlowPolicy > static_cast<ConsumerTooSlowPolicyUT>(ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA)
+        || trafficClass > static_cast<TrafficClassUT>(mepoo::TrafficClass::BULK))
     {
         return err(Serialization::Error::DESERIALIZATION_FAILED);
     }
 
     publisherOptions.subscriberTooSlowPolicy = static_cast<ConsumerTooSlowPolicy>(subscriberTooSlowPolicy);
+    publisherOptions.trafficClass = static_cast<mepoo::TrafficClass>(trafficClass);
     return ok(publisherOptions);
 }
 } // namespace popo
@@ -0,0 +1,134 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/popo/timer.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/popo/notification_attorney.hpp"
+#include "iox/assertions.hpp"
+
+namespace iox
+{
+namespace popo
+{
+Timer::Timer(const units::Duration period, const TimerMode mode) noexcept
+    : m_period(period)
+    , m_mode(mode)
+{
+    IOX_ENFORCE(period > units::Duration::zero(), "The period of a timer must be greater than zero");
+}
+
+Timer::~Timer() noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    stopAndDetachUnchecked();
+}
+
+void Timer::start() noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    m_isStartRequested = true;
+    if (m_conditionListener != nullptr)
+    {
+        m_conditionListener->startTimer(m_trigger.getUniqueId(), m_period, m_mode);
+    }
+}
+
+void Timer::stop() noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    m_isStartRequested = false;
+    if (m_conditionListener != nullptr)
+    {
+        m_conditionListener->stopTimer(m_trigger.getUniqueId());
+    }
+}
+
+bool Timer::isRunning() const noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    if (m_conditionListener != nullptr)
+    {
+        return m_conditionListener->isTimerRunning(m_trigger.getUniqueId());
+    }
+    return m_isStartRequested;
+}
+
+units::Duration Timer::getPeriod() const noexcept
+{
+    return m_period;
+}
+
+TimerMode Timer::getMode() const noexcept
+{
+    return m_mode;
+}
+
+void Timer::invalidateTrigger(const uint64_t uniqueTriggerId) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    if (uniqueTriggerId == m_trigger.getUniqueId())
+    {
+        if (m_conditionListener != nullptr)
+        {
+            m_conditionListener->stopTimer(uniqueTriggerId);
+            m_conditionListener = nullptr;
+        }
+        m_isStartRequested = false;
+        m_trigger.invalidate();
+    }
+}
+
+void Timer::enableEvent(TriggerHandle&& triggerHandle) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    m_trigger = std::move(triggerHandle);
+}
+
+void Timer::enableTimer(ConditionListener& conditionListener) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    m_conditionListener = &conditionListener;
+    if (m_isStartRequested)
+    {
+        m_conditionListener->startTimer(m_trigger.getUniqueId(), m_period, m_mode);
+    }
+}
+
+void Timer::disableEvent() noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    stopAndDetachUnchecked();
+}
+
+void Timer::stopAndDetachUnchecked() noexcept
+{
+    if (m_conditionListener != nullptr)
+    {
+        m_conditionListener->stopTimer(m_trigger.getUniqueId());
+        m_conditionListener = nullptr;
+    }
+    m_isStartRequested = false;
+    m_trigger.reset();
+}
+
+void NotificationAttorney::enableTimer(Timer& timer, ConditionListener& conditionListener) noexcept
+{
+    timer.enableTimer(conditionListener);
+}
+
+} // namespace popo
+} // namespace iox
@@ -0,0 +1,54 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/roudi/mempool_advisor.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iox/algorithm.hpp"
+
+#include <limits>
+
+namespace iox
+{
+namespace roudi
+{
+mepoo::MePooConfig adviseMePooConfig(const ChunkSizeHistogramContainer& chunkSizeHistogram,
+                                     const uint32_t headroomPercent) noexcept
+{
+    constexpr uint64_t PERCENT{100U};
+    mepoo::MePooConfig mePooConfig;
+
+    for (const auto& sizeClass : chunkSizeHistogram)
+    {
+        if (sizeClass.m_numRequests == 0U || sizeClass.m_chunkSize <= sizeof(mepoo::ChunkHeader))
+        {
+            continue;
+        }
+
+        const uint64_t chunkPayloadSize = sizeClass.m_chunkSize - sizeof(mepoo::ChunkHeader);
+        const uint64_t chunkCount =
+            (static_cast<uint64_t>(sizeClass.m_peakChunksInUse) * (PERCENT + headroomPercent) + PERCENT - 1U) / PERCENT;
+        const auto boundedChunkCount = static_cast<uint32_t>(algorithm::minVal(
+            algorithm::maxVal(chunkCount, static_cast<uint64_t>(1U)),
+            static_cast<uint64_t>(std::numeric_limits<uint32_t>::max())));
+
+        mePooConfig.addMemPool({chunkPayloadSize, boundedChunkCount});
+    }
+
+    return mePooConfig;
+}
+
+} // namespace roudi
+} // namespace iox
@@ -219,6 +219,16 @@ void ProcessManager::evaluateKillError(const Process& process,
     }
 }
 
+void ProcessManager::enableProcessTerminationMonitor(
+    const ProcessTerminationMonitor::TerminationCallback_t& onTermination) noexcept
+{
+    m_terminationMonitor.emplace(onTermination);
+    if (!m_terminationMonitor->isSupported())
+    {
+        m_terminationMonitor.reset();
+    }
+}
+
 bool ProcessManager::registerProcess(const RuntimeName_t& name,
                                      const uint32_t pid,
                                      const PosixUser user,
@@ -298,7 +308,10 @@ bool ProcessManager::addProcess(const RuntimeName_t& name,
     auto heartbeatPoolIndex = HeartbeatPool::Index::INVALID;
     iox::UntypedRelativePointer::offset_t heartbeatOffset{iox::UntypedRelativePointer::NULL_POINTER_OFFSET};
 
-    if (isMonitored)
+    // the heartbeat is only required if the termination of the process cannot be detected directly
+    const bool isMonitoredByPidFd =
+        isMonitored && m_terminationMonitor.has_value() && m_terminationMonitor->addProcess(pid);
+    if (isMonitored && !isMonitoredByPidFd)
     {
         auto heartbeat = m_heartbeatPool->emplace();
         heartbeatPoolIndex = heartbeat.to_index();
@@ -358,6 +371,7 @@ bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(Process
 {
     if (processIter != m_processList.end())
     {
+        m_terminationMonitor.and_then([&](auto& monitor) { monitor.removeProcess(processIter->getPid()); });
         m_portManager.deletePortsOfProcess(processIter->getName());
         m_processIntrospection->removeProcess(static_cast<int32_t>(processIter->getPid()));
 
@@ -461,10 +475,16 @@ void ProcessManager::addPublisherForProcess(const RuntimeName_t& name,
 {
     findProcess(name)
         .and_then([&](auto& process) { // create a PublisherPort
-            auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
+            auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(
+                process->getUser(), publisherOptions.segmentName, publisherOptions.trafficClass);
 
             if (!segmentInfo.m_memoryManager.has_value())
             {
+                IOX_LOG(Warn,
+                        "No writable segment found for the PublisherPort of application '"
+                            << name << "' with service description '" << service << "' and segment name '"
+                            << publisherOptions.segmentName << "'");
+
                 // Tell the app no writable shared memory segment was found
                 runtime::IpcMessage sendBuffer;
                 sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR_RESPONSE);
@@ -706,6 +726,8 @@ optional<Process*> ProcessManager::findProcess(const RuntimeName_t& name) noexce
 
 void ProcessManager::monitorProcesses() noexcept
 {
+    removeTerminatedProcesses();
+
     static_assert(runtime::PROCESS_KEEP_ALIVE_TIMEOUT > runtime::PROCESS_KEEP_ALIVE_INTERVAL,
                   "keep alive timeout too small");
     auto timeout = runtime::PROCESS_KEEP_ALIVE_TIMEOUT.toMilliseconds();
@@ -745,6 +767,34 @@ void ProcessManager::monitorProcesses() noexcept
     }
 }
 
+void ProcessManager::removeTerminatedProcesses() noexcept
+{
+    if (!m_terminationMonitor.has_value())
+    {
+        return;
+    }
+
+    for (const auto pid : m_terminationMonitor->takeTerminatedProcesses())
+    {
+        auto processIterator = m_processList.begin();
+        while (processIterator != m_processList.end())
+        {
+            if (processIterator->getPid() != pid)
+            {
+                ++processIterator;
+                continue;
+            }
+
+            IOX_LOG(Warn,
+                    "Application " << processIterator->getName()
+                                   << " terminated without unregistering --> removing it");
+            IOX_DISCARD_RESULT(removeProcessAndDeleteRespectiveSharedMemoryObjects(
+                processIterator, TerminationFeedback::DO_NOT_SEND_ACK_TO_PROCESS));
+            break;
+        }
+    }
+}
+
 void ProcessManager::discoveryUpdate() noexcept
 {
     m_portManager.doDiscovery();
@@ -0,0 +1,315 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/roudi/process_termination_monitor.hpp"
+#include "iox/logging.hpp"
+#include "iox/posix_call.hpp"
+#include "iox/thread.hpp"
+
+#include <limits>
+
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__) && defined(SYS_pidfd_open)
+#define IOX_PROCESS_TERMINATION_MONITOR_SUPPORTED
+#endif
+
+namespace iox
+{
+namespace roudi
+{
+#if defined(IOX_PROCESS_TERMINATION_MONITOR_SUPPORTED)
+namespace
+{
+// the pids are stored as epoll user data; this value can never be a valid pid
+constexpr uint64_t SHUTDOWN_EVENT{std::numeric_limits<uint64_t>::max()};
+constexpr int32_t MAX_EVENTS_PER_WAIT{16};
+
+int32_t pidfdOpen(const pid_t pid, const uint32_t flags) noexcept
+{
+    // glibc provides no wrapper for pidfd_open before 2.36
+    return static_cast<int32_t>(syscall(SYS_pidfd_open, pid, flags));
+}
+
+int32_t closeFd(const int32_t fd) noexcept
+{
+    return close(fd);
+}
+} // namespace
+
+ProcessTerminationMonitor::ProcessTerminationMonitor(const TerminationCallback_t& onTermination) noexcept
+    : m_onTermination(onTermination)
+{
+    // probe whether the kernel supports pidfds (Linux 5.3 and later) with the own process
+    auto probeResult = IOX_POSIX_CALL(pidfdOpen)(getpid(), 0U).failureReturnValue(INVALID_FD).evaluate();
+    if (probeResult.has_error())
+    {
+        IOX_LOG(Info,
+                "pidfds are not supported by the kernel (" << probeResult.error().getHumanReadableErrnum()
+                                                           << "), falling back to heartbeat monitoring");
+        return;
+    }
+    IOX_DISCARD_RESULT(IOX_POSIX_CALL(closeFd)(probeResult->value).failureReturnValue(INVALID_FD).evaluate());
+
+    auto epollResult =
+        IOX_POSIX_CALL(epoll_create1)(EPOLL_CLOEXEC).failureReturnValue(INVALID_FD).evaluate().or_else([](auto& r) {
+            IOX_LOG(Error, "Unable to create the epoll instance: " << r.getHumanReadableErrnum());
+        });
+    auto eventFdResult =
+        IOX_POSIX_CALL(eventfd)(0U, EFD_CLOEXEC).failureReturnValue(INVALID_FD).evaluate().or_else([](auto& r) {
+            IOX_LOG(Error, "Unable to create the shutdown eventfd: " << r.getHumanReadableErrnum());
+        });
+    if (epollResult.has_error() || eventFdResult.has_error())
+    {
+        if (!epollResult.has_error())
+        {
+            IOX_DISCARD_RESULT(IOX_POSIX_CALL(closeFd)(epollResult->value).failureReturnValue(INVALID_FD).evaluate());
+        }
+        if (!eventFdResult.has_error())
+        {
+            IOX_DISCARD_RESULT(IOX_POSIX_CALL(closeFd)(eventFdResult->value).failureReturnValue(INVALID_FD).evaluate());
+        }
+        return;
+    }
+
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.u64 = SHUTDOWN_EVENT;
+    if (IOX_POSIX_CALL(epoll_ctl)(epollResult->value, EPOLL_CTL_ADD, eventFdResult->value, &event)
+            .failureReturnValue(-1)
+            .evaluate()
+            .or_else([](auto& r) {
+                IOX_LOG(Error, "Unable to add the shutdown eventfd to epoll: " << r.getHumanReadableErrnum());
+            })
+            .has_error())
+    {
+        IOX_DISCARD_RESULT(IOX_POSIX_CALL(closeFd)(epollResult->value).failureReturnValue(INVALID_FD).evaluate());
+        IOX_DISCARD_RESULT(IOX_POSIX_CALL(closeFd)(eventFdResult->value).failureReturnValue(INVALID_FD).evaluate());
+        return;
+    }
+
+    m_epollFd = epollResult->value;
+    m_shutdownFd = eventFdResult->value;
+    m_thread = std::thread(&ProcessTerminationMonitor::run, this);
+}
+
+ProcessTerminationMonitor::~ProcessTerminationMonitor() noexcept
+{
+    if (!isSupported())
+    {
+        return;
+    }
+
+    const uint64_t shutdown{1U};
+    IOX_POSIX_CALL(write)(m_shutdownFd, &shutdown, sizeof(shutdown))
+        .failureReturnValue(-1)
+        .evaluate()
+        .or_else([](auto& r) {
+            IOX_LOG(Error, "Unable to signal the shutdown of the process termination monitor: "
+                               << r.getHumanReadableErrnum());
+        });
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+
+    for (const auto& process : m_monitoredProcesses)
+    {
+        closePidFd(process);
+    }
+    IOX_DISCARD_RESULT(IOX_POSIX_CALL(closeFd)(m_shutdownFd).failureReturnValue(INVALID_FD).evaluate());
+    IOX_DISCARD_RESULT(IOX_POSIX_CALL(closeFd)(m_epollFd).failureReturnValue(INVALID_FD).evaluate());
+}
+
+bool ProcessTerminationMonitor::addProcess(const uint32_t pid) noexcept
+{
+    if (!isSupported())
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& process : m_monitoredProcesses)
+    {
+        if (process.m_pid == pid)
+        {
+            return false;
+        }
+    }
+    if (m_monitoredProcesses.size() >= m_monitoredProcesses.capacity())
+    {
+        return false;
+    }
+
+    auto pidFdResult = IOX_POSIX_CALL(pidfdOpen)(static_cast<pid_t>(pid), 0U)
+                           .failureReturnValue(INVALID_FD)
+                           .evaluate()
+                           .or_else([&](auto& r) {
+                               IOX_LOG(Warn,
+                                       "Unable to open a pidfd for process " << pid << ": "
+                                                                             << r.getHumanReadableErrnum());
+                           });
+    if (pidFdResult.has_error())
+    {
+        return false;
+    }
+
+    MonitoredProcess process{pid, pidFdResult->value};
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.u64 = pid;
+    if (IOX_POSIX_CALL(epoll_ctl)(m_epollFd, EPOLL_CTL_ADD, process.m_pidFd, &event)
+            .failureReturnValue(-1)
+            .evaluate()
+            .or_else([&](auto& r) {
+                IOX_LOG(Warn, "Unable to monitor the pidfd of process " << pid << ": " << r.getHumanReadableErrnum());
+            })
+            .has_error())
+    {
+        IOX_DISCARD_RESULT(IOX_POSIX_CALL(closeFd)(process.m_pidFd).failureReturnValue(INVALID_FD).evaluate());
+        return false;
+    }
+
+    m_monitoredProcesses.emplace_back(process);
+    return true;
+}
+
+void ProcessTerminationMonitor::removeProcess(const uint32_t pid) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto iter = m_monitoredProcesses.begin(); iter != m_monitoredProcesses.end(); ++iter)
+    {
+        if (iter->m_pid == pid)
+        {
+            closePidFd(*iter);
+            m_monitoredProcesses.erase(iter);
+            break;
+        }
+    }
+    for (auto iter = m_terminatedProcesses.begin(); iter != m_terminatedProcesses.end(); ++iter)
+    {
+        if (*iter == pid)
+        {
+            m_terminatedProcesses.erase(iter);
+            break;
+        }
+    }
+}
+
+void ProcessTerminationMonitor::run() noexcept
+{
+    setThreadName("ProcTermMonitor");
+
+    // NOLINTJUSTIFICATION the array is passed to epoll_wait together with its size
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    epoll_event events[MAX_EVENTS_PER_WAIT];
+    while (true)
+    {
+        auto waitResult = IOX_POSIX_CALL(epoll_wait)(m_epollFd, &events[0], MAX_EVENTS_PER_WAIT, -1)
+                              .failureReturnValue(-1)
+                              .ignoreErrnos(EINTR)
+                              .evaluate();
+        if (waitResult.has_error())
+        {
+            IOX_LOG(Error,
+                    "Waiting for process termination failed: " << waitResult.error().getHumanReadableErrnum()
+                                                               << " - stopping process termination monitoring");
+            return;
+        }
+
+        bool hasTerminatedProcesses{false};
+        for (int32_t i = 0; i < waitResult->value; ++i)
+        {
+            if (events[i].data.u64 == SHUTDOWN_EVENT)
+            {
+                return;
+            }
+            handleTermination(static_cast<uint32_t>(events[i].data.u64));
+            hasTerminatedProcesses = true;
+        }
+
+        if (hasTerminatedProcesses)
+        {
+            m_onTermination();
+        }
+    }
+}
+
+void ProcessTerminationMonitor::handleTermination(const uint32_t pid) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto iter = m_monitoredProcesses.begin(); iter != m_monitoredProcesses.end(); ++iter)
+    {
+        if (iter->m_pid == pid)
+        {
+            closePidFd(*iter);
+            m_monitoredProcesses.erase(iter);
+            // cannot overflow since a pid is either monitored or terminated
+            m_terminatedProcesses.emplace_back(pid);
+            IOX_LOG(Debug, "Detected termination of process " << pid);
+            break;
+        }
+    }
+}
+
+void ProcessTerminationMonitor::closePidFd(const MonitoredProcess& process) noexcept
+{
+    // closing the fd also removes it from the epoll instance
+    IOX_DISCARD_RESULT(IOX_POSIX_CALL(closeFd)(process.m_pidFd).failureReturnValue(INVALID_FD).evaluate());
+}
+
+#else
+
+ProcessTerminationMonitor::ProcessTerminationMonitor(const TerminationCallback_t& onTermination) noexcept
+    : m_onTermination(onTermination)
+{
+    IOX_LOG(Info, "pidfds are not supported on this platform, falling back to heartbeat monitoring");
+}
+
+ProcessTerminationMonitor::~ProcessTerminationMonitor() noexcept = default;
+
+bool ProcessTerminationMonitor::addProcess(const uint32_t) noexcept
+{
+    return false;
+}
+
+void ProcessTerminationMonitor::removeProcess(const uint32_t) noexcept
+{
+}
+
+#endif
+
+bool ProcessTerminationMonitor::isSupported() const noexcept
+{
+    return m_epollFd != INVALID_FD;
+}
+
+ProcessTerminationMonitor::TerminatedProcesses_t ProcessTerminationMonitor::takeTerminatedProcesses() noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    TerminatedProcesses_t terminatedProcesses{m_terminatedProcesses};
+    m_terminatedProcesses.clear();
+    return terminatedProcesses;
+}
+
+} // namespace roudi
+} // namespace iox
@@ -57,6 +57,11 @@ RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
     m_processIntrospection.registerPublisherPort(
         PublisherPortUserType(m_prcMgr->addIntrospectionPublisherPort(IntrospectionProcessService)));
     m_prcMgr->initIntrospection(&m_processIntrospection);
+    if (m_roudiConfig.monitoringMode == roudi::MonitoringMode::ON && !m_roudiConfig.sharesAddressSpaceWithApplications)
+    {
+        // wake up the discovery loop to release the resources of a terminated process immediately
+        m_prcMgr->enableProcessTerminationMonitor([this] { m_processTerminationTrigger.trigger(); });
+    }
     m_processIntrospection.run();
     m_mempoolIntrospection.run();
 
@@ -202,7 +207,7 @@ void RouDi::monitorAndDiscoveryUpdate() noexcept
 {
     setThreadName("Mon+Discover");
 
-    class DiscoveryWaitSet : public popo::WaitSet<1>
+    class DiscoveryWaitSet : public popo::WaitSet<2>
     {
       public:
         DiscoveryWaitSet(popo::ConditionVariableData& condVarData) noexcept
@@ -213,13 +218,19 @@ void RouDi::monitorAndDiscoveryUpdate() noexcept
 
     popo::ConditionVariableData conditionVariableData;
     DiscoveryWaitSet discoveryLoopWaitset{conditionVariableData};
-    discoveryLoopWaitset.attachEvent(m_discoveryLoopTrigger).expect("Failed to attach a single event");
+    discoveryLoopWaitset.attachEvent(m_discoveryLoopTrigger).expect("Failed to attach the discovery loop trigger");
+    discoveryLoopWaitset.attachEvent(m_processTerminationTrigger)
+        .expect("Failed to attach the process termination trigger");
     bool manuallyTriggered{false};
 
     while (m_runMonitoringAndDiscoveryThread)
     {
         m_prcMgr->run();
 
+        // extend the mempools which run low on chunks before they are exhausted
+        m_roudiMemoryInterface->segmentManager().and_then(
+            [](auto& segmentManager) { segmentManager->createOverflowSegmentsIfRequired(); });
+
         cyclicUpdateHook();
 
         if (manuallyTriggered)
@@ -251,6 +262,13 @@ void RouDi::processRuntimeMessages(runtime::IpcInterfaceCreator&& roudiIpcInterf
 
     IOX_LOG(Info, "Resource prefix: " << IOX_DEFAULT_RESOURCE_PREFIX);
     IOX_LOG(Info, "Domain ID: " << static_cast<DomainId::value_type>(m_roudiConfig.domainId));
+    // this thread only receives the messages; they are processed concurrently by the workers of the dispatcher, which
+    // are stopped when the dispatcher goes out of scope
+    RuntimeMessageDispatcher dispatcher{m_roudiConfig.runtimeMessageWorkerCount,
+                                        [this](const auto& message, const auto& cmd, const auto& runtimeName) {
+                                            processMessage(message, cmd, runtimeName);
+                                        }};
+
     IOX_LOG(Info, "RouDi is ready for clients");
     fflush(stdout); // explicitly flush 'stdout' for 'launch_testing'
 
@@ -263,7 +281,7 @@ void RouDi::processRuntimeMessages(runtime::IpcInterfaceCreator&& roudiIpcInterf
             auto cmd = runtime::stringToIpcMessageType(message.getElementAtIndex(0).c_str());
             RuntimeName_t runtimeName{into<lossy<RuntimeName_t>>(message.getElementAtIndex(1))};
 
-            processMessage(message, cmd, runtimeName);
+            dispatcher.dispatch(std::move(message), cmd, runtimeName);
         }
     }
 }
@@ -323,9 +341,16 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
             int64_t transmissionTimestamp{0};
             version::VersionInfo versionInfo = parseRegisterMessage(message, pid, userId, transmissionTimestamp);
 
+            // the user database is queried with non-reentrant functions which are also used by the ProcessManager,
+            // therefore the user is looked up under its lock since registrations are processed concurrently
+            auto user = [&] {
+                auto processManagerGuard = m_prcMgr.get_scope_guard();
+                return PosixUser{userId};
+            }();
+
             registerProcess(runtimeName,
                             pid,
-                            PosixUser{userId},
+                            user,
                             transmissionTimestamp,
                             getUniqueSessionIdForProcess(),
                             versionInfo);
@@ -562,7 +587,7 @@ void RouDi::registerProcess(const RuntimeName_t& name,
                             const uint64_t sessionId,
                             const version::VersionInfo& versionInfo) noexcept
 {
-    bool monitorProcess = (m_roudiConfig.monitoringMode == roudi::MonitoringMode::ON
+    bool monitorProcess = (m_roudiConfig.monitoringMode != roudi::MonitoringMode::OFF
                            && !m_roudiConfig.sharesAddressSpaceWithApplications);
     IOX_DISCARD_RESULT(
         m_prcMgr->registerProcess(name, pid, user, monitorProcess, transmissionTimestamp, sessionId, versionInfo));
@@ -570,8 +595,9 @@ void RouDi::registerProcess(const RuntimeName_t& name,
 
 uint64_t RouDi::getUniqueSessionIdForProcess() noexcept
 {
-    static uint64_t sessionId = 0;
-    return ++sessionId;
+    // the registration requests are processed concurrently
+    static concurrent::Atomic<uint64_t> sessionId{0U};
+    return sessionId.fetch_add(1U, std::memory_order_relaxed) + 1U;
 }
 
 void RouDi::IpcMessageErrorHandler() noexcept
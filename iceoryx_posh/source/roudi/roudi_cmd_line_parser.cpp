@@ -39,10 +39,11 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
                                        {"compatibility", required_argument, nullptr, 'x'},
                                        {"termination-delay", required_argument, nullptr, 't'},
                                        {"kill-delay", required_argument, nullptr, 'k'},
+                                       {"runtime-message-workers", required_argument, nullptr, 'w'},
                                        {nullptr, 0, nullptr, 0}};
 
     // colon after shortOption means it requires an argument, two colons mean optional argument
-    constexpr const char* SHORT_OPTIONS = "hvm:l:d:u:x:t:k:";
+    constexpr const char* SHORT_OPTIONS = "hvm:l:d:u:x:t:k:w:";
     int index;
     int32_t opt{-1};
     while ((opt = getopt_long(argc, argv, SHORT_OPTIONS, LONG_OPTIONS, &index), opt != -1))
@@ -60,10 +61,14 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
             std::cout << "-u, --unique-roudi-id <UINT>      Set the unique RouDi ID." << std::endl;
             std::cout << "                                  <UINT> 0..65535" << std::endl;
             std::cout << "-m, --monitoring-mode <MODE>      Set process alive monitoring mode." << std::endl;
-            std::cout << "                                  <MODE> {on, off}" << std::endl;
+            std::cout << "                                  <MODE> {on, off, heartbeat}" << std::endl;
             std::cout << "                                  default = 'off'" << std::endl;
-            std::cout << "                                  on: enables monitoring for all processes" << std::endl;
+            std::cout << "                                  on: enables monitoring for all processes;" << std::endl;
+            std::cout << "                                  uses pidfds if supported" << std::endl;
             std::cout << "                                  off: disables monitoring for all processes" << std::endl;
+            std::cout << "                                  heartbeat: monitors all processes with a" << std::endl;
+            std::cout << "                                  heartbeat; required if the applications" << std::endl;
+            std::cout << "                                  run in a different pid namespace" << std::endl;
             std::cout << "-l, --log-level <LEVEL>           Set log level." << std::endl;
             std::cout << "                                  <LEVEL> {off, fatal, error, warning, info," << std::endl;
             std::cout << "                                  debug, trace}" << std::endl;
@@ -92,6 +97,12 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
             std::cout << "                                  SIGKILL to application which did not respond" << std::endl;
             std::cout << "                                  to the initial SIGTERM signal." << std::endl;
             std::cout << "                                  default = '45'" << std::endl;
+            std::cout << "-w, --runtime-message-workers <UINT>" << std::endl;
+            std::cout << "                                  Sets the number of threads which process the" << std::endl;
+            std::cout << "                                  requests of the applications concurrently." << std::endl;
+            std::cout << "                                  <UINT> 1.." << roudi::MAX_RUNTIME_MESSAGE_WORKER_COUNT << std::endl;
+            std::cout << "                                  default = '" << roudi::DEFAULT_RUNTIME_MESSAGE_WORKER_COUNT
+                      << "'" << std::endl;
 
             m_cmdLineArgs.run = false;
             break;
@@ -147,9 +158,13 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
             {
                 m_cmdLineArgs.roudiConfig.monitoringMode = roudi::MonitoringMode::OFF;
             }
+            else if (strcmp(optarg, "heartbeat") == 0)
+            {
+                m_cmdLineArgs.roudiConfig.monitoringMode = roudi::MonitoringMode::HEARTBEAT;
+            }
             else
             {
-                IOX_LOG(Error, "Options for monitoring-mode are 'on' and 'off'!");
+                IOX_LOG(Error, "Options for monitoring-mode are 'on', 'off' and 'heartbeat'!");
                 return err(CmdLineParserResult::INVALID_PARAMETER);
             }
             break;
@@ -220,6 +235,21 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
             m_cmdLineArgs.roudiConfig.processKillDelay = units::Duration::fromSeconds(maybeValue.value());
             break;
         }
+        case 'w':
+        {
+            auto maybeValue = convert::from_string<uint32_t>(optarg);
+            if (!maybeValue.has_value() || maybeValue.value() == 0U
+                || maybeValue.value() > roudi::MAX_RUNTIME_MESSAGE_WORKER_COUNT)
+            {
+                IOX_LOG(Error,
+                        "The number of runtime message workers must be in the range of [1, "
+                            << roudi::MAX_RUNTIME_MESSAGE_WORKER_COUNT << "]");
+                return err(CmdLineParserResult::INVALID_PARAMETER);
+            }
+
+            m_cmdLineArgs.roudiConfig.runtimeMessageWorkerCount = maybeValue.value();
+            break;
+        }
         case 'x':
         {
             if (strcmp(optarg, "off") == 0)
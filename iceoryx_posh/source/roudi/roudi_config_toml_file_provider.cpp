@@ -171,12 +171,54 @@ TomlRouDiConfigFileProvider::parse(std::istream& stream) noexcept
             {
                 return iox::err(iox::roudi::RouDiConfigFileParseError::MEMPOOL_WITHOUT_CHUNK_COUNT);
             }
-            mempoolConfig.addMemPool({*chunkSize, *chunkCount});
+            auto overflowChunkCount = mempool->get_as<uint32_t>("overflow-count").value_or(0U);
+            auto maxChunksPerPublisher = mempool->get_as<uint32_t>("max-chunks-per-publisher").value_or(0U);
+            mempoolConfig.addMemPool({*chunkSize, *chunkCount, overflowChunkCount, maxChunksPerPublisher});
         }
+        mempoolConfig.m_overflowThresholdPercent =
+            segment->get_as<uint32_t>("overflow-threshold").value_or(iox::DEFAULT_OVERFLOW_THRESHOLD_PERCENT);
+
+        iox::NumaPlacement numaPlacement;
+        auto numaNode = segment->get_as<uint32_t>("numa-node");
+        auto numaInterleave = segment->get_as<bool>("numa-interleave").value_or(false);
+        if (numaNode && numaInterleave)
+        {
+            return iox::err(iox::roudi::RouDiConfigFileParseError::SEGMENT_WITH_CONFLICTING_NUMA_PLACEMENT);
+        }
+        if (numaNode)
+        {
+            numaPlacement = {iox::NumaPolicy::BIND, *numaNode};
+        }
+        else if (numaInterleave)
+        {
+            numaPlacement.policy = iox::NumaPolicy::INTERLEAVE;
+        }
+
+        auto trafficClass = iox::mepoo::TrafficClass::UNSPECIFIED;
+        auto trafficClassName = segment->get_as<std::string>("traffic-class");
+        if (trafficClassName)
+        {
+            if (*trafficClassName == "latency-critical")
+            {
+                trafficClass = iox::mepoo::TrafficClass::LATENCY_CRITICAL;
+            }
+            else if (*trafficClassName == "bulk")
+            {
+                trafficClass = iox::mepoo::TrafficClass::BULK;
+            }
+            else
+            {
+                return iox::err(iox::roudi::RouDiConfigFileParseError::SEGMENT_WITH_INVALID_TRAFFIC_CLASS);
+            }
+        }
+
         parsedConfig.m_sharedMemorySegments.push_back(
             {PosixGroup::groupName_t(iox::TruncateToCapacity, reader.c_str(), reader.size()),
              PosixGroup::groupName_t(iox::TruncateToCapacity, writer.c_str(), writer.size()),
-             mempoolConfig});
+             mempoolConfig,
+             iox::mepoo::MemoryInfo(),
+             numaPlacement,
+             trafficClass});
     }
 
     return iox::ok(parsedConfig);
@@ -0,0 +1,126 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/roudi/runtime_message_dispatcher.hpp"
+#include "iox/logging.hpp"
+#include "iox/thread.hpp"
+
+#include <algorithm>
+
+namespace iox
+{
+namespace roudi
+{
+RuntimeMessageDispatcher::RuntimeMessageDispatcher(const uint32_t numberOfWorkers,
+                                                   const MessageHandler_t& handler) noexcept
+    : m_handler(handler)
+{
+    const auto workerCount = std::min(std::max(numberOfWorkers, 1U), MAX_RUNTIME_MESSAGE_WORKER_COUNT);
+    if (workerCount != numberOfWorkers)
+    {
+        IOX_LOG(Warn,
+                "The number of runtime message workers must be in the range of [1, "
+                    << MAX_RUNTIME_MESSAGE_WORKER_COUNT << "], using " << workerCount << " instead of "
+                    << numberOfWorkers);
+    }
+
+    for (uint32_t i = 0U; i < workerCount; ++i)
+    {
+        m_workers.emplace_back();
+    }
+    // the threads are started after all workers are created since the vector must not change anymore
+    for (auto& worker : m_workers)
+    {
+        worker.m_thread = std::thread(&RuntimeMessageDispatcher::run, this, std::ref(worker));
+    }
+}
+
+RuntimeMessageDispatcher::~RuntimeMessageDispatcher() noexcept
+{
+    for (auto& worker : m_workers)
+    {
+        {
+            std::lock_guard<std::mutex> lock(worker.m_mutex);
+            worker.m_keepRunning = false;
+        }
+        worker.m_wakeup.notify_one();
+    }
+    for (auto& worker : m_workers)
+    {
+        if (worker.m_thread.joinable())
+        {
+            worker.m_thread.join();
+        }
+    }
+}
+
+void RuntimeMessageDispatcher::dispatch(runtime::IpcMessage&& message,
+                                        const runtime::IpcMessageType cmd,
+                                        const RuntimeName_t& runtimeName) noexcept
+{
+    auto& worker = m_workers[workerIndex(runtimeName, numberOfWorkers())];
+    {
+        std::lock_guard<std::mutex> lock(worker.m_mutex);
+        worker.m_requests.push_back(Request{std::move(message), cmd, runtimeName});
+    }
+    worker.m_wakeup.notify_one();
+}
+
+uint32_t RuntimeMessageDispatcher::numberOfWorkers() const noexcept
+{
+    return static_cast<uint32_t>(m_workers.size());
+}
+
+uint32_t RuntimeMessageDispatcher::workerIndex(const RuntimeName_t& runtimeName,
+                                               const uint32_t numberOfWorkers) noexcept
+{
+    // FNV-1a
+    constexpr uint64_t FNV_OFFSET_BASIS{14695981039346656037U};
+    constexpr uint64_t FNV_PRIME{1099511628211U};
+    uint64_t hash{FNV_OFFSET_BASIS};
+    for (uint64_t i = 0U; i < runtimeName.size(); ++i)
+    {
+        hash ^= static_cast<uint8_t>(runtimeName.unchecked_at(i));
+        hash *= FNV_PRIME;
+    }
+    return (numberOfWorkers == 0U) ? 0U : static_cast<uint32_t>(hash % numberOfWorkers);
+}
+
+void RuntimeMessageDispatcher::run(Worker& worker) noexcept
+{
+    setThreadName("IPC-msg-worker");
+
+    while (true)
+    {
+        Request request;
+        {
+            std::unique_lock<std::mutex> lock(worker.m_mutex);
+            worker.m_wakeup.wait(lock, [&] { return !worker.m_keepRunning || !worker.m_requests.empty(); });
+            if (!worker.m_keepRunning)
+            {
+                return;
+            }
+            request = std::move(worker.m_requests.front());
+            worker.m_requests.pop_front();
+        }
+
+        m_handler(request.m_message, request.m_cmd, request.m_runtimeName);
+    }
+}
+
+} // namespace roudi
+} // namespace iox
@@ -56,6 +56,13 @@ concurrent::Atomic<bool>& poshRuntimeNeedsManualDestruction()
     return s_needsManualDestruction;
 }
 
+// The domain which is used by the default runtime factory; set by 'initRuntime' before the runtime is created.
+DomainId& defaultRuntimeDomainId()
+{
+    static DomainId s_domainId{DEFAULT_DOMAIN_ID};
+    return s_domainId;
+}
+
 } // anonymous namespace
 
 PoshRuntime::factory_t& PoshRuntime::getRuntimeFactory() noexcept
@@ -85,7 +92,7 @@ PoshRuntime& PoshRuntime::defaultRuntimeFactory(optional<const RuntimeName_t*> n
     // This is the primary lifetime participant. It ensures that, even if getLifetimeParticipant()
     // is never called, the runtime has the same lifetime as a regular static variable.
     static ScopeGuard staticLifetimeParticipant = [](auto name) {
-        new (&buf) PoshRuntimeImpl(name);
+        new (&buf) PoshRuntimeImpl(name, defaultRuntimeDomainId());
         poshRuntimeNeedsManualDestruction() = true;
         return getLifetimeParticipant();
     }(name);
@@ -103,6 +110,12 @@ PoshRuntime& PoshRuntime::initRuntime(const RuntimeName_t& name) noexcept
     return getInstance(make_optional<const RuntimeName_t*>(&name));
 }
 
+PoshRuntime& PoshRuntime::initRuntime(const RuntimeName_t& name, const DomainId domainId) noexcept
+{
+    defaultRuntimeDomainId() = domainId;
+    return getInstance(make_optional<const RuntimeName_t*>(&name));
+}
+
 PoshRuntime& PoshRuntime::getInstance(optional<const RuntimeName_t*> name) noexcept
 {
     return getRuntimeFactory()(name);
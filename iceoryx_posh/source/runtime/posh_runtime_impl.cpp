@@ -210,7 +210,8 @@ PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service
                 "Service '"
                     << service
                     << "' could not be created. RouDi did not find a writable shared memory segment for the current "
-                       "user. Try using another user or adapt RouDi's config.");
+                       "user which matches the 'segmentName' of the PublisherOptions. Try using another user or adapt "
+                       "RouDi's config.");
             IOX_REPORT(PoshError::POSH__RUNTIME_NO_WRITABLE_SHM_SEGMENT, iox::er::RUNTIME_ERROR);
             break;
         default:
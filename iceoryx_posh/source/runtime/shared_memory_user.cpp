@@ -24,12 +24,45 @@
 #include "iox/posix_user.hpp"
 #include "iox/scope_guard.hpp"
 
+#include <mutex>
+
 namespace iox
 {
 namespace runtime
 {
 constexpr uint32_t SharedMemoryUser::NUMBER_OF_ALL_SHM_SEGMENTS;
 
+namespace
+{
+optional<mepoo::SegmentManager<>::SegmentMapping> findSegmentMapping(mepoo::SegmentManager<>& segmentManager,
+                                                                     const uint64_t segmentId) noexcept
+{
+    const auto user = PosixUser::getUserOfCurrentProcess();
+    for (const auto& mapping : segmentManager.getSegmentMappings(user))
+    {
+        if (mapping.m_segmentId == segmentId)
+        {
+            return mapping;
+        }
+    }
+    return segmentManager.getOverflowSegmentMapping(user, segmentId);
+}
+} // namespace
+
+struct SharedMemoryUser::OnDemandSegments
+{
+    std::mutex m_mutex;
+    DomainId m_domainId{DEFAULT_DOMAIN_ID};
+    mepoo::SegmentManager<>* m_segmentManager{nullptr};
+    ShmVector_t m_shmSegments;
+};
+
+SharedMemoryUser::OnDemandSegments& SharedMemoryUser::onDemandSegments() noexcept
+{
+    static OnDemandSegments onDemandSegments;
+    return onDemandSegments;
+}
+
 expected<SharedMemoryUser, SharedMemoryUserError>
 SharedMemoryUser::create(const DomainId domainId,
                          const uint64_t segmentId,
@@ -52,13 +85,19 @@ SharedMemoryUser::create(const DomainId domainId,
         return err(shmOpen.error());
     }
 
-    // open payload segments
+    // open the writable payload segment; the read-only ones are mapped on demand since a process usually reads only
+    // from a few of the segments it has access to
     auto* ptr = UntypedRelativePointer::getPtr(segment_id_t{segmentId}, segmentManagerAddressOffset);
     auto* segmentManager = static_cast<mepoo::SegmentManager<>*>(ptr);
 
     auto segmentMapping = segmentManager->getSegmentMappings(PosixUser::getUserOfCurrentProcess());
     for (const auto& segment : segmentMapping)
     {
+        if (!segment.m_isWritable)
+        {
+            continue;
+        }
+
         if (static_cast<uint32_t>(shmSegments.size()) >= MAX_SHM_SEGMENTS)
         {
             return err(SharedMemoryUserError::TOO_MANY_SHM_SEGMENTS);
@@ -70,13 +109,21 @@ SharedMemoryUser::create(const DomainId domainId,
                                       ResourceType::USER_DEFINED,
                                       segment.m_sharedMemoryName,
                                       segment.m_size,
-                                      segment.m_isWritable ? AccessMode::ReadWrite : AccessMode::ReadOnly);
+                                      AccessMode::ReadWrite);
         if (shmOpen.has_error())
         {
             return err(shmOpen.error());
         }
     }
 
+    {
+        auto& onDemand = onDemandSegments();
+        std::lock_guard<std::mutex> lock(onDemand.m_mutex);
+        onDemand.m_domainId = domainId;
+        onDemand.m_segmentManager = segmentManager;
+    }
+    UntypedRelativePointer::setUnknownSegmentHandler(&SharedMemoryUser::mapSegmentOnDemand);
+
     ScopeGuard::release(std::move(shmCleaner));
     return ok(SharedMemoryUser{std::move(shmSegments)});
 }
@@ -88,9 +135,62 @@ SharedMemoryUser::SharedMemoryUser(ShmVector_t&& payloadShm) noexcept
 
 SharedMemoryUser::~SharedMemoryUser() noexcept
 {
+    // a moved-from SharedMemoryUser has no segments and must not touch the on demand segments of the moved-to one
+    if (!m_shmSegments.empty())
+    {
+        UntypedRelativePointer::setUnknownSegmentHandler(nullptr);
+        auto& onDemand = onDemandSegments();
+        std::lock_guard<std::mutex> lock(onDemand.m_mutex);
+        onDemand.m_segmentManager = nullptr;
+        SharedMemoryUser::destroy(onDemand.m_shmSegments);
+    }
     SharedMemoryUser::destroy(m_shmSegments);
 }
 
+void SharedMemoryUser::mapSegmentOnDemand(const segment_id_underlying_t segmentId) noexcept
+{
+    auto& onDemand = onDemandSegments();
+    std::lock_guard<std::mutex> lock(onDemand.m_mutex);
+    if (onDemand.m_segmentManager == nullptr)
+    {
+        return;
+    }
+
+    // another thread might have mapped the segment while this one was waiting for the lock
+    for (auto& shm : onDemand.m_shmSegments)
+    {
+        if (UntypedRelativePointer::searchId(shm.getBaseAddress()) == segmentId)
+        {
+            return;
+        }
+    }
+
+    auto mapping = findSegmentMapping(*onDemand.m_segmentManager, segmentId);
+    if (!mapping.has_value())
+    {
+        IOX_LOG(Error, "Unable to resolve a relative pointer to the unknown segment with id " << segmentId);
+        return;
+    }
+
+    if (onDemand.m_shmSegments.size() >= onDemand.m_shmSegments.capacity())
+    {
+        IOX_LOG(Error, "Unable to map the segment with id " << segmentId << " since too many are mapped");
+        return;
+    }
+
+    auto shmOpen = openShmSegment(onDemand.m_shmSegments,
+                                  onDemand.m_domainId,
+                                  mapping->m_segmentId,
+                                  ResourceType::USER_DEFINED,
+                                  mapping->m_sharedMemoryName,
+                                  mapping->m_size,
+                                  mapping->m_isWritable ? AccessMode::ReadWrite : AccessMode::ReadOnly);
+    if (shmOpen.has_error())
+    {
+        IOX_LOG(Error, "Unable to map the segment with id " << segmentId);
+    }
+}
+
 void SharedMemoryUser::destroy(ShmVector_t& shmSegments) noexcept
 {
     while (!shmSegments.empty())
@@ -29,6 +29,7 @@
 #include "test.hpp"
 
 #include <optional>
+#include <thread>
 
 namespace
 {
@@ -507,6 +508,32 @@ TEST(Node_test, CreatingWaitSetWithCustomCapacityWorks)
     EXPECT_TRUE((std::is_same_v<decltype(ws), iox::unique_ptr<iox::posh::experimental::WaitSet<CAPACITY>>>));
 }
 
+TEST(Node_test, WaitSetWithSpinDurationIsNotifiedBySubscriber)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "58b90c74-2186-406f-b9b2-d8d01bdee03f");
+
+    RouDiEnv roudi;
+
+    auto node = RouDiEnvNodeBuilder("hypnotoad").create().expect("Creating a node should not fail!");
+
+    auto publisher = node.publisher({"all", "glory", "hypnotoad"}).create<uint64_t>().expect("Getting publisher");
+    auto subscriber = node.subscriber({"all", "glory", "hypnotoad"}).create<uint64_t>().expect("Getting subscriber");
+    auto ws = node.wait_set().spin_duration(10_s).relax_cpu_while_spinning(false).create().expect("Getting waitset");
+
+    ASSERT_FALSE(ws->attachState(*subscriber.get(), iox::popo::SubscriberState::HAS_DATA).has_error());
+
+    std::thread delayed_publisher([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        constexpr uint64_t DATA{42};
+        publisher->publishCopyOf(DATA).or_else([](const auto) { GTEST_FAIL() << "Expected to send data"; });
+    });
+
+    auto notifications = ws->wait();
+    delayed_publisher.join();
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_TRUE(notifications[0]->doesOriginateFrom(subscriber.get()));
+}
+
 TEST(Node_test, ExhaustingPublisherSubscriberAndWaitSetLeadsToError)
 {
     ::testing::Test::RecordProperty("TEST_ID", "794e5db8-8d08-428b-af21-e3934a29ea8f");
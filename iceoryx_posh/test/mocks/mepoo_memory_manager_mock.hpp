@@ -27,6 +27,20 @@ class MePooMemoryManager_MOCK
         return iox::MAX_NUMBER_OF_MEMPOOLS;
     }
     MOCK_CONST_METHOD1(getMemPoolInfo, iox::mepoo::MemPoolInfo(uint32_t));
+    iox::mepoo::MemPoolInfo getOverflowMemPoolInfo(uint32_t) const
+    {
+        return {0U, 0U, 0U, 0U};
+    }
+    uint32_t getNumberOfOverflowMemPools(uint32_t) const
+    {
+        return 0U;
+    }
+    const iox::mepoo::ChunkSizeHistogram& getChunkSizeHistogram() const
+    {
+        return chunkSizeHistogram;
+    }
+
+    iox::mepoo::ChunkSizeHistogram chunkSizeHistogram;
 };
 
 #endif // IOX_POSH_MOCKS_MEPOO_MEMORY_MANAGER_MOCK_HPP
@@ -56,6 +56,8 @@ class MockPublisherPortUser
     MOCK_METHOD4(tryAllocateChunk,
                  iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError>(
                      const uint64_t, const uint32_t, const uint32_t, const uint32_t));
+    MOCK_METHOD2(tryAllocateChainedChunk,
+                 iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError>(const uint64_t, const uint32_t));
     MOCK_METHOD1(releaseChunk, void(iox::mepoo::ChunkHeader* const));
     MOCK_METHOD1(sendChunk, void(iox::mepoo::ChunkHeader* const));
     MOCK_METHOD0(tryGetPreviousChunk, iox::optional<iox::mepoo::ChunkHeader*>());
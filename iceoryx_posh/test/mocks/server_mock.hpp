@@ -58,6 +58,10 @@ class MockServerPortUser : public MockBasePort
                 allocateResponse,
                 (const iox::popo::RequestHeader* const, const uint64_t, const uint32_t),
                 (noexcept));
+    MOCK_METHOD((iox::expected<iox::popo::ResponseHeader*, iox::popo::AllocationError>),
+                allocateResponseInPlace,
+                (const iox::popo::RequestHeader* const, const uint64_t, const uint32_t),
+                (noexcept));
     MOCK_METHOD(void, releaseResponse, (const iox::popo::ResponseHeader* const), (noexcept));
     MOCK_METHOD((iox::expected<void, iox::popo::ServerSendError>),
                 sendResponse,
@@ -0,0 +1,127 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/mepoo/chained_payload.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/bump_allocator.hpp"
+
+#include "test.hpp"
+
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+
+using iox::mepoo::ChainedPayload;
+using iox::mepoo::ConstChainedPayload;
+
+class ChainedPayload_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        mempoolconf.addMemPool({CHUNK_SIZE, CHUNK_COUNT});
+        memoryManager.configureMemoryManager(mempoolconf, allocator, allocator);
+    }
+
+    static constexpr uint64_t CHUNK_SIZE{128U};
+    static constexpr uint32_t CHUNK_COUNT{20U};
+    static constexpr uint64_t USER_PAYLOAD_SIZE{5U * CHUNK_SIZE + 7U};
+
+    static constexpr size_t MEMORY_SIZE{100000U};
+    alignas(8) uint8_t memory[MEMORY_SIZE];
+    iox::BumpAllocator allocator{memory, MEMORY_SIZE};
+    iox::mepoo::MePooConfig mempoolconf;
+    iox::mepoo::MemoryManager memoryManager;
+};
+
+TEST_F(ChainedPayload_test, ViewOfChunkWhichIsNotChainedIsNotCreated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cc7d249f-cb21-4ddf-9fce-c5f976438628");
+    auto chunkSettings = iox::mepoo::ChunkSettings::create(CHUNK_SIZE / 2U, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+    ASSERT_FALSE(chunkSettings.has_error());
+    auto chunk = memoryManager.getChunk(chunkSettings.value());
+    ASSERT_FALSE(chunk.has_error());
+
+    EXPECT_FALSE(ChainedPayload::fromUserPayload(chunk->getUserPayload()).has_value());
+    EXPECT_FALSE(ChainedPayload::fromUserPayload(nullptr).has_value());
+}
+
+TEST_F(ChainedPayload_test, SegmentsAreAlignedAndCoverTheWholeUserPayload)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "073b937b-69ed-4bf1-94c3-dc957a8a31c1");
+    constexpr uint32_t USER_PAYLOAD_ALIGNMENT{16U};
+    auto chunk = memoryManager.getChainedChunk(USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT);
+    ASSERT_FALSE(chunk.has_error());
+    auto sut = ChainedPayload::fromUserPayload(chunk->getUserPayload());
+    ASSERT_TRUE(sut.has_value());
+
+    EXPECT_THAT(sut->segment(0U).data(), Eq(chunk->getUserPayload()));
+    uint64_t size{0U};
+    uint32_t numberOfSegments{0U};
+    for (const auto segment : *sut)
+    {
+        EXPECT_THAT(reinterpret_cast<uintptr_t>(segment.data()) % USER_PAYLOAD_ALIGNMENT, Eq(0U));
+        size += segment.size();
+        ++numberOfSegments;
+    }
+    EXPECT_THAT(size, Eq(USER_PAYLOAD_SIZE));
+    EXPECT_THAT(numberOfSegments, Eq(sut->numberOfSegments()));
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(numberOfSegments));
+}
+
+TEST_F(ChainedPayload_test, CopyFromAndCopyToRestoreTheUserPayload)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6b606c62-07ce-4583-bf02-ec90a4396c4f");
+    auto chunk = memoryManager.getChainedChunk(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+    ASSERT_FALSE(chunk.has_error());
+    auto sut = ChainedPayload::fromUserPayload(chunk->getUserPayload());
+    ASSERT_TRUE(sut.has_value());
+
+    std::vector<uint8_t> data(USER_PAYLOAD_SIZE);
+    for (uint64_t i = 0U; i < USER_PAYLOAD_SIZE; ++i)
+    {
+        data[i] = static_cast<uint8_t>(i * 7U);
+    }
+    EXPECT_THAT(sut->copyFrom(data.data(), data.size()), Eq(USER_PAYLOAD_SIZE));
+
+    const void* userPayload = chunk->getUserPayload();
+    auto constView = ConstChainedPayload::fromUserPayload(userPayload);
+    ASSERT_TRUE(constView.has_value());
+    std::vector<uint8_t> copy(USER_PAYLOAD_SIZE);
+    EXPECT_THAT(constView->copyTo(copy.data(), copy.size()), Eq(USER_PAYLOAD_SIZE));
+    EXPECT_THAT(copy, Eq(data));
+}
+
+TEST_F(ChainedPayload_test, CopyIsLimitedByTheSizeOfTheSmallerMemory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f44b7b3f-3a61-4c33-ae49-074a5b03fa90");
+    auto chunk = memoryManager.getChainedChunk(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+    ASSERT_FALSE(chunk.has_error());
+    auto sut = ChainedPayload::fromUserPayload(chunk->getUserPayload());
+    ASSERT_TRUE(sut.has_value());
+
+    std::vector<uint8_t> smallerMemory(CHUNK_SIZE + 3U, 42U);
+    EXPECT_THAT(sut->copyFrom(smallerMemory.data(), smallerMemory.size()), Eq(smallerMemory.size()));
+
+    std::vector<uint8_t> largerMemory(2U * USER_PAYLOAD_SIZE, 0U);
+    EXPECT_THAT(sut->copyTo(largerMemory.data(), largerMemory.size()), Eq(USER_PAYLOAD_SIZE));
+    EXPECT_THAT(largerMemory[smallerMemory.size() - 1U], Eq(42U));
+}
+
+} // namespace
@@ -0,0 +1,149 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/chunk_size_histogram.hpp"
+
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/mepoo/chunk_settings.hpp"
+
+#include "test.hpp"
+
+#include <cstdint>
+
+namespace
+{
+using namespace ::testing;
+
+using namespace iox::mepoo;
+
+class ChunkSizeHistogram_test : public Test
+{
+  public:
+    ChunkSizeHistogram sut;
+};
+
+TEST_F(ChunkSizeHistogram_test, SizesUpToTheMinimalChunkSizeFallIntoTheFirstSizeClass)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8656e0b1-705b-4bc9-a00d-ab4a3f7e0c10");
+    EXPECT_THAT(ChunkSizeHistogram::sizeClass(0U), Eq(0U));
+    EXPECT_THAT(ChunkSizeHistogram::sizeClass(ChunkSizeHistogram::MIN_CHUNK_SIZE), Eq(0U));
+    EXPECT_THAT(ChunkSizeHistogram::sizeClassUpperBound(0U), Eq(ChunkSizeHistogram::MIN_CHUNK_SIZE));
+}
+
+TEST_F(ChunkSizeHistogram_test, EachPowerOfTwoIsSplitIntoSubClasses)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ca981f40-0254-4b85-a1a3-5a382d67200d");
+    EXPECT_THAT(ChunkSizeHistogram::sizeClass(65U), Eq(1U));
+    EXPECT_THAT(ChunkSizeHistogram::sizeClass(80U), Eq(1U));
+    EXPECT_THAT(ChunkSizeHistogram::sizeClass(81U), Eq(2U));
+    EXPECT_THAT(ChunkSizeHistogram::sizeClass(128U), Eq(4U));
+    EXPECT_THAT(ChunkSizeHistogram::sizeClass(129U), Eq(5U));
+
+    EXPECT_THAT(ChunkSizeHistogram::sizeClassUpperBound(1U), Eq(80U));
+    EXPECT_THAT(ChunkSizeHistogram::sizeClassUpperBound(2U), Eq(96U));
+    EXPECT_THAT(ChunkSizeHistogram::sizeClassUpperBound(4U), Eq(128U));
+    EXPECT_THAT(ChunkSizeHistogram::sizeClassUpperBound(5U), Eq(160U));
+}
+
+TEST_F(ChunkSizeHistogram_test, EveryChunkSizeFitsIntoTheUpperBoundOfItsSizeClass)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "49357f2b-b3b5-4640-820b-6bb6387dec25");
+    for (uint64_t chunkSize = 1U; chunkSize < 100000U; chunkSize += 7U)
+    {
+        const auto sizeClass = ChunkSizeHistogram::sizeClass(chunkSize);
+        EXPECT_THAT(ChunkSizeHistogram::sizeClassUpperBound(sizeClass), Ge(chunkSize));
+        if (sizeClass > 0U)
+        {
+            EXPECT_THAT(ChunkSizeHistogram::sizeClassUpperBound(sizeClass - 1U), Lt(chunkSize));
+        }
+    }
+}
+
+TEST_F(ChunkSizeHistogram_test, HugeChunkSizesFallIntoTheLargestSizeClass)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bf609154-6ed3-4899-86e9-812b310d3479");
+    EXPECT_THAT(ChunkSizeHistogram::sizeClass(std::numeric_limits<uint64_t>::max()),
+                Eq(ChunkSizeHistogram::NUMBER_OF_SIZE_CLASSES - 1U));
+    EXPECT_THAT(ChunkSizeHistogram::sizeClass(std::numeric_limits<uint32_t>::max()),
+                Lt(ChunkSizeHistogram::NUMBER_OF_SIZE_CLASSES - 1U));
+}
+
+TEST_F(ChunkSizeHistogram_test, AcquisitionsAreCountedInTheirSizeClass)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8479e048-40e8-4516-ada1-06f9df8d2d4f");
+    sut.recordAcquisition(100U);
+    sut.recordAcquisition(110U);
+    sut.recordAcquisition(1000U);
+
+    const auto info = sut.getSizeClassInfo(ChunkSizeHistogram::sizeClass(100U));
+    EXPECT_THAT(info.m_chunkSize, Eq(112U));
+    EXPECT_THAT(info.m_numRequests, Eq(2U));
+    EXPECT_THAT(info.m_chunksInUse, Eq(2U));
+    EXPECT_THAT(info.m_peakChunksInUse, Eq(2U));
+
+    EXPECT_THAT(sut.getSizeClassInfo(ChunkSizeHistogram::sizeClass(1000U)).m_numRequests, Eq(1U));
+    EXPECT_THAT(sut.getSizeClassInfo(0U).m_numRequests, Eq(0U));
+}
+
+TEST_F(ChunkSizeHistogram_test, ReleasesReduceTheChunksInUseButKeepThePeak)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "007616c6-8d5e-45cd-90bb-a84f666790ea");
+    constexpr uint64_t USER_PAYLOAD_SIZE{200U};
+    auto chunkSettings = ChunkSettings::create(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).value();
+    alignas(ChunkHeader) uint8_t chunk[1024U];
+    auto* chunkHeader = new (chunk) ChunkHeader(sizeof(chunk), chunkSettings);
+
+    EXPECT_THAT(ChunkSizeHistogram::requiredChunkSize(*chunkHeader), Eq(chunkSettings.requiredChunkSize()));
+
+    sut.recordAcquisition(chunkSettings.requiredChunkSize());
+    sut.recordAcquisition(chunkSettings.requiredChunkSize());
+    sut.recordRelease(*chunkHeader);
+    sut.recordRelease(*chunkHeader);
+    sut.recordAcquisition(chunkSettings.requiredChunkSize());
+
+    const auto info = sut.getSizeClassInfo(ChunkSizeHistogram::sizeClass(chunkSettings.requiredChunkSize()));
+    EXPECT_THAT(info.m_numRequests, Eq(3U));
+    EXPECT_THAT(info.m_chunksInUse, Eq(1U));
+    EXPECT_THAT(info.m_peakChunksInUse, Eq(2U));
+    chunkHeader->~ChunkHeader();
+}
+
+TEST_F(ChunkSizeHistogram_test, RequiredChunkSizeIsRecalculatedWithUserHeaderAndCustomAlignment)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c6e56f27-2628-4af8-b54c-e2f456b95782");
+    constexpr uint64_t USER_PAYLOAD_SIZE{100U};
+    constexpr uint32_t USER_PAYLOAD_ALIGNMENT{128U};
+    constexpr uint32_t USER_HEADER_SIZE{16U};
+    constexpr uint32_t USER_HEADER_ALIGNMENT{8U};
+    auto chunkSettings =
+        ChunkSettings::create(USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT)
+            .value();
+    alignas(ChunkHeader) uint8_t chunk[1024U];
+    auto* chunkHeader = new (chunk) ChunkHeader(sizeof(chunk), chunkSettings);
+
+    EXPECT_THAT(ChunkSizeHistogram::requiredChunkSize(*chunkHeader), Eq(chunkSettings.requiredChunkSize()));
+    chunkHeader->~ChunkHeader();
+}
+
+TEST_F(ChunkSizeHistogram_test, InfoOfInvalidSizeClassIsEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4299d00c-578e-4315-b15f-fada5131bc8a");
+    const auto info = sut.getSizeClassInfo(ChunkSizeHistogram::NUMBER_OF_SIZE_CLASSES);
+    EXPECT_THAT(info.m_chunkSize, Eq(0U));
+    EXPECT_THAT(info.m_numRequests, Eq(0U));
+}
+
+} // namespace
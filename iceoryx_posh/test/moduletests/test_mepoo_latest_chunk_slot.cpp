@@ -0,0 +1,198 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/latest_chunk_slot.hpp"
+
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/bump_allocator.hpp"
+
+#include "test.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+
+using namespace iox::mepoo;
+
+class LatestChunkSlot_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        MePooConfig mempoolconf;
+        mempoolconf.addMemPool({CHUNK_SIZE, NUM_CHUNKS_IN_POOL});
+        memoryManager.configureMemoryManager(mempoolconf, m_memoryAllocator, m_memoryAllocator);
+    }
+
+    SharedChunk getChunkFromMemoryManager()
+    {
+        auto chunkSettings =
+            iox::mepoo::ChunkSettings::create(sizeof(uint64_t), alignof(uint64_t)).expect("Valid 'ChunkSettings'");
+
+        return memoryManager.getChunk(chunkSettings).expect("Obtaining chunk");
+    }
+
+    uint64_t usedChunks()
+    {
+        return memoryManager.getMemPoolInfo(0).m_usedChunks;
+    }
+
+    iox::mepoo::MemoryManager memoryManager;
+    LatestChunkSlot sut;
+
+  private:
+    static constexpr size_t KILOBYTE = 1 << 10;
+    static constexpr size_t MEMORY_SIZE = 100 * KILOBYTE;
+    std::unique_ptr<char[]> m_memory{new char[MEMORY_SIZE]};
+    static constexpr uint32_t NUM_CHUNKS_IN_POOL = 100;
+    static constexpr uint64_t CHUNK_SIZE = 128;
+
+    iox::BumpAllocator m_memoryAllocator{m_memory.get(), MEMORY_SIZE};
+};
+
+TEST_F(LatestChunkSlot_test, DefaultConstructedSlotIsEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "10ef23ba-b555-407c-8f10-02af2492fa35");
+    EXPECT_TRUE(sut.isEmpty());
+    EXPECT_FALSE(sut.tryAcquire());
+}
+
+TEST_F(LatestChunkSlot_test, StoredChunkCanBeAcquired)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "39fa55b3-6073-4a5c-b902-c341409a1fa5");
+    auto chunk = getChunkFromMemoryManager();
+    sut.store(chunk);
+
+    EXPECT_FALSE(sut.isEmpty());
+    auto acquiredChunk = sut.tryAcquire();
+    ASSERT_TRUE(acquiredChunk);
+    EXPECT_TRUE(acquiredChunk == chunk);
+
+    sut.clear();
+}
+
+TEST_F(LatestChunkSlot_test, SlotKeepsChunkAliveWhenOtherOwnersReleaseIt)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a5592d76-3392-4796-84a2-24b8aa49717f");
+    sut.store(getChunkFromMemoryManager());
+
+    EXPECT_THAT(usedChunks(), Eq(1U));
+    EXPECT_TRUE(sut.tryAcquire());
+
+    sut.clear();
+    EXPECT_THAT(usedChunks(), Eq(0U));
+}
+
+TEST_F(LatestChunkSlot_test, StoringNewChunkReleasesPreviousChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8e260c87-cbff-4fea-a8da-db4117038a97");
+    sut.store(getChunkFromMemoryManager());
+    auto newChunk = getChunkFromMemoryManager();
+    sut.store(newChunk);
+
+    EXPECT_THAT(usedChunks(), Eq(1U));
+    EXPECT_TRUE(sut.tryAcquire() == newChunk);
+
+    newChunk = SharedChunk();
+    sut.clear();
+    EXPECT_THAT(usedChunks(), Eq(0U));
+}
+
+TEST_F(LatestChunkSlot_test, AcquiredChunkOutlivesReplacementInSlot)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "53664cc1-01a7-4ce2-875f-3acd89ef9eaf");
+    sut.store(getChunkFromMemoryManager());
+    auto acquiredChunk = sut.tryAcquire();
+    ASSERT_TRUE(acquiredChunk);
+
+    sut.clear();
+
+    EXPECT_TRUE(sut.isEmpty());
+    EXPECT_FALSE(sut.tryAcquire());
+    EXPECT_THAT(usedChunks(), Eq(1U));
+
+    acquiredChunk = SharedChunk();
+    EXPECT_THAT(usedChunks(), Eq(0U));
+}
+
+TEST_F(LatestChunkSlot_test, StoringEmptyChunkClearsSlot)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d6f46b8b-ecac-4b47-9cc6-a465eebc7aeb");
+    sut.store(getChunkFromMemoryManager());
+    sut.store(SharedChunk());
+
+    EXPECT_TRUE(sut.isEmpty());
+    EXPECT_THAT(usedChunks(), Eq(0U));
+}
+
+TEST_F(LatestChunkSlot_test, ConcurrentReadersAlwaysAcquireConsistentChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ca5eb1b2-8f52-493a-b2f6-d4ed1304b1cd");
+    constexpr uint64_t NUMBER_OF_READERS{4U};
+    constexpr uint64_t NUMBER_OF_STORES{10000U};
+
+    std::atomic<bool> keepRunning{true};
+    std::atomic<uint64_t> numberOfInconsistentChunks{0U};
+    std::vector<std::thread> readers;
+    for (uint64_t i = 0U; i < NUMBER_OF_READERS; ++i)
+    {
+        readers.emplace_back([&] {
+            uint64_t lastValue{0U};
+            while (keepRunning.load())
+            {
+                auto chunk = sut.tryAcquire();
+                if (chunk)
+                {
+                    // the writer only stores increasing values and an acquired chunk must not be recycled while
+                    // it is held
+                    const volatile auto* value = static_cast<uint64_t*>(chunk.getUserPayload());
+                    const uint64_t firstRead = *value;
+                    std::this_thread::yield();
+                    if ((firstRead != *value) || (firstRead < lastValue))
+                    {
+                        ++numberOfInconsistentChunks;
+                    }
+                    lastValue = firstRead;
+                }
+            }
+        });
+    }
+
+    for (uint64_t value = 1U; value <= NUMBER_OF_STORES; ++value)
+    {
+        auto chunk = getChunkFromMemoryManager();
+        *static_cast<uint64_t*>(chunk.getUserPayload()) = value;
+        sut.store(chunk);
+    }
+
+    keepRunning = false;
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    EXPECT_THAT(numberOfInconsistentChunks.load(), Eq(0U));
+    sut.clear();
+    EXPECT_THAT(usedChunks(), Eq(0U));
+}
+
+} // namespace
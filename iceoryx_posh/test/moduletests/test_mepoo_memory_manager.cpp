@@ -18,6 +18,7 @@
 #include "iceoryx_hoofs/testing/mocks/logger_mock.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iceoryx_posh/mepoo/chained_payload.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iox/bump_allocator.hpp"
 #include "iox/detail/hoofs_error_reporting.hpp"
@@ -443,6 +444,389 @@ TEST_F(MemoryManager_test, addMemPoolWithChunkCountZeroShouldFail)
     IOX_EXPECT_FATAL_FAILURE([&] { sut->configureMemoryManager(mempoolconf, *allocator, *allocator); }, iox::er::FATAL);
 }
 
+TEST_F(MemoryManager_test, MemPoolWithoutOverflowChunkCountCannotBeExtended)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "24e739b9-986f-4e61-8e69-6b145185eaa7");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT, chunkSettings_128);
+
+    EXPECT_FALSE(sut->getMemPoolIndexRequiringOverflow().has_value());
+    EXPECT_THAT(sut->requiredOverflowMemorySize(0U), Eq(0U));
+    EXPECT_FALSE(sut->addOverflowMemPool(0U, *allocator));
+}
+
+TEST_F(MemoryManager_test, MemPoolRequiresOverflowWhenChunksInUseCrossTheThreshold)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "26fd768d-d0b8-4880-83ec-8db208e3051f");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t OVERFLOW_CHUNK_COUNT{5U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT, OVERFLOW_CHUNK_COUNT});
+    mempoolconf.m_overflowThresholdPercent = 80U;
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(7U, chunkSettings_128);
+    EXPECT_FALSE(sut->getMemPoolIndexRequiringOverflow().has_value());
+
+    auto additionalChunk = getChunksFromSut(1U, chunkSettings_128);
+    auto index = sut->getMemPoolIndexRequiringOverflow();
+    ASSERT_TRUE(index.has_value());
+    EXPECT_THAT(index.value(), Eq(1U));
+}
+
+TEST_F(MemoryManager_test, ChunksAreAcquiredFromOverflowMemPoolWhenMemPoolIsExhausted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1fa392ca-dd03-4db6-b7f3-5c7637fe6fe1");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t OVERFLOW_CHUNK_COUNT{5U};
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT, OVERFLOW_CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    const auto overflowMemorySize = sut->requiredOverflowMemorySize(0U);
+    ASSERT_THAT(overflowMemorySize, Ne(0U));
+    std::vector<uint64_t> overflowMemory(overflowMemorySize / sizeof(uint64_t) + 1U);
+    iox::BumpAllocator overflowAllocator(overflowMemory.data(), overflowMemorySize);
+    ASSERT_TRUE(sut->addOverflowMemPool(0U, overflowAllocator));
+
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT + OVERFLOW_CHUNK_COUNT, chunkSettings_128);
+
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(CHUNK_COUNT));
+    const auto overflowInfo = sut->getOverflowMemPoolInfo(0U);
+    EXPECT_THAT(overflowInfo.m_usedChunks, Eq(OVERFLOW_CHUNK_COUNT));
+    EXPECT_THAT(overflowInfo.m_numChunks, Eq(OVERFLOW_CHUNK_COUNT));
+    EXPECT_THAT(sut->getNumberOfOverflowMemPools(0U), Eq(1U));
+
+    constexpr auto EXPECTED_ERROR{iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS};
+    sut->getChunk(chunkSettings_128)
+        .and_then(
+            [&](auto&) { GTEST_FAIL() << "getChunk should fail with '" << EXPECTED_ERROR << "' but did not fail"; })
+        .or_else([&](const auto& error) { EXPECT_EQ(error, EXPECTED_ERROR); });
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS);
+}
+
+TEST_F(MemoryManager_test, ReleasedOverflowChunksAreReturnedToTheOverflowMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6cd24c50-8526-4a3a-a407-f6ec4fd84e91");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t OVERFLOW_CHUNK_COUNT{5U};
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT, OVERFLOW_CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    const auto overflowMemorySize = sut->requiredOverflowMemorySize(0U);
+    std::vector<uint64_t> overflowMemory(overflowMemorySize / sizeof(uint64_t) + 1U);
+    iox::BumpAllocator overflowAllocator(overflowMemory.data(), overflowMemorySize);
+    ASSERT_TRUE(sut->addOverflowMemPool(0U, overflowAllocator));
+
+    {
+        auto chunkStore = getChunksFromSut(CHUNK_COUNT + OVERFLOW_CHUNK_COUNT, chunkSettings_128);
+        EXPECT_THAT(sut->getOverflowMemPoolInfo(0U).m_usedChunks, Eq(OVERFLOW_CHUNK_COUNT));
+    }
+
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getOverflowMemPoolInfo(0U).m_usedChunks, Eq(0U));
+    EXPECT_FALSE(sut->getMemPoolIndexRequiringOverflow().has_value());
+}
+
+TEST_F(MemoryManager_test, ContainsChunkIsTrueForChunksOfAllMemPoolsIncludingOverflowMemPools)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "850ab069-82fa-4765-bbe9-d9684507fa54");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t OVERFLOW_CHUNK_COUNT{5U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT, OVERFLOW_CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    const auto overflowMemorySize = sut->requiredOverflowMemorySize(1U);
+    std::vector<uint64_t> overflowMemory(overflowMemorySize / sizeof(uint64_t) + 1U);
+    iox::BumpAllocator overflowAllocator(overflowMemory.data(), overflowMemorySize);
+    ASSERT_TRUE(sut->addOverflowMemPool(1U, overflowAllocator));
+
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT, chunkSettings_32);
+    auto overflowChunkStore = getChunksFromSut(CHUNK_COUNT + OVERFLOW_CHUNK_COUNT, chunkSettings_128);
+
+    for (const auto& chunk : chunkStore)
+    {
+        EXPECT_TRUE(sut->containsChunk(chunk.getChunkHeader()));
+    }
+    for (const auto& chunk : overflowChunkStore)
+    {
+        EXPECT_TRUE(sut->containsChunk(chunk.getChunkHeader()));
+    }
+}
+
+TEST_F(MemoryManager_test, ContainsChunkIsFalseForChunksOfOtherMemoryManager)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "be5c6fb8-1688-4e69-9138-8e5964b99903");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    std::vector<uint64_t> otherMemory(rawMemorySize / sizeof(uint64_t));
+    iox::BumpAllocator otherAllocator(otherMemory.data(), rawMemorySize);
+    iox::mepoo::MemoryManager otherMemoryManager;
+    otherMemoryManager.configureMemoryManager(mempoolconf, otherAllocator, otherAllocator);
+
+    auto chunk = otherMemoryManager.getChunk(chunkSettings_32);
+    ASSERT_FALSE(chunk.has_error());
+
+    EXPECT_FALSE(sut->containsChunk(chunk.value().getChunkHeader()));
+    EXPECT_TRUE(otherMemoryManager.containsChunk(chunk.value().getChunkHeader()));
+}
+
+TEST_F(MemoryManager_test, NumberOfOverflowMemPoolsIsLimited)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "491e8219-1455-41f9-996a-97bc263d4708");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t OVERFLOW_CHUNK_COUNT{1U};
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT, OVERFLOW_CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    for (uint32_t i = 0U; i < iox::MAX_NUMBER_OF_OVERFLOW_SEGMENTS_PER_SEGMENT; ++i)
+    {
+        EXPECT_TRUE(sut->addOverflowMemPool(0U, *allocator));
+    }
+    EXPECT_FALSE(sut->addOverflowMemPool(0U, *allocator));
+
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT + iox::MAX_NUMBER_OF_OVERFLOW_SEGMENTS_PER_SEGMENT, chunkSettings_128);
+    EXPECT_FALSE(sut->getMemPoolIndexRequiringOverflow().has_value());
+}
+
+TEST_F(MemoryManager_test, AcquiredAndReleasedChunksAreRecordedInTheChunkSizeHistogram)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8275d1c1-2d7a-42cc-b473-8c68ff4ffda5");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_256, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    const auto sizeClass = iox::mepoo::ChunkSizeHistogram::sizeClass(chunkSettings_128.requiredChunkSize());
+    {
+        auto chunkStore = getChunksFromSut(3U, chunkSettings_128);
+        const auto info = sut->getChunkSizeHistogram().getSizeClassInfo(sizeClass);
+        EXPECT_THAT(info.m_numRequests, Eq(3U));
+        EXPECT_THAT(info.m_chunksInUse, Eq(3U));
+        EXPECT_THAT(info.m_peakChunksInUse, Eq(3U));
+    }
+
+    const auto info = sut->getChunkSizeHistogram().getSizeClassInfo(sizeClass);
+    EXPECT_THAT(info.m_numRequests, Eq(3U));
+    EXPECT_THAT(info.m_chunksInUse, Eq(0U));
+    EXPECT_THAT(info.m_peakChunksInUse, Eq(3U));
+    EXPECT_THAT(info.m_chunkSize, Ge(chunkSettings_128.requiredChunkSize()));
+}
+
+TEST_F(MemoryManager_test, ChainedChunkWhichFitsIntoTheLargestMemPoolHasNoContinuationChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4c917a9d-eb35-4291-8997-a107b3844c11");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint64_t USER_PAYLOAD_SIZE{100U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_256, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunk = sut->getChainedChunk(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+    ASSERT_FALSE(chunk.has_error());
+
+    EXPECT_THAT(chunk->getChunkHeader()->userHeaderId(), Eq(ChunkHeader::CHAINED_CHUNK_USER_HEADER));
+    auto chainedPayload = iox::mepoo::ChainedPayload::fromUserPayload(chunk->getUserPayload());
+    ASSERT_TRUE(chainedPayload.has_value());
+    EXPECT_THAT(chainedPayload->numberOfSegments(), Eq(1U));
+    EXPECT_THAT(chainedPayload->size(), Eq(USER_PAYLOAD_SIZE));
+    EXPECT_THAT(sut->getMemPoolInfo(1U).m_usedChunks, Eq(1U));
+}
+
+TEST_F(MemoryManager_test, ChainedChunkLargerThanTheLargestMemPoolIsSplitIntoContinuationChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cb6bbc6f-f48c-439b-88af-a40f44ed33fd");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint64_t USER_PAYLOAD_SIZE{1000U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_256, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    {
+        auto chunk = sut->getChainedChunk(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+        ASSERT_FALSE(chunk.has_error());
+
+        auto chainedPayload = iox::mepoo::ChainedPayload::fromUserPayload(chunk->getUserPayload());
+        ASSERT_TRUE(chainedPayload.has_value());
+        EXPECT_THAT(chainedPayload->numberOfSegments(), Gt(1U));
+        EXPECT_THAT(chainedPayload->size(), Eq(USER_PAYLOAD_SIZE));
+
+        uint64_t sizeOfAllSegments{0U};
+        for (const auto segment : *chainedPayload)
+        {
+            sizeOfAllSegments += segment.size();
+        }
+        EXPECT_THAT(sizeOfAllSegments, Eq(USER_PAYLOAD_SIZE));
+        EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks + sut->getMemPoolInfo(1U).m_usedChunks,
+                    Eq(chainedPayload->numberOfSegments()));
+    }
+
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1U).m_usedChunks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, ChainedChunkFailsAndReleasesAllChunksWhenMemPoolIsExhausted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "662b599b-b289-4aa1-b609-cb1c5d547d3a");
+    constexpr uint32_t CHUNK_COUNT{2U};
+    constexpr uint64_t USER_PAYLOAD_SIZE{1000U};
+    mempoolconf.addMemPool({CHUNK_SIZE_256, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunk = sut->getChainedChunk(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+
+    ASSERT_TRUE(chunk.has_error());
+    EXPECT_THAT(chunk.error(), Eq(iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS));
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS);
+}
+
+TEST_F(MemoryManager_test, ChainedChunkExceedingTheMaximumNumberOfContinuationChunksFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e46f7b96-10ed-4b7c-824b-e99b9ac425d9");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_256, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunk = sut->getChainedChunk(CHUNK_SIZE_256 * (iox::MAX_NUMBER_OF_CONTINUATION_CHUNKS + 1U),
+                                      iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+
+    ASSERT_TRUE(chunk.has_error());
+    EXPECT_THAT(chunk.error(), Eq(iox::mepoo::MemoryManager::Error::NO_MEMPOOL_FOR_REQUESTED_CHUNK_SIZE));
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_CHUNK_IS_TOO_LARGE);
+}
+
+TEST_F(MemoryManager_test, AcquiringChunkQuotaWithoutLimitsAndReservationReturnsNullptr)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "575614bc-f602-4f3e-94cd-ab2be92dc9ea");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    EXPECT_THAT(sut->acquireChunkQuota(iox::mepoo::ChunkQuotaSettings()), Eq(nullptr));
+}
+
+TEST_F(MemoryManager_test, ChunkQuotaLimitsTheChunksPerMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4a70abc5-741e-4919-ad53-6d35ad1f5ddc");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t MAX_CHUNKS_PER_MEMPOOL{2U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto* chunkQuota = sut->acquireChunkQuota({MAX_CHUNKS_PER_MEMPOOL, 0U, 0U});
+    ASSERT_THAT(chunkQuota, Ne(nullptr));
+
+    ChunkStore chunkStore;
+    for (uint32_t i = 0U; i < MAX_CHUNKS_PER_MEMPOOL; ++i)
+    {
+        auto chunk = sut->getChunk(chunkSettings_32, chunkQuota);
+        ASSERT_FALSE(chunk.has_error());
+        chunkStore.push_back(chunk.value());
+    }
+
+    auto exceedingChunk = sut->getChunk(chunkSettings_32, chunkQuota);
+    ASSERT_TRUE(exceedingChunk.has_error());
+    EXPECT_THAT(exceedingChunk.error(), Eq(iox::mepoo::MemoryManager::Error::CHUNK_QUOTA_EXCEEDED));
+    EXPECT_FALSE(sut->getChunk(chunkSettings_64, chunkQuota).has_error());
+    EXPECT_FALSE(sut->getChunk(chunkSettings_32).has_error());
+
+    const auto chunkQuotaInfo = chunkQuota->getInfo();
+    EXPECT_THAT(chunkQuotaInfo.m_chunksInUse, Eq(MAX_CHUNKS_PER_MEMPOOL));
+    EXPECT_THAT(chunkQuotaInfo.m_numberOfExceededRequests, Eq(1U));
+
+    chunkStore.clear();
+    EXPECT_FALSE(sut->getChunk(chunkSettings_32, chunkQuota).has_error());
+    iox::mepoo::MemoryManager::releaseChunkQuota(*chunkQuota);
+}
+
+TEST_F(MemoryManager_test, MaxChunksPerPublisherOfMePooConfigLimitsEveryChunkQuota)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4b2854af-8963-405d-b58c-df30298e88f8");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t OVERFLOW_CHUNK_COUNT{0U};
+    constexpr uint32_t MAX_CHUNKS_PER_PUBLISHER{1U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT, OVERFLOW_CHUNK_COUNT, MAX_CHUNKS_PER_PUBLISHER});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto* chunkQuota = sut->acquireChunkQuota(iox::mepoo::ChunkQuotaSettings());
+    ASSERT_THAT(chunkQuota, Ne(nullptr));
+
+    auto chunk = sut->getChunk(chunkSettings_32, chunkQuota);
+    ASSERT_FALSE(chunk.has_error());
+    auto exceedingChunk = sut->getChunk(chunkSettings_32, chunkQuota);
+    ASSERT_TRUE(exceedingChunk.has_error());
+    EXPECT_THAT(exceedingChunk.error(), Eq(iox::mepoo::MemoryManager::Error::CHUNK_QUOTA_EXCEEDED));
+
+    iox::mepoo::MemoryManager::releaseChunkQuota(*chunkQuota);
+}
+
+TEST_F(MemoryManager_test, ReservedChunksOfChunkQuotaAreAvailableWhenMemPoolIsExhaustedByOthers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e65d3a5f-7916-4050-9ccd-226f9bcdc574");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t RESERVED_CHUNKS{3U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto* chunkQuota = sut->acquireChunkQuota({0U, CHUNK_SIZE_32, RESERVED_CHUNKS});
+    ASSERT_THAT(chunkQuota, Ne(nullptr));
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_reservedChunks, Eq(RESERVED_CHUNKS));
+
+    auto otherChunks = getChunksFromSut(CHUNK_COUNT - RESERVED_CHUNKS, chunkSettings_32);
+    auto exhaustedChunk = sut->getChunk(chunkSettings_32);
+    ASSERT_TRUE(exhaustedChunk.has_error());
+    EXPECT_THAT(exhaustedChunk.error(), Eq(iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS));
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS);
+
+    ChunkStore reservedChunks;
+    for (uint32_t i = 0U; i < RESERVED_CHUNKS; ++i)
+    {
+        auto chunk = sut->getChunk(chunkSettings_32, chunkQuota);
+        ASSERT_FALSE(chunk.has_error());
+        reservedChunks.push_back(chunk.value());
+    }
+    EXPECT_THAT(chunkQuota->getInfo().m_reservedChunksInUse, Eq(RESERVED_CHUNKS));
+
+    reservedChunks.clear();
+    EXPECT_THAT(chunkQuota->getInfo().m_reservedChunksInUse, Eq(0U));
+    EXPECT_TRUE(sut->getChunk(chunkSettings_32).has_error());
+
+    iox::mepoo::MemoryManager::releaseChunkQuota(*chunkQuota);
+}
+
+TEST_F(MemoryManager_test, ReservationIsReturnedWhenChunkQuotaAndAllItsChunksAreReleased)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d11cc1ca-3853-42ca-8a37-f95112b97b59");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t RESERVED_CHUNKS{3U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto* chunkQuota = sut->acquireChunkQuota({0U, CHUNK_SIZE_32, RESERVED_CHUNKS});
+    ASSERT_THAT(chunkQuota, Ne(nullptr));
+
+    {
+        auto chunk = sut->getChunk(chunkSettings_32, chunkQuota);
+        ASSERT_FALSE(chunk.has_error());
+
+        iox::mepoo::MemoryManager::releaseChunkQuota(*chunkQuota);
+        EXPECT_THAT(sut->getMemPoolInfo(0U).m_reservedChunks, Eq(RESERVED_CHUNKS));
+    }
+
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_reservedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+    auto chunks = getChunksFromSut(CHUNK_COUNT, chunkSettings_32);
+    EXPECT_THAT(chunks.size(), Eq(CHUNK_COUNT));
+}
+
 TEST(MemoryManagerEnumString_test, asStringLiteralConvertsEnumValuesToStrings)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5f6c3942-0af5-4c48-b44c-7268191dbac5");
@@ -451,8 +835,10 @@ TEST(MemoryManagerEnumString_test, asStringLiteralConvertsEnumValuesToStrings)
     // each bit corresponds to an enum value and must be set to true on test
     uint64_t testedEnumValues{0U};
     uint64_t loopCounter{0U};
-    for (const auto& sut :
-         {Error::NO_MEMPOOLS_AVAILABLE, Error::NO_MEMPOOL_FOR_REQUESTED_CHUNK_SIZE, Error::MEMPOOL_OUT_OF_CHUNKS})
+    for (const auto& sut : {Error::NO_MEMPOOLS_AVAILABLE,
+                            Error::NO_MEMPOOL_FOR_REQUESTED_CHUNK_SIZE,
+                            Error::MEMPOOL_OUT_OF_CHUNKS,
+                            Error::CHUNK_QUOTA_EXCEEDED})
     {
         auto enumString = iox::mepoo::asStringLiteral(sut);
 
@@ -467,6 +853,9 @@ TEST(MemoryManagerEnumString_test, asStringLiteralConvertsEnumValuesToStrings)
         case Error::MEMPOOL_OUT_OF_CHUNKS:
             EXPECT_THAT(enumString, StrEq("MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS"));
             break;
+        case Error::CHUNK_QUOTA_EXCEEDED:
+            EXPECT_THAT(enumString, StrEq("MemoryManager::Error::CHUNK_QUOTA_EXCEEDED"));
+            break;
         }
 
         testedEnumValues |= 1U << static_cast<uint64_t>(sut);
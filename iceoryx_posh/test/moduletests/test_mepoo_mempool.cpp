@@ -300,6 +300,63 @@ TEST_F(MemPool_test, GetMinFreeMethodReturnsTheNumberOfFreeChunks)
     }
 }
 
+TEST_F(MemPool_test, ReservedChunksCannotBeAcquiredWithGetChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "eb6dbbe1-d506-4175-8ae8-70fc990f3230");
+    constexpr uint32_t RESERVED_CHUNKS{10U};
+    ASSERT_TRUE(sut.reserveChunks(RESERVED_CHUNKS));
+    EXPECT_THAT(sut.getReservedChunks(), Eq(RESERVED_CHUNKS));
+
+    std::vector<void*> chunks;
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS - RESERVED_CHUNKS; ++i)
+    {
+        chunks.push_back(sut.getChunk());
+        ASSERT_THAT(chunks.back(), Ne(nullptr));
+    }
+
+    EXPECT_THAT(sut.getChunk(), Eq(nullptr));
+
+    for (uint32_t i = 0U; i < RESERVED_CHUNKS; ++i)
+    {
+        chunks.push_back(sut.getReservedChunk());
+        ASSERT_THAT(chunks.back(), Ne(nullptr));
+    }
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_CHUNKS));
+}
+
+TEST_F(MemPool_test, ReservingMoreChunksThanUnreservedAndUnusedOnesFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f89c9e61-3fbc-42ee-8318-894f7c3d9107");
+    constexpr uint32_t USED_CHUNKS{60U};
+    for (uint32_t i = 0U; i < USED_CHUNKS; ++i)
+    {
+        ASSERT_THAT(sut.getChunk(), Ne(nullptr));
+    }
+
+    EXPECT_FALSE(sut.reserveChunks(NUMBER_OF_CHUNKS - USED_CHUNKS + 1U));
+    EXPECT_TRUE(sut.reserveChunks(NUMBER_OF_CHUNKS - USED_CHUNKS));
+    EXPECT_FALSE(sut.reserveChunks(1U));
+}
+
+TEST_F(MemPool_test, UnreservedChunksCanBeAcquiredWithGetChunkAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "33e27def-c93b-4550-8b61-479a01b22601");
+    ASSERT_TRUE(sut.reserveChunks(NUMBER_OF_CHUNKS));
+    auto* reservedChunk = sut.getReservedChunk();
+    ASSERT_THAT(reservedChunk, Ne(nullptr));
+    EXPECT_THAT(sut.getChunk(), Eq(nullptr));
+
+    sut.freeReservedChunk(reservedChunk);
+    sut.unreserveChunks(NUMBER_OF_CHUNKS);
+
+    EXPECT_THAT(sut.getReservedChunks(), Eq(0U));
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        ASSERT_THAT(sut.getChunk(), Ne(nullptr));
+    }
+    EXPECT_THAT(sut.getInfo().m_reservedChunks, Eq(0U));
+}
+
 TEST_F(MemPool_test, dieWhenMempoolChunkSizeIsSmallerThan32Bytes)
 {
     ::testing::Test::RecordProperty("TEST_ID", "7704246e-42b5-46fd-8827-ebac200390e1");
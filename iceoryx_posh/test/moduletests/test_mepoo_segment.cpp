@@ -82,6 +82,16 @@ class MePooSegment_test : public Test
             return iox::ok(m_memorySizeInBytes);
         }
 
+        // fakes a machine with as many NUMA nodes as required by the test
+        iox::optional<uint32_t> getNumaNode() const
+        {
+            if (m_numaPlacement.policy == NumaPolicy::BIND)
+            {
+                return m_numaPlacement.node;
+            }
+            return 0U;
+        }
+
         void* getBaseAddress()
         {
             return &memory[0];
@@ -89,6 +99,7 @@ class MePooSegment_test : public Test
 
         uint64_t m_memorySizeInBytes{0};
         void* m_baseAddressHint{nullptr};
+        NumaPlacement m_numaPlacement;
         static constexpr int MEM_SIZE = 100000;
         alignas(8) char memory[MEM_SIZE];
         shm_handle_t filehandle;
@@ -109,15 +120,19 @@ class MePooSegment_test : public Test
 
         IOX_BUILDER_PARAMETER(iox::access_rights, permissions, iox::perms::none)
 
+        IOX_BUILDER_PARAMETER(NumaPlacement, numaPlacement, NumaPlacement())
+
       public:
         iox::expected<SharedMemoryObject_MOCK, PosixSharedMemoryObjectError> create() noexcept
         {
-            return iox::ok(SharedMemoryObject_MOCK(m_name,
-                                                   m_memorySizeInBytes,
-                                                   m_accessMode,
-                                                   m_openMode,
-                                                   (m_baseAddressHint) ? *m_baseAddressHint : nullptr,
-                                                   m_permissions));
+            SharedMemoryObject_MOCK sharedMemoryObject(m_name,
+                                                       m_memorySizeInBytes,
+                                                       m_accessMode,
+                                                       m_openMode,
+                                                       (m_baseAddressHint) ? *m_baseAddressHint : nullptr,
+                                                       m_permissions);
+            sharedMemoryObject.m_numaPlacement = m_numaPlacement;
+            return iox::ok(std::move(sharedMemoryObject));
         }
     };
 
@@ -226,4 +241,33 @@ TEST_F(MePooSegment_test, GetMemoryManager)
         .or_else([](auto& error) { GTEST_FAIL() << "getChunk failed with: " << error; });
 }
 
+TEST_F(MePooSegment_test, NumaPlacementIsAppliedToSharedMemoryAndReported)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8d8ef8c3-3ed3-45ee-a2be-33176fb5f55e");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    constexpr uint32_t FAKE_NUMA_NODE{3U};
+    SUT sut{mepooConfig,
+            DEFAULT_DOMAIN_ID,
+            m_managementAllocator,
+            PosixGroup{"iox_roudi_test1"},
+            PosixGroup{"iox_roudi_test2"},
+            MemoryInfo(),
+            {NumaPolicy::BIND, FAKE_NUMA_NODE}};
+
+    EXPECT_THAT(sut.getNumaPlacement().policy, Eq(NumaPolicy::BIND));
+    EXPECT_THAT(sut.getNumaPlacement().node, Eq(FAKE_NUMA_NODE));
+    ASSERT_TRUE(sut.getNumaNode().has_value());
+    EXPECT_THAT(sut.getNumaNode().value(), Eq(FAKE_NUMA_NODE));
+}
+
+TEST_F(MePooSegment_test, SegmentWithoutNumaPlacementUsesDefaultPolicy)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "da0f52e3-c76b-40a0-8dea-83d717cc86a4");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    auto sut = createSut();
+    EXPECT_THAT(sut->getNumaPlacement().policy, Eq(NumaPolicy::DEFAULT));
+}
+
 } // namespace
@@ -27,7 +27,6 @@
 #include "iox/posix_user.hpp"
 
 #include "iceoryx_hoofs/testing/error_reporting/testing_support.hpp"
-#include "iceoryx_hoofs/testing/fatal_failure.hpp"
 #include "test.hpp"
 
 namespace
@@ -43,13 +42,61 @@ class MePooSegmentMock
     MePooSegmentMock(const MePooConfig& mempoolConfig [[maybe_unused]],
                      const DomainId domainId [[maybe_unused]],
                      iox::BumpAllocator& managementAllocator [[maybe_unused]],
-                     const PosixGroup& readerGroup [[maybe_unused]],
-                     const PosixGroup& writerGroup [[maybe_unused]],
-                     const MemoryInfo& memoryInfo [[maybe_unused]]) noexcept
+                     const PosixGroup& readerGroup,
+                     const PosixGroup& writerGroup,
+                     const MemoryInfo& memoryInfo [[maybe_unused]],
+                     const NumaPlacement& numaPlacement [[maybe_unused]],
+                     const TrafficClass trafficClass) noexcept
+        : m_readerGroup(readerGroup)
+        , m_writerGroup(writerGroup)
+        , m_trafficClass(trafficClass)
+        , m_segmentId(nextSegmentId++)
     {
     }
+
+    PosixGroup getReaderGroup() const noexcept
+    {
+        return m_readerGroup;
+    }
+
+    PosixGroup getWriterGroup() const noexcept
+    {
+        return m_writerGroup;
+    }
+
+    TrafficClass getTrafficClass() const noexcept
+    {
+        return m_trafficClass;
+    }
+
+    uint64_t getSegmentId() const noexcept
+    {
+        return m_segmentId;
+    }
+
+    uint64_t getSegmentSize() const noexcept
+    {
+        return 0U;
+    }
+
+    MemoryManager& getMemoryManager() noexcept
+    {
+        // the MemoryManager is too large to have one per mock on the stack and its content is not relevant
+        static MemoryManager memoryManager;
+        return memoryManager;
+    }
+
+    static uint64_t nextSegmentId;
+
+  private:
+    PosixGroup m_readerGroup;
+    PosixGroup m_writerGroup;
+    TrafficClass m_trafficClass;
+    uint64_t m_segmentId;
 };
 
+uint64_t MePooSegmentMock::nextSegmentId{0U};
+
 class SegmentManager_test : public Test
 {
   public:
@@ -77,11 +124,15 @@ class SegmentManager_test : public Test
         return config;
     }
 
-    SegmentConfig getInvalidSegmentConfig()
+    SegmentConfig getSegmentConfigWithTwoWritableSegmentsForCurrentUser()
     {
+        // both segments share the writer group since the current user is not necessarily in several groups; this is
+        // only possible with the mock since the shared memory of a segment is named after its writer group
+        const PosixGroup::groupName_t group{PosixGroup::getGroupOfCurrentProcess().getName()};
         SegmentConfig config;
-        config.m_sharedMemorySegments.push_back({"iox_roudi_test1", "iox_roudi_test1", mepooConfig});
-        config.m_sharedMemorySegments.push_back({"iox_roudi_test3", "iox_roudi_test1", mepooConfig});
+        config.m_sharedMemorySegments.push_back({group, group, mepooConfig});
+        config.m_sharedMemorySegments.push_back(
+            {group, group, mepooConfig, MemoryInfo(), NumaPlacement(), TrafficClass::BULK});
         return config;
     }
 
@@ -185,17 +236,81 @@ TEST_F(SegmentManager_test, getMemoryManagerForUserFailWithNonExistingUser)
     EXPECT_FALSE(sut->getSegmentInformationWithWriteAccessForUser(PosixUser{"no_user"}).m_memoryManager.has_value());
 }
 
-TEST_F(SegmentManager_test, addingMoreThanOneWriterGroupFails)
+TEST_F(SegmentManager_test, getSegmentMappingsForUserWithSeveralWritableSegments)
 {
-    ::testing::Test::RecordProperty("TEST_ID", "3fa29560-7341-43bf-a22e-2d3550b49e4e");
-    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+    ::testing::Test::RecordProperty("TEST_ID", "ee962cd1-7768-4669-a3b5-f9ec8d10aab4");
+    SegmentConfig segmentConfig = getSegmentConfigWithTwoWritableSegmentsForCurrentUser();
+    SegmentManager<MePooSegmentMock> sut{segmentConfig, DEFAULT_DOMAIN_ID, &allocator};
 
-    SegmentConfig segmentConfig = getInvalidSegmentConfig();
-    SUT sut{segmentConfig, DEFAULT_DOMAIN_ID, &allocator};
+    auto mapping = sut.getSegmentMappings(PosixUser::getUserOfCurrentProcess());
+    ASSERT_THAT(mapping.size(), Eq(2U));
+    EXPECT_TRUE(mapping[0].m_isWritable);
+    EXPECT_TRUE(mapping[1].m_isWritable);
+}
+
+TEST_F(SegmentManager_test, getSegmentInformationWithoutSelectionReturnsFirstWritableSegment)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "28b2e59b-c027-4a0a-adc9-18539c541d86");
+    SegmentConfig segmentConfig = getSegmentConfigWithTwoWritableSegmentsForCurrentUser();
+    MePooSegmentMock::nextSegmentId = 0U;
+    SegmentManager<MePooSegmentMock> sut{segmentConfig, DEFAULT_DOMAIN_ID, &allocator};
+
+    auto segmentInfo = sut.getSegmentInformationWithWriteAccessForUser(PosixUser::getUserOfCurrentProcess());
+    EXPECT_TRUE(segmentInfo.m_memoryManager.has_value());
+    EXPECT_THAT(segmentInfo.m_segmentID, Eq(0U));
+}
 
+TEST_F(SegmentManager_test, getSegmentInformationSelectsSegmentByTrafficClass)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "11f59c91-f918-473f-a1ca-db00be4d3ebd");
+    SegmentConfig segmentConfig = getSegmentConfigWithTwoWritableSegmentsForCurrentUser();
+    MePooSegmentMock::nextSegmentId = 0U;
+    SegmentManager<MePooSegmentMock> sut{segmentConfig, DEFAULT_DOMAIN_ID, &allocator};
+
+    auto segmentInfo = sut.getSegmentInformationWithWriteAccessForUser(
+        PosixUser::getUserOfCurrentProcess(), SegmentName_t(), TrafficClass::BULK);
+    EXPECT_TRUE(segmentInfo.m_memoryManager.has_value());
+    EXPECT_THAT(segmentInfo.m_segmentID, Eq(1U));
+}
+
+TEST_F(SegmentManager_test, getSegmentInformationFallsBackToFirstWritableSegmentForUnavailableTrafficClass)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "99a08e22-7079-43e4-9cb1-551a96523f2a");
+    SegmentConfig segmentConfig = getSegmentConfigWithTwoWritableSegmentsForCurrentUser();
+    MePooSegmentMock::nextSegmentId = 0U;
+    SegmentManager<MePooSegmentMock> sut{segmentConfig, DEFAULT_DOMAIN_ID, &allocator};
+
+    auto segmentInfo = sut.getSegmentInformationWithWriteAccessForUser(
+        PosixUser::getUserOfCurrentProcess(), SegmentName_t(), TrafficClass::LATENCY_CRITICAL);
+    EXPECT_TRUE(segmentInfo.m_memoryManager.has_value());
+    EXPECT_THAT(segmentInfo.m_segmentID, Eq(0U));
+}
+
+TEST_F(SegmentManager_test, getSegmentInformationSelectsSegmentByName)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "61601687-0eba-4aec-961f-c33760f51cb3");
+    SegmentConfig segmentConfig = getSegmentConfigWithTwoWritableSegmentsForCurrentUser();
+    MePooSegmentMock::nextSegmentId = 0U;
+    SegmentManager<MePooSegmentMock> sut{segmentConfig, DEFAULT_DOMAIN_ID, &allocator};
+
+    // the segment name takes precedence over the traffic class
+    auto segmentInfo =
+        sut.getSegmentInformationWithWriteAccessForUser(PosixUser::getUserOfCurrentProcess(),
+                                                        PosixGroup::getGroupOfCurrentProcess().getName(),
+                                                        TrafficClass::BULK);
+    EXPECT_TRUE(segmentInfo.m_memoryManager.has_value());
+    EXPECT_THAT(segmentInfo.m_segmentID, Eq(0U));
+}
+
+TEST_F(SegmentManager_test, getSegmentInformationFailsForUnknownSegmentName)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5d22dd3d-3c66-456b-ac2d-fa34bc3f90ba");
+    SegmentConfig segmentConfig = getSegmentConfigWithTwoWritableSegmentsForCurrentUser();
+    SegmentManager<MePooSegmentMock> sut{segmentConfig, DEFAULT_DOMAIN_ID, &allocator};
 
-    IOX_EXPECT_FATAL_FAILURE([&] { sut.getSegmentMappings(PosixUser("iox_roudi_test1")); },
-                             iox::PoshError::MEPOO__USER_WITH_MORE_THAN_ONE_WRITE_SEGMENT);
+    auto segmentInfo = sut.getSegmentInformationWithWriteAccessForUser(PosixUser::getUserOfCurrentProcess(),
+                                                                       SegmentName_t("iox_unknown_segment"));
+    EXPECT_FALSE(segmentInfo.m_memoryManager.has_value());
 }
 
 TEST_F(SegmentManager_test, addingMaximumNumberOfSegmentsWorks)
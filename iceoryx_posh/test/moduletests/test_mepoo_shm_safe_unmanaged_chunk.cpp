@@ -301,4 +301,75 @@ TEST_F(ShmSafeUnmanagedChunk_test,
     EXPECT_FALSE(sut.isNotLogicalNullptrAndHasNoOtherOwners());
 }
 
+TEST_F(ShmSafeUnmanagedChunk_test, CallTryCloneToSharedChunkOnDefaultConstructedSutResultsInEmptySharedChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c78c69c8-259a-405f-9ce8-4f52376e8e5d");
+    ShmSafeUnmanagedChunk sut;
+
+    EXPECT_FALSE(sut.tryCloneToSharedChunk());
+}
+
+TEST_F(ShmSafeUnmanagedChunk_test, CallTryCloneToSharedChunkOnSutConstructedWithSharedChunkResultsInNewOwner)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "67311e6e-4a05-48c2-b442-66adb6f3df2c");
+    auto sharedChunk = getChunkFromMemoryManager();
+
+    ShmSafeUnmanagedChunk sut(sharedChunk);
+    sharedChunk = SharedChunk();
+
+    {
+        auto clonedChunk = sut.tryCloneToSharedChunk();
+        ASSERT_TRUE(clonedChunk);
+        EXPECT_THAT(clonedChunk.getChunkHeader(), Eq(sut.getChunkHeader()));
+        EXPECT_FALSE(sut.isNotLogicalNullptrAndHasNoOtherOwners());
+    }
+
+    EXPECT_TRUE(sut.isNotLogicalNullptrAndHasNoOtherOwners());
+    sut.releaseToSharedChunk();
+}
+
+TEST_F(ShmSafeUnmanagedChunk_test, CallTryCloneToSharedChunkOnAlreadyReleasedChunkResultsInEmptySharedChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6ccb09b6-eb42-4ade-b07f-427ef1c8191d");
+    auto sharedChunk = getChunkFromMemoryManager();
+
+    ShmSafeUnmanagedChunk sut(sharedChunk);
+    ShmSafeUnmanagedChunk staleCopy = sut;
+    sharedChunk = SharedChunk();
+    sut.releaseToSharedChunk();
+
+    EXPECT_FALSE(staleCopy.tryCloneToSharedChunk());
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ShmSafeUnmanagedChunk_test, SutsReferringToSameChunkAreEqual)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "59b73418-d4c6-4e33-a9e5-4a99e529983c");
+    auto sharedChunk = getChunkFromMemoryManager();
+
+    ShmSafeUnmanagedChunk sut(sharedChunk);
+    ShmSafeUnmanagedChunk copy = sut;
+
+    EXPECT_TRUE(sut == copy);
+    EXPECT_FALSE(sut != copy);
+
+    sut.releaseToSharedChunk();
+}
+
+TEST_F(ShmSafeUnmanagedChunk_test, SutsReferringToDifferentChunksAreNotEqual)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3ac2f2ea-bec8-4544-875b-80798e2b8c8d");
+    ShmSafeUnmanagedChunk sut(getChunkFromMemoryManager());
+    ShmSafeUnmanagedChunk other(getChunkFromMemoryManager());
+    ShmSafeUnmanagedChunk empty;
+
+    EXPECT_FALSE(sut == other);
+    EXPECT_TRUE(sut != other);
+    EXPECT_TRUE(sut != empty);
+    EXPECT_TRUE(empty == ShmSafeUnmanagedChunk());
+
+    sut.releaseToSharedChunk();
+    other.releaseToSharedChunk();
+}
+
 } // namespace
@@ -61,4 +61,17 @@ TEST_F(MonitoringModeLogStreamTest, MonitoringModeOnLeadsToCorrectString)
     EXPECT_THAT(m_loggerMock.logs[0].message, Eq("MonitoringMode::ON"));
 }
 
+TEST_F(MonitoringModeLogStreamTest, MonitoringModeHeartbeatLeadsToCorrectString)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "61839149-5289-479b-813f-bc45665aec44");
+    auto sut = MonitoringMode::HEARTBEAT;
+
+    {
+        IOX_LOGSTREAM_MOCK(m_loggerMock) << sut;
+    }
+
+    ASSERT_THAT(m_loggerMock.logs.size(), Eq(1U));
+    EXPECT_THAT(m_loggerMock.logs[0].message, Eq("MonitoringMode::HEARTBEAT"));
+}
+
 } // namespace
@@ -28,6 +28,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/internal/popo/ports/base_port.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iceoryx_posh/mepoo/chained_payload.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iceoryx_posh/testing/mocks/chunk_mock.hpp"
 #include "iox/bump_allocator.hpp"
@@ -37,6 +38,7 @@
 #include "test.hpp"
 
 #include <memory>
+#include <vector>
 
 namespace
 {
@@ -770,6 +772,157 @@ TEST_F(ChunkSender_test, ReuseOfLastIfBiggerButFitsInChunk)
     EXPECT_TRUE((*chunkBigger)->userPayload() == (*maybeLastChunk)->userPayload());
 }
 
+TEST_F(ChunkSender_test, sendChainedChunkWithReceiverDeliversAllSegments)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2d66f05f-df39-4fe8-a87c-63a24b95dae3");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+
+    constexpr uint64_t USER_PAYLOAD_SIZE{3U * BIG_CHUNK};
+    std::vector<uint8_t> data(USER_PAYLOAD_SIZE);
+    for (uint64_t i = 0U; i < USER_PAYLOAD_SIZE; ++i)
+    {
+        data[i] = static_cast<uint8_t>(i);
+    }
+
+    auto maybeChunkHeader = m_chunkSender.tryAllocateChained(
+        UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID), USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    auto chainedPayload = iox::mepoo::ChainedPayload::fromUserPayload((*maybeChunkHeader)->userPayload());
+    ASSERT_TRUE(chainedPayload.has_value());
+    EXPECT_THAT(chainedPayload->copyFrom(data.data(), data.size()), Eq(USER_PAYLOAD_SIZE));
+
+    auto numberOfDeliveries = m_chunkSender.send(*maybeChunkHeader);
+    EXPECT_THAT(numberOfDeliveries, Eq(1U));
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    auto popRet = myQueue.tryPop();
+    ASSERT_TRUE(popRet.has_value());
+    EXPECT_TRUE(myQueue.empty());
+
+    auto receivedPayload = iox::mepoo::ConstChainedPayload::fromUserPayload(popRet->getUserPayload());
+    ASSERT_TRUE(receivedPayload.has_value());
+    std::vector<uint8_t> receivedData(USER_PAYLOAD_SIZE);
+    EXPECT_THAT(receivedPayload->copyTo(receivedData.data(), receivedData.size()), Eq(USER_PAYLOAD_SIZE));
+    EXPECT_THAT(receivedData, Eq(data));
+}
+
+TEST_F(ChunkSender_test, NoReuseOfLastIfChained)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1623e86c-d504-4ad2-91cc-0d08d6257122");
+    constexpr uint64_t USER_PAYLOAD_SIZE{3U * BIG_CHUNK};
+    auto maybeChunkHeader = m_chunkSender.tryAllocateChained(
+        UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID), USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    const auto usedChunks =
+        m_memoryManager.getMemPoolInfo(0).m_usedChunks + m_memoryManager.getMemPoolInfo(1).m_usedChunks;
+    EXPECT_THAT(usedChunks, Gt(1U));
+
+    m_chunkSender.send(*maybeChunkHeader);
+
+    auto maybeSmallChunkHeader = m_chunkSender.tryAllocate(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                                           SMALL_CHUNK / 2,
+                                                           USER_PAYLOAD_ALIGNMENT,
+                                                           USER_HEADER_SIZE,
+                                                           USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeSmallChunkHeader.has_error());
+    EXPECT_THAT(*maybeSmallChunkHeader, Ne(*maybeChunkHeader));
+    EXPECT_THAT((*maybeSmallChunkHeader)->userHeaderId(), Eq(iox::mepoo::ChunkHeader::NO_USER_HEADER));
+
+    m_chunkSender.send(*maybeSmallChunkHeader);
+
+    // the chained message with all its continuation chunks is released when it is no longer the last chunk
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks + m_memoryManager.getMemPoolInfo(1).m_usedChunks,
+                Eq(1U));
+}
+
+TEST_F(ChunkSender_test, allocateFailsWhenChunkQuotaIsExceeded)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9def3d58-9387-4d96-84b5-b09a9a527bc2");
+    constexpr uint32_t MAX_CHUNKS_PER_MEMPOOL{2U};
+    ChunkSenderData_t chunkSenderData{&m_memoryManager,
+                                      iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA,
+                                      0U,
+                                      iox::mepoo::MemoryInfo(),
+                                      iox::mepoo::ChunkQuotaSettings{MAX_CHUNKS_PER_MEMPOOL, 0U, 0U}};
+    iox::popo::ChunkSender<ChunkSenderData_t> sut{&chunkSenderData};
+    ASSERT_TRUE(chunkSenderData.m_chunkQuota);
+
+    auto allocate = [&] {
+        return sut.tryAllocate(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                               SMALL_CHUNK,
+                               USER_PAYLOAD_ALIGNMENT,
+                               USER_HEADER_SIZE,
+                               USER_HEADER_ALIGNMENT);
+    };
+
+    for (uint32_t i = 0U; i < MAX_CHUNKS_PER_MEMPOOL; ++i)
+    {
+        EXPECT_FALSE(allocate().has_error());
+    }
+
+    auto maybeChunkHeader = allocate();
+    ASSERT_TRUE(maybeChunkHeader.has_error());
+    EXPECT_THAT(maybeChunkHeader.error(), Eq(iox::popo::AllocationError::CHUNK_QUOTA_EXCEEDED));
+    EXPECT_THAT(chunkSenderData.m_chunkQuota->getInfo().m_numberOfExceededRequests, Eq(1U));
+
+    sut.releaseAll();
+    EXPECT_FALSE(allocate().has_error());
+    sut.releaseAll();
+}
+
+TEST_F(ChunkSender_test, tryReuseOfChunkFromOwnMemoryManagerReusesTheChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dc580fad-1c64-4b0c-b4de-98c0ce8d8c7c");
+    const auto originId = UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID);
+    auto chunkSettings = iox::mepoo::ChunkSettings::create(sizeof(DummySample), alignof(DummySample)).value();
+    auto chunk = m_memoryManager.getChunk(chunkSettings).value();
+
+    auto reusedChunkHeader = m_chunkSender.tryReuse(originId, chunk, chunkSettings);
+
+    ASSERT_TRUE(reusedChunkHeader.has_value());
+    EXPECT_THAT(reusedChunkHeader.value(), Eq(chunk.getChunkHeader()));
+    EXPECT_THAT(reusedChunkHeader.value()->originId(), Eq(originId));
+
+    // the ChunkSender holds the reused chunk, so it is still in use when the original owner releases it
+    chunk = nullptr;
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
+    m_chunkSender.release(reusedChunkHeader.value());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ChunkSender_test, tryReuseOfTooSmallChunkFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d4e9480c-3897-41b8-9dbe-18c4928837de");
+    auto chunkSettings = iox::mepoo::ChunkSettings::create(sizeof(DummySample), alignof(DummySample)).value();
+    auto chunk = m_memoryManager.getChunk(chunkSettings).value();
+
+    auto largeChunkSettings = iox::mepoo::ChunkSettings::create(BIG_CHUNK, alignof(DummySample)).value();
+    auto reusedChunkHeader =
+        m_chunkSender.tryReuse(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID), chunk, largeChunkSettings);
+
+    EXPECT_FALSE(reusedChunkHeader.has_value());
+    chunk = nullptr;
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ChunkSender_test, tryReuseOfChunkFromOtherMemoryManagerFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "22b60922-6aa5-4d52-91c7-e036fe1e98e9");
+    constexpr uint64_t OTHER_MEMORY_SIZE{64U * 1024U};
+    std::vector<uint64_t> otherMemory(OTHER_MEMORY_SIZE / sizeof(uint64_t));
+    iox::BumpAllocator otherAllocator(otherMemory.data(), OTHER_MEMORY_SIZE);
+    iox::mepoo::MemoryManager otherMemoryManager;
+    otherMemoryManager.configureMemoryManager(m_mempoolconf, otherAllocator, otherAllocator);
+
+    auto chunkSettings = iox::mepoo::ChunkSettings::create(sizeof(DummySample), alignof(DummySample)).value();
+    auto chunk = otherMemoryManager.getChunk(chunkSettings).value();
+
+    auto reusedChunkHeader =
+        m_chunkSender.tryReuse(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID), chunk, chunkSettings);
+
+    EXPECT_FALSE(reusedChunkHeader.has_value());
+}
+
 TEST_F(ChunkSender_test, Cleanup)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5e5ab921-24bf-45a9-9572-68e444120baa");
@@ -818,7 +971,8 @@ TEST_F(ChunkSender_test, asStringLiteralConvertsAllocationErrorValuesToStrings)
                             AllocationError::RUNNING_OUT_OF_CHUNKS,
                             AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL,
                             AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER,
-                            AllocationError::INVALID_PARAMETER_FOR_REQUEST_HEADER})
+                            AllocationError::INVALID_PARAMETER_FOR_REQUEST_HEADER,
+                            AllocationError::CHUNK_QUOTA_EXCEEDED})
     {
         auto enumString = iox::popo::asStringLiteral(sut);
 
@@ -842,6 +996,9 @@ TEST_F(ChunkSender_test, asStringLiteralConvertsAllocationErrorValuesToStrings)
         case AllocationError::INVALID_PARAMETER_FOR_REQUEST_HEADER:
             EXPECT_THAT(enumString, StrEq("AllocationError::INVALID_PARAMETER_FOR_REQUEST_HEADER"));
             break;
+        case AllocationError::CHUNK_QUOTA_EXCEEDED:
+            EXPECT_THAT(enumString, StrEq("AllocationError::CHUNK_QUOTA_EXCEEDED"));
+            break;
         }
 
         testedEnumValues |= 1U << static_cast<uint64_t>(sut);
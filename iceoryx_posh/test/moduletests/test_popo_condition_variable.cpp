@@ -465,6 +465,74 @@ TEST_F(ConditionVariable_test, TimedWaitReturnsSortedListWhenTriggeredInOrder)
         *this, [this] { return m_waiter.timedWait(iox::units::Duration::fromSeconds(1)); });
 }
 
+TEST_F(ConditionVariable_test, SpinningWaitCollectsNotificationWithoutSemaphorePost)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c2042666-dd2f-477a-8ac2-39dc853be261");
+    constexpr Type_t EVENT_INDEX = 7U;
+    ConditionListener sut(m_condVarData, WaitStrategy{1_m, true});
+    NotificationVector_t activeNotifications;
+
+    std::thread waiter([&] { activeNotifications = sut.wait(); });
+
+    while (!m_condVarData.m_isSpinning.load())
+    {
+        std::this_thread::yield();
+    }
+    ConditionNotifier(m_condVarData, EVENT_INDEX).notify();
+    waiter.join();
+
+    ASSERT_THAT(activeNotifications.size(), Eq(1U));
+    EXPECT_THAT(activeNotifications[0], Eq(EVENT_INDEX));
+    EXPECT_FALSE(m_condVarData.m_isSpinning.load());
+    EXPECT_FALSE(m_condVarData.m_semaphore->tryWait().value());
+}
+
+TEST_F(ConditionVariable_test, NotifyAfterSpinDurationWakesUpBlockingWait)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "457f88cd-3ba0-4b9e-a159-bd107c88592b");
+    constexpr Type_t EVENT_INDEX = 3U;
+    ConditionListener sut(m_condVarData, WaitStrategy{1_ms, false});
+    NotificationVector_t activeNotifications;
+
+    std::thread waiter([&] { activeNotifications = sut.wait(); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(m_timingTestTime.toMilliseconds()));
+    ConditionNotifier(m_condVarData, EVENT_INDEX).notify();
+    waiter.join();
+
+    ASSERT_THAT(activeNotifications.size(), Eq(1U));
+    EXPECT_THAT(activeNotifications[0], Eq(EVENT_INDEX));
+}
+
+TEST_F(ConditionVariable_test, TimedWaitWithSpinDurationLongerThanTimeoutReturnsAfterTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "044d5258-ffb0-44d2-8cdd-1ee70bde5f7c");
+    ConditionListener sut(m_condVarData, WaitStrategy{1_m, true});
+
+    auto activeNotifications = sut.timedWait(m_timingTestTime);
+
+    EXPECT_THAT(activeNotifications.size(), Eq(0U));
+    EXPECT_FALSE(m_condVarData.m_isSpinning.load());
+}
+
+TEST_F(ConditionVariable_test, DestroyStopsSpinningWaitWhichReturnsEmptyVector)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a969e89b-286d-45a2-9ee7-42c31b2adfbb");
+    ConditionListener sut(m_condVarData, WaitStrategy{1_m, true});
+    NotificationVector_t activeNotifications;
+
+    std::thread waiter([&] { activeNotifications = sut.wait(); });
+
+    while (!m_condVarData.m_isSpinning.load())
+    {
+        std::this_thread::yield();
+    }
+    sut.destroy();
+    waiter.join();
+
+    EXPECT_THAT(activeNotifications.size(), Eq(0U));
+}
+
 void waitReturnsSortedListWhenTriggeredInReverseOrder(
     ConditionVariable_test& test, const iox::function_ref<ConditionListener::NotificationVector_t()> wait)
 {
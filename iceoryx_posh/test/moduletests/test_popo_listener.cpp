@@ -133,8 +133,8 @@ class SimpleEventClass
 class TestListener : public Listener
 {
   public:
-    TestListener(ConditionVariableData& data) noexcept
-        : Listener(data)
+    TestListener(ConditionVariableData& data, const WaitStrategy& waitStrategy = {}) noexcept
+        : Listener(data, waitStrategy)
     {
     }
 };
@@ -668,6 +668,23 @@ TIMING_TEST_F(Listener_test, CallbackIsCalledAfterNotify, Repeat(5), [&] {
     TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_count.load() == 1U);
 })
 
+TIMING_TEST_F(Listener_test, CallbackIsCalledAfterNotifyWithSpinningWaitStrategy, Repeat(5), [&] {
+    ::testing::Test::RecordProperty("TEST_ID", "ea21e022-794c-4137-a994-e4431486cc0b");
+    m_sut.emplace(m_condVarData, WaitStrategy{1_s, true});
+    SimpleEventClass fuu;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(fuu,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<0U>))
+                     .has_error());
+
+    fuu.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_source.load() == &fuu);
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_count.load() == 1U);
+})
+
 TIMING_TEST_F(Listener_test, CallbackWithEventAndUserTypeIsCalledAfterNotify, Repeat(5), [&] {
     ::testing::Test::RecordProperty("TEST_ID", "6df97139-8c2e-42b1-bd9a-8770c295bf2e");
     m_sut.emplace(m_condVarData);
@@ -234,6 +234,64 @@ TEST_F(PublisherTest, CanLoanSamplesAndPublishCopiesOfProvidedValues)
     // ===== Cleanup ===== //
 }
 
+TEST_F(PublisherTest, LoanUninitializedLoansChunkLargeEnoughForTheType)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "25298148-9f6a-41ba-a496-88c36a46d3d9");
+    EXPECT_CALL(portMock, tryAllocateChunk(sizeof(DummyData), alignof(DummyData), _, _))
+        .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))));
+    // ===== Test ===== //
+    auto result = sut.loanUninitialized();
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value().get(), chunkMock.chunkHeader()->userPayload());
+    EXPECT_CALL(portMock, releaseChunk(chunkMock.chunkHeader()));
+    // ===== Cleanup ===== //
+}
+
+TEST_F(PublisherTest, LoanUninitializedFailsAndForwardsAllocationErrorsToCaller)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "85222a26-68c3-47cd-bf86-aa3bf3678b29");
+    EXPECT_CALL(portMock, tryAllocateChunk(sizeof(DummyData), _, _, _))
+        .WillOnce(Return(ByMove(iox::err(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS))));
+    // ===== Test ===== //
+    auto result = sut.loanUninitialized();
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS, result.error());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(PublisherTest, CanLoanSamplesAndPublishStreamingCopiesOfProvidedValues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5df3dd62-22b3-4379-8f30-b4b777da0678");
+    constexpr uint64_t CUSTOM_VALUE{73};
+    EXPECT_CALL(portMock, tryAllocateChunk(sizeof(DummyData), _, _, _))
+        .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))));
+    EXPECT_CALL(portMock, sendChunk(chunkMock.chunkHeader()));
+    DummyData data(CUSTOM_VALUE);
+    // ===== Test ===== //
+    auto result = sut.publishStreamingCopyOf(data);
+    // ===== Verify ===== //
+    EXPECT_FALSE(result.has_error());
+    EXPECT_EQ(chunkMock.sample()->val, CUSTOM_VALUE);
+    // ===== Cleanup ===== //
+}
+
+TEST_F(PublisherTest, PublishStreamingCopyOfForwardsAllocationErrorsToCaller)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "94e489e1-77be-4fe7-9356-017174aaf5aa");
+    EXPECT_CALL(portMock, tryAllocateChunk(sizeof(DummyData), _, _, _))
+        .WillOnce(Return(ByMove(iox::err(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS))));
+    EXPECT_CALL(portMock, sendChunk(_)).Times(0);
+    DummyData data(73);
+    // ===== Test ===== //
+    auto result = sut.publishStreamingCopyOf(data);
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS, result.error());
+    // ===== Cleanup ===== //
+}
+
 TEST_F(PublisherTest, LoanFailsAndForwardsAllocationErrorsToCaller)
 {
     ::testing::Test::RecordProperty("TEST_ID", "257750cd-3a1b-4363-a6d2-4318590528bb");
@@ -32,6 +32,11 @@ TEST(PublisherOptions_test, SerializationRoundTripIsSuccessful)
     testOptions.nodeName = "hypnotoad";
     testOptions.offerOnCreate = false;
     testOptions.subscriberTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    testOptions.maxChunksPerMemPool = 13;
+    testOptions.reservedUserPayloadSize = 73;
+    testOptions.reservedChunks = 37;
+    testOptions.segmentName = "camera";
+    testOptions.trafficClass = iox::mepoo::TrafficClass::BULK;
 
     iox::popo::PublisherOptions::deserialize(testOptions.serialize())
         .and_then([&](auto& roundTripOptions) {
@@ -46,6 +51,21 @@ TEST(PublisherOptions_test, SerializationRoundTripIsSuccessful)
 
             EXPECT_THAT(roundTripOptions.subscriberTooSlowPolicy, Ne(defaultOptions.subscriberTooSlowPolicy));
             EXPECT_THAT(roundTripOptions.subscriberTooSlowPolicy, Eq(testOptions.subscriberTooSlowPolicy));
+
+            EXPECT_THAT(roundTripOptions.maxChunksPerMemPool, Ne(defaultOptions.maxChunksPerMemPool));
+            EXPECT_THAT(roundTripOptions.maxChunksPerMemPool, Eq(testOptions.maxChunksPerMemPool));
+
+            EXPECT_THAT(roundTripOptions.reservedUserPayloadSize, Ne(defaultOptions.reservedUserPayloadSize));
+            EXPECT_THAT(roundTripOptions.reservedUserPayloadSize, Eq(testOptions.reservedUserPayloadSize));
+
+            EXPECT_THAT(roundTripOptions.reservedChunks, Ne(defaultOptions.reservedChunks));
+            EXPECT_THAT(roundTripOptions.reservedChunks, Eq(testOptions.reservedChunks));
+
+            EXPECT_THAT(roundTripOptions.segmentName, Ne(defaultOptions.segmentName));
+            EXPECT_THAT(roundTripOptions.segmentName, Eq(testOptions.segmentName));
+
+            EXPECT_THAT(roundTripOptions.trafficClass, Ne(defaultOptions.trafficClass));
+            EXPECT_THAT(roundTripOptions.trafficClass, Eq(testOptions.trafficClass));
         })
         .or_else([&](auto&) { GTEST_FAIL() << "Serialization/Deserialization of PublisherOptions failed!"; });
 }
@@ -66,9 +86,48 @@ TEST(PublisherOptions_test, DeserializingInvalidSubscriberTooSlowPolicyFails)
     const iox::NodeName_t NODE_NAME{"harr-harr"};
     constexpr bool OFFER_ON_CREATE{true};
     constexpr std::underlying_type_t<iox::popo::ConsumerTooSlowPolicy> SUBSCRIBER_TOO_SLOW_POLICY{111};
+    constexpr uint32_t MAX_CHUNKS_PER_MEMPOOL{0U};
+    constexpr uint64_t RESERVED_USER_PAYLOAD_SIZE{0U};
+    constexpr uint32_t RESERVED_CHUNKS{0U};
+    const iox::mepoo::SegmentName_t SEGMENT_NAME{""};
+    constexpr std::underlying_type_t<iox::mepoo::TrafficClass> TRAFFIC_CLASS{0U};
+
+    const auto serialized = iox::Serialization::create(HISTORY_CAPACITY,
+                                                       NODE_NAME,
+                                                       OFFER_ON_CREATE,
+                                                       SUBSCRIBER_TOO_SLOW_POLICY,
+                                                       MAX_CHUNKS_PER_MEMPOOL,
+                                                       RESERVED_USER_PAYLOAD_SIZE,
+                                                       RESERVED_CHUNKS,
+                                                       SEGMENT_NAME,
+                                                       TRAFFIC_CLASS);
+    iox::popo::PublisherOptions::deserialize(serialized)
+        .and_then([&](auto&) { GTEST_FAIL() << "Deserialization is expected to fail!"; })
+        .or_else([&](auto&) { GTEST_SUCCEED(); });
+}
+
+TEST(PublisherOptions_test, DeserializingInvalidTrafficClassFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7fd5144d-f6ab-40ca-b84a-4aeb42e73441");
+    constexpr uint64_t HISTORY_CAPACITY{42U};
+    const iox::NodeName_t NODE_NAME{"harr-harr"};
+    constexpr bool OFFER_ON_CREATE{true};
+    constexpr std::underlying_type_t<iox::popo::ConsumerTooSlowPolicy> SUBSCRIBER_TOO_SLOW_POLICY{0U};
+    constexpr uint32_t MAX_CHUNKS_PER_MEMPOOL{0U};
+    constexpr uint64_t RESERVED_USER_PAYLOAD_SIZE{0U};
+    constexpr uint32_t RESERVED_CHUNKS{0U};
+    const iox::mepoo::SegmentName_t SEGMENT_NAME{"camera"};
+    constexpr std::underlying_type_t<iox::mepoo::TrafficClass> TRAFFIC_CLASS{111};
 
-    const auto serialized =
-        iox::Serialization::create(HISTORY_CAPACITY, NODE_NAME, OFFER_ON_CREATE, SUBSCRIBER_TOO_SLOW_POLICY);
+    const auto serialized = iox::Serialization::create(HISTORY_CAPACITY,
+                                                       NODE_NAME,
+                                                       OFFER_ON_CREATE,
+                                                       SUBSCRIBER_TOO_SLOW_POLICY,
+                                                       MAX_CHUNKS_PER_MEMPOOL,
+                                                       RESERVED_USER_PAYLOAD_SIZE,
+                                                       RESERVED_CHUNKS,
+                                                       SEGMENT_NAME,
+                                                       TRAFFIC_CLASS);
     iox::popo::PublisherOptions::deserialize(serialized)
         .and_then([&](auto&) { GTEST_FAIL() << "Deserialization is expected to fail!"; })
         .or_else([&](auto&) { GTEST_SUCCEED(); });
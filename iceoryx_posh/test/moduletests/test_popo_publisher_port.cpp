@@ -23,6 +23,8 @@
 #include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_roudi.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_user.hpp"
+#include "iceoryx_posh/internal/popo/ports/subscriber_port_multi_producer.hpp"
+#include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iox/bump_allocator.hpp"
 #include "test.hpp"
@@ -594,4 +596,149 @@ TEST_F(PublisherPort_test, cleanupReleasesAllChunks)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
+class PublisherPortLatestValue_test : public PublisherPort_test
+{
+  protected:
+    static iox::popo::SubscriberOptions createLatestValueOptions()
+    {
+        iox::popo::SubscriberOptions options;
+        options.latestValueOnly = true;
+        return options;
+    }
+
+    void SetUp() override
+    {
+        m_sutNoOfferOnCreateUserSide.offer();
+        m_sutNoOfferOnCreateRouDiSide.tryGetCaProMessage();
+    }
+
+    void subscribe()
+    {
+        auto subMessage = m_subscriberRouDiSide.tryGetCaProMessage();
+        ASSERT_TRUE(subMessage.has_value());
+        ASSERT_TRUE(subMessage->m_latestValueOnly);
+
+        auto response = m_sutNoOfferOnCreateRouDiSide.dispatchCaProMessageAndGetPossibleResponse(subMessage.value());
+        ASSERT_TRUE(response.has_value());
+        ASSERT_THAT(response->m_type, Eq(iox::capro::CaproMessageType::ACK));
+        ASSERT_THAT(response->m_latestChunkSlot, Ne(nullptr));
+        m_subscriberRouDiSide.dispatchCaProMessageAndGetPossibleResponse(response.value());
+    }
+
+    void publish(const uint64_t value)
+    {
+        auto chunkHeader = m_sutNoOfferOnCreateUserSide
+                               .tryAllocateChunk(sizeof(DummySample),
+                                                 alignof(DummySample),
+                                                 USER_HEADER_SIZE,
+                                                 USER_HEADER_ALIGNMENT)
+                               .expect("Allocating a chunk");
+        new (chunkHeader->userPayload()) DummySample{value};
+        m_sutNoOfferOnCreateUserSide.sendChunk(chunkHeader);
+    }
+
+    uint64_t takeValue()
+    {
+        auto chunkHeader = m_subscriberUserSide.tryGetChunk().expect("Taking the latest chunk");
+        auto value = static_cast<const DummySample*>(chunkHeader->userPayload())->dummy;
+        m_subscriberUserSide.releaseChunk(chunkHeader);
+        return value;
+    }
+
+    iox::popo::SubscriberOptions m_latestValueOptions{createLatestValueOptions()};
+    iox::popo::SubscriberPortData m_subscriberPortData{iox::capro::ServiceDescription("a", "b", "c"),
+                                                       "myApp",
+                                                       iox::roudi::DEFAULT_UNIQUE_ROUDI_ID,
+                                                       iox::popo::VariantQueueTypes::SoFi_MultiProducerSingleConsumer,
+                                                       m_latestValueOptions};
+    iox::popo::SubscriberPortUser m_subscriberUserSide{&m_subscriberPortData};
+    iox::popo::SubscriberPortMultiProducer m_subscriberRouDiSide{&m_subscriberPortData};
+};
+
+TEST_F(PublisherPortLatestValue_test, SubscriberGetsNoChunkBeforeThePublisherSentAfterSubscription)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e4517fe8-a458-45dc-9349-6e6cbbc85ed2");
+    publish(13U);
+    subscribe();
+
+    EXPECT_FALSE(m_subscriberUserSide.hasNewChunks());
+    EXPECT_TRUE(m_subscriberUserSide.tryGetChunk().has_error());
+}
+
+TEST_F(PublisherPortLatestValue_test, SubscriberReadsOnlyTheLatestChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2dc42d84-a813-4134-a6fc-f19f979e677d");
+    subscribe();
+    publish(1U);
+    publish(2U);
+    publish(3U);
+
+    EXPECT_TRUE(m_subscriberUserSide.hasNewChunks());
+    EXPECT_THAT(takeValue(), Eq(3U));
+}
+
+TEST_F(PublisherPortLatestValue_test, LatestChunkIsProvidedOnlyOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7311c24b-e2ce-4477-be33-2940389857ae");
+    subscribe();
+    publish(42U);
+
+    EXPECT_THAT(takeValue(), Eq(42U));
+    EXPECT_FALSE(m_subscriberUserSide.hasNewChunks());
+    EXPECT_TRUE(m_subscriberUserSide.tryGetChunk().has_error());
+
+    publish(73U);
+    EXPECT_THAT(takeValue(), Eq(73U));
+}
+
+TEST_F(PublisherPortLatestValue_test, HeldLatestChunkIsNotReusedByThePublisher)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b2560373-3c5e-4e86-8264-429f95850341");
+    subscribe();
+    publish(1U);
+
+    auto chunkHeader = m_subscriberUserSide.tryGetChunk().expect("Taking the latest chunk");
+    publish(2U);
+    publish(3U);
+
+    EXPECT_THAT(static_cast<const DummySample*>(chunkHeader->userPayload())->dummy, Eq(1U));
+    m_subscriberUserSide.releaseChunk(chunkHeader);
+    EXPECT_THAT(takeValue(), Eq(3U));
+}
+
+TEST_F(PublisherPortLatestValue_test, StopOfferRemovesTheLatestChunkFromTheSubscriber)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3cae76a8-6b05-4a17-b167-d2484dacfacb");
+    subscribe();
+    publish(1U);
+
+    m_sutNoOfferOnCreateUserSide.stopOffer();
+    auto stopOfferMessage = m_sutNoOfferOnCreateRouDiSide.tryGetCaProMessage();
+    ASSERT_TRUE(stopOfferMessage.has_value());
+    m_subscriberRouDiSide.dispatchCaProMessageAndGetPossibleResponse(stopOfferMessage.value());
+
+    EXPECT_FALSE(m_subscriberUserSide.hasNewChunks());
+    EXPECT_TRUE(m_subscriberUserSide.tryGetChunk().has_error());
+}
+
+TEST_F(PublisherPortLatestValue_test, UnsubscribedLatestValueReaderNoLongerBlocksReuseOfTheLastChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "61e83bf0-4ad6-49fa-b266-09b3e87839da");
+    subscribe();
+    publish(1U);
+
+    m_subscriberUserSide.unsubscribe();
+    auto unsubMessage = m_subscriberRouDiSide.tryGetCaProMessage();
+    ASSERT_TRUE(unsubMessage.has_value());
+    EXPECT_TRUE(unsubMessage->m_latestValueOnly);
+    auto response = m_sutNoOfferOnCreateRouDiSide.dispatchCaProMessageAndGetPossibleResponse(unsubMessage.value());
+    ASSERT_TRUE(response.has_value());
+    EXPECT_THAT(response->m_type, Eq(iox::capro::CaproMessageType::ACK));
+
+    // the first publish clears the latest chunk slot, the second one can then reuse the last chunk
+    publish(2U);
+    publish(3U);
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
+}
+
 } // namespace
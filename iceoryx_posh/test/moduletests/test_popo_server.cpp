@@ -150,6 +150,56 @@ TEST_F(Server_test, LoanCallsUnderlyingPortWithErrorResult)
     EXPECT_CALL(sut.mockPort, releaseRequest(requestMock.userHeader())).Times(1);
 }
 
+TEST_F(Server_test, LoanInPlaceCallsUnderlyingPortAndConsumesTheRequest)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3f28c38b-bdad-48be-aa9d-efbea6c23218");
+
+    const iox::expected<const RequestHeader*, ServerRequestResult> getRequestResult =
+        iox::ok<const RequestHeader*>(requestMock.userHeader());
+
+    EXPECT_CALL(sut.mockPort, getRequest()).WillOnce(Return(getRequestResult));
+    auto takeResult = sut.take();
+    ASSERT_FALSE(takeResult.has_error());
+
+    const iox::expected<ResponseHeader*, AllocationError> allocateResponseResult =
+        iox::ok<ResponseHeader*>(responseMock.userHeader());
+
+    EXPECT_CALL(sut.mockPort, allocateResponseInPlace(requestMock.userHeader(), PAYLOAD_SIZE, PAYLOAD_ALIGNMENT))
+        .WillOnce(Return(allocateResponseResult));
+    EXPECT_CALL(sut.mockPort, releaseRequest(_)).Times(0);
+
+    constexpr uint64_t RESPONSE_DATA{73U};
+    auto loanResult = sut.loanInPlace(std::move(takeResult.value()), DummyResponse{RESPONSE_DATA});
+    ASSERT_FALSE(loanResult.has_error());
+    EXPECT_THAT(&loanResult.value().getResponseHeader(), Eq(responseMock.userHeader()));
+    EXPECT_THAT(loanResult.value()->data, Eq(RESPONSE_DATA));
+
+    EXPECT_CALL(sut.mockPort, releaseResponse(responseMock.userHeader())).Times(1);
+}
+
+TEST_F(Server_test, LoanInPlaceCallsUnderlyingPortWithErrorResult)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7b6e90b8-e359-469d-bd6e-e6871bd1bf04");
+
+    const iox::expected<const RequestHeader*, ServerRequestResult> getRequestResult =
+        iox::ok<const RequestHeader*>(requestMock.userHeader());
+
+    EXPECT_CALL(sut.mockPort, getRequest()).WillOnce(Return(getRequestResult));
+    auto takeResult = sut.take();
+    ASSERT_FALSE(takeResult.has_error());
+
+    constexpr AllocationError ALLOCATION_ERROR{AllocationError::RUNNING_OUT_OF_CHUNKS};
+    const iox::expected<ResponseHeader*, AllocationError> allocateResponseResult = iox::err(ALLOCATION_ERROR);
+
+    EXPECT_CALL(sut.mockPort, allocateResponseInPlace(requestMock.userHeader(), PAYLOAD_SIZE, PAYLOAD_ALIGNMENT))
+        .WillOnce(Return(allocateResponseResult));
+    EXPECT_CALL(sut.mockPort, releaseRequest(_)).Times(0);
+
+    auto loanResult = sut.loanInPlace(std::move(takeResult.value()));
+    ASSERT_TRUE(loanResult.has_error());
+    EXPECT_THAT(loanResult.error(), Eq(ALLOCATION_ERROR));
+}
+
 TEST_F(Server_test, SendCallsUnderlyingPort)
 {
     ::testing::Test::RecordProperty("TEST_ID", "535414bd-1846-4254-8fa1-78a296c185b5");
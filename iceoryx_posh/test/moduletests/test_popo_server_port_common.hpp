@@ -63,6 +63,7 @@ class ServerPort_test : public Test
         MePooConfig mempoolconf;
         mempoolconf.addMemPool({CHUNK_SIZE, NUM_CHUNKS});
         m_memoryManager.configureMemoryManager(mempoolconf, m_memoryAllocator, m_memoryAllocator);
+        m_foreignMemoryManager.configureMemoryManager(mempoolconf, m_foreignMemoryAllocator, m_foreignMemoryAllocator);
     }
 
     void SetUp() override
@@ -103,7 +104,14 @@ class ServerPort_test : public Test
         return m_memoryManager.getMemPoolInfo(0U).m_usedChunks;
     }
 
-    SharedChunk getChunkFromMemoryManager(uint64_t userPayloadSize, uint32_t userHeaderSize)
+    uint32_t getNumberOfUsedChunksInForeignSegment() const
+    {
+        return m_foreignMemoryManager.getMemPoolInfo(0U).m_usedChunks;
+    }
+
+    SharedChunk getChunkFromMemoryManager(uint64_t userPayloadSize,
+                                          uint32_t userHeaderSize,
+                                          MemoryManager* memoryManager = nullptr)
     {
         auto chunkSettings = ChunkSettings::create(userPayloadSize,
                                                    iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
@@ -111,15 +119,19 @@ class ServerPort_test : public Test
                                                    iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT)
                                  .expect("Valid 'ChunkSettings'");
 
-        return m_memoryManager.getChunk(chunkSettings).expect("Obtaining chunk");
+        auto& chunkSource = (memoryManager != nullptr) ? *memoryManager : m_memoryManager;
+        return chunkSource.getChunk(chunkSettings).expect("Obtaining chunk");
     }
 
     static constexpr uint64_t DUMMY_DATA{0U};
 
-    SharedChunk getChunkWithInitializedRequestHeaderAndData(const uint64_t data = DUMMY_DATA)
+    /// @param[in] fromForeignSegment if true the chunk is acquired from a payload segment the server does not write to
+    SharedChunk getChunkWithInitializedRequestHeaderAndData(const uint64_t data = DUMMY_DATA,
+                                                            const bool fromForeignSegment = false)
     {
         constexpr uint64_t USER_PAYLOAD_SIZE{sizeof(uint64_t)};
-        auto sharedChunk = getChunkFromMemoryManager(USER_PAYLOAD_SIZE, sizeof(RequestHeader));
+        auto sharedChunk = getChunkFromMemoryManager(
+            USER_PAYLOAD_SIZE, sizeof(RequestHeader), fromForeignSegment ? &m_foreignMemoryManager : nullptr);
         new (sharedChunk.getChunkHeader()->userHeader())
             RequestHeader(clientChunkQueueData.m_uniqueId, RpcBaseHeader::UNKNOWN_CLIENT_QUEUE_INDEX);
         new (sharedChunk.getUserPayload()) uint64_t(data);
@@ -186,6 +198,10 @@ class ServerPort_test : public Test
     uint8_t m_memory[MEMORY_SIZE];
     iox::BumpAllocator m_memoryAllocator{m_memory, MEMORY_SIZE};
     MemoryManager m_memoryManager;
+    static constexpr size_t FOREIGN_MEMORY_SIZE = 64U * 1024U;
+    uint8_t m_foreignMemory[FOREIGN_MEMORY_SIZE];
+    iox::BumpAllocator m_foreignMemoryAllocator{m_foreignMemory, FOREIGN_MEMORY_SIZE};
+    MemoryManager m_foreignMemoryManager;
 
     ServiceDescription m_serviceDescription{"hyp", "no", "toad"};
     iox::RuntimeName_t m_runtimeName{"hypnotoad"};
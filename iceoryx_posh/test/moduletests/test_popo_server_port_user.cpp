@@ -600,6 +600,117 @@ TEST_F(ServerPort_test, AllocateResponseWithValidParameterReturnsResponseHeader)
 
 // END allocateResponse tests
 
+// BEGIN allocateResponseInPlace tests
+
+TEST_F(ServerPort_test, AllocateResponseInPlaceWithNullptrAsRequestHeaderFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "64890fa6-4dbf-4027-b827-4deaeabd93e2");
+    auto& sut = serverPortWithOfferOnCreate;
+
+    sut.portUser.allocateResponseInPlace(nullptr, USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT)
+        .and_then([&](const auto&) {
+            GTEST_FAIL() << "Expected AllocationError::INVALID_PARAMETER_FOR_REQUEST_HEADER but got chunk";
+        })
+        .or_else([&](const auto& error) {
+            EXPECT_THAT(error, Eq(AllocationError::INVALID_PARAMETER_FOR_REQUEST_HEADER));
+        });
+}
+
+TEST_F(ServerPort_test, AllocateResponseInPlaceReusesTheChunkOfTheRequest)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e85b67f3-3b81-4ac5-838e-39efb8cec50d");
+    auto& sut = serverPortWithOfferOnCreate;
+
+    constexpr uint64_t NUMBER_OF_REQUESTS{1U};
+    ASSERT_TRUE(pushRequests(sut.requestQueuePusher, NUMBER_OF_REQUESTS));
+    auto requestResult = sut.portUser.getRequest();
+    ASSERT_FALSE(requestResult.has_error());
+    const auto* requestChunkHeader = requestResult.value()->getChunkHeader();
+
+    sut.portUser.allocateResponseInPlace(requestResult.value(), USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT)
+        .and_then([&](auto& responseHeader) {
+            EXPECT_THAT(responseHeader->getChunkHeader(), Eq(requestChunkHeader));
+            EXPECT_THAT(responseHeader->getChunkHeader()->userPayloadSize(), Eq(USER_PAYLOAD_SIZE));
+            EXPECT_THAT(responseHeader->getChunkHeader()->originId(), Eq(sut.portUser.getUniqueID()));
+            EXPECT_FALSE(responseHeader->hasServerError());
+            EXPECT_THAT(this->getNumberOfUsedChunks(), Eq(1U));
+        })
+        .or_else([&](const auto& error) { GTEST_FAIL() << "Expected ResponseHeader but got error: " << error; });
+}
+
+TEST_F(ServerPort_test, AllocateResponseInPlaceWithRequestFromForeignSegmentAllocatesNewChunkAndReleasesTheRequest)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "010ec971-677c-4520-ba15-6bd0da07d316");
+    auto& sut = serverPortWithOfferOnCreate;
+
+    constexpr bool FROM_FOREIGN_SEGMENT{true};
+    auto requestChunk = getChunkWithInitializedRequestHeaderAndData(DUMMY_DATA, FROM_FOREIGN_SEGMENT);
+    ASSERT_TRUE(sut.requestQueuePusher.push(requestChunk));
+    requestChunk = nullptr;
+    auto requestResult = sut.portUser.getRequest();
+    ASSERT_FALSE(requestResult.has_error());
+    const auto* requestChunkHeader = requestResult.value()->getChunkHeader();
+
+    sut.portUser.allocateResponseInPlace(requestResult.value(), USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT)
+        .and_then([&](auto& responseHeader) {
+            EXPECT_THAT(responseHeader->getChunkHeader(), Ne(requestChunkHeader));
+            EXPECT_THAT(this->getNumberOfUsedChunks(), Eq(1U));
+            EXPECT_THAT(this->getNumberOfUsedChunksInForeignSegment(), Eq(0U));
+        })
+        .or_else([&](const auto& error) { GTEST_FAIL() << "Expected ResponseHeader but got error: " << error; });
+}
+
+TEST_F(ServerPort_test, AllocateResponseInPlaceWithTooLargeUserPayloadFailsAndReleasesTheRequest)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "de9983b7-d6d9-4ae3-8f4d-2a9f8e1905ee");
+    auto& sut = serverPortWithOfferOnCreate;
+
+    constexpr uint64_t NUMBER_OF_REQUESTS{1U};
+    ASSERT_TRUE(pushRequests(sut.requestQueuePusher, NUMBER_OF_REQUESTS));
+    auto requestResult = sut.portUser.getRequest();
+    ASSERT_FALSE(requestResult.has_error());
+
+    // the user-payload neither fits into the request chunk nor into any mempool
+    constexpr uint64_t TOO_LARGE_USER_PAYLOAD_SIZE{1024U};
+    sut.portUser.allocateResponseInPlace(requestResult.value(), TOO_LARGE_USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT)
+        .and_then([&](const auto&) { GTEST_FAIL() << "Expected AllocationError but got chunk"; })
+        .or_else([&](const auto& error) { EXPECT_THAT(error, Eq(AllocationError::NO_MEMPOOLS_AVAILABLE)); });
+
+    EXPECT_THAT(this->getNumberOfUsedChunks(), Eq(0U));
+}
+
+TEST_F(ServerPort_test, AllocateResponseInPlaceAndSendResponseDeliversTheRequestChunkToTheClientQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e9a4f828-0413-431e-8a33-2b8d3e29f589");
+    auto& sut = serverPortWithOfferOnCreate;
+
+    addClientQueue(sut);
+
+    constexpr uint64_t NUMBER_OF_REQUESTS{1U};
+    constexpr uint64_t REQUEST_DATA{42U};
+    ASSERT_TRUE(pushRequests(sut.requestQueuePusher, NUMBER_OF_REQUESTS, REQUEST_DATA));
+    auto requestResult = sut.portUser.getRequest();
+    ASSERT_FALSE(requestResult.has_error());
+    const auto* requestChunkHeader = requestResult.value()->getChunkHeader();
+    const auto responseData = getRequestData(requestResult.value()) + 1U;
+
+    auto responseResult =
+        sut.portUser.allocateResponseInPlace(requestResult.value(), sizeof(uint64_t), alignof(uint64_t));
+    ASSERT_FALSE(responseResult.has_error());
+    new (ChunkHeader::fromUserHeader(responseResult.value())->userPayload()) uint64_t(responseData);
+    EXPECT_FALSE(sut.portUser.sendResponse(responseResult.value()).has_error());
+
+    auto maybeChunk [[maybe_unused]] = clientResponseQueue.tryPop()
+                                           .and_then([&](const auto& chunk) {
+                                               EXPECT_THAT(chunk.getChunkHeader(), Eq(requestChunkHeader));
+                                               auto data = *static_cast<uint64_t*>(chunk.getUserPayload());
+                                               EXPECT_THAT(data, Eq(REQUEST_DATA + 1U));
+                                           })
+                                           .or_else([&]() { GTEST_FAIL() << "Expected response but got none"; });
+}
+
+// END allocateResponseInPlace tests
+
 // BEGIN releaseResponse tests
 
 TEST_F(ServerPort_test, ReleaseResponseWithValidResponseHeaderWorksAndReleasesTheChunkToTheMempool)
@@ -0,0 +1,242 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/popo/listener.hpp"
+#include "iceoryx_posh/popo/timer.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
+#include "iox/atomic.hpp"
+#include "iox/deadline_timer.hpp"
+
+#include "test.hpp"
+
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::popo;
+using namespace iox::units::duration_literals;
+
+class WaitSetTest : public WaitSet<>
+{
+  public:
+    WaitSetTest(ConditionVariableData& condVarData) noexcept
+        : WaitSet(condVarData)
+    {
+    }
+};
+
+class ListenerTest : public Listener
+{
+  public:
+    ListenerTest(ConditionVariableData& condVarData) noexcept
+        : Listener(condVarData)
+    {
+    }
+};
+
+class Timer_test : public Test
+{
+  public:
+    static void callback(Timer* origin, concurrent::Atomic<uint64_t>* counter)
+    {
+        if (origin != nullptr)
+        {
+            counter->fetch_add(1U);
+        }
+    }
+
+    ConditionVariableData m_condVar{"Tick"};
+    WaitSetTest m_waitSet{m_condVar};
+};
+
+TEST_F(Timer_test, IsNotRunningWhenCreated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "48f0c9e4-785e-4e42-8a9c-72b7fecc3c36");
+    Timer sut(10_ms, TimerMode::ONE_SHOT);
+
+    EXPECT_FALSE(sut.isRunning());
+    EXPECT_THAT(sut.getPeriod(), Eq(10_ms));
+    EXPECT_THAT(sut.getMode(), Eq(TimerMode::ONE_SHOT));
+}
+
+TEST_F(Timer_test, IsRunningWhenStartedBeforeAttach)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4e041bfe-0d7a-44d5-be48-d20f6ed3e3ac");
+    Timer sut(1_h);
+    sut.start();
+    EXPECT_TRUE(sut.isRunning());
+
+    ASSERT_FALSE(m_waitSet.attachEvent(sut).has_error());
+    EXPECT_TRUE(sut.isRunning());
+}
+
+TEST_F(Timer_test, IsNotRunningAfterStop)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8f92bd9d-4249-4682-b9ac-8e1c944c370b");
+    Timer sut(1_h);
+    ASSERT_FALSE(m_waitSet.attachEvent(sut).has_error());
+    sut.start();
+    sut.stop();
+
+    EXPECT_FALSE(sut.isRunning());
+}
+
+TEST_F(Timer_test, IsStoppedWhenDetached)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d5c61a6a-77c2-48d5-b417-2e9af9e5f384");
+    Timer sut(1_h);
+    ASSERT_FALSE(m_waitSet.attachEvent(sut).has_error());
+    sut.start();
+    m_waitSet.detachEvent(sut);
+
+    EXPECT_FALSE(sut.isRunning());
+    EXPECT_THAT(m_waitSet.size(), Eq(0U));
+}
+
+TEST_F(Timer_test, IsStoppedWhenWaitSetGoesOutOfScope)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1672c7c7-5bb0-4f3c-a46a-d4f291b1dee9");
+    Timer sut(1_h);
+    {
+        ConditionVariableData condVar{"Tock"};
+        WaitSetTest waitSet{condVar};
+        ASSERT_FALSE(waitSet.attachEvent(sut).has_error());
+        sut.start();
+    }
+
+    EXPECT_FALSE(sut.isRunning());
+}
+
+TEST_F(Timer_test, IsDetachedWhenGoingOutOfScope)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ebfe5d3f-2df2-4187-bf42-a1ad30e3840f");
+    {
+        Timer sut(1_h);
+        ASSERT_FALSE(m_waitSet.attachEvent(sut).has_error());
+        sut.start();
+    }
+
+    EXPECT_THAT(m_waitSet.size(), Eq(0U));
+}
+
+TEST_F(Timer_test, StoppedTimerDoesNotWakeUpWaitSet)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6dadd18a-5870-4f14-abc3-0b6f4763b2f5");
+    Timer sut(1_ms);
+    ASSERT_FALSE(m_waitSet.attachEvent(sut).has_error());
+
+    EXPECT_TRUE(m_waitSet.timedWait(10_ms).empty());
+}
+
+TEST_F(Timer_test, ExpiredTimerWakesUpWaitSet)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "27f53bf6-dc90-4ee9-a10d-99fcfcc1d9bd");
+    Timer sut(10_ms, TimerMode::ONE_SHOT);
+    ASSERT_FALSE(m_waitSet.attachEvent(sut).has_error());
+    sut.start();
+
+    auto notifications = m_waitSet.wait();
+
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_TRUE(notifications[0]->doesOriginateFrom(&sut));
+    EXPECT_FALSE(sut.isRunning());
+}
+
+TEST_F(Timer_test, ExpiredTimerWakesUpTimedWaitBeforeTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b6508737-e1b4-44ac-9cea-059270445859");
+    Timer sut(10_ms);
+    ASSERT_FALSE(m_waitSet.attachEvent(sut).has_error());
+    sut.start();
+
+    deadline_timer timeout{1_h};
+    auto notifications = m_waitSet.timedWait(1_h);
+
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_TRUE(notifications[0]->doesOriginateFrom(&sut));
+    EXPECT_THAT(timeout.remainingTime(), Gt(59_m));
+}
+
+TEST_F(Timer_test, TimedWaitReturnsAtTimeoutBeforeTimerExpires)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "814e48ba-22a8-42da-b63c-76c34c09f518");
+    Timer sut(1_h);
+    ASSERT_FALSE(m_waitSet.attachEvent(sut).has_error());
+    sut.start();
+
+    EXPECT_TRUE(m_waitSet.timedWait(10_ms).empty());
+    EXPECT_TRUE(sut.isRunning());
+}
+
+TEST_F(Timer_test, PeriodicTimerWakesUpWaitSetRepeatedly)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c2154f71-bca1-49ae-bb91-f44b52800c4f");
+    constexpr uint64_t NUMBER_OF_EXPIRATIONS = 3U;
+    Timer sut(5_ms);
+    ASSERT_FALSE(m_waitSet.attachEvent(sut).has_error());
+    sut.start();
+
+    for (uint64_t i = 0U; i < NUMBER_OF_EXPIRATIONS; ++i)
+    {
+        auto notifications = m_waitSet.wait();
+        ASSERT_THAT(notifications.size(), Eq(1U));
+        EXPECT_TRUE(notifications[0]->doesOriginateFrom(&sut));
+    }
+    EXPECT_TRUE(sut.isRunning());
+}
+
+TEST_F(Timer_test, StartingTimerWakesUpBlockingWaitToTakeDeadlineIntoAccount)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9bf33117-0e9c-4411-b717-ea2825c08375");
+    Timer sut(10_ms, TimerMode::ONE_SHOT);
+    ASSERT_FALSE(m_waitSet.attachEvent(sut).has_error());
+
+    std::thread starter([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        sut.start();
+    });
+    auto notifications = m_waitSet.wait();
+    starter.join();
+
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_TRUE(notifications[0]->doesOriginateFrom(&sut));
+}
+
+TEST_F(Timer_test, ExpiredTimerCallsListenerCallback)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ffed7d7c-810b-4972-ad18-6cba65a28856");
+    constexpr uint64_t NUMBER_OF_EXPIRATIONS = 3U;
+    concurrent::Atomic<uint64_t> counter{0U};
+    Timer sut(5_ms);
+    ConditionVariableData condVar{"Listen"};
+    ListenerTest listener{condVar};
+    ASSERT_FALSE(listener.attachEvent(sut, createNotificationCallback(Timer_test::callback, counter)).has_error());
+    sut.start();
+
+    deadline_timer timeout{5_s};
+    while (counter.load() < NUMBER_OF_EXPIRATIONS && !timeout.hasExpired())
+    {
+        std::this_thread::yield();
+    }
+    listener.detachEvent(sut);
+
+    EXPECT_THAT(counter.load(), Ge(NUMBER_OF_EXPIRATIONS));
+    EXPECT_FALSE(sut.isRunning());
+}
+} // namespace
@@ -0,0 +1,203 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/popo/building_blocks/timer_queue.hpp"
+#include "iox/vector.hpp"
+
+#include "test.hpp"
+
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::popo;
+using namespace iox::units::duration_literals;
+
+class TimerQueue_test : public Test
+{
+  public:
+    vector<uint64_t, TimerQueue::CAPACITY> expire()
+    {
+        vector<uint64_t, TimerQueue::CAPACITY> expiredTimers;
+        m_sut.expire([&](const uint64_t index) { expiredTimers.emplace_back(index); });
+        return expiredTimers;
+    }
+
+    TimerQueue m_sut;
+};
+
+TEST_F(TimerQueue_test, HasNoNextExpirationWhenNoTimerIsRunning)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f8fcc95f-e4d4-4514-93a1-691b4bdca510");
+    EXPECT_FALSE(m_sut.timeUntilNextExpiration().has_value());
+    EXPECT_FALSE(m_sut.isRunning(0U));
+    EXPECT_TRUE(expire().empty());
+}
+
+TEST_F(TimerQueue_test, StartedTimerIsRunning)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "adedadd3-4a39-41e1-b551-5dce77f0aea9");
+    m_sut.start(3U, 1_h, TimerMode::PERIODIC);
+
+    EXPECT_TRUE(m_sut.isRunning(3U));
+    EXPECT_FALSE(m_sut.isRunning(2U));
+}
+
+TEST_F(TimerQueue_test, NextExpirationIsTheEarliestDeadline)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dbc223e5-de72-4b00-a2cd-118b89ee3d1a");
+    m_sut.start(0U, 3_h, TimerMode::PERIODIC);
+    m_sut.start(1U, 1_h, TimerMode::PERIODIC);
+    m_sut.start(2U, 2_h, TimerMode::ONE_SHOT);
+
+    auto timeUntilNextExpiration = m_sut.timeUntilNextExpiration();
+    ASSERT_TRUE(timeUntilNextExpiration.has_value());
+    EXPECT_THAT(timeUntilNextExpiration.value(), Le(1_h));
+    EXPECT_THAT(timeUntilNextExpiration.value(), Gt(59_m));
+}
+
+TEST_F(TimerQueue_test, StoppedTimerDoesNotDefineNextExpiration)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0932953e-84fc-464b-8af5-1da1f1cf2042");
+    m_sut.start(0U, 3_h, TimerMode::PERIODIC);
+    m_sut.start(1U, 1_h, TimerMode::PERIODIC);
+    m_sut.stop(1U);
+
+    EXPECT_FALSE(m_sut.isRunning(1U));
+    auto timeUntilNextExpiration = m_sut.timeUntilNextExpiration();
+    ASSERT_TRUE(timeUntilNextExpiration.has_value());
+    EXPECT_THAT(timeUntilNextExpiration.value(), Gt(2_h));
+}
+
+TEST_F(TimerQueue_test, StoppingTimerWhichIsNotRunningHasNoEffect)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7b272f94-55e9-43bc-a534-8a562d0ddb49");
+    m_sut.start(0U, 1_h, TimerMode::PERIODIC);
+    m_sut.stop(1U);
+
+    EXPECT_TRUE(m_sut.isRunning(0U));
+    EXPECT_TRUE(m_sut.timeUntilNextExpiration().has_value());
+}
+
+TEST_F(TimerQueue_test, RestartingTimerMovesItsDeadline)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "238c7e5e-d800-4367-90e2-54995e3b7a65");
+    m_sut.start(0U, 1_h, TimerMode::PERIODIC);
+    m_sut.start(0U, 1_ms, TimerMode::PERIODIC);
+
+    auto timeUntilNextExpiration = m_sut.timeUntilNextExpiration();
+    ASSERT_TRUE(timeUntilNextExpiration.has_value());
+    EXPECT_THAT(timeUntilNextExpiration.value(), Le(1_ms));
+}
+
+TEST_F(TimerQueue_test, TimerDoesNotExpireBeforeDeadline)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "60dbc825-7b1e-44b2-b8f9-fb59c4421421");
+    m_sut.start(0U, 1_h, TimerMode::ONE_SHOT);
+
+    EXPECT_TRUE(expire().empty());
+    EXPECT_TRUE(m_sut.isRunning(0U));
+}
+
+TEST_F(TimerQueue_test, ExpiredOneShotTimerIsStopped)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "94395840-33af-483b-8485-61763a7f750e");
+    m_sut.start(5U, 1_ms, TimerMode::ONE_SHOT);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+
+    auto expiredTimers = expire();
+    ASSERT_THAT(expiredTimers.size(), Eq(1U));
+    EXPECT_THAT(expiredTimers[0], Eq(5U));
+    EXPECT_FALSE(m_sut.isRunning(5U));
+    EXPECT_FALSE(m_sut.timeUntilNextExpiration().has_value());
+}
+
+TEST_F(TimerQueue_test, ExpiredPeriodicTimerKeepsRunning)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1997dddc-9974-4adb-b129-3beedcb055ac");
+    m_sut.start(2U, 1_ms, TimerMode::PERIODIC);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+
+    auto expiredTimers = expire();
+    ASSERT_THAT(expiredTimers.size(), Eq(1U));
+    EXPECT_THAT(expiredTimers[0], Eq(2U));
+    EXPECT_TRUE(m_sut.isRunning(2U));
+    EXPECT_TRUE(m_sut.timeUntilNextExpiration().has_value());
+}
+
+TEST_F(TimerQueue_test, PeriodicTimerWithMissedDeadlinesExpiresOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "58bbd285-cf0b-418c-bddb-d2d081de806a");
+    m_sut.start(0U, 1_ms, TimerMode::PERIODIC);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    EXPECT_THAT(expire().size(), Eq(1U));
+    EXPECT_TRUE(expire().empty());
+}
+
+TEST_F(TimerQueue_test, PeriodicTimerDoesNotDriftWhenExpiredLate)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bb428d25-bb74-47f8-9c65-457c9e36c836");
+    constexpr auto PERIOD = 100_ms;
+    m_sut.start(0U, PERIOD, TimerMode::PERIODIC);
+    std::this_thread::sleep_for(std::chrono::milliseconds(130));
+
+    ASSERT_THAT(expire().size(), Eq(1U));
+    // the next deadline is two periods after the start and not one period after the late expiration
+    auto timeUntilNextExpiration = m_sut.timeUntilNextExpiration();
+    ASSERT_TRUE(timeUntilNextExpiration.has_value());
+    EXPECT_THAT(timeUntilNextExpiration.value(), Le(70_ms));
+}
+
+TEST_F(TimerQueue_test, OnlyExpiredTimersAreReported)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4d19a2e0-7097-4d1d-bf8a-6d0bdd172267");
+    m_sut.start(0U, 1_h, TimerMode::PERIODIC);
+    m_sut.start(1U, 1_ms, TimerMode::ONE_SHOT);
+    m_sut.start(2U, 2_h, TimerMode::ONE_SHOT);
+    m_sut.start(3U, 2_ms, TimerMode::PERIODIC);
+    std::this_thread::sleep_for(std::chrono::milliseconds(3));
+
+    auto expiredTimers = expire();
+    ASSERT_THAT(expiredTimers.size(), Eq(2U));
+    EXPECT_THAT(expiredTimers[0], Eq(1U));
+    EXPECT_THAT(expiredTimers[1], Eq(3U));
+    EXPECT_TRUE(m_sut.isRunning(0U));
+    EXPECT_FALSE(m_sut.isRunning(1U));
+    EXPECT_TRUE(m_sut.isRunning(2U));
+    EXPECT_TRUE(m_sut.isRunning(3U));
+}
+
+TEST_F(TimerQueue_test, AllTimersCanBeStartedAndStopped)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "14fd8028-5d77-4e17-8c28-4156b5ff7c26");
+    for (uint64_t i = 0U; i < TimerQueue::CAPACITY; ++i)
+    {
+        m_sut.start(i, units::Duration::fromHours(TimerQueue::CAPACITY - i), TimerMode::PERIODIC);
+    }
+    for (uint64_t i = TimerQueue::CAPACITY - 1U; i > 0U; --i)
+    {
+        m_sut.stop(i);
+    }
+
+    auto timeUntilNextExpiration = m_sut.timeUntilNextExpiration();
+    ASSERT_TRUE(timeUntilNextExpiration.has_value());
+    EXPECT_THAT(timeUntilNextExpiration.value(), Gt(units::Duration::fromHours(TimerQueue::CAPACITY - 1U)));
+}
+} // namespace
@@ -108,6 +108,21 @@ TEST_F(UntypedPublisherTest, LoanFailsIfPortCannotSatisfyAllocationRequest)
     // ===== Cleanup ===== //
 }
 
+TEST_F(UntypedPublisherTest, LoanChainedDelegatesCallToPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "414db119-6408-43cd-aa38-48c23ad9452e");
+    constexpr uint64_t USER_PAYLOAD_SIZE = 1000000U;
+    constexpr uint32_t USER_PAYLOAD_ALIGNMENT = 16U;
+    EXPECT_CALL(portMock, tryAllocateChainedChunk(USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT))
+        .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))));
+    // ===== Test ===== //
+    auto result = sut.loanChained(USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT);
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value(), chunkMock.chunkHeader()->userPayload());
+    // ===== Cleanup ===== //
+}
+
 TEST_F(UntypedPublisherTest, ReleaseDelegatesCallToPort)
 {
     ::testing::Test::RecordProperty("TEST_ID", "e114b083-10c7-403e-a841-a04487a5f1e0");
@@ -139,6 +154,36 @@ TEST_F(UntypedPublisherTest, PublishesUserPayloadViaUnderlyingPort)
 
 // test whether the BasePublisher methods are called
 
+TEST_F(UntypedPublisherTest, PublishStreamingCopyOfCopiesUserPayloadAndPublishesViaUnderlyingPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3fdae5e7-fb9b-4813-ace4-0fc5be7f12fd");
+    constexpr uint64_t USER_PAYLOAD{0xC0FFEE};
+    EXPECT_CALL(portMock, tryAllocateChunk(sizeof(USER_PAYLOAD), alignof(uint64_t), _, _))
+        .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))));
+    EXPECT_CALL(portMock, sendChunk(chunkMock.chunkHeader()));
+    // ===== Test ===== //
+    auto result = sut.publishStreamingCopyOf(&USER_PAYLOAD, sizeof(USER_PAYLOAD), alignof(uint64_t));
+    // ===== Verify ===== //
+    EXPECT_FALSE(result.has_error());
+    EXPECT_EQ(*chunkMock.sample(), USER_PAYLOAD);
+    // ===== Cleanup ===== //
+}
+
+TEST_F(UntypedPublisherTest, PublishStreamingCopyOfFailsIfPortCannotSatisfyAllocationRequest)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f10e1ffe-9970-4ceb-b77b-3bac2b2c3c1d");
+    constexpr uint64_t USER_PAYLOAD{0xC0FFEE};
+    EXPECT_CALL(portMock, tryAllocateChunk(sizeof(USER_PAYLOAD), _, _, _))
+        .WillOnce(Return(ByMove(iox::err(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS))));
+    EXPECT_CALL(portMock, sendChunk(_)).Times(0);
+    // ===== Test ===== //
+    auto result = sut.publishStreamingCopyOf(&USER_PAYLOAD, sizeof(USER_PAYLOAD));
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS, result.error());
+    // ===== Cleanup ===== //
+}
+
 TEST_F(UntypedPublisherTest, OfferDoesOfferServiceOnUnderlyingPort)
 {
     ::testing::Test::RecordProperty("TEST_ID", "cd396859-0677-4289-8f6b-7c955b9a7a03");
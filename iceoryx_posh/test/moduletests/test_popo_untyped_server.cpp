@@ -138,6 +138,40 @@ TEST_F(UntypedServer_test, LoanCallsUnderlyingPortWithErrorResult)
     EXPECT_THAT(loanResult.error(), Eq(ALLOCATION_ERROR));
 }
 
+TEST_F(UntypedServer_test, LoanInPlaceCallsUnderlyingPortWithSuccessResult)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "52edacd3-5ee8-4d32-a731-3dccb4be1bfd");
+
+    constexpr uint64_t PAYLOAD_SIZE{8U};
+    constexpr uint32_t PAYLOAD_ALIGNMENT{32U};
+    const iox::expected<ResponseHeader*, AllocationError> allocateResponseResult =
+        iox::ok<ResponseHeader*>(responseMock.userHeader());
+
+    EXPECT_CALL(sut.mockPort, allocateResponseInPlace(requestMock.userHeader(), PAYLOAD_SIZE, PAYLOAD_ALIGNMENT))
+        .WillOnce(Return(allocateResponseResult));
+
+    auto loanResult = sut.loanInPlace(requestMock.sample(), PAYLOAD_SIZE, PAYLOAD_ALIGNMENT);
+    ASSERT_FALSE(loanResult.has_error());
+    EXPECT_THAT(loanResult.value(), Eq(responseMock.sample()));
+}
+
+TEST_F(UntypedServer_test, LoanInPlaceCallsUnderlyingPortWithErrorResult)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "66f421ab-18a9-4772-a0b4-3f2146ca595d");
+
+    constexpr uint64_t PAYLOAD_SIZE{8U};
+    constexpr uint32_t PAYLOAD_ALIGNMENT{32U};
+    constexpr AllocationError ALLOCATION_ERROR{AllocationError::RUNNING_OUT_OF_CHUNKS};
+    const iox::expected<ResponseHeader*, AllocationError> allocateResponseResult = iox::err(ALLOCATION_ERROR);
+
+    EXPECT_CALL(sut.mockPort, allocateResponseInPlace(requestMock.userHeader(), PAYLOAD_SIZE, PAYLOAD_ALIGNMENT))
+        .WillOnce(Return(allocateResponseResult));
+
+    auto loanResult = sut.loanInPlace(requestMock.sample(), PAYLOAD_SIZE, PAYLOAD_ALIGNMENT);
+    ASSERT_TRUE(loanResult.has_error());
+    EXPECT_THAT(loanResult.error(), Eq(ALLOCATION_ERROR));
+}
+
 TEST_F(UntypedServer_test, SendWithValidPayloadPointerCallsUnderlyingPort)
 {
     ::testing::Test::RecordProperty("TEST_ID", "707cfdd8-05ae-490c-8cbb-9a4253135937");
@@ -39,6 +39,7 @@ bool operator==(const CmdLineArgs_t& lhs, const CmdLineArgs_t& rhs)
            && (lhs.roudiConfig.compatibilityCheckLevel == rhs.roudiConfig.compatibilityCheckLevel)
            && (lhs.roudiConfig.processTerminationDelay == rhs.roudiConfig.processTerminationDelay)
            && (lhs.roudiConfig.processKillDelay == rhs.roudiConfig.processKillDelay)
+           && (lhs.roudiConfig.runtimeMessageWorkerCount == rhs.roudiConfig.runtimeMessageWorkerCount)
            && (lhs.roudiConfig.domainId == rhs.roudiConfig.domainId)
            && (lhs.roudiConfig.uniqueRouDiId == rhs.roudiConfig.uniqueRouDiId) && (lhs.run == rhs.run)
            && (lhs.configFilePath == rhs.configFilePath);
@@ -203,11 +204,11 @@ TEST_F(CmdLineParser_test, MonitoringModeOptionsLeadToCorrectMode)
 {
     ::testing::Test::RecordProperty("TEST_ID", "362435bb-c35b-4617-b08b-17c359543c69");
     constexpr uint8_t NUMBER_OF_ARGS{3U};
-    MonitoringMode modeArray[] = {MonitoringMode::ON, MonitoringMode::OFF};
+    MonitoringMode modeArray[] = {MonitoringMode::ON, MonitoringMode::OFF, MonitoringMode::HEARTBEAT};
     char* args[NUMBER_OF_ARGS];
     char appName[] = "./foo";
     char optionArray[][20] = {"-m", "--monitoring-mode"};
-    char valueArray[][10] = {"on", "off"};
+    char valueArray[][10] = {"on", "off", "heartbeat"};
     args[0] = &appName[0];
 
     for (auto optionValue : optionArray)
@@ -409,6 +410,71 @@ TEST_F(CmdLineParser_test, TerminationDelayOptionOutOfBoundsLeadsToError)
     EXPECT_THAT(result.error(), Eq(CmdLineParserResult::INVALID_PARAMETER));
 }
 
+TEST_F(CmdLineParser_test, RuntimeMessageWorkersLongOptionLeadsToCorrectWorkerCount)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9d54db0d-819b-4c2a-981a-8d425c0589c1");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "--runtime-message-workers";
+    char value[] = "13";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value().roudiConfig.runtimeMessageWorkerCount, 13U);
+    EXPECT_TRUE(result.value().run);
+}
+
+TEST_F(CmdLineParser_test, RuntimeMessageWorkersShortOptionLeadsToCorrectWorkerCount)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "af8a9875-0aae-4ae4-9149-355f9fe0271e");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "-w";
+    char value[] = "1";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value().roudiConfig.runtimeMessageWorkerCount, 1U);
+    EXPECT_TRUE(result.value().run);
+}
+
+TEST_F(CmdLineParser_test, RuntimeMessageWorkersOptionOutOfBoundsLeadsToError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f9f1c030-ceeb-4e55-a7b7-fe215739c160");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "--runtime-message-workers";
+    char zeroValue[] = "0";
+    char tooLargeValue[] = "65"; // MAX_RUNTIME_MESSAGE_WORKER_COUNT + 1
+    args[0] = &appName[0];
+    args[1] = &option[0];
+
+    for (auto value : {&zeroValue[0], &tooLargeValue[0]})
+    {
+        args[2] = value;
+        optind = 0;
+
+        CmdLineParser sut;
+        auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+        ASSERT_TRUE(result.has_error());
+        EXPECT_THAT(result.error(), Eq(CmdLineParserResult::INVALID_PARAMETER));
+    }
+}
+
 TEST_F(CmdLineParser_test, CompatibilityLevelOptionsLeadToCorrectCompatibilityLevel)
 {
     ::testing::Test::RecordProperty("TEST_ID", "62b7d5c9-0638-4314-b4f7-c622ef101045");
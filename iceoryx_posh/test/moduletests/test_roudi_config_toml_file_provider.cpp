@@ -98,6 +98,81 @@ TEST_F(RoudiConfigTomlFileProvider_test, ParsingFileIsSuccessful)
     });
 }
 
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingNumaPlacementOfSegmentsIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f9849fff-151e-4cfa-9151-4bc3fa8803e9");
+
+    std::istringstream stream(R"([general]
+        version = 1
+
+        [[segment]]
+        numa-node = 1
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+
+        [[segment]]
+        numa-interleave = true
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+    )");
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    const auto& segments = result->m_sharedMemorySegments;
+    ASSERT_THAT(segments.size(), Eq(3U));
+    EXPECT_THAT(segments[0].m_numaPlacement.policy, Eq(iox::NumaPolicy::BIND));
+    EXPECT_THAT(segments[0].m_numaPlacement.node, Eq(1U));
+    EXPECT_THAT(segments[1].m_numaPlacement.policy, Eq(iox::NumaPolicy::INTERLEAVE));
+    EXPECT_THAT(segments[2].m_numaPlacement.policy, Eq(iox::NumaPolicy::DEFAULT));
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingTrafficClassOfSegmentsIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "55e7f4b6-4827-46ce-9f25-8b3ca60fb4e2");
+
+    std::istringstream stream(R"([general]
+        version = 1
+
+        [[segment]]
+        traffic-class = "latency-critical"
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+
+        [[segment]]
+        traffic-class = "bulk"
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+    )");
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    const auto& segments = result->m_sharedMemorySegments;
+    ASSERT_THAT(segments.size(), Eq(3U));
+    EXPECT_THAT(segments[0].m_trafficClass, Eq(iox::mepoo::TrafficClass::LATENCY_CRITICAL));
+    EXPECT_THAT(segments[1].m_trafficClass, Eq(iox::mepoo::TrafficClass::BULK));
+    EXPECT_THAT(segments[2].m_trafficClass, Eq(iox::mepoo::TrafficClass::UNSPECIFIED));
+}
+
 constexpr const char* CONFIG_NO_GENERAL_SECTION = R"(
     [[segment]]
 
@@ -181,6 +256,31 @@ constexpr const char* CONFIG_MEMPOOL_WITHOUT_CHUNK_COUNT = R"(
     size = 128
 )";
 
+constexpr const char* CONFIG_SEGMENT_WITH_CONFLICTING_NUMA_PLACEMENT = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+    numa-node = 0
+    numa-interleave = true
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+)";
+
+constexpr const char* CONFIG_SEGMENT_WITH_INVALID_TRAFFIC_CLASS = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+    traffic-class = "hypnotoad"
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+)";
+
 constexpr const char* CONFIG_EXCEPTION_IN_PARSER = R"(🐔)";
 
 INSTANTIATE_TEST_SUITE_P(
@@ -200,6 +300,10 @@ INSTANTIATE_TEST_SUITE_P(
                                  CONFIG_MEMPOOL_WITHOUT_CHUNK_SIZE},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::MEMPOOL_WITHOUT_CHUNK_COUNT,
                                  CONFIG_MEMPOOL_WITHOUT_CHUNK_COUNT},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::SEGMENT_WITH_CONFLICTING_NUMA_PLACEMENT,
+                                 CONFIG_SEGMENT_WITH_CONFLICTING_NUMA_PLACEMENT},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::SEGMENT_WITH_INVALID_TRAFFIC_CLASS,
+                                 CONFIG_SEGMENT_WITH_INVALID_TRAFFIC_CLASS},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::EXCEPTION_IN_PARSER,
                                  CONFIG_EXCEPTION_IN_PARSER}));
 
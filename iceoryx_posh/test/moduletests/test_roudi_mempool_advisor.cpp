@@ -0,0 +1,115 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/roudi/mempool_advisor.hpp"
+
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iox/bump_allocator.hpp"
+
+#include "test.hpp"
+
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+
+using namespace iox::roudi;
+
+ChunkSizeClassInfo sizeClass(const uint64_t chunkSize, const uint64_t numRequests, const uint32_t peakChunksInUse)
+{
+    ChunkSizeClassInfo info;
+    info.m_chunkSize = chunkSize;
+    info.m_numRequests = numRequests;
+    info.m_peakChunksInUse = peakChunksInUse;
+    return info;
+}
+
+TEST(MemPoolAdvisor_test, EmptyHistogramResultsInEmptyConfig)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bbc5b782-06f0-4800-aa4b-311cf453abef");
+    ChunkSizeHistogramContainer histogram;
+
+    EXPECT_TRUE(adviseMePooConfig(histogram, DEFAULT_MEMPOOL_ADVISOR_HEADROOM_PERCENT).m_mempoolConfig.empty());
+}
+
+TEST(MemPoolAdvisor_test, EachRequestedSizeClassResultsInOneMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1278e54e-9b42-498e-8158-fcd86a55becd");
+    ChunkSizeHistogramContainer histogram;
+    histogram.emplace_back(sizeClass(128U, 1000U, 10U));
+    histogram.emplace_back(sizeClass(1024U, 5U, 4U));
+
+    constexpr uint32_t NO_HEADROOM{0U};
+    const auto config = adviseMePooConfig(histogram, NO_HEADROOM);
+
+    ASSERT_THAT(config.m_mempoolConfig.size(), Eq(2U));
+    EXPECT_THAT(config.m_mempoolConfig[0].m_size, Eq(128U - sizeof(iox::mepoo::ChunkHeader)));
+    EXPECT_THAT(config.m_mempoolConfig[0].m_chunkCount, Eq(10U));
+    EXPECT_THAT(config.m_mempoolConfig[1].m_size, Eq(1024U - sizeof(iox::mepoo::ChunkHeader)));
+    EXPECT_THAT(config.m_mempoolConfig[1].m_chunkCount, Eq(4U));
+}
+
+TEST(MemPoolAdvisor_test, SizeClassesWithoutRequestsAreSkipped)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "06729fee-2574-4f8b-b291-d9f5c97db691");
+    ChunkSizeHistogramContainer histogram;
+    histogram.emplace_back(sizeClass(128U, 0U, 0U));
+    histogram.emplace_back(sizeClass(256U, 3U, 1U));
+
+    const auto config = adviseMePooConfig(histogram, DEFAULT_MEMPOOL_ADVISOR_HEADROOM_PERCENT);
+
+    ASSERT_THAT(config.m_mempoolConfig.size(), Eq(1U));
+    EXPECT_THAT(config.m_mempoolConfig[0].m_size, Eq(256U - sizeof(iox::mepoo::ChunkHeader)));
+}
+
+TEST(MemPoolAdvisor_test, HeadroomIsAddedAndRoundedUp)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "404fda9a-c802-447f-83ea-f3e7e1228dd4");
+    ChunkSizeHistogramContainer histogram;
+    histogram.emplace_back(sizeClass(128U, 100U, 10U));
+    histogram.emplace_back(sizeClass(256U, 100U, 3U));
+
+    constexpr uint32_t HEADROOM_PERCENT{25U};
+    const auto config = adviseMePooConfig(histogram, HEADROOM_PERCENT);
+
+    ASSERT_THAT(config.m_mempoolConfig.size(), Eq(2U));
+    EXPECT_THAT(config.m_mempoolConfig[0].m_chunkCount, Eq(13U));
+    EXPECT_THAT(config.m_mempoolConfig[1].m_chunkCount, Eq(4U));
+}
+
+TEST(MemPoolAdvisor_test, AdvisedMemPoolsCanBeUsedToConfigureAMemoryManager)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "da8ac75b-744c-429d-9084-45e7fe675fc1");
+    ChunkSizeHistogramContainer histogram;
+    histogram.emplace_back(sizeClass(64U, 10U, 2U));
+    histogram.emplace_back(sizeClass(80U, 10U, 2U));
+    histogram.emplace_back(sizeClass(112U, 10U, 2U));
+
+    const auto config = adviseMePooConfig(histogram, DEFAULT_MEMPOOL_ADVISOR_HEADROOM_PERCENT);
+
+    ASSERT_THAT(config.m_mempoolConfig.size(), Eq(3U));
+    const auto memorySize = iox::mepoo::MemoryManager::requiredFullMemorySize(config);
+    std::vector<uint64_t> memory(memorySize / sizeof(uint64_t) + 1U);
+    iox::BumpAllocator allocator(memory.data(), memorySize);
+    iox::mepoo::MemoryManager memoryManager;
+    memoryManager.configureMemoryManager(config, allocator, allocator);
+
+    EXPECT_THAT(memoryManager.getNumberOfMemPools(), Eq(3U));
+}
+
+} // namespace
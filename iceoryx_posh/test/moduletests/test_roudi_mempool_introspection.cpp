@@ -72,6 +72,25 @@ class SegmentMock
         return iox::PosixGroup::getGroupOfCurrentProcess();
     }
 
+    iox::NumaPlacement getNumaPlacement() const
+    {
+        return numaPlacement;
+    }
+
+    iox::optional<uint32_t> getNumaNode() const
+    {
+        return numaNode;
+    }
+
+    iox::mepoo::TrafficClass getTrafficClass() const
+    {
+        return trafficClass;
+    }
+
+    iox::NumaPlacement numaPlacement;
+    iox::optional<uint32_t> numaNode;
+    iox::mepoo::TrafficClass trafficClass{iox::mepoo::TrafficClass::UNSPECIFIED};
+
   private:
     MePooMemoryManager_MOCK memoryManager;
 };
@@ -15,7 +15,9 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iceoryx_platform/signal.hpp"
 #include "iceoryx_platform/types.hpp"
+#include "iceoryx_platform/wait.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/roudi/process_manager.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_creator.hpp"
@@ -28,6 +30,9 @@
 #include "iox/string.hpp"
 #include "test.hpp"
 
+#include <chrono>
+#include <thread>
+
 namespace
 {
 using namespace ::testing;
@@ -171,4 +176,44 @@ TEST_F(ProcessManager_test, HandleProcessShutdownPreparationRequestWorks)
     ASSERT_FALSE(publisher.isOffered());
 }
 
+#if defined(__linux__)
+TEST_F(ProcessManager_test, TerminatedProcessIsRemovedWithProcessTerminationMonitor)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "92f6d8cb-ff49-494f-b0b7-61caa3a6e674");
+    concurrent::Atomic<bool> terminationDetected{false};
+    m_sut->enableProcessTerminationMonitor([&] { terminationDetected.store(true); });
+
+    auto pid = fork();
+    ASSERT_THAT(pid, Ne(-1));
+    if (pid == 0)
+    {
+        while (true)
+        {
+            pause();
+        }
+    }
+    ASSERT_TRUE(
+        m_sut->registerProcess(m_processname, static_cast<uint32_t>(pid), m_user, m_isMonitored, 1U, 1U, m_versionInfo));
+
+    kill(pid, SIGKILL);
+    waitpid(pid, nullptr, 0);
+
+    // without pidfd support the process is monitored with a heartbeat, which is not triggered here
+    constexpr std::chrono::milliseconds TIMEOUT{5000};
+    auto deadline = std::chrono::steady_clock::now() + TIMEOUT;
+    while (!terminationDetected.load() && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    if (!terminationDetected.load())
+    {
+        GTEST_SKIP() << "pidfds are not supported by the kernel";
+    }
+
+    m_sut->run();
+
+    EXPECT_THAT(m_sut->registeredProcessCount(), Eq(0));
+}
+#endif
+
 } // namespace
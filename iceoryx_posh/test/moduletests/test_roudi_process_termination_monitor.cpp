@@ -0,0 +1,192 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#if defined(__linux__)
+
+#include "iceoryx_platform/signal.hpp"
+#include "iceoryx_platform/unistd.hpp"
+#include "iceoryx_platform/wait.hpp"
+#include "iceoryx_posh/internal/roudi/process_termination_monitor.hpp"
+#include "iox/atomic.hpp"
+
+#include "test.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::roudi;
+
+class ProcessTerminationMonitor_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        if (!m_sut.isSupported())
+        {
+            GTEST_SKIP() << "pidfds are not supported by the kernel";
+        }
+    }
+
+    void TearDown() override
+    {
+        for (auto pid : m_children)
+        {
+            kill(pid, SIGKILL);
+            waitpid(pid, nullptr, 0);
+        }
+    }
+
+    pid_t spawnChild()
+    {
+        auto pid = fork();
+        if (pid == 0)
+        {
+            while (true)
+            {
+                pause();
+            }
+        }
+        m_children.emplace_back(pid);
+        return pid;
+    }
+
+    void killChild(const pid_t pid)
+    {
+        kill(pid, SIGKILL);
+        waitpid(pid, nullptr, 0);
+        m_children.erase(std::remove(m_children.begin(), m_children.end(), pid), m_children.end());
+    }
+
+    bool waitForTermination()
+    {
+        constexpr std::chrono::milliseconds TIMEOUT{5000};
+        constexpr std::chrono::milliseconds POLL_INTERVAL{1};
+        auto deadline = std::chrono::steady_clock::now() + TIMEOUT;
+        while (!m_terminationDetected.load() && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(POLL_INTERVAL);
+        }
+        return m_terminationDetected.load();
+    }
+
+    std::vector<pid_t> m_children;
+    concurrent::Atomic<bool> m_terminationDetected{false};
+    ProcessTerminationMonitor m_sut{[this] { m_terminationDetected.store(true); }};
+};
+
+TEST_F(ProcessTerminationMonitor_test, AddingRunningProcessSucceeds)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1df53117-ba1d-47ef-83df-c8d7aba41063");
+    auto pid = spawnChild();
+
+    EXPECT_TRUE(m_sut.addProcess(static_cast<uint32_t>(pid)));
+}
+
+TEST_F(ProcessTerminationMonitor_test, AddingProcessTwiceFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5a074b66-bf83-47d7-b6cc-55edcbe8fe1c");
+    auto pid = spawnChild();
+
+    ASSERT_TRUE(m_sut.addProcess(static_cast<uint32_t>(pid)));
+    EXPECT_FALSE(m_sut.addProcess(static_cast<uint32_t>(pid)));
+}
+
+TEST_F(ProcessTerminationMonitor_test, AddingNonExistingProcessFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4f1ce970-ffbe-4b37-b10d-362a934555e3");
+    auto pid = spawnChild();
+    killChild(pid);
+
+    EXPECT_FALSE(m_sut.addProcess(static_cast<uint32_t>(pid)));
+}
+
+TEST_F(ProcessTerminationMonitor_test, NoProcessesAreTerminatedInitially)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0c74cb73-120a-4d28-a1e1-451743116ec7");
+    auto pid = spawnChild();
+    ASSERT_TRUE(m_sut.addProcess(static_cast<uint32_t>(pid)));
+
+    EXPECT_TRUE(m_sut.takeTerminatedProcesses().empty());
+}
+
+TEST_F(ProcessTerminationMonitor_test, TerminationOfProcessIsDetected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "90724c2e-9e6d-4709-98e4-b1e53efc8811");
+    auto pid = spawnChild();
+    auto otherPid = spawnChild();
+    ASSERT_TRUE(m_sut.addProcess(static_cast<uint32_t>(pid)));
+    ASSERT_TRUE(m_sut.addProcess(static_cast<uint32_t>(otherPid)));
+
+    killChild(pid);
+
+    ASSERT_TRUE(waitForTermination());
+    auto terminatedProcesses = m_sut.takeTerminatedProcesses();
+    ASSERT_THAT(terminatedProcesses.size(), Eq(1U));
+    EXPECT_THAT(terminatedProcesses[0], Eq(static_cast<uint32_t>(pid)));
+    EXPECT_TRUE(m_sut.takeTerminatedProcesses().empty());
+}
+
+TEST_F(ProcessTerminationMonitor_test, TerminatedProcessCanBeAddedAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6e420da8-0bcd-4e6e-ba60-efc7b54c7ef3");
+    auto pid = spawnChild();
+    ASSERT_TRUE(m_sut.addProcess(static_cast<uint32_t>(pid)));
+    m_sut.removeProcess(static_cast<uint32_t>(pid));
+
+    EXPECT_TRUE(m_sut.addProcess(static_cast<uint32_t>(pid)));
+}
+
+TEST_F(ProcessTerminationMonitor_test, TerminationOfRemovedProcessIsNotReported)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c3b56e30-3962-42cb-a272-d6d3bd76a207");
+    auto pid = spawnChild();
+    auto otherPid = spawnChild();
+    ASSERT_TRUE(m_sut.addProcess(static_cast<uint32_t>(pid)));
+    ASSERT_TRUE(m_sut.addProcess(static_cast<uint32_t>(otherPid)));
+    m_sut.removeProcess(static_cast<uint32_t>(pid));
+
+    killChild(pid);
+    killChild(otherPid);
+
+    ASSERT_TRUE(waitForTermination());
+    auto terminatedProcesses = m_sut.takeTerminatedProcesses();
+    ASSERT_THAT(terminatedProcesses.size(), Eq(1U));
+    EXPECT_THAT(terminatedProcesses[0], Eq(static_cast<uint32_t>(otherPid)));
+}
+
+TEST_F(ProcessTerminationMonitor_test, PendingTerminationIsDiscardedWhenProcessIsRemoved)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7f5c766f-ca74-46c3-8bdc-3caecee8052e");
+    auto pid = spawnChild();
+    ASSERT_TRUE(m_sut.addProcess(static_cast<uint32_t>(pid)));
+
+    killChild(pid);
+    ASSERT_TRUE(waitForTermination());
+    m_sut.removeProcess(static_cast<uint32_t>(pid));
+
+    EXPECT_TRUE(m_sut.takeTerminatedProcesses().empty());
+}
+
+} // namespace
+
+#endif
@@ -0,0 +1,218 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/roudi/runtime_message_dispatcher.hpp"
+#include "iox/atomic.hpp"
+#include "iox/string.hpp"
+
+#include "test.hpp"
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::roudi;
+using namespace iox::runtime;
+
+class RuntimeMessageDispatcher_test : public Test
+{
+  public:
+    static IpcMessage createMessage(const uint64_t sequenceNumber)
+    {
+        IpcMessage message;
+        message << IpcMessageTypeToString(IpcMessageType::REG) << std::to_string(sequenceNumber);
+        return message;
+    }
+
+    bool waitUntil(const std::function<bool()>& condition)
+    {
+        constexpr std::chrono::milliseconds TIMEOUT{5000};
+        auto deadline = std::chrono::steady_clock::now() + TIMEOUT;
+        while (!condition() && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return condition();
+    }
+
+    /// @brief finds a runtime name which is processed by a different worker than the given one
+    static RuntimeName_t runtimeOfOtherWorker(const RuntimeName_t& runtimeName, const uint32_t numberOfWorkers)
+    {
+        const auto worker = RuntimeMessageDispatcher::workerIndex(runtimeName, numberOfWorkers);
+        for (uint32_t i = 0U;; ++i)
+        {
+            RuntimeName_t candidate{TruncateToCapacity, ("runtime" + std::to_string(i)).c_str()};
+            if (RuntimeMessageDispatcher::workerIndex(candidate, numberOfWorkers) != worker)
+            {
+                return candidate;
+            }
+        }
+    }
+
+    std::mutex m_mutex;
+    std::map<std::string, std::vector<std::string>> m_processedMessages;
+    concurrent::Atomic<uint64_t> m_numberOfProcessedMessages{0U};
+};
+
+TEST_F(RuntimeMessageDispatcher_test, NumberOfWorkersIsLimitedToValidRange)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "aff107ec-c2b8-4afe-8601-713f9e95e11a");
+    auto handler = [](const auto&, const auto&, const auto&) {};
+
+    RuntimeMessageDispatcher noWorkers{0U, handler};
+    RuntimeMessageDispatcher someWorkers{3U, handler};
+    RuntimeMessageDispatcher tooManyWorkers{MAX_RUNTIME_MESSAGE_WORKER_COUNT + 1U, handler};
+
+    EXPECT_THAT(noWorkers.numberOfWorkers(), Eq(1U));
+    EXPECT_THAT(someWorkers.numberOfWorkers(), Eq(3U));
+    EXPECT_THAT(tooManyWorkers.numberOfWorkers(), Eq(MAX_RUNTIME_MESSAGE_WORKER_COUNT));
+}
+
+TEST_F(RuntimeMessageDispatcher_test, WorkerIndexOfRuntimeIsStableAndInRange)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "32556e8e-a1b9-46f1-a8fd-3d0ee2705ef4");
+    constexpr uint32_t NUMBER_OF_WORKERS{7U};
+    for (uint32_t i = 0U; i < 100U; ++i)
+    {
+        RuntimeName_t runtimeName{TruncateToCapacity, ("app" + std::to_string(i)).c_str()};
+        auto index = RuntimeMessageDispatcher::workerIndex(runtimeName, NUMBER_OF_WORKERS);
+        EXPECT_THAT(index, Lt(NUMBER_OF_WORKERS));
+        EXPECT_THAT(RuntimeMessageDispatcher::workerIndex(runtimeName, NUMBER_OF_WORKERS), Eq(index));
+    }
+}
+
+TEST_F(RuntimeMessageDispatcher_test, MessagesArePassedToHandler)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2b909d5f-cace-4680-975f-faa85303f63c");
+    const RuntimeName_t runtimeName{"hypnotoad"};
+    IpcMessageType receivedType{IpcMessageType::NOTYPE};
+    RuntimeName_t receivedRuntimeName;
+    std::string receivedSequenceNumber;
+    RuntimeMessageDispatcher sut{2U, [&](const auto& message, const auto& cmd, const auto& name) {
+                                     receivedType = cmd;
+                                     receivedRuntimeName = name;
+                                     receivedSequenceNumber = message.getElementAtIndex(1);
+                                     m_numberOfProcessedMessages.fetch_add(1U);
+                                 }};
+
+    sut.dispatch(createMessage(42U), IpcMessageType::REG, runtimeName);
+
+    ASSERT_TRUE(waitUntil([&] { return m_numberOfProcessedMessages.load() == 1U; }));
+    EXPECT_THAT(receivedType, Eq(IpcMessageType::REG));
+    EXPECT_THAT(receivedRuntimeName, Eq(runtimeName));
+    EXPECT_THAT(receivedSequenceNumber, Eq("42"));
+}
+
+TEST_F(RuntimeMessageDispatcher_test, MessagesOfRuntimeAreProcessedInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ba033151-180a-4ad0-b81c-408539382b20");
+    constexpr uint64_t NUMBER_OF_RUNTIMES{10U};
+    constexpr uint64_t MESSAGES_PER_RUNTIME{200U};
+    RuntimeMessageDispatcher sut{4U, [&](const auto& message, const auto&, const auto& name) {
+                                     std::lock_guard<std::mutex> lock(m_mutex);
+                                     m_processedMessages[name.c_str()].emplace_back(message.getElementAtIndex(1));
+                                     m_numberOfProcessedMessages.fetch_add(1U);
+                                 }};
+
+    for (uint64_t i = 0U; i < MESSAGES_PER_RUNTIME; ++i)
+    {
+        for (uint64_t runtime = 0U; runtime < NUMBER_OF_RUNTIMES; ++runtime)
+        {
+            RuntimeName_t runtimeName{TruncateToCapacity, ("app" + std::to_string(runtime)).c_str()};
+            sut.dispatch(createMessage(i), IpcMessageType::REG, runtimeName);
+        }
+    }
+
+    ASSERT_TRUE(waitUntil(
+        [&] { return m_numberOfProcessedMessages.load() == NUMBER_OF_RUNTIMES * MESSAGES_PER_RUNTIME; }));
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ASSERT_THAT(m_processedMessages.size(), Eq(NUMBER_OF_RUNTIMES));
+    for (const auto& runtime : m_processedMessages)
+    {
+        ASSERT_THAT(runtime.second.size(), Eq(MESSAGES_PER_RUNTIME));
+        for (uint64_t i = 0U; i < MESSAGES_PER_RUNTIME; ++i)
+        {
+            EXPECT_THAT(runtime.second[i], Eq(std::to_string(i)));
+        }
+    }
+}
+
+TEST_F(RuntimeMessageDispatcher_test, BlockedRuntimeDoesNotBlockRuntimesOfOtherWorkers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "368477be-dbe9-4c8b-b8c7-1a195066c74b");
+    constexpr uint32_t NUMBER_OF_WORKERS{2U};
+    const RuntimeName_t blockedRuntime{"blocked"};
+    const RuntimeName_t otherRuntime = runtimeOfOtherWorker(blockedRuntime, NUMBER_OF_WORKERS);
+    concurrent::Atomic<bool> unblock{false};
+    concurrent::Atomic<bool> otherRuntimeProcessed{false};
+    RuntimeMessageDispatcher sut{NUMBER_OF_WORKERS, [&](const auto&, const auto&, const auto& name) {
+                                     if (name == blockedRuntime)
+                                     {
+                                         while (!unblock.load())
+                                         {
+                                             std::this_thread::yield();
+                                         }
+                                     }
+                                     else
+                                     {
+                                         otherRuntimeProcessed.store(true);
+                                     }
+                                 }};
+
+    sut.dispatch(createMessage(0U), IpcMessageType::REG, blockedRuntime);
+    sut.dispatch(createMessage(0U), IpcMessageType::REG, otherRuntime);
+
+    EXPECT_TRUE(waitUntil([&] { return otherRuntimeProcessed.load(); }));
+    unblock.store(true);
+}
+
+TEST_F(RuntimeMessageDispatcher_test, PendingMessagesAreDiscardedOnDestruction)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a2a227c5-d23b-438b-a9d4-de702d53188a");
+    concurrent::Atomic<bool> unblock{false};
+    concurrent::Atomic<bool> isProcessing{false};
+    {
+        RuntimeMessageDispatcher sut{1U, [&](const auto&, const auto&, const auto&) {
+                                         isProcessing.store(true);
+                                         while (!unblock.load())
+                                         {
+                                             std::this_thread::yield();
+                                         }
+                                         m_numberOfProcessedMessages.fetch_add(1U);
+                                     }};
+        sut.dispatch(createMessage(0U), IpcMessageType::REG, RuntimeName_t{"app"});
+        sut.dispatch(createMessage(1U), IpcMessageType::REG, RuntimeName_t{"app"});
+        ASSERT_TRUE(waitUntil([&] { return isProcessing.load(); }));
+
+        std::thread unblocker([&] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            unblock.store(true);
+        });
+        unblocker.detach();
+    }
+
+    EXPECT_THAT(m_numberOfProcessedMessages.load(), Eq(1U));
+}
+
+} // namespace
@@ -0,0 +1,147 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/popo/client.hpp"
+#include "iceoryx_posh/popo/server.hpp"
+#include "iceoryx_posh/roudi_env/minimal_iceoryx_config.hpp"
+#include "iceoryx_posh/roudi_env/roudi_env.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iox/logging.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <thread>
+
+namespace
+{
+using namespace iox;
+
+struct Request
+{
+    uint64_t sequence{0U};
+    uint64_t value{0U};
+};
+
+struct Response
+{
+    uint64_t sequence{0U};
+    uint64_t value{0U};
+};
+
+enum class ResponseAllocation
+{
+    LOAN,
+    IN_PLACE
+};
+
+/// @brief Performs request/response round trips between a client and a server of the same runtime and measures the
+/// mean time per round trip. The server either loans a new chunk for each response or reuses the request chunk.
+void performBenchmark(popo::Client<Request, Response>& client,
+                      popo::Server<Request, Response>& server,
+                      const ResponseAllocation allocation,
+                      const uint64_t numberOfRoundTrips)
+{
+    uint64_t checksum{0U};
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t sequence = 0U; sequence < numberOfRoundTrips; ++sequence)
+    {
+        client.loan().and_then([&](auto& request) {
+            request->sequence = sequence;
+            request->value = sequence;
+            request.send().or_else([](const auto&) { std::cout << "Could not send request" << std::endl; });
+        });
+
+        server.take().and_then([&](auto& request) {
+            const Response result{request->sequence, request->value + 1U};
+            auto response = (allocation == ResponseAllocation::IN_PLACE)
+                                ? server.loanInPlace(std::move(request), result)
+                                : server.loan(request, result);
+            response.and_then([](auto& response) {
+                response.send().or_else([](const auto&) { std::cout << "Could not send response" << std::endl; });
+            });
+        });
+
+        client.take().and_then([&](const auto& response) { checksum += response->value; });
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    const auto expectedChecksum = numberOfRoundTrips * (numberOfRoundTrips + 1U) / 2U;
+    const auto timePerRoundTrip =
+        static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count())
+        / static_cast<double>(numberOfRoundTrips);
+
+    // Not using iceoryx logger due to width requirements
+    std::cout << "[ " << std::setw(8) << ((allocation == ResponseAllocation::IN_PLACE) ? "in-place" : "loan")
+              << " ] " << numberOfRoundTrips << " round trips, " << std::fixed << std::setprecision(1)
+              << std::setw(10) << timePerRoundTrip << " ns per round trip"
+              << ((checksum == expectedChecksum) ? "" : " (responses were lost)") << std::endl;
+}
+
+bool parseArgument(const char* argument, uint64_t& value)
+{
+    char* end{nullptr};
+    const auto parsedValue = std::strtoull(argument, &end, 10);
+    if (*end != '\0' || parsedValue == 0U || parsedValue > std::numeric_limits<uint32_t>::max())
+    {
+        return false;
+    }
+    value = static_cast<uint64_t>(parsedValue);
+    return true;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    iox::log::Logger::init(iox::log::logLevelFromEnvOr(iox::log::LogLevel::Warn));
+
+    uint64_t numberOfRoundTrips{1000000U};
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic) access to the command line arguments
+    if (argc > 2 || (argc == 2 && !parseArgument(argv[1], numberOfRoundTrips)))
+    {
+        std::cout << "Usage: " << argv[0] << " [number of round trips]" << std::endl;
+        return EXIT_FAILURE;
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    roudi_env::RouDiEnv roudiEnv{roudi_env::MinimalIceoryxConfigBuilder().create()};
+    runtime::PoshRuntime::initRuntime("iox-bm-request-response");
+
+    const capro::ServiceDescription service{"Benchmark", "RequestResponse", "RoundTrip"};
+    popo::Server<Request, Response> server{service};
+    popo::Client<Request, Response> client{service};
+
+    while (client.getConnectionState() != ConnectionState::CONNECTED || !server.hasClients())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // each variant is run twice, the first run warms up the mempools and the caches
+    for (const auto allocation : {ResponseAllocation::LOAN,
+                                  ResponseAllocation::LOAN,
+                                  ResponseAllocation::IN_PLACE,
+                                  ResponseAllocation::IN_PLACE})
+    {
+        performBenchmark(client, server, allocation, numberOfRoundTrips);
+    }
+
+    return EXIT_SUCCESS;
+}
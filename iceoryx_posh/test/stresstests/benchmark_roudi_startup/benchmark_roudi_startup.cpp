@@ -0,0 +1,141 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/popo/untyped_publisher.hpp"
+#include "iceoryx_posh/popo/untyped_subscriber.hpp"
+#include "iceoryx_posh/roudi_env/minimal_iceoryx_config.hpp"
+#include "iceoryx_posh/roudi_env/roudi_env.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iox/atomic.hpp"
+#include "iox/logging.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace iox;
+
+/// @brief Measures the time until a number of runtimes are registered at RouDi and created their ports. Each runtime
+/// is started in its own thread and creates the same number of publishers and subscribers. The runtimes are kept alive
+/// until all of them are ready, i.e. the measured time is the startup time of the whole system.
+void performBenchmark(const uint32_t numberOfRuntimes, const uint32_t portsPerRuntime, const uint32_t numberOfWorkers)
+{
+    auto config = roudi_env::MinimalIceoryxConfigBuilder().create();
+    config.runtimeMessageWorkerCount = numberOfWorkers;
+    roudi_env::RouDiEnv roudiEnv{config};
+
+    concurrent::Atomic<uint32_t> numberOfReadyRuntimes{0U};
+    concurrent::Atomic<bool> keepRunning{true};
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> runtimes;
+    for (uint32_t i = 0U; i < numberOfRuntimes; ++i)
+    {
+        runtimes.emplace_back([&, i] {
+            const auto name = "runtime" + std::to_string(i);
+            runtime::PoshRuntime::initRuntime(RuntimeName_t(TruncateToCapacity, name.c_str()));
+
+            std::vector<std::unique_ptr<popo::UntypedPublisher>> publishers;
+            std::vector<std::unique_ptr<popo::UntypedSubscriber>> subscribers;
+            for (uint32_t port = 0U; port < portsPerRuntime; ++port)
+            {
+                const auto instance = name + "_" + std::to_string(port);
+                const capro::ServiceDescription service{
+                    "Benchmark", capro::IdString_t(TruncateToCapacity, instance.c_str()), "Startup"};
+                publishers.emplace_back(std::make_unique<popo::UntypedPublisher>(service));
+                subscribers.emplace_back(std::make_unique<popo::UntypedSubscriber>(service));
+            }
+
+            numberOfReadyRuntimes.fetch_add(1U);
+            while (keepRunning.load())
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        });
+    }
+
+    while (numberOfReadyRuntimes.load() < numberOfRuntimes)
+    {
+        std::this_thread::yield();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    keepRunning = false;
+    for (auto& runtime : runtimes)
+    {
+        runtime.join();
+    }
+
+    const auto timeToReady = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    // Not using iceoryx logger due to width requirements
+    std::cout << "[ " << std::setw(3) << numberOfRuntimes << " runtimes x " << std::setw(3) << portsPerRuntime
+              << " publishers and subscribers, " << std::setw(2) << numberOfWorkers << " workers ] time-to-ready: "
+              << std::setw(10) << timeToReady << " us" << std::endl;
+}
+
+bool parseArgument(const char* argument, uint32_t& value)
+{
+    char* end{nullptr};
+    const auto parsedValue = std::strtoul(argument, &end, 10);
+    if (*end != '\0' || parsedValue == 0U || parsedValue > std::numeric_limits<uint32_t>::max())
+    {
+        return false;
+    }
+    value = static_cast<uint32_t>(parsedValue);
+    return true;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    iox::log::Logger::init(iox::log::logLevelFromEnvOr(iox::log::LogLevel::Warn));
+
+    uint32_t numberOfRuntimes{16U};
+    uint32_t portsPerRuntime{8U};
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic) access to the command line arguments
+    const bool validArguments = (argc < 2 || parseArgument(argv[1], numberOfRuntimes))
+                                && (argc < 3 || parseArgument(argv[2], portsPerRuntime));
+
+    if (!validArguments || numberOfRuntimes > MAX_PROCESS_NUMBER || numberOfRuntimes * portsPerRuntime > MAX_PUBLISHERS
+        || numberOfRuntimes * portsPerRuntime > MAX_SUBSCRIBERS)
+    {
+        std::cout << "Usage: " << argv[0] << " [number of runtimes] [publishers and subscribers per runtime]"
+                  << std::endl;
+        std::cout << "At most " << MAX_PROCESS_NUMBER << " runtimes, " << MAX_PUBLISHERS << " publishers and "
+                  << MAX_SUBSCRIBERS << " subscribers are supported" << std::endl;
+        return EXIT_FAILURE;
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    for (const uint32_t numberOfWorkers : {1U, 2U, roudi::DEFAULT_RUNTIME_MESSAGE_WORKER_COUNT, 8U})
+    {
+        performBenchmark(numberOfRuntimes, portsPerRuntime, numberOfWorkers);
+    }
+
+    return EXIT_SUCCESS;
+}
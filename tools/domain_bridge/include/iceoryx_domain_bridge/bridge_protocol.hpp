@@ -0,0 +1,243 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_TOOLS_DOMAIN_BRIDGE_BRIDGE_PROTOCOL_HPP
+#define IOX_TOOLS_DOMAIN_BRIDGE_BRIDGE_PROTOCOL_HPP
+
+#include "iceoryx_platform/platform_settings.hpp"
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iox/optional.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace iox
+{
+namespace gw
+{
+/// @brief The protocol between the source and the sink of the domain bridge
+/// @code
+/// | BridgeRecordHeader | record | data, padded to BRIDGE_RECORD_ALIGNMENT | BridgeRecordHeader | record | ...
+/// @endcode
+/// A message is a sequence of records which is transferred as a single datagram. The source announces the topics and
+/// the shared memory segments of its domain and sends the chunks either as reference into an announced segment or as
+/// copy of the user-header and the user-payload. The sink answers with the segments it was able to map and with the
+/// chunks it has finished to read from the segments of the source.
+
+constexpr uint64_t MAX_BRIDGE_MESSAGE_SIZE{64U * 1024U};
+constexpr uint64_t BRIDGE_RECORD_ALIGNMENT{8U};
+constexpr uint32_t INVALID_TOPIC_ID{std::numeric_limits<uint32_t>::max()};
+
+constexpr uint64_t alignToBridgeRecord(const uint64_t size) noexcept
+{
+    return (size + BRIDGE_RECORD_ALIGNMENT - 1U) / BRIDGE_RECORD_ALIGNMENT * BRIDGE_RECORD_ALIGNMENT;
+}
+
+enum class BridgeRecordType : uint16_t
+{
+    /// @brief source -> sink, TopicRecord
+    TOPIC_ADDED = 1U,
+    /// @brief source -> sink, TopicRecord
+    TOPIC_REMOVED,
+    /// @brief source -> sink, SegmentRecord
+    SEGMENT,
+    /// @brief sink -> source, SegmentMappedRecord
+    SEGMENT_MAPPED,
+    /// @brief source -> sink, ChunkReferenceRecord
+    CHUNK_REFERENCE,
+    /// @brief source -> sink, ChunkDataRecord followed by the data of the fragment
+    CHUNK_DATA,
+    /// @brief sink -> source, ReleaseRecord
+    RELEASE,
+};
+
+struct BridgeRecordHeader
+{
+    BridgeRecordType type{BridgeRecordType::TOPIC_ADDED};
+    uint16_t reserved{0U};
+    /// @brief the size of the record including this header and the padding
+    uint32_t size{0U};
+};
+
+/// @brief Announces a topic of the source domain; sent again when the topic is offered again after a TOPIC_REMOVED
+struct TopicRecord
+{
+    static constexpr uint64_t ID_STRING_SIZE{capro::IdString_t::capacity() + 1U};
+
+    uint32_t topicId{INVALID_TOPIC_ID};
+    uint32_t reserved{0U};
+    char service[ID_STRING_SIZE]{};
+    char instance[ID_STRING_SIZE]{};
+    char event[ID_STRING_SIZE]{};
+
+    static TopicRecord create(const uint32_t topicId, const capro::ServiceDescription& service) noexcept;
+
+    /// @brief the service description of the topic
+    /// @param[in] commInterface the source interface of the returned service description
+    capro::ServiceDescription serviceDescription(const capro::Interfaces commInterface) const noexcept;
+};
+
+/// @brief Announces a shared memory segment of the source domain which contains chunks of a topic
+struct SegmentRecord
+{
+    static constexpr uint64_t NAME_SIZE{platform::IOX_MAX_FILENAME_LENGTH + 1U};
+
+    uint32_t segmentIndex{0U};
+    uint32_t reserved{0U};
+    /// @brief the size which must be mapped to access all chunks of the segment
+    uint64_t size{0U};
+    /// @brief the name of the shared memory object
+    char name[NAME_SIZE]{};
+};
+
+struct SegmentMappedRecord
+{
+    uint32_t segmentIndex{0U};
+    /// @brief 1 if the sink has mapped the segment and accepts chunk references into it, 0 otherwise
+    uint32_t isMapped{0U};
+};
+
+/// @brief A chunk which is transferred by reference; the source holds the chunk until it is released by the sink
+struct ChunkReferenceRecord
+{
+    uint32_t topicId{INVALID_TOPIC_ID};
+    uint32_t segmentIndex{0U};
+    /// @brief the offset of the ChunkHeader in the segment
+    uint64_t chunkOffset{0U};
+};
+
+/// @brief A fragment of a chunk which is transferred by copy. The data of a chunk is the user-header followed by
+/// the user-payload; it is split into fragments when it does not fit into a single message. The fragments of a chunk
+/// are sent in order and are not interleaved with fragments of other chunks of the same topic.
+struct ChunkDataRecord
+{
+    static constexpr uint32_t FLAG_CHAINED{1U};
+
+    uint32_t topicId{INVALID_TOPIC_ID};
+    uint32_t flags{0U};
+    uint32_t userHeaderSize{0U};
+    uint32_t userPayloadAlignment{0U};
+    uint64_t userPayloadSize{0U};
+    uint64_t fragmentOffset{0U};
+    uint64_t fragmentSize{0U};
+
+    uint64_t dataSize() const noexcept
+    {
+        return userHeaderSize + userPayloadSize;
+    }
+};
+
+/// @brief Releases the oldest chunk references of a topic
+struct ReleaseRecord
+{
+    uint32_t topicId{INVALID_TOPIC_ID};
+    uint32_t numberOfChunks{0U};
+};
+
+static_assert(std::is_trivially_copyable<TopicRecord>::value, "records are transferred as bytes");
+static_assert(std::is_trivially_copyable<SegmentRecord>::value, "records are transferred as bytes");
+static_assert(std::is_trivially_copyable<ChunkDataRecord>::value, "records are transferred as bytes");
+static_assert(sizeof(BridgeRecordHeader) % BRIDGE_RECORD_ALIGNMENT == 0U, "the records must be aligned");
+static_assert(sizeof(ChunkDataRecord) % BRIDGE_RECORD_ALIGNMENT == 0U, "the chunk data must be aligned");
+
+/// @brief A record of a received message
+struct BridgeRecord
+{
+    BridgeRecordType type{BridgeRecordType::TOPIC_ADDED};
+    /// @brief the record followed by its data
+    const uint8_t* body{nullptr};
+    uint64_t bodySize{0U};
+
+    /// @brief the record as the given type
+    /// @return the record or nullptr if the body is too small for the type
+    template <typename Record>
+    const Record* as() const noexcept;
+
+    /// @brief the data which follows the record
+    template <typename Record>
+    const uint8_t* data() const noexcept;
+};
+
+/// @brief Composes a message from records
+class BridgeMessageWriter
+{
+  public:
+    explicit BridgeMessageWriter(const uint64_t capacity = MAX_BRIDGE_MESSAGE_SIZE) noexcept;
+
+    /// @brief appends a record
+    /// @param[in] type of the record
+    /// @param[in] record which is appended
+    /// @return false if the record does not fit into the message
+    template <typename Record>
+    bool append(const BridgeRecordType type, const Record& record) noexcept;
+
+    /// @brief appends a record which is followed by data
+    /// @param[in] type of the record
+    /// @param[in] record which is appended
+    /// @param[in] dataSize the number of bytes which follow the record
+    /// @return the memory for the data which must be filled by the caller or nullptr if the record does not fit
+    template <typename Record>
+    uint8_t* appendWithData(const BridgeRecordType type, const Record& record, const uint64_t dataSize) noexcept;
+
+    /// @brief the number of data bytes which fit into the message after a record of the given type
+    template <typename Record>
+    uint64_t availableDataSize() const noexcept;
+
+    /// @brief the record which was appended last, if it has the given type
+    /// @note used to merge subsequent records, e.g. the releases of the same topic
+    template <typename Record>
+    Record* lastRecord(const BridgeRecordType type) noexcept;
+
+    const uint8_t* data() const noexcept;
+    uint64_t size() const noexcept;
+    bool empty() const noexcept;
+    void clear() noexcept;
+
+  private:
+    std::vector<uint8_t> m_buffer;
+    uint64_t m_size{0U};
+    uint64_t m_lastRecordOffset{0U};
+};
+
+/// @brief Iterates over the records of a received message
+class BridgeMessageReader
+{
+  public:
+    BridgeMessageReader(const void* const message, const uint64_t size) noexcept;
+
+    /// @brief the next record of the message
+    /// @return the record or nullopt at the end of the message or if the message is malformed
+    optional<BridgeRecord> next() noexcept;
+
+    /// @brief true if a record with an invalid size was encountered
+    bool isMalformed() const noexcept;
+
+  private:
+    const uint8_t* m_message{nullptr};
+    uint64_t m_size{0U};
+    uint64_t m_offset{0U};
+    bool m_isMalformed{false};
+};
+
+} // namespace gw
+} // namespace iox
+
+#include "iceoryx_domain_bridge/internal/bridge_protocol.inl"
+
+#endif // IOX_TOOLS_DOMAIN_BRIDGE_BRIDGE_PROTOCOL_HPP
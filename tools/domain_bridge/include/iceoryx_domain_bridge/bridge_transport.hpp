@@ -0,0 +1,83 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_TOOLS_DOMAIN_BRIDGE_BRIDGE_TRANSPORT_HPP
+#define IOX_TOOLS_DOMAIN_BRIDGE_BRIDGE_TRANSPORT_HPP
+
+#include "iox/duration.hpp"
+#include "iox/expected.hpp"
+
+#include <cstdint>
+#include <utility>
+
+namespace iox
+{
+namespace gw
+{
+enum class BridgeTransportError : uint8_t
+{
+    CREATION_FAILED,
+    SEND_FAILED,
+    RECEIVE_FAILED,
+    CONNECTION_CLOSED,
+};
+
+/// @brief converts the BridgeTransportError to a string literal
+const char* asStringLiteral(const BridgeTransportError error) noexcept;
+
+/// @brief One end of a connected pair of unix domain sockets of type SOCK_SEQPACKET. The messages are delivered
+/// reliably, in order and with their boundaries preserved. The pair is created before the process forks into the
+/// source and the sink of the domain bridge, i.e. no file system entry is required.
+class BridgeTransport
+{
+  public:
+    using Pair_t = std::pair<BridgeTransport, BridgeTransport>;
+
+    /// @brief creates a connected pair of transports
+    /// @param[in] receiveTimeout after which 'receive' returns without a message, to be able to check for termination
+    static expected<Pair_t, BridgeTransportError> createPair(const units::Duration receiveTimeout) noexcept;
+
+    BridgeTransport(const BridgeTransport&) = delete;
+    BridgeTransport& operator=(const BridgeTransport&) = delete;
+    BridgeTransport(BridgeTransport&& rhs) noexcept;
+    BridgeTransport& operator=(BridgeTransport&& rhs) noexcept;
+    ~BridgeTransport() noexcept;
+
+    /// @brief sends a message; blocks while the receive buffer of the peer is full
+    expected<void, BridgeTransportError> send(const void* const message, const uint64_t size) const noexcept;
+
+    /// @brief receives a message
+    /// @return the size of the message or 0 when the receive timeout has elapsed
+    expected<uint64_t, BridgeTransportError> receive(void* const buffer, const uint64_t bufferSize) const noexcept;
+
+    /// @brief shuts the connection down; a blocked 'receive' of both ends returns with CONNECTION_CLOSED
+    void shutdown() const noexcept;
+
+    /// @brief closes this end, e.g. the end of the peer in a forked process
+    void close() noexcept;
+
+  private:
+    explicit BridgeTransport(const int socket) noexcept;
+
+    static constexpr int INVALID_SOCKET{-1};
+    int m_socket{INVALID_SOCKET};
+};
+
+} // namespace gw
+} // namespace iox
+
+#endif // IOX_TOOLS_DOMAIN_BRIDGE_BRIDGE_TRANSPORT_HPP
@@ -0,0 +1,93 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_TOOLS_DOMAIN_BRIDGE_CHUNK_DATA_HPP
+#define IOX_TOOLS_DOMAIN_BRIDGE_CHUNK_DATA_HPP
+
+#include "iceoryx_posh/mepoo/chained_payload.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iox/optional.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace iox
+{
+namespace gw
+{
+/// @brief The data of a chunk as it is transferred by copy, i.e. the user-header followed by the user-payload. The
+/// user-payload of a chained message is the concatenation of its segments; its user-header is not part of the data
+/// since it only references the continuation chunks and is recreated by 'loanChained'.
+/// @tparam ByteType is either 'uint8_t' for the sink side or 'const uint8_t' for the source side
+template <typename ByteType>
+class ChunkDataView
+{
+    static_assert(std::is_same<std::remove_const_t<ByteType>, uint8_t>::value, "ByteType must be (const) uint8_t");
+
+  public:
+    using UserPayload_t = std::conditional_t<std::is_const<ByteType>::value, const void, void>;
+    using ChunkHeader_t =
+        std::conditional_t<std::is_const<ByteType>::value, const mepoo::ChunkHeader, mepoo::ChunkHeader>;
+
+    /// @brief creates the view of a chunk or of a chained message
+    /// @param[in] userPayload of the chunk, as provided by 'loan', 'loanChained' or 'take'
+    explicit ChunkDataView(UserPayload_t* const userPayload) noexcept;
+
+    bool isChained() const noexcept;
+    uint32_t userHeaderSize() const noexcept;
+    uint64_t userPayloadSize() const noexcept;
+    uint32_t userPayloadAlignment() const noexcept;
+
+    /// @brief the size of the data, i.e. of the user-header and the user-payload
+    uint64_t size() const noexcept;
+
+    /// @brief copies a part of the data into contiguous memory
+    /// @param[in] offset in the data
+    /// @param[in] destination to copy to
+    /// @param[in] size the number of bytes to copy, limited by the end of the data
+    /// @return the number of copied bytes
+    uint64_t copyTo(const uint64_t offset, void* const destination, const uint64_t size) const noexcept;
+
+    /// @brief copies contiguous memory into a part of the data
+    /// @param[in] offset in the data
+    /// @param[in] source to copy from
+    /// @param[in] size the number of bytes to copy, limited by the end of the data
+    /// @return the number of copied bytes
+    template <typename T = ByteType, typename = std::enable_if_t<!std::is_const<T>::value>>
+    uint64_t copyFrom(const uint64_t offset, const void* const source, const uint64_t size) const noexcept;
+
+  private:
+    /// @brief calls 'f(memory, position, length)' for each contiguous part of the data in [offset, offset + size),
+    /// with 'position' being the number of bytes in front of 'memory' in the requested range
+    template <typename Function>
+    uint64_t forEachPart(const uint64_t offset, const uint64_t size, const Function& f) const noexcept;
+
+    ChunkHeader_t* m_chunkHeader{nullptr};
+    optional<mepoo::ChainedPayloadView<ByteType>> m_chainedPayload;
+};
+
+/// @brief Sink side view of the data of a chunk
+using ChunkData = ChunkDataView<uint8_t>;
+/// @brief Source side view of the data of a chunk
+using ConstChunkData = ChunkDataView<const uint8_t>;
+
+} // namespace gw
+} // namespace iox
+
+#include "iceoryx_domain_bridge/internal/chunk_data.inl"
+
+#endif // IOX_TOOLS_DOMAIN_BRIDGE_CHUNK_DATA_HPP
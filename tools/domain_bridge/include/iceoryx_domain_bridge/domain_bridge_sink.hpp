@@ -0,0 +1,99 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_TOOLS_DOMAIN_BRIDGE_DOMAIN_BRIDGE_SINK_HPP
+#define IOX_TOOLS_DOMAIN_BRIDGE_DOMAIN_BRIDGE_SINK_HPP
+
+#include "iceoryx_domain_bridge/bridge_protocol.hpp"
+#include "iceoryx_domain_bridge/bridge_transport.hpp"
+#include "iceoryx_posh/popo/untyped_publisher.hpp"
+#include "iox/atomic.hpp"
+#include "iox/function_ref.hpp"
+#include "iox/optional.hpp"
+#include "iox/posix_shared_memory_object.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace iox
+{
+namespace gw
+{
+/// @brief The sink side of the domain bridge. It offers a publisher for every topic of the DomainBridgeSource in its
+/// own domain and publishes the received chunks. The segments of the source domain are mapped read-only and a chunk
+/// reference is copied directly from the segment of the source into the loaned chunk, i.e. with a single copy.
+class DomainBridgeSink
+{
+  public:
+    /// @brief creates the sink
+    /// @param[in] transport to the source, must outlive the sink
+    explicit DomainBridgeSink(const BridgeTransport& transport) noexcept;
+
+    DomainBridgeSink(const DomainBridgeSink&) = delete;
+    DomainBridgeSink& operator=(const DomainBridgeSink&) = delete;
+    DomainBridgeSink(DomainBridgeSink&&) = delete;
+    DomainBridgeSink& operator=(DomainBridgeSink&&) = delete;
+    ~DomainBridgeSink() noexcept = default;
+
+    /// @brief receives and publishes the chunks until the connection is closed or 'keepRunning' returns false
+    /// @param[in] keepRunning is called after each received message and each receive timeout of the transport
+    void run(const function_ref<bool()> keepRunning) noexcept;
+
+    uint64_t numberOfPublishedChunks() const noexcept;
+    uint64_t numberOfMappedSegments() const noexcept;
+
+  private:
+    struct Topic
+    {
+        std::unique_ptr<popo::UntypedPublisher> publisher;
+        /// @brief the chunk whose fragments are currently received; nullptr if the loan failed
+        void* pendingUserPayload{nullptr};
+        uint64_t receivedSize{0U};
+    };
+
+    struct Segment
+    {
+        optional<PosixSharedMemoryObject> memory;
+        uint64_t size{0U};
+    };
+
+    void handleMessage(const void* const message, const uint64_t size) noexcept;
+    void handleRecord(const BridgeRecord& record) noexcept;
+    void addTopic(const TopicRecord& record) noexcept;
+    void removeTopic(const TopicRecord& record) noexcept;
+    void mapSegment(const SegmentRecord& record) noexcept;
+    void publishReference(const ChunkReferenceRecord& record) noexcept;
+    void publishData(const ChunkDataRecord& record, const uint8_t* const data) noexcept;
+    Topic* findTopic(const uint32_t topicId) noexcept;
+    void releaseReference(const uint32_t topicId) noexcept;
+    template <typename Record>
+    void appendReply(const BridgeRecordType type, const Record& record) noexcept;
+    void sendReplies() noexcept;
+
+    const BridgeTransport& m_transport;
+    std::vector<Topic> m_topics;
+    std::vector<Segment> m_segments;
+    BridgeMessageWriter m_replies;
+    bool m_isConnected{true};
+    concurrent::Atomic<uint64_t> m_numberOfPublishedChunks{0U};
+    concurrent::Atomic<uint64_t> m_numberOfMappedSegments{0U};
+};
+
+} // namespace gw
+} // namespace iox
+
+#endif // IOX_TOOLS_DOMAIN_BRIDGE_DOMAIN_BRIDGE_SINK_HPP
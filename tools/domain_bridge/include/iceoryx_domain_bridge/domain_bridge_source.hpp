@@ -0,0 +1,156 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_TOOLS_DOMAIN_BRIDGE_DOMAIN_BRIDGE_SOURCE_HPP
+#define IOX_TOOLS_DOMAIN_BRIDGE_DOMAIN_BRIDGE_SOURCE_HPP
+
+#include "iceoryx_domain_bridge/bridge_protocol.hpp"
+#include "iceoryx_domain_bridge/bridge_transport.hpp"
+#include "iceoryx_domain_bridge/segment_locator.hpp"
+#include "iceoryx_posh/gateway/channel.hpp"
+#include "iceoryx_posh/gateway/gateway_generic.hpp"
+#include "iceoryx_posh/popo/listener.hpp"
+#include "iceoryx_posh/popo/untyped_subscriber.hpp"
+#include "iox/atomic.hpp"
+#include "iox/unnamed_semaphore.hpp"
+
+#include <array>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace iox
+{
+namespace gw
+{
+/// @brief The state of a bridged topic in the source domain; the external terminal of the channel
+struct BridgeTopic
+{
+    BridgeTopic(const capro::IdString_t& service,
+                const capro::IdString_t& instance,
+                const capro::IdString_t& event) noexcept;
+
+    /// @brief the id of the topic in the messages; set by the discovery thread before 'isAnnounced'
+    uint32_t topicId{INVALID_TOPIC_ID};
+    /// @brief true when the sink knows the topic, i.e. chunks of the topic can be sent
+    concurrent::Atomic<bool> isAnnounced{false};
+    /// @brief the chunks which were sent by reference and are not yet released by the sink, oldest first; only
+    /// accessed by the forwarding thread
+    std::deque<const void*> chunksInFlight;
+};
+
+/// @brief The source side of the domain bridge. It subscribes to the bridged services of its domain and sends their
+/// chunks to the DomainBridgeSink of the other domain. A chunk in a shared memory segment which the sink was able to
+/// map is sent by reference and held until the sink has copied it; all other chunks, e.g. chained messages or chunks
+/// of segments without read access for the sink, are copied into the messages of the transport.
+class DomainBridgeSource : public GatewayGeneric<Channel<popo::UntypedSubscriber, BridgeTopic>>
+{
+  public:
+    using ChannelType = Channel<popo::UntypedSubscriber, BridgeTopic>;
+
+    /// @brief the maximum number of chunks of a topic which are sent by reference and not yet released by the sink;
+    /// one chunk is left to the subscriber for the chunks which are sent by copy
+    static constexpr uint32_t MAX_CHUNKS_IN_FLIGHT_PER_TOPIC{MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY - 1U};
+
+    /// @brief creates the source; the bridged services are set with 'loadConfiguration'
+    /// @param[in] transport to the sink, must outlive the source
+    /// @param[in] forceCopy sends all chunks by copy, also when the sink has mapped their segments
+    /// @param[in] forwardingPeriod the maximum time between two forwarding cycles; new chunks start a cycle earlier
+    DomainBridgeSource(const BridgeTransport& transport,
+                       const bool forceCopy,
+                       const units::Duration forwardingPeriod) noexcept;
+    ~DomainBridgeSource() noexcept override;
+
+    DomainBridgeSource(const DomainBridgeSource&) = delete;
+    DomainBridgeSource& operator=(const DomainBridgeSource&) = delete;
+    DomainBridgeSource(DomainBridgeSource&&) = delete;
+    DomainBridgeSource& operator=(DomainBridgeSource&&) = delete;
+
+    /// @brief sets the bridged services; a '*' in a service description is a wildcard. The internal introspection
+    /// and service discovery services are only bridged when their service is configured explicitly.
+    void loadConfiguration(const config::GatewayConfig& config) noexcept override;
+    void discover(const capro::CaproMessage& msg) noexcept override;
+    void forward(const ChannelType& channel) noexcept override;
+
+    /// @brief true as long as the connection to the sink is established
+    bool isConnected() const noexcept;
+
+    uint64_t numberOfChunksSentByReference() const noexcept;
+    uint64_t numberOfChunksSentByCopy() const noexcept;
+
+  protected:
+    void waitForNextForwarding(const std::chrono::steady_clock::time_point deadline) noexcept override;
+
+  private:
+    enum class SegmentState : uint8_t
+    {
+        UNKNOWN,
+        ANNOUNCED,
+        MAPPED,
+        UNAVAILABLE,
+    };
+
+    bool isBridged(const capro::ServiceDescription& service) const noexcept;
+    void addTopic(const capro::ServiceDescription& service) noexcept;
+    void removeTopic(const capro::ServiceDescription& service) noexcept;
+
+    void releaseChunks(BridgeTopic& topic, popo::UntypedSubscriber& subscriber) noexcept;
+    bool sendByReference(BridgeTopic& topic, const void* const userPayload) noexcept;
+    void sendByCopy(const BridgeTopic& topic, const void* const userPayload) noexcept;
+    void announceSegment(const uint32_t segmentIndex) noexcept;
+    template <typename Record>
+    void appendRecord(const BridgeRecordType type, const Record& record) noexcept;
+    void flush() noexcept;
+    void send(const BridgeMessageWriter& writer) noexcept;
+
+    void receiveLoop() noexcept;
+    void handleReply(const BridgeRecord& record) noexcept;
+    static void onDataReceived(popo::UntypedSubscriber* const subscriber, DomainBridgeSource* const self) noexcept;
+
+    const BridgeTransport& m_transport;
+    const bool m_forceCopy{false};
+    std::vector<capro::ServiceDescription> m_bridgedServices;
+    concurrent::Atomic<bool> m_isConnected{true};
+    std::mutex m_sendMutex;
+
+    // discovery thread
+    uint32_t m_nextTopicId{0U};
+    BridgeMessageWriter m_discoveryWriter{alignToBridgeRecord(sizeof(BridgeRecordHeader) + sizeof(TopicRecord))};
+
+    // forwarding thread
+    BridgeMessageWriter m_writer;
+    SegmentLocator m_segmentLocator;
+    std::array<uint64_t, SegmentLocator::MAX_SEGMENTS> m_announcedSegmentSizes{};
+
+    // written by the receive thread, read by the forwarding thread
+    std::array<concurrent::Atomic<SegmentState>, SegmentLocator::MAX_SEGMENTS> m_segmentStates;
+    std::array<concurrent::Atomic<uint32_t>, MAX_CHANNEL_NUMBER> m_releasedChunks;
+
+    concurrent::Atomic<uint64_t> m_numberOfChunksSentByReference{0U};
+    concurrent::Atomic<uint64_t> m_numberOfChunksSentByCopy{0U};
+
+    optional<UnnamedSemaphore> m_wakeUp;
+    concurrent::Atomic<bool> m_keepReceiving{true};
+    std::thread m_receiveThread;
+    popo::Listener m_listener;
+};
+
+} // namespace gw
+} // namespace iox
+
+#endif // IOX_TOOLS_DOMAIN_BRIDGE_DOMAIN_BRIDGE_SOURCE_HPP
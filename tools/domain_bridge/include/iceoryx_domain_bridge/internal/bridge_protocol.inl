@@ -0,0 +1,114 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_TOOLS_DOMAIN_BRIDGE_BRIDGE_PROTOCOL_INL
+#define IOX_TOOLS_DOMAIN_BRIDGE_BRIDGE_PROTOCOL_INL
+
+#include "iceoryx_domain_bridge/bridge_protocol.hpp"
+
+#include <cstring>
+
+namespace iox
+{
+namespace gw
+{
+template <typename Record>
+inline const Record* BridgeRecord::as() const noexcept
+{
+    if (bodySize < sizeof(Record))
+    {
+        return nullptr;
+    }
+    // the records are aligned to BRIDGE_RECORD_ALIGNMENT in the message
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    return reinterpret_cast<const Record*>(body);
+}
+
+template <typename Record>
+inline const uint8_t* BridgeRecord::data() const noexcept
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return body + sizeof(Record);
+}
+
+template <typename Record>
+inline bool BridgeMessageWriter::append(const BridgeRecordType type, const Record& record) noexcept
+{
+    return appendWithData(type, record, 0U) != nullptr;
+}
+
+template <typename Record>
+inline uint8_t* BridgeMessageWriter::appendWithData(const BridgeRecordType type,
+                                                    const Record& record,
+                                                    const uint64_t dataSize) noexcept
+{
+    static_assert(std::is_trivially_copyable<Record>::value, "records are transferred as bytes");
+
+    const uint64_t usedSize = sizeof(BridgeRecordHeader) + sizeof(Record) + dataSize;
+    const uint64_t recordSize = alignToBridgeRecord(usedSize);
+    if (recordSize > m_buffer.size() - m_size)
+    {
+        return nullptr;
+    }
+
+    BridgeRecordHeader header;
+    header.type = type;
+    header.size = static_cast<uint32_t>(recordSize);
+
+    auto* position = &m_buffer[m_size];
+    std::memcpy(position, &header, sizeof(header));
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    std::memcpy(position + sizeof(header), &record, sizeof(Record));
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    std::memset(position + usedSize, 0, recordSize - usedSize);
+
+    m_lastRecordOffset = m_size;
+    m_size += recordSize;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return position + sizeof(header) + sizeof(Record);
+}
+
+template <typename Record>
+inline uint64_t BridgeMessageWriter::availableDataSize() const noexcept
+{
+    const uint64_t recordSize = sizeof(BridgeRecordHeader) + sizeof(Record);
+    const uint64_t freeSize = (m_buffer.size() - m_size) / BRIDGE_RECORD_ALIGNMENT * BRIDGE_RECORD_ALIGNMENT;
+    return (freeSize > recordSize) ? freeSize - recordSize : 0U;
+}
+
+template <typename Record>
+inline Record* BridgeMessageWriter::lastRecord(const BridgeRecordType type) noexcept
+{
+    if (m_size == 0U)
+    {
+        return nullptr;
+    }
+    auto* position = &m_buffer[m_lastRecordOffset];
+    BridgeRecordHeader header;
+    std::memcpy(&header, position, sizeof(header));
+    if (header.type != type)
+    {
+        return nullptr;
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return reinterpret_cast<Record*>(position + sizeof(header));
+}
+
+} // namespace gw
+} // namespace iox
+
+#endif // IOX_TOOLS_DOMAIN_BRIDGE_BRIDGE_PROTOCOL_INL
@@ -0,0 +1,128 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_TOOLS_DOMAIN_BRIDGE_CHUNK_DATA_INL
+#define IOX_TOOLS_DOMAIN_BRIDGE_CHUNK_DATA_INL
+
+#include "iceoryx_domain_bridge/chunk_data.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace iox
+{
+namespace gw
+{
+template <typename ByteType>
+inline ChunkDataView<ByteType>::ChunkDataView(UserPayload_t* const userPayload) noexcept
+    : m_chunkHeader(mepoo::ChunkHeader::fromUserPayload(userPayload))
+    , m_chainedPayload(mepoo::ChainedPayloadView<ByteType>::fromUserPayload(userPayload))
+{
+}
+
+template <typename ByteType>
+inline bool ChunkDataView<ByteType>::isChained() const noexcept
+{
+    return m_chainedPayload.has_value();
+}
+
+template <typename ByteType>
+inline uint32_t ChunkDataView<ByteType>::userHeaderSize() const noexcept
+{
+    return isChained() ? 0U : m_chunkHeader->userHeaderSize();
+}
+
+template <typename ByteType>
+inline uint64_t ChunkDataView<ByteType>::userPayloadSize() const noexcept
+{
+    return isChained() ? m_chainedPayload->size() : m_chunkHeader->userPayloadSize();
+}
+
+template <typename ByteType>
+inline uint32_t ChunkDataView<ByteType>::userPayloadAlignment() const noexcept
+{
+    return m_chunkHeader->userPayloadAlignment();
+}
+
+template <typename ByteType>
+inline uint64_t ChunkDataView<ByteType>::size() const noexcept
+{
+    return userHeaderSize() + userPayloadSize();
+}
+
+template <typename ByteType>
+inline uint64_t
+ChunkDataView<ByteType>::copyTo(const uint64_t offset, void* const destination, const uint64_t size) const noexcept
+{
+    auto* bytes = static_cast<uint8_t*>(destination);
+    return forEachPart(offset, size, [bytes](ByteType* memory, const uint64_t position, const uint64_t length) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        std::memcpy(bytes + position, memory, length);
+    });
+}
+
+template <typename ByteType>
+template <typename T, typename>
+inline uint64_t
+ChunkDataView<ByteType>::copyFrom(const uint64_t offset, const void* const source, const uint64_t size) const noexcept
+{
+    const auto* bytes = static_cast<const uint8_t*>(source);
+    return forEachPart(offset, size, [bytes](ByteType* memory, const uint64_t position, const uint64_t length) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        std::memcpy(memory, bytes + position, length);
+    });
+}
+
+template <typename ByteType>
+template <typename Function>
+inline uint64_t
+ChunkDataView<ByteType>::forEachPart(const uint64_t offset, const uint64_t size, const Function& f) const noexcept
+{
+    uint64_t partBegin{0U};
+    uint64_t done{0U};
+    auto visit = [&](ByteType* memory, const uint64_t partSize) {
+        const uint64_t partEnd = partBegin + partSize;
+        const uint64_t position = offset + done;
+        if (done < size && position >= partBegin && position < partEnd)
+        {
+            const uint64_t length = std::min(partEnd - position, size - done);
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            f(memory + (position - partBegin), done, length);
+            done += length;
+        }
+        partBegin = partEnd;
+    };
+
+    if (m_chainedPayload.has_value())
+    {
+        for (auto segment : *m_chainedPayload)
+        {
+            visit(segment.data(), segment.size());
+        }
+    }
+    else
+    {
+        visit(static_cast<ByteType*>(m_chunkHeader->userHeader()), userHeaderSize());
+        visit(static_cast<ByteType*>(m_chunkHeader->userPayload()), userPayloadSize());
+    }
+    return done;
+}
+
+} // namespace gw
+} // namespace iox
+
+#endif // IOX_TOOLS_DOMAIN_BRIDGE_CHUNK_DATA_INL
@@ -0,0 +1,100 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_TOOLS_DOMAIN_BRIDGE_SEGMENT_LOCATOR_HPP
+#define IOX_TOOLS_DOMAIN_BRIDGE_SEGMENT_LOCATOR_HPP
+
+#include "iceoryx_platform/platform_settings.hpp"
+#include "iox/optional.hpp"
+#include "iox/string.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace iox
+{
+namespace gw
+{
+/// @brief A shared memory object which is mapped into the process
+struct SharedMemorySegment
+{
+    using Name_t = string<platform::IOX_MAX_FILENAME_LENGTH>;
+
+    /// @brief the name of the shared memory object, without the leading slash
+    Name_t name;
+    /// @brief the size which must be mapped to access all mapped regions of the shared memory object
+    uint64_t size{0U};
+};
+
+/// @brief The location of an address in a shared memory object
+struct SegmentLocation
+{
+    /// @brief the index of the segment in the SegmentLocator; it does not change as long as the locator exists
+    uint32_t segmentIndex{0U};
+    /// @brief the offset of the address in the shared memory object
+    uint64_t offset{0U};
+};
+
+/// @brief Finds the shared memory object which contains an address of the process by parsing the memory maps
+/// of the process. The result is cached and the memory maps are parsed again when an address is not found, e.g.
+/// because a segment was mapped after the last update.
+/// @note This is only supported on platforms which provide '/proc/self/maps' and which represent the shared memory
+/// objects in '/dev/shm'; on all other platforms no address is found.
+class SegmentLocator
+{
+  public:
+    static constexpr uint32_t MAX_SEGMENTS{256U};
+    static constexpr const char* SHARED_MEMORY_DIRECTORY{"/dev/shm/"};
+
+    /// @brief creates the locator
+    /// @param[in] memoryMapsFile the file with the memory maps of the process, in the format of '/proc/self/maps'
+    explicit SegmentLocator(const std::string& memoryMapsFile = "/proc/self/maps") noexcept;
+
+    /// @brief finds the shared memory object which contains the address
+    /// @return the location or nullopt if the address is not in a shared memory object
+    optional<SegmentLocation> locate(const void* const address) noexcept;
+
+    /// @brief the segment with the given index
+    /// @param[in] segmentIndex from a SegmentLocation
+    /// @return the segment or nullopt if the index is invalid
+    optional<SharedMemorySegment> segment(const uint32_t segmentIndex) const noexcept;
+
+  private:
+    struct Region
+    {
+        uint64_t begin{0U};
+        uint64_t end{0U};
+        uint64_t fileOffset{0U};
+        uint32_t segmentIndex{0U};
+    };
+
+    optional<SegmentLocation> find(const uint64_t address) const noexcept;
+    void update() noexcept;
+    optional<uint32_t> segmentIndex(const SharedMemorySegment::Name_t& name) noexcept;
+    static optional<uint64_t> fileSize(const SharedMemorySegment::Name_t& name) noexcept;
+
+    std::string m_memoryMapsFile;
+    bool m_isSupported{true};
+    std::vector<Region> m_regions;
+    std::vector<SharedMemorySegment> m_segments;
+};
+
+} // namespace gw
+} // namespace iox
+
+#endif // IOX_TOOLS_DOMAIN_BRIDGE_SEGMENT_LOCATOR_HPP
@@ -0,0 +1,350 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_domain_bridge/domain_bridge_sink.hpp"
+#include "iceoryx_domain_bridge/domain_bridge_source.hpp"
+#include "iceoryx_platform/unistd.hpp"
+#include "iceoryx_platform/wait.hpp"
+#include "iceoryx_posh/popo/untyped_publisher.hpp"
+#include "iceoryx_posh/popo/untyped_subscriber.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
+#include "iceoryx_posh/roudi_env/minimal_iceoryx_config.hpp"
+#include "iceoryx_posh/roudi_env/roudi_env.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iox/attributes.hpp"
+#include "iox/cli_definition.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace iox;
+using namespace iox::gw;
+
+struct CommandLine
+{
+    IOX_CLI_DEFINITION(CommandLine);
+
+    IOX_CLI_OPTIONAL(uint32_t, samples, 1000U, 'n', "samples", "The number of samples of the latency measurement");
+    IOX_CLI_OPTIONAL(
+        uint32_t, burst, 10000U, 'b', "burst", "The number of samples of the throughput measurement");
+};
+
+constexpr DomainId SOURCE_DOMAIN{1};
+constexpr DomainId SINK_DOMAIN{2};
+constexpr uint32_t CHUNK_COUNT{64U};
+const capro::ServiceDescription BENCHMARK_SERVICE{"DomainBridge", "Benchmark", "Sample"};
+const units::Duration CONTROL_TIMEOUT{units::Duration::fromMilliseconds(10)};
+const units::Duration SAMPLE_TIMEOUT{units::Duration::fromSeconds(2)};
+
+enum class Phase : uint32_t
+{
+    WARM_UP,
+    LATENCY,
+    THROUGHPUT,
+    END,
+};
+
+/// @brief the header of every benchmark sample; the remaining user-payload is transferred but not touched
+struct Sample
+{
+    uint64_t timestampInNanoseconds{0U};
+    Phase phase{Phase::WARM_UP};
+    uint32_t sequenceNumber{0U};
+};
+
+struct Scenario
+{
+    uint64_t payloadSize{0U};
+    bool forceCopy{false};
+    uint32_t numberOfLatencySamples{0U};
+    uint32_t numberOfThroughputSamples{0U};
+};
+
+uint64_t now()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+}
+
+void publish(popo::UntypedPublisher& publisher, const uint64_t payloadSize, const Phase phase, const uint32_t sequence)
+{
+    // the chunks are returned when the bridge has transferred them
+    while (true)
+    {
+        auto loanResult = publisher.loan(payloadSize, alignof(Sample));
+        if (!loanResult.has_error())
+        {
+            auto* sample = static_cast<Sample*>(loanResult.value());
+            sample->phase = phase;
+            sample->sequenceNumber = sequence;
+            sample->timestampInNanoseconds = now();
+            publisher.publish(sample);
+            return;
+        }
+        std::this_thread::yield();
+    }
+}
+
+/// @brief runs in the source domain; publishes the samples which are bridged by the source
+int runPublisherAndSource(const Scenario& scenario, const BridgeTransport& transport, const BridgeTransport& control)
+{
+    runtime::PoshRuntime::initRuntime("iox-domain-bridge-benchmark-source", SOURCE_DOMAIN);
+
+    config::GatewayConfig config;
+    config.m_configuredServices.push_back({BENCHMARK_SERVICE});
+    DomainBridgeSource source(transport, scenario.forceCopy, units::Duration::fromMilliseconds(10));
+    source.loadConfiguration(config);
+    source.runMultithreaded();
+
+    popo::UntypedPublisher publisher(BENCHMARK_SERVICE);
+
+    // the subscriber acknowledges the first sample which has crossed the bridge; a closed connection ends the wait
+    auto isAcknowledged = [&] {
+        uint8_t acknowledge{0U};
+        auto receiveResult = control.receive(&acknowledge, sizeof(acknowledge));
+        return receiveResult.has_error() || receiveResult.value() > 0U;
+    };
+
+    uint32_t sequence{0U};
+    do
+    {
+        publish(publisher, scenario.payloadSize, Phase::WARM_UP, sequence++);
+    } while (!isAcknowledged());
+
+    for (uint32_t i = 0U; i < scenario.numberOfLatencySamples; ++i)
+    {
+        publish(publisher, scenario.payloadSize, Phase::LATENCY, i);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    for (uint32_t i = 0U; i < scenario.numberOfThroughputSamples; ++i)
+    {
+        publish(publisher, scenario.payloadSize, Phase::THROUGHPUT, i);
+    }
+
+    // the end marker is repeated until the subscriber has received it
+    do
+    {
+        publish(publisher, scenario.payloadSize, Phase::END, 0U);
+    } while (!isAcknowledged());
+
+    source.shutdown();
+    transport.shutdown();
+    return EXIT_SUCCESS;
+}
+
+void printResult(const Scenario& scenario,
+                 std::vector<uint64_t>& latencies,
+                 const uint32_t numberOfThroughputSamples,
+                 const uint64_t throughputDuration)
+{
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&](const double p) {
+        if (latencies.empty())
+        {
+            return 0.0;
+        }
+        const auto index = static_cast<uint64_t>(p * static_cast<double>(latencies.size() - 1U));
+        return static_cast<double>(latencies[index]) / 1000.0;
+    };
+    const double seconds = static_cast<double>(throughputDuration) / 1e9;
+    const double samplesPerSecond = (seconds > 0.0) ? numberOfThroughputSamples / seconds : 0.0;
+    const double mebibytesPerSecond =
+        samplesPerSecond * static_cast<double>(scenario.payloadSize) / (1024.0 * 1024.0);
+
+    std::cout << std::setw(10) << scenario.payloadSize << std::setw(11) << (scenario.forceCopy ? "copy" : "reference")
+              << std::fixed << std::setprecision(1) << std::setw(12) << percentile(0.5) << std::setw(12)
+              << percentile(0.99) << std::setw(12) << percentile(1.0) << std::setw(14) << samplesPerSecond
+              << std::setw(12) << mebibytesPerSecond << std::setw(8) << numberOfThroughputSamples << "/"
+              << scenario.numberOfThroughputSamples << std::endl;
+}
+
+/// @brief runs in the sink domain; receives the bridged samples and prints the measurement
+int runSinkAndSubscriber(const Scenario& scenario, const BridgeTransport& transport, const BridgeTransport& control)
+{
+    runtime::PoshRuntime::initRuntime("iox-domain-bridge-benchmark-sink", SINK_DOMAIN);
+
+    DomainBridgeSink sink(transport);
+    std::thread sinkThread([&] { sink.run([] { return true; }); });
+
+    popo::SubscriberOptions options;
+    options.queueCapacity = popo::SubscriberChunkQueueData_t::MAX_CAPACITY;
+    popo::UntypedSubscriber subscriber(BENCHMARK_SERVICE, options);
+    popo::WaitSet<> waitSet;
+    waitSet.attachState(subscriber, popo::SubscriberState::HAS_DATA).expect("attaching the subscriber");
+
+    std::vector<uint64_t> latencies;
+    latencies.reserve(scenario.numberOfLatencySamples);
+    uint32_t numberOfThroughputSamples{0U};
+    uint64_t throughputStart{0U};
+    uint64_t throughputEnd{0U};
+    bool isWarmedUp{false};
+    bool hasEnded{false};
+    const uint8_t acknowledge{1U};
+
+    while (!hasEnded)
+    {
+        if (waitSet.timedWait(SAMPLE_TIMEOUT).empty())
+        {
+            std::cerr << "No sample received within the timeout" << std::endl;
+            break;
+        }
+
+        while (!hasEnded)
+        {
+            auto takeResult = subscriber.take();
+            if (takeResult.has_error())
+            {
+                break;
+            }
+            const auto receiveTime = now();
+            const auto* sample = static_cast<const Sample*>(takeResult.value());
+            switch (sample->phase)
+            {
+            case Phase::WARM_UP:
+                if (!isWarmedUp)
+                {
+                    isWarmedUp = true;
+                    IOX_DISCARD_RESULT(control.send(&acknowledge, sizeof(acknowledge)));
+                }
+                break;
+            case Phase::LATENCY:
+                latencies.push_back(receiveTime - sample->timestampInNanoseconds);
+                break;
+            case Phase::THROUGHPUT:
+                if (numberOfThroughputSamples == 0U)
+                {
+                    throughputStart = sample->timestampInNanoseconds;
+                }
+                ++numberOfThroughputSamples;
+                throughputEnd = receiveTime;
+                break;
+            case Phase::END:
+                hasEnded = true;
+                IOX_DISCARD_RESULT(control.send(&acknowledge, sizeof(acknowledge)));
+                break;
+            }
+            subscriber.release(sample);
+        }
+    }
+
+    printResult(scenario, latencies, numberOfThroughputSamples, throughputEnd - throughputStart);
+
+    transport.shutdown();
+    sinkThread.join();
+    return hasEnded ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+bool waitForChild(const pid_t pid)
+{
+    int status{0};
+    return waitpid(pid, &status, 0) != -1 && WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS;
+}
+
+bool runScenario(const Scenario& scenario)
+{
+    auto transports = BridgeTransport::createPair(units::Duration::fromMilliseconds(100));
+    auto controls = BridgeTransport::createPair(CONTROL_TIMEOUT);
+    if (transports.has_error() || controls.has_error())
+    {
+        std::cerr << "Unable to create the transports" << std::endl;
+        return false;
+    }
+
+    // every process is registered in exactly one domain; both RouDis are hosted by this process and the children
+    // are started before them, since a forked child must not inherit the mapped segments of a RouDi
+    std::vector<pid_t> children;
+    for (const bool isSource : {true, false})
+    {
+        const auto pid = fork();
+        if (pid == -1)
+        {
+            std::cerr << "Unable to start the benchmark process" << std::endl;
+            return false;
+        }
+        if (pid == 0)
+        {
+            const auto result = isSource
+                                    ? runPublisherAndSource(scenario, transports->first, controls->first)
+                                    : runSinkAndSubscriber(scenario, transports->second, controls->second);
+            // skips the destructors of the state which was inherited from the parent
+            _exit(result);
+        }
+        children.push_back(pid);
+    }
+
+    const auto config = roudi_env::MinimalIceoryxConfigBuilder()
+                            .payloadChunkSize(std::max<uint64_t>(scenario.payloadSize, sizeof(Sample)))
+                            .payloadChunkCount(CHUNK_COUNT)
+                            .create();
+    roudi_env::RouDiEnv sourceRouDi(SOURCE_DOMAIN, config);
+    roudi_env::RouDiEnv sinkRouDi(SINK_DOMAIN, config);
+
+    bool isSuccessful{true};
+    for (const auto pid : children)
+    {
+        isSuccessful &= waitForChild(pid);
+    }
+    return isSuccessful;
+}
+
+/// @brief runs the scenario in a child process, since the segments of the RouDis of a scenario stay registered in
+/// the process after the RouDis are gone
+bool runScenarioInChildProcess(const Scenario& scenario)
+{
+    const auto pid = fork();
+    if (pid == -1)
+    {
+        std::cerr << "Unable to start the benchmark process" << std::endl;
+        return false;
+    }
+    if (pid == 0)
+    {
+        _exit(runScenario(scenario) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+    return waitForChild(pid);
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    auto cmd = CommandLine::parse(argc, argv, "Measures the latency and the throughput of the domain bridge");
+
+    // the domains are separated by the domain id only with the experimental posh features
+    experimental::hasExperimentalPoshFeaturesEnabled(true);
+
+    std::cout << std::setw(10) << "size [B]" << std::setw(11) << "mode" << std::setw(12) << "p50 [us]"
+              << std::setw(12) << "p99 [us]" << std::setw(12) << "max [us]" << std::setw(14) << "samples/s"
+              << std::setw(12) << "MiB/s" << std::setw(14) << "received" << std::endl;
+
+    bool isSuccessful{true};
+    for (const uint64_t payloadSize : {64U, 1024U, 16U * 1024U, 256U * 1024U})
+    {
+        for (const bool forceCopy : {false, true})
+        {
+            isSuccessful &= runScenarioInChildProcess({payloadSize, forceCopy, cmd.samples(), cmd.burst()});
+        }
+    }
+
+    return isSuccessful ? EXIT_SUCCESS : EXIT_FAILURE;
+}
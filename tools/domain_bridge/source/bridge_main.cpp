@@ -0,0 +1,152 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_domain_bridge/domain_bridge_sink.hpp"
+#include "iceoryx_domain_bridge/domain_bridge_source.hpp"
+#include "iceoryx_platform/unistd.hpp"
+#include "iceoryx_platform/wait.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iox/attributes.hpp"
+#include "iox/cli_definition.hpp"
+#include "iox/signal_watcher.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+
+namespace
+{
+struct CommandLine
+{
+    IOX_CLI_DEFINITION(CommandLine);
+
+    IOX_CLI_REQUIRED(uint16_t, fromDomain, 'f', "from-domain", "The domain id in which the services are offered");
+    IOX_CLI_REQUIRED(uint16_t, toDomain, 't', "to-domain", "The domain id into which the services are bridged");
+    IOX_CLI_OPTIONAL(
+        iox::cli::Argument_t, service, {""}, 's', "service", "The service which is bridged, all when not set");
+    IOX_CLI_OPTIONAL(
+        iox::cli::Argument_t, instance, {""}, 'i', "instance", "The instance which is bridged, all when not set");
+    IOX_CLI_OPTIONAL(iox::cli::Argument_t, event, {""}, 'e', "event", "The event which is bridged, all when not set");
+    IOX_CLI_SWITCH(copy, 'c', "copy", "Transfers all chunks by copy instead of reading them from the shared memory");
+    IOX_CLI_OPTIONAL(uint64_t,
+                     period,
+                     10U,
+                     'p',
+                     "period",
+                     "The maximum time in milliseconds between two forwarding cycles");
+};
+
+iox::capro::IdString_t toFilter(const iox::cli::Argument_t& value)
+{
+    return value.empty() ? iox::capro::IdString_t("*") : iox::capro::IdString_t(iox::TruncateToCapacity, value.c_str());
+}
+
+iox::RuntimeName_t runtimeName(const char* const role, const CommandLine& cmd)
+{
+    const auto name = std::string("iox-domain-bridge-") + role + "-" + std::to_string(cmd.fromDomain()) + "-to-"
+                      + std::to_string(cmd.toDomain());
+    return iox::RuntimeName_t(iox::TruncateToCapacity, name.c_str());
+}
+
+int runSource(const CommandLine& cmd, const iox::gw::BridgeTransport& transport)
+{
+    using namespace iox::gw;
+
+    iox::runtime::PoshRuntime::initRuntime(runtimeName("source", cmd), iox::DomainId{cmd.fromDomain()});
+
+    iox::config::GatewayConfig config;
+    config.m_configuredServices.push_back(
+        {iox::capro::ServiceDescription(toFilter(cmd.service()), toFilter(cmd.instance()), toFilter(cmd.event()))});
+
+    DomainBridgeSource source(transport, cmd.copy(), iox::units::Duration::fromMilliseconds(cmd.period()));
+    source.loadConfiguration(config);
+    source.runMultithreaded();
+
+    while (!iox::hasTerminationRequested() && source.isConnected())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    // the sink terminates when the connection is closed
+    transport.shutdown();
+    source.shutdown();
+
+    std::cout << "Bridged " << source.numberOfChunksSentByReference() << " chunks by reference and "
+              << source.numberOfChunksSentByCopy() << " chunks by copy" << std::endl;
+    return EXIT_SUCCESS;
+}
+
+int runSink(const CommandLine& cmd, const iox::gw::BridgeTransport& transport)
+{
+    iox::runtime::PoshRuntime::initRuntime(runtimeName("sink", cmd), iox::DomainId{cmd.toDomain()});
+
+    iox::gw::DomainBridgeSink sink(transport);
+    // the sink terminates as well when the source closes the connection
+    sink.run([] { return !iox::hasTerminationRequested(); });
+    return EXIT_SUCCESS;
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    using namespace iox::gw;
+
+    auto cmd = CommandLine::parse(argc, argv, "Bridges publish-subscribe topics from one iceoryx domain into another");
+
+    if (!iox::experimental::hasExperimentalPoshFeaturesEnabled())
+    {
+        std::cerr << "The domain id is an experimental feature, please build with the 'IOX_EXPERIMENTAL_POSH' cmake "
+                     "option to use the domain bridge"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+    if (cmd.fromDomain() == cmd.toDomain())
+    {
+        std::cerr << "The domains must differ" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    auto transports = BridgeTransport::createPair(iox::units::Duration::fromMilliseconds(100));
+    if (transports.has_error())
+    {
+        std::cerr << "Unable to create the transport: " << asStringLiteral(transports.error()) << std::endl;
+        return EXIT_FAILURE;
+    }
+    auto& sourceTransport = transports->first;
+    auto& sinkTransport = transports->second;
+
+    // a process is registered in exactly one domain, therefore the sink runs in a child process
+    const auto pid = fork();
+    if (pid == -1)
+    {
+        std::cerr << "Unable to start the sink process" << std::endl;
+        return EXIT_FAILURE;
+    }
+    if (pid == 0)
+    {
+        sourceTransport.close();
+        return runSink(cmd, sinkTransport);
+    }
+
+    sinkTransport.close();
+    const auto result = runSource(cmd, sourceTransport);
+
+    int status{0};
+    IOX_DISCARD_RESULT(waitpid(pid, &status, 0));
+    return result;
+}
@@ -0,0 +1,124 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_domain_bridge/bridge_protocol.hpp"
+
+#include <cstring>
+
+namespace iox
+{
+namespace gw
+{
+namespace
+{
+template <uint64_t Size>
+void copyIdString(char (&destination)[Size], const capro::IdString_t& source) noexcept
+{
+    static_assert(Size > capro::IdString_t::capacity(), "the destination must hold the string and the terminator");
+    std::memcpy(&destination[0], source.c_str(), source.size());
+    destination[source.size()] = '\0';
+}
+
+template <uint64_t Size>
+capro::IdString_t toIdString(const char (&source)[Size]) noexcept
+{
+    return capro::IdString_t(TruncateToCapacity, &source[0], strnlen(&source[0], Size - 1U));
+}
+} // namespace
+
+TopicRecord TopicRecord::create(const uint32_t topicId, const capro::ServiceDescription& service) noexcept
+{
+    TopicRecord record;
+    record.topicId = topicId;
+    copyIdString(record.service, service.getServiceIDString());
+    copyIdString(record.instance, service.getInstanceIDString());
+    copyIdString(record.event, service.getEventIDString());
+    return record;
+}
+
+capro::ServiceDescription TopicRecord::serviceDescription(const capro::Interfaces commInterface) const noexcept
+{
+    return capro::ServiceDescription(
+        toIdString(service), toIdString(instance), toIdString(event), {0U, 0U, 0U, 0U}, commInterface);
+}
+
+BridgeMessageWriter::BridgeMessageWriter(const uint64_t capacity) noexcept
+    : m_buffer(capacity / BRIDGE_RECORD_ALIGNMENT * BRIDGE_RECORD_ALIGNMENT)
+{
+}
+
+const uint8_t* BridgeMessageWriter::data() const noexcept
+{
+    return m_buffer.data();
+}
+
+uint64_t BridgeMessageWriter::size() const noexcept
+{
+    return m_size;
+}
+
+bool BridgeMessageWriter::empty() const noexcept
+{
+    return m_size == 0U;
+}
+
+void BridgeMessageWriter::clear() noexcept
+{
+    m_size = 0U;
+    m_lastRecordOffset = 0U;
+}
+
+BridgeMessageReader::BridgeMessageReader(const void* const message, const uint64_t size) noexcept
+    : m_message(static_cast<const uint8_t*>(message))
+    , m_size(size)
+{
+}
+
+optional<BridgeRecord> BridgeMessageReader::next() noexcept
+{
+    if (m_isMalformed || m_offset + sizeof(BridgeRecordHeader) > m_size)
+    {
+        m_isMalformed = m_isMalformed || (m_offset != m_size);
+        return nullopt;
+    }
+
+    BridgeRecordHeader header;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    std::memcpy(&header, m_message + m_offset, sizeof(header));
+    if (header.size < sizeof(BridgeRecordHeader) || header.size % BRIDGE_RECORD_ALIGNMENT != 0U
+        || header.size > m_size - m_offset)
+    {
+        m_isMalformed = true;
+        return nullopt;
+    }
+
+    BridgeRecord record;
+    record.type = header.type;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    record.body = m_message + m_offset + sizeof(BridgeRecordHeader);
+    record.bodySize = header.size - sizeof(BridgeRecordHeader);
+    m_offset += header.size;
+    return record;
+}
+
+bool BridgeMessageReader::isMalformed() const noexcept
+{
+    return m_isMalformed;
+}
+
+} // namespace gw
+} // namespace iox
@@ -0,0 +1,188 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_domain_bridge/bridge_transport.hpp"
+#include "iceoryx_platform/errno.hpp"
+#include "iceoryx_platform/socket.hpp"
+#include "iox/logging.hpp"
+#include "iox/posix_call.hpp"
+
+namespace iox
+{
+namespace gw
+{
+namespace
+{
+#if defined(MSG_NOSIGNAL)
+constexpr int SEND_FLAGS{MSG_NOSIGNAL};
+#else
+constexpr int SEND_FLAGS{0};
+#endif
+constexpr int ERROR_CODE{-1};
+} // namespace
+
+const char* asStringLiteral(const BridgeTransportError error) noexcept
+{
+    switch (error)
+    {
+    case BridgeTransportError::CREATION_FAILED:
+        return "BridgeTransportError::CREATION_FAILED";
+    case BridgeTransportError::SEND_FAILED:
+        return "BridgeTransportError::SEND_FAILED";
+    case BridgeTransportError::RECEIVE_FAILED:
+        return "BridgeTransportError::RECEIVE_FAILED";
+    case BridgeTransportError::CONNECTION_CLOSED:
+        return "BridgeTransportError::CONNECTION_CLOSED";
+    }
+
+    return "[Undefined BridgeTransportError]";
+}
+
+expected<BridgeTransport::Pair_t, BridgeTransportError>
+BridgeTransport::createPair(const units::Duration receiveTimeout) noexcept
+{
+    int sockets[2]{INVALID_SOCKET, INVALID_SOCKET};
+    auto socketPairCall =
+        IOX_POSIX_CALL(socketpair)(AF_UNIX, SOCK_SEQPACKET, 0, &sockets[0]).failureReturnValue(ERROR_CODE).evaluate();
+    if (socketPairCall.has_error())
+    {
+        IOX_LOG(Error, "Unable to create the socket pair of the bridge transport");
+        return err(BridgeTransportError::CREATION_FAILED);
+    }
+
+    Pair_t transports{BridgeTransport(sockets[0]), BridgeTransport(sockets[1])};
+
+    // the messages are large and sent in bursts, the default buffer would only hold a few of them
+    constexpr int BUFFER_SIZE{4 * 1024 * 1024};
+    auto tv = receiveTimeout.timeval();
+    for (const auto socket : sockets)
+    {
+        auto receiveTimeoutCall =
+            IOX_POSIX_CALL(iox_setsockopt)(socket, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv))
+                .failureReturnValue(ERROR_CODE)
+                .evaluate();
+        if (receiveTimeoutCall.has_error())
+        {
+            IOX_LOG(Error, "Unable to set the receive timeout of the bridge transport");
+            return err(BridgeTransportError::CREATION_FAILED);
+        }
+
+        // a smaller buffer than requested is no error, it only limits the number of messages in flight
+        IOX_POSIX_CALL(iox_setsockopt)(socket, SOL_SOCKET, SO_SNDBUF, &BUFFER_SIZE, sizeof(BUFFER_SIZE))
+            .failureReturnValue(ERROR_CODE)
+            .evaluate()
+            .or_else([](auto&) { IOX_LOG(Debug, "Unable to enlarge the send buffer of the bridge transport"); });
+    }
+
+    return ok(std::move(transports));
+}
+
+BridgeTransport::BridgeTransport(const int socket) noexcept
+    : m_socket(socket)
+{
+}
+
+BridgeTransport::BridgeTransport(BridgeTransport&& rhs) noexcept
+{
+    *this = std::move(rhs);
+}
+
+BridgeTransport& BridgeTransport::operator=(BridgeTransport&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        close();
+        m_socket = rhs.m_socket;
+        rhs.m_socket = INVALID_SOCKET;
+    }
+    return *this;
+}
+
+BridgeTransport::~BridgeTransport() noexcept
+{
+    close();
+}
+
+expected<void, BridgeTransportError> BridgeTransport::send(const void* const message,
+                                                            const uint64_t size) const noexcept
+{
+    auto sendCall =
+        IOX_POSIX_CALL(iox_sendto)(m_socket, message, static_cast<size_t>(size), SEND_FLAGS, nullptr, 0)
+            .failureReturnValue(ERROR_CODE)
+            .suppressErrorMessagesForErrnos(EPIPE, ECONNRESET)
+            .evaluate();
+    if (sendCall.has_error())
+    {
+        const auto errnum = sendCall.error().errnum;
+        return err((errnum == EPIPE || errnum == ECONNRESET) ? BridgeTransportError::CONNECTION_CLOSED
+                                                             : BridgeTransportError::SEND_FAILED);
+    }
+    return ok();
+}
+
+expected<uint64_t, BridgeTransportError> BridgeTransport::receive(void* const buffer,
+                                                                   const uint64_t bufferSize) const noexcept
+{
+    auto receiveCall =
+        IOX_POSIX_CALL(iox_recvfrom)(m_socket, buffer, static_cast<size_t>(bufferSize), 0, nullptr, nullptr)
+            .failureReturnValue(ERROR_CODE)
+            .ignoreErrnos(EAGAIN, EWOULDBLOCK, EINTR)
+            .evaluate();
+    if (receiveCall.has_error())
+    {
+        return err(receiveCall.error().errnum == ECONNRESET ? BridgeTransportError::CONNECTION_CLOSED
+                                                            : BridgeTransportError::RECEIVE_FAILED);
+    }
+    if (receiveCall->value == ERROR_CODE)
+    {
+        // timeout or interrupted by a signal
+        return ok<uint64_t>(0U);
+    }
+    if (receiveCall->value == 0)
+    {
+        // an empty message is never sent, i.e. the peer has closed the connection
+        return err(BridgeTransportError::CONNECTION_CLOSED);
+    }
+    return ok(static_cast<uint64_t>(receiveCall->value));
+}
+
+void BridgeTransport::shutdown() const noexcept
+{
+    if (m_socket != INVALID_SOCKET)
+    {
+        IOX_POSIX_CALL(::shutdown)(m_socket, SHUT_RDWR)
+            .failureReturnValue(ERROR_CODE)
+            .ignoreErrnos(ENOTCONN)
+            .evaluate()
+            .or_else([](auto&) { IOX_LOG(Warn, "Unable to shut the bridge transport down"); });
+    }
+}
+
+void BridgeTransport::close() noexcept
+{
+    if (m_socket != INVALID_SOCKET)
+    {
+        IOX_POSIX_CALL(iox_closesocket)(m_socket)
+            .failureReturnValue(ERROR_CODE)
+            .evaluate()
+            .or_else([](auto&) { IOX_LOG(Warn, "Unable to close the bridge transport"); });
+        m_socket = INVALID_SOCKET;
+    }
+}
+
+} // namespace gw
+} // namespace iox
@@ -0,0 +1,357 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_domain_bridge/domain_bridge_sink.hpp"
+#include "iceoryx_domain_bridge/chunk_data.hpp"
+#include "iceoryx_domain_bridge/segment_locator.hpp"
+#include "iox/logging.hpp"
+
+#include <cstring>
+
+namespace iox
+{
+namespace gw
+{
+DomainBridgeSink::DomainBridgeSink(const BridgeTransport& transport) noexcept
+    : m_transport(transport)
+{
+}
+
+void DomainBridgeSink::run(const function_ref<bool()> keepRunning) noexcept
+{
+    std::vector<uint8_t> buffer(MAX_BRIDGE_MESSAGE_SIZE);
+    while (m_isConnected && keepRunning())
+    {
+        auto receiveResult = m_transport.receive(buffer.data(), buffer.size());
+        if (receiveResult.has_error())
+        {
+            if (receiveResult.error() == BridgeTransportError::CONNECTION_CLOSED)
+            {
+                IOX_LOG(Info, "The source of the domain bridge has closed the connection");
+            }
+            else
+            {
+                IOX_LOG(Error, "Unable to receive from the source: " << asStringLiteral(receiveResult.error()));
+            }
+            break;
+        }
+
+        if (receiveResult.value() > 0U)
+        {
+            handleMessage(buffer.data(), receiveResult.value());
+        }
+    }
+}
+
+uint64_t DomainBridgeSink::numberOfPublishedChunks() const noexcept
+{
+    return m_numberOfPublishedChunks.load(std::memory_order_relaxed);
+}
+
+uint64_t DomainBridgeSink::numberOfMappedSegments() const noexcept
+{
+    return m_numberOfMappedSegments.load(std::memory_order_relaxed);
+}
+
+void DomainBridgeSink::handleMessage(const void* const message, const uint64_t size) noexcept
+{
+    BridgeMessageReader reader(message, size);
+    for (auto record = reader.next(); record.has_value(); record = reader.next())
+    {
+        handleRecord(record.value());
+    }
+    if (reader.isMalformed())
+    {
+        IOX_LOG(Error, "Received a malformed message from the source");
+    }
+
+    // the chunk references of a message are released together
+    sendReplies();
+}
+
+void DomainBridgeSink::handleRecord(const BridgeRecord& record) noexcept
+{
+    switch (record.type)
+    {
+    case BridgeRecordType::TOPIC_ADDED:
+        if (const auto* topic = record.as<TopicRecord>())
+        {
+            addTopic(*topic);
+            return;
+        }
+        break;
+    case BridgeRecordType::TOPIC_REMOVED:
+        if (const auto* topic = record.as<TopicRecord>())
+        {
+            removeTopic(*topic);
+            return;
+        }
+        break;
+    case BridgeRecordType::SEGMENT:
+        if (const auto* segment = record.as<SegmentRecord>())
+        {
+            mapSegment(*segment);
+            return;
+        }
+        break;
+    case BridgeRecordType::CHUNK_REFERENCE:
+        if (const auto* reference = record.as<ChunkReferenceRecord>())
+        {
+            publishReference(*reference);
+            return;
+        }
+        break;
+    case BridgeRecordType::CHUNK_DATA:
+    {
+        const auto* chunkData = record.as<ChunkDataRecord>();
+        if (chunkData != nullptr && chunkData->fragmentSize <= record.bodySize - sizeof(ChunkDataRecord))
+        {
+            publishData(*chunkData, record.data<ChunkDataRecord>());
+            return;
+        }
+        break;
+    }
+    default:
+        break;
+    }
+
+    IOX_LOG(Warn, "Received an unexpected or invalid record from the source");
+}
+
+void DomainBridgeSink::addTopic(const TopicRecord& record) noexcept
+{
+    if (record.topicId >= MAX_CHANNEL_NUMBER)
+    {
+        IOX_LOG(Error, "Received the invalid topic id " << record.topicId);
+        return;
+    }
+    if (record.topicId >= m_topics.size())
+    {
+        m_topics.resize(record.topicId + 1U);
+    }
+
+    auto& topic = m_topics[record.topicId];
+    if (topic.publisher)
+    {
+        topic.publisher->offer();
+        return;
+    }
+
+    // the interface prevents that the publisher is bridged back into the source domain by another bridge
+    const auto service = record.serviceDescription(capro::Interfaces::DOMAIN_BRIDGE);
+    popo::PublisherOptions options;
+    options.nodeName = NodeName_t(TruncateToCapacity, "iox-domain-bridge");
+    topic.publisher = std::make_unique<popo::UntypedPublisher>(service, options);
+
+    IOX_LOG(Info, "Publishing " << service);
+}
+
+void DomainBridgeSink::removeTopic(const TopicRecord& record) noexcept
+{
+    auto* topic = findTopic(record.topicId);
+    if (topic != nullptr)
+    {
+        topic->publisher->stopOffer();
+    }
+}
+
+void DomainBridgeSink::mapSegment(const SegmentRecord& record) noexcept
+{
+    SegmentMappedRecord reply;
+    reply.segmentIndex = record.segmentIndex;
+
+    if (record.segmentIndex < SegmentLocator::MAX_SEGMENTS)
+    {
+        if (record.segmentIndex >= m_segments.size())
+        {
+            m_segments.resize(record.segmentIndex + 1U);
+        }
+
+        const detail::PosixSharedMemory::Name_t name(
+            TruncateToCapacity, &record.name[0], strnlen(&record.name[0], SegmentRecord::NAME_SIZE - 1U));
+        auto& segment = m_segments[record.segmentIndex];
+        segment.memory.reset();
+        PosixSharedMemoryObjectBuilder()
+            .name(name)
+            .memorySizeInBytes(record.size)
+            .accessMode(AccessMode::ReadOnly)
+            .openMode(OpenMode::OpenExisting)
+            .create()
+            .and_then([&](auto& memory) {
+                segment.memory.emplace(std::move(memory));
+                segment.size = record.size;
+                reply.isMapped = 1U;
+                m_numberOfMappedSegments.fetch_add(1U, std::memory_order_relaxed);
+                IOX_LOG(Info, "Mapped the segment '" << name << "' of the source domain");
+            })
+            .or_else([&](auto) {
+                IOX_LOG(Info,
+                        "Unable to map the segment '" << name
+                                                      << "' of the source domain, its chunks are transferred by copy");
+            });
+    }
+
+    appendReply(BridgeRecordType::SEGMENT_MAPPED, reply);
+}
+
+void DomainBridgeSink::publishReference(const ChunkReferenceRecord& record) noexcept
+{
+    // the source holds the chunk until it is released, regardless whether it could be published
+    releaseReference(record.topicId);
+
+    auto* topic = findTopic(record.topicId);
+    if (topic == nullptr || record.segmentIndex >= m_segments.size()
+        || !m_segments[record.segmentIndex].memory.has_value())
+    {
+        IOX_LOG(Error, "Received a chunk reference of an unknown topic or segment");
+        return;
+    }
+
+    const auto& segment = m_segments[record.segmentIndex];
+    if (record.chunkOffset > segment.size || segment.size - record.chunkOffset < sizeof(mepoo::ChunkHeader))
+    {
+        IOX_LOG(Error, "Received a chunk reference outside of the segment");
+        return;
+    }
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    // the chunk is in the mapped segment, its position was validated above
+    const auto* chunkHeader = reinterpret_cast<const mepoo::ChunkHeader*>(
+        static_cast<const uint8_t*>(segment.memory->getBaseAddress()) + record.chunkOffset);
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    if (chunkHeader->usedSizeOfChunk() > segment.size - record.chunkOffset)
+    {
+        IOX_LOG(Error, "Received a chunk reference which exceeds the segment");
+        return;
+    }
+
+    const auto userHeaderSize = chunkHeader->userHeaderSize();
+    const uint32_t userHeaderAlignment =
+        (userHeaderSize == 0U) ? CHUNK_NO_USER_HEADER_ALIGNMENT : alignof(mepoo::ChunkHeader);
+    topic->publisher
+        ->loan(chunkHeader->userPayloadSize(), chunkHeader->userPayloadAlignment(), userHeaderSize, userHeaderAlignment)
+        .and_then([&](auto& userPayload) {
+            if (userHeaderSize > 0U)
+            {
+                std::memcpy(mepoo::ChunkHeader::fromUserPayload(userPayload)->userHeader(),
+                            chunkHeader->userHeader(),
+                            userHeaderSize);
+            }
+            std::memcpy(userPayload, chunkHeader->userPayload(), chunkHeader->userPayloadSize());
+            topic->publisher->publish(userPayload);
+            m_numberOfPublishedChunks.fetch_add(1U, std::memory_order_relaxed);
+        })
+        .or_else([](auto& error) { IOX_LOG(Warn, "Unable to loan a chunk: " << error); });
+}
+
+void DomainBridgeSink::publishData(const ChunkDataRecord& record, const uint8_t* const data) noexcept
+{
+    auto* topic = findTopic(record.topicId);
+    if (topic == nullptr)
+    {
+        IOX_LOG(Error, "Received a chunk of an unknown topic");
+        return;
+    }
+    auto& publisher = *topic->publisher;
+
+    if (record.fragmentOffset == 0U)
+    {
+        if (topic->pendingUserPayload != nullptr)
+        {
+            IOX_LOG(Warn, "Discarding an incomplete chunk");
+            publisher.release(topic->pendingUserPayload);
+        }
+        topic->pendingUserPayload = nullptr;
+        topic->receivedSize = 0U;
+
+        const bool isChained = (record.flags & ChunkDataRecord::FLAG_CHAINED) != 0U;
+        const uint32_t userHeaderAlignment =
+            (record.userHeaderSize == 0U) ? CHUNK_NO_USER_HEADER_ALIGNMENT : alignof(mepoo::ChunkHeader);
+        auto loanResult = isChained ? publisher.loanChained(record.userPayloadSize, record.userPayloadAlignment)
+                                    : publisher.loan(record.userPayloadSize,
+                                                     record.userPayloadAlignment,
+                                                     record.userHeaderSize,
+                                                     userHeaderAlignment);
+        loanResult.and_then([&](auto& userPayload) { topic->pendingUserPayload = userPayload; })
+            .or_else([](auto& error) { IOX_LOG(Warn, "Unable to loan a chunk: " << error); });
+    }
+
+    if (topic->pendingUserPayload == nullptr || record.fragmentOffset != topic->receivedSize)
+    {
+        // the loan has failed or a fragment is missing, the chunk is discarded
+        return;
+    }
+
+    ChunkData(topic->pendingUserPayload).copyFrom(record.fragmentOffset, data, record.fragmentSize);
+    topic->receivedSize += record.fragmentSize;
+    if (topic->receivedSize >= record.dataSize())
+    {
+        publisher.publish(topic->pendingUserPayload);
+        topic->pendingUserPayload = nullptr;
+        m_numberOfPublishedChunks.fetch_add(1U, std::memory_order_relaxed);
+    }
+}
+
+DomainBridgeSink::Topic* DomainBridgeSink::findTopic(const uint32_t topicId) noexcept
+{
+    if (topicId >= m_topics.size() || !m_topics[topicId].publisher)
+    {
+        return nullptr;
+    }
+    return &m_topics[topicId];
+}
+
+void DomainBridgeSink::releaseReference(const uint32_t topicId) noexcept
+{
+    auto* lastRelease = m_replies.lastRecord<ReleaseRecord>(BridgeRecordType::RELEASE);
+    if (lastRelease != nullptr && lastRelease->topicId == topicId)
+    {
+        ++lastRelease->numberOfChunks;
+        return;
+    }
+
+    ReleaseRecord release;
+    release.topicId = topicId;
+    release.numberOfChunks = 1U;
+    appendReply(BridgeRecordType::RELEASE, release);
+}
+
+template <typename Record>
+void DomainBridgeSink::appendReply(const BridgeRecordType type, const Record& record) noexcept
+{
+    if (!m_replies.append(type, record))
+    {
+        sendReplies();
+        m_replies.append(type, record);
+    }
+}
+
+void DomainBridgeSink::sendReplies() noexcept
+{
+    if (m_replies.empty())
+    {
+        return;
+    }
+
+    m_transport.send(m_replies.data(), m_replies.size()).or_else([&](auto& error) {
+        IOX_LOG(Error, "Unable to send to the source: " << asStringLiteral(error));
+        m_isConnected = false;
+    });
+    m_replies.clear();
+}
+
+} // namespace gw
+} // namespace iox
@@ -0,0 +1,459 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_domain_bridge/domain_bridge_source.hpp"
+#include "iceoryx_domain_bridge/chunk_data.hpp"
+#include "iceoryx_posh/internal/capro/capro_message.hpp"
+#include "iceoryx_posh/roudi/introspection_types.hpp"
+#include "iox/logging.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace iox
+{
+namespace gw
+{
+namespace
+{
+const capro::IdString_t WILDCARD{TruncateToCapacity, "*"};
+
+bool matches(const capro::IdString_t& filter, const capro::IdString_t& value) noexcept
+{
+    return filter == WILDCARD || filter == value;
+}
+
+constexpr units::Duration DISCOVERY_PERIOD{100_ms};
+
+/// @brief a fragment of a chunk is only started in a message when at least this amount of data fits into it
+constexpr uint64_t MIN_FRAGMENT_SIZE{1024U};
+} // namespace
+
+BridgeTopic::BridgeTopic(const capro::IdString_t&, const capro::IdString_t&, const capro::IdString_t&) noexcept
+{
+}
+
+DomainBridgeSource::DomainBridgeSource(const BridgeTransport& transport,
+                                       const bool forceCopy,
+                                       const units::Duration forwardingPeriod) noexcept
+    : GatewayGeneric<ChannelType>(capro::Interfaces::DOMAIN_BRIDGE, DISCOVERY_PERIOD, forwardingPeriod)
+    , m_transport(transport)
+    , m_forceCopy(forceCopy)
+{
+    for (auto& state : m_segmentStates)
+    {
+        state.store(SegmentState::UNKNOWN, std::memory_order_relaxed);
+    }
+    for (auto& releasedChunks : m_releasedChunks)
+    {
+        releasedChunks.store(0U, std::memory_order_relaxed);
+    }
+
+    UnnamedSemaphoreBuilder().initialValue(0U).isInterProcessCapable(false).create(m_wakeUp).or_else([](auto) {
+        IOX_LOG(Warn, "Unable to create the wake up semaphore, the chunks are forwarded periodically");
+    });
+
+    m_receiveThread = std::thread([this] { receiveLoop(); });
+}
+
+DomainBridgeSource::~DomainBridgeSource() noexcept
+{
+    // the threads of the gateway access the members of this class and must be stopped before they are destroyed
+    shutdown();
+    m_keepReceiving.store(false);
+    m_receiveThread.join();
+}
+
+void DomainBridgeSource::loadConfiguration(const config::GatewayConfig& config) noexcept
+{
+    m_bridgedServices.clear();
+    for (const auto& entry : config.m_configuredServices)
+    {
+        m_bridgedServices.push_back(entry.m_serviceDescription);
+    }
+}
+
+void DomainBridgeSource::discover(const capro::CaproMessage& msg) noexcept
+{
+    if (msg.m_serviceType != capro::CaproServiceType::PUBLISHER || !isBridged(msg.m_serviceDescription))
+    {
+        return;
+    }
+
+    if (msg.m_type == capro::CaproMessageType::OFFER)
+    {
+        addTopic(msg.m_serviceDescription);
+    }
+    else if (msg.m_type == capro::CaproMessageType::STOP_OFFER)
+    {
+        removeTopic(msg.m_serviceDescription);
+    }
+}
+
+void DomainBridgeSource::forward(const ChannelType& channel) noexcept
+{
+    auto& topic = *channel.getExternalTerminal();
+    auto& subscriber = *channel.getIceoryxTerminal();
+    if (!topic.isAnnounced.load(std::memory_order_acquire) || !isConnected())
+    {
+        return;
+    }
+
+    releaseChunks(topic, subscriber);
+
+    while (topic.chunksInFlight.size() < MAX_CHUNKS_IN_FLIGHT_PER_TOPIC)
+    {
+        auto takeResult = subscriber.take();
+        if (takeResult.has_error())
+        {
+            break;
+        }
+
+        const void* userPayload = takeResult.value();
+        if (!sendByReference(topic, userPayload))
+        {
+            sendByCopy(topic, userPayload);
+            subscriber.release(userPayload);
+        }
+    }
+}
+
+bool DomainBridgeSource::isConnected() const noexcept
+{
+    return m_isConnected.load(std::memory_order_relaxed);
+}
+
+uint64_t DomainBridgeSource::numberOfChunksSentByReference() const noexcept
+{
+    return m_numberOfChunksSentByReference.load(std::memory_order_relaxed);
+}
+
+uint64_t DomainBridgeSource::numberOfChunksSentByCopy() const noexcept
+{
+    return m_numberOfChunksSentByCopy.load(std::memory_order_relaxed);
+}
+
+void DomainBridgeSource::waitForNextForwarding(const std::chrono::steady_clock::time_point deadline) noexcept
+{
+    // the records of all channels of a cycle are sent together
+    flush();
+
+    const auto now = std::chrono::steady_clock::now();
+    if (!m_wakeUp.has_value() || now >= deadline)
+    {
+        std::this_thread::sleep_until(deadline);
+        return;
+    }
+
+    const auto timeout = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - now);
+    m_wakeUp->timedWait(units::Duration::fromNanoseconds(static_cast<uint64_t>(timeout.count())))
+        .or_else([](auto) { IOX_LOG(Error, "Unable to wait for new chunks"); });
+}
+
+bool DomainBridgeSource::isBridged(const capro::ServiceDescription& service) const noexcept
+{
+    for (const auto& bridgedService : m_bridgedServices)
+    {
+        if (matches(bridgedService.getServiceIDString(), service.getServiceIDString())
+            && matches(bridgedService.getInstanceIDString(), service.getInstanceIDString())
+            && matches(bridgedService.getEventIDString(), service.getEventIDString()))
+        {
+            const bool isInternalService =
+                service.getServiceIDString() == capro::IdString_t(TruncateToCapacity, roudi::INTROSPECTION_SERVICE_ID)
+                || service.getServiceIDString()
+                       == capro::IdString_t(TruncateToCapacity, SERVICE_DISCOVERY_SERVICE_NAME);
+            // the internal services are only bridged when they are requested explicitly
+            return !isInternalService || bridgedService.getServiceIDString() != WILDCARD;
+        }
+    }
+    return false;
+}
+
+void DomainBridgeSource::addTopic(const capro::ServiceDescription& service) noexcept
+{
+    popo::SubscriberOptions options;
+    options.queueCapacity = popo::SubscriberChunkQueueData_t::MAX_CAPACITY;
+    options.nodeName = NodeName_t(TruncateToCapacity, "iox-domain-bridge");
+
+    auto channel = addChannel(service, options);
+    if (channel.has_error())
+    {
+        IOX_LOG(Warn, "Unable to bridge the service " << service);
+        return;
+    }
+
+    auto& topic = *channel->getExternalTerminal();
+    if (topic.topicId == INVALID_TOPIC_ID)
+    {
+        topic.topicId = m_nextTopicId++;
+
+        auto& subscriber = *channel->getIceoryxTerminal();
+        m_listener
+            .attachEvent(subscriber,
+                         popo::SubscriberEvent::DATA_RECEIVED,
+                         popo::createNotificationCallback(onDataReceived, *this))
+            .or_else([&](auto) {
+                IOX_LOG(Info, "The chunks of " << service << " are forwarded periodically since the listener is full");
+            });
+    }
+
+    m_discoveryWriter.clear();
+    m_discoveryWriter.append(BridgeRecordType::TOPIC_ADDED, TopicRecord::create(topic.topicId, service));
+    send(m_discoveryWriter);
+    topic.isAnnounced.store(true, std::memory_order_release);
+
+    IOX_LOG(Info, "Bridging " << service);
+}
+
+void DomainBridgeSource::removeTopic(const capro::ServiceDescription& service) noexcept
+{
+    // the channel is kept since its chunks might still be in flight; the topic is announced again when the service
+    // is offered again
+    findChannel(service).and_then([&](auto& channel) {
+        auto& topic = *channel.getExternalTerminal();
+        if (topic.topicId == INVALID_TOPIC_ID)
+        {
+            return;
+        }
+        m_discoveryWriter.clear();
+        m_discoveryWriter.append(BridgeRecordType::TOPIC_REMOVED, TopicRecord::create(topic.topicId, service));
+        send(m_discoveryWriter);
+
+        IOX_LOG(Info, "Stopped bridging " << service);
+    });
+}
+
+void DomainBridgeSource::releaseChunks(BridgeTopic& topic, popo::UntypedSubscriber& subscriber) noexcept
+{
+    auto numberOfChunks = m_releasedChunks[topic.topicId].exchange(0U, std::memory_order_acquire);
+    for (; numberOfChunks > 0U && !topic.chunksInFlight.empty(); --numberOfChunks)
+    {
+        subscriber.release(topic.chunksInFlight.front());
+        topic.chunksInFlight.pop_front();
+    }
+
+    if (numberOfChunks > 0U)
+    {
+        IOX_LOG(Error, "The sink has released more chunks than were sent to it");
+    }
+}
+
+bool DomainBridgeSource::sendByReference(BridgeTopic& topic, const void* const userPayload) noexcept
+{
+    // the continuation chunks of a chained message are referenced by relative pointers which cannot be resolved in
+    // the other domain
+    if (m_forceCopy || mepoo::ConstChainedPayload::fromUserPayload(userPayload).has_value())
+    {
+        return false;
+    }
+
+    const auto* chunkHeader = mepoo::ChunkHeader::fromUserPayload(userPayload);
+    auto location = m_segmentLocator.locate(chunkHeader);
+    if (!location.has_value())
+    {
+        return false;
+    }
+
+    const auto segmentIndex = location->segmentIndex;
+    switch (m_segmentStates[segmentIndex].load(std::memory_order_acquire))
+    {
+    case SegmentState::UNKNOWN:
+        announceSegment(segmentIndex);
+        return false;
+    case SegmentState::ANNOUNCED:
+    case SegmentState::UNAVAILABLE:
+        return false;
+    case SegmentState::MAPPED:
+        break;
+    }
+
+    if (location->offset + chunkHeader->usedSizeOfChunk() > m_announcedSegmentSizes[segmentIndex])
+    {
+        // the chunk is in a region which was mapped after the segment was announced
+        return false;
+    }
+
+    ChunkReferenceRecord record;
+    record.topicId = topic.topicId;
+    record.segmentIndex = segmentIndex;
+    record.chunkOffset = location->offset;
+    appendRecord(BridgeRecordType::CHUNK_REFERENCE, record);
+
+    topic.chunksInFlight.push_back(userPayload);
+    m_numberOfChunksSentByReference.fetch_add(1U, std::memory_order_relaxed);
+    return true;
+}
+
+void DomainBridgeSource::sendByCopy(const BridgeTopic& topic, const void* const userPayload) noexcept
+{
+    const ConstChunkData chunkData(userPayload);
+
+    ChunkDataRecord record;
+    record.topicId = topic.topicId;
+    record.flags = chunkData.isChained() ? ChunkDataRecord::FLAG_CHAINED : 0U;
+    record.userHeaderSize = chunkData.userHeaderSize();
+    record.userPayloadSize = chunkData.userPayloadSize();
+    record.userPayloadAlignment = chunkData.userPayloadAlignment();
+
+    const auto dataSize = chunkData.size();
+    do
+    {
+        const auto availableSize = m_writer.availableDataSize<ChunkDataRecord>();
+        const auto remainingSize = dataSize - record.fragmentOffset;
+        if (availableSize < std::min(remainingSize, MIN_FRAGMENT_SIZE) || availableSize == 0U)
+        {
+            flush();
+            continue;
+        }
+
+        record.fragmentSize = std::min(remainingSize, availableSize);
+        auto* data = m_writer.appendWithData(BridgeRecordType::CHUNK_DATA, record, record.fragmentSize);
+        chunkData.copyTo(record.fragmentOffset, data, record.fragmentSize);
+        record.fragmentOffset += record.fragmentSize;
+    } while (record.fragmentOffset < dataSize && isConnected());
+
+    m_numberOfChunksSentByCopy.fetch_add(1U, std::memory_order_relaxed);
+}
+
+void DomainBridgeSource::announceSegment(const uint32_t segmentIndex) noexcept
+{
+    m_segmentLocator.segment(segmentIndex).and_then([&](auto& segment) {
+        SegmentRecord record;
+        record.segmentIndex = segmentIndex;
+        record.size = segment.size;
+        std::memcpy(&record.name[0], segment.name.c_str(), segment.name.size());
+
+        m_announcedSegmentSizes[segmentIndex] = segment.size;
+        m_segmentStates[segmentIndex].store(SegmentState::ANNOUNCED, std::memory_order_relaxed);
+        appendRecord(BridgeRecordType::SEGMENT, record);
+    });
+}
+
+template <typename Record>
+void DomainBridgeSource::appendRecord(const BridgeRecordType type, const Record& record) noexcept
+{
+    if (!m_writer.append(type, record))
+    {
+        flush();
+        m_writer.append(type, record);
+    }
+}
+
+void DomainBridgeSource::flush() noexcept
+{
+    if (!m_writer.empty())
+    {
+        send(m_writer);
+        m_writer.clear();
+    }
+}
+
+void DomainBridgeSource::send(const BridgeMessageWriter& writer) noexcept
+{
+    if (!isConnected())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_sendMutex);
+    m_transport.send(writer.data(), writer.size()).or_else([&](auto& error) {
+        IOX_LOG(Error, "Unable to send to the sink: " << asStringLiteral(error));
+        m_isConnected.store(false, std::memory_order_relaxed);
+    });
+}
+
+void DomainBridgeSource::receiveLoop() noexcept
+{
+    std::vector<uint8_t> buffer(MAX_BRIDGE_MESSAGE_SIZE);
+    while (m_keepReceiving.load(std::memory_order_relaxed) && isConnected())
+    {
+        auto receiveResult = m_transport.receive(buffer.data(), buffer.size());
+        if (receiveResult.has_error())
+        {
+            if (receiveResult.error() == BridgeTransportError::CONNECTION_CLOSED)
+            {
+                IOX_LOG(Info, "The sink of the domain bridge has closed the connection");
+            }
+            else
+            {
+                IOX_LOG(Error, "Unable to receive from the sink: " << asStringLiteral(receiveResult.error()));
+            }
+            m_isConnected.store(false, std::memory_order_relaxed);
+            break;
+        }
+        if (receiveResult.value() == 0U)
+        {
+            continue;
+        }
+
+        BridgeMessageReader reader(buffer.data(), receiveResult.value());
+        for (auto record = reader.next(); record.has_value(); record = reader.next())
+        {
+            handleReply(record.value());
+        }
+        if (reader.isMalformed())
+        {
+            IOX_LOG(Error, "Received a malformed message from the sink");
+        }
+
+        if (m_wakeUp.has_value())
+        {
+            m_wakeUp->post().or_else([](auto) { IOX_LOG(Error, "Unable to wake up the forwarding"); });
+        }
+    }
+}
+
+void DomainBridgeSource::handleReply(const BridgeRecord& record) noexcept
+{
+    switch (record.type)
+    {
+    case BridgeRecordType::SEGMENT_MAPPED:
+    {
+        const auto* segmentMapped = record.as<SegmentMappedRecord>();
+        if (segmentMapped != nullptr && segmentMapped->segmentIndex < SegmentLocator::MAX_SEGMENTS)
+        {
+            m_segmentStates[segmentMapped->segmentIndex].store(
+                segmentMapped->isMapped != 0U ? SegmentState::MAPPED : SegmentState::UNAVAILABLE,
+                std::memory_order_release);
+        }
+        break;
+    }
+    case BridgeRecordType::RELEASE:
+    {
+        const auto* release = record.as<ReleaseRecord>();
+        if (release != nullptr && release->topicId < MAX_CHANNEL_NUMBER)
+        {
+            m_releasedChunks[release->topicId].fetch_add(release->numberOfChunks, std::memory_order_release);
+        }
+        break;
+    }
+    default:
+        IOX_LOG(Warn, "Received an unexpected record from the sink");
+        break;
+    }
+}
+
+void DomainBridgeSource::onDataReceived(popo::UntypedSubscriber* const, DomainBridgeSource* const self) noexcept
+{
+    if (self->m_wakeUp.has_value())
+    {
+        self->m_wakeUp->post().or_else([](auto) { IOX_LOG(Error, "Unable to wake up the forwarding"); });
+    }
+}
+
+} // namespace gw
+} // namespace iox
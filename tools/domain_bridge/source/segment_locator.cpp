@@ -0,0 +1,192 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_domain_bridge/segment_locator.hpp"
+#include "iox/file.hpp"
+#include "iox/file_reader.hpp"
+#include "iox/logging.hpp"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+namespace iox
+{
+namespace gw
+{
+SegmentLocator::SegmentLocator(const std::string& memoryMapsFile) noexcept
+    : m_memoryMapsFile(memoryMapsFile)
+{
+    update();
+}
+
+optional<SegmentLocation> SegmentLocator::locate(const void* const address) noexcept
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) the address is only compared with the regions
+    const auto addressValue = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(address));
+    auto location = find(addressValue);
+    if (!location.has_value() && m_isSupported)
+    {
+        update();
+        location = find(addressValue);
+    }
+    return location;
+}
+
+optional<SharedMemorySegment> SegmentLocator::segment(const uint32_t segmentIndex) const noexcept
+{
+    if (segmentIndex >= m_segments.size())
+    {
+        return nullopt;
+    }
+    return m_segments[segmentIndex];
+}
+
+optional<SegmentLocation> SegmentLocator::find(const uint64_t address) const noexcept
+{
+    auto region = std::upper_bound(m_regions.begin(), m_regions.end(), address, [](auto value, const auto& region) {
+        return value < region.begin;
+    });
+    if (region == m_regions.begin())
+    {
+        return nullopt;
+    }
+    --region;
+    if (address >= region->end)
+    {
+        return nullopt;
+    }
+    return SegmentLocation{region->segmentIndex, region->fileOffset + (address - region->begin)};
+}
+
+void SegmentLocator::update() noexcept
+{
+    FileReader reader(m_memoryMapsFile, "", FileReader::ErrorMode::Ignore);
+    if (!reader.isOpen())
+    {
+        IOX_LOG(Info,
+                "The memory maps '" << m_memoryMapsFile.c_str()
+                                    << "' are not available, the chunks are transferred by copy");
+        m_isSupported = false;
+        return;
+    }
+
+    const auto directoryLength = strlen(SHARED_MEMORY_DIRECTORY);
+    std::vector<Region> regions;
+    std::vector<uint32_t> grownSegments;
+    std::string line;
+    while (reader.readLine(line))
+    {
+        // e.g. "7f2a1c000000-7f2a2c000000 rw-s 00000000 00:19 1234    /dev/shm/iox1_0_i_root"
+        uint64_t begin{0U};
+        uint64_t end{0U};
+        uint64_t fileOffset{0U};
+        char permissions[5]{};
+        int pathPosition{0};
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) the format of the memory maps is fixed
+        if (std::sscanf(line.c_str(),
+                        "%" SCNx64 "-%" SCNx64 " %4s %" SCNx64 " %*s %*s %n",
+                        &begin,
+                        &end,
+                        &permissions[0],
+                        &fileOffset,
+                        &pathPosition)
+                != 4
+            || pathPosition <= 0 || permissions[3] != 's')
+        {
+            continue;
+        }
+
+        const auto path = line.substr(static_cast<uint64_t>(pathPosition));
+        if (path.compare(0U, directoryLength, SHARED_MEMORY_DIRECTORY) != 0
+            || path.find(' ') != std::string::npos)
+        {
+            // not a shared memory object or a deleted one
+            continue;
+        }
+
+        const SharedMemorySegment::Name_t name(TruncateToCapacity, path.substr(directoryLength).c_str());
+        const auto index = segmentIndex(name);
+        if (!index.has_value())
+        {
+            continue;
+        }
+
+        auto& segment = m_segments[index.value()];
+        if (fileOffset + (end - begin) > segment.size)
+        {
+            segment.size = fileOffset + (end - begin);
+            grownSegments.push_back(index.value());
+        }
+        regions.push_back(Region{begin, end, fileOffset, index.value()});
+    }
+
+    // the regions are page aligned while the shared memory object might be smaller
+    for (const auto index : grownSegments)
+    {
+        auto& segment = m_segments[index];
+        fileSize(segment.name).and_then([&](const auto size) { segment.size = std::min(segment.size, size); });
+    }
+
+    std::sort(regions.begin(), regions.end(), [](const auto& lhs, const auto& rhs) { return lhs.begin < rhs.begin; });
+    m_regions = std::move(regions);
+}
+
+optional<uint64_t> SegmentLocator::fileSize(const SharedMemorySegment::Name_t& name) noexcept
+{
+    const string<platform::IOX_MAX_FILENAME_LENGTH> directory(TruncateToCapacity, SHARED_MEMORY_DIRECTORY);
+    auto path = FilePath::create(concatenate(directory, name));
+    if (path.has_error())
+    {
+        return nullopt;
+    }
+    auto file = FileBuilder().open(path.value());
+    if (file.has_error())
+    {
+        return nullopt;
+    }
+    auto size = file->get_size();
+    if (size.has_error())
+    {
+        return nullopt;
+    }
+    return size.value();
+}
+
+optional<uint32_t> SegmentLocator::segmentIndex(const SharedMemorySegment::Name_t& name) noexcept
+{
+    for (uint32_t index = 0U; index < m_segments.size(); ++index)
+    {
+        if (m_segments[index].name == name)
+        {
+            return index;
+        }
+    }
+
+    if (m_segments.size() >= MAX_SEGMENTS)
+    {
+        IOX_LOG(Warn, "Too many shared memory segments, '" << name << "' is transferred by copy");
+        return nullopt;
+    }
+
+    m_segments.push_back(SharedMemorySegment{name, 0U});
+    return static_cast<uint32_t>(m_segments.size() - 1U);
+}
+
+} // namespace gw
+} // namespace iox
@@ -0,0 +1,172 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_domain_bridge/bridge_protocol.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::gw;
+
+ReleaseRecord releaseRecord(const uint32_t topicId, const uint32_t numberOfChunks)
+{
+    ReleaseRecord record;
+    record.topicId = topicId;
+    record.numberOfChunks = numberOfChunks;
+    return record;
+}
+
+TEST(BridgeProtocol_test, RecordsAreReadInTheOrderTheyWereAppended)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ee9da4ca-5492-463a-9c45-df49feeaa98c");
+    const capro::ServiceDescription service{"Radar", "Front", "Objects"};
+
+    BridgeMessageWriter writer;
+    ASSERT_TRUE(writer.append(BridgeRecordType::TOPIC_ADDED, TopicRecord::create(3U, service)));
+    ASSERT_TRUE(writer.append(BridgeRecordType::RELEASE, releaseRecord(3U, 7U)));
+    EXPECT_THAT(writer.size() % BRIDGE_RECORD_ALIGNMENT, Eq(0U));
+
+    BridgeMessageReader reader(writer.data(), writer.size());
+
+    auto topic = reader.next();
+    ASSERT_TRUE(topic.has_value());
+    ASSERT_THAT(topic->type, Eq(BridgeRecordType::TOPIC_ADDED));
+    ASSERT_THAT(topic->as<TopicRecord>(), Ne(nullptr));
+    EXPECT_THAT(topic->as<TopicRecord>()->topicId, Eq(3U));
+    const auto bridgedService = topic->as<TopicRecord>()->serviceDescription(capro::Interfaces::DOMAIN_BRIDGE);
+    EXPECT_THAT(bridgedService, Eq(service));
+    EXPECT_THAT(bridgedService.getSourceInterface(), Eq(capro::Interfaces::DOMAIN_BRIDGE));
+
+    auto release = reader.next();
+    ASSERT_TRUE(release.has_value());
+    ASSERT_THAT(release->type, Eq(BridgeRecordType::RELEASE));
+    ASSERT_THAT(release->as<ReleaseRecord>(), Ne(nullptr));
+    EXPECT_THAT(release->as<ReleaseRecord>()->numberOfChunks, Eq(7U));
+
+    EXPECT_FALSE(reader.next().has_value());
+    EXPECT_FALSE(reader.isMalformed());
+}
+
+TEST(BridgeProtocol_test, DataOfARecordIsReadWithTheRecord)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5a8327f0-a843-48bd-b215-f83e023bf2a6");
+    constexpr char DATA[]{"hypnotoad"};
+
+    ChunkDataRecord record;
+    record.topicId = 1U;
+    record.userPayloadSize = sizeof(DATA);
+    record.fragmentSize = sizeof(DATA);
+
+    BridgeMessageWriter writer;
+    auto* data = writer.appendWithData(BridgeRecordType::CHUNK_DATA, record, sizeof(DATA));
+    ASSERT_THAT(data, Ne(nullptr));
+    std::memcpy(data, &DATA[0], sizeof(DATA));
+    EXPECT_THAT(writer.size() % BRIDGE_RECORD_ALIGNMENT, Eq(0U));
+
+    BridgeMessageReader reader(writer.data(), writer.size());
+    auto chunkData = reader.next();
+    ASSERT_TRUE(chunkData.has_value());
+    ASSERT_THAT(chunkData->as<ChunkDataRecord>(), Ne(nullptr));
+    EXPECT_THAT(chunkData->as<ChunkDataRecord>()->fragmentSize, Eq(sizeof(DATA)));
+    EXPECT_THAT(chunkData->bodySize, Ge(sizeof(ChunkDataRecord) + sizeof(DATA)));
+    EXPECT_THAT(std::memcmp(chunkData->data<ChunkDataRecord>(), &DATA[0], sizeof(DATA)), Eq(0));
+}
+
+TEST(BridgeProtocol_test, RecordIsNotAppendedWhenTheMessageIsFull)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6956bd98-fec0-42a6-ba88-f11b62cf7908");
+    BridgeMessageWriter writer(sizeof(BridgeRecordHeader) + sizeof(ReleaseRecord));
+
+    EXPECT_TRUE(writer.append(BridgeRecordType::RELEASE, releaseRecord(0U, 1U)));
+    EXPECT_FALSE(writer.append(BridgeRecordType::RELEASE, releaseRecord(1U, 1U)));
+    EXPECT_THAT(writer.availableDataSize<ChunkDataRecord>(), Eq(0U));
+    EXPECT_THAT(writer.appendWithData(BridgeRecordType::CHUNK_DATA, ChunkDataRecord(), 1U), Eq(nullptr));
+
+    writer.clear();
+    EXPECT_TRUE(writer.empty());
+    EXPECT_TRUE(writer.append(BridgeRecordType::RELEASE, releaseRecord(1U, 1U)));
+}
+
+TEST(BridgeProtocol_test, LastRecordOfTheRequestedTypeCanBeMerged)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f5ab45b6-85ab-4f2e-a705-5bf240273a71");
+    BridgeMessageWriter writer;
+    EXPECT_THAT(writer.lastRecord<ReleaseRecord>(BridgeRecordType::RELEASE), Eq(nullptr));
+
+    ASSERT_TRUE(writer.append(BridgeRecordType::RELEASE, releaseRecord(2U, 1U)));
+    EXPECT_THAT(writer.lastRecord<SegmentMappedRecord>(BridgeRecordType::SEGMENT_MAPPED), Eq(nullptr));
+    auto* lastRelease = writer.lastRecord<ReleaseRecord>(BridgeRecordType::RELEASE);
+    ASSERT_THAT(lastRelease, Ne(nullptr));
+    ++lastRelease->numberOfChunks;
+
+    BridgeMessageReader reader(writer.data(), writer.size());
+    auto release = reader.next();
+    ASSERT_TRUE(release.has_value());
+    EXPECT_THAT(release->as<ReleaseRecord>()->numberOfChunks, Eq(2U));
+    EXPECT_FALSE(reader.next().has_value());
+}
+
+TEST(BridgeProtocol_test, RecordWhichIsTooSmallForTheRequestedTypeIsNotInterpreted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "da875ddc-9dfa-4938-be84-0fa99c1eaf16");
+    BridgeMessageWriter writer;
+    ASSERT_TRUE(writer.append(BridgeRecordType::SEGMENT, releaseRecord(0U, 1U)));
+
+    BridgeMessageReader reader(writer.data(), writer.size());
+    auto segment = reader.next();
+    ASSERT_TRUE(segment.has_value());
+    EXPECT_THAT(segment->as<SegmentRecord>(), Eq(nullptr));
+}
+
+TEST(BridgeProtocol_test, RecordWithInvalidSizeMarksTheMessageAsMalformed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4d3acd3a-c17c-436f-8a6e-548ad84d153a");
+    BridgeMessageWriter writer;
+    ASSERT_TRUE(writer.append(BridgeRecordType::RELEASE, releaseRecord(0U, 1U)));
+    ASSERT_TRUE(writer.append(BridgeRecordType::RELEASE, releaseRecord(1U, 1U)));
+
+    // the size of the second record exceeds the message
+    std::vector<uint8_t> message(writer.data(), writer.data() + writer.size());
+    BridgeRecordHeader header;
+    std::memcpy(&header, &message[writer.size() / 2U], sizeof(header));
+    header.size += BRIDGE_RECORD_ALIGNMENT;
+    std::memcpy(&message[writer.size() / 2U], &header, sizeof(header));
+
+    BridgeMessageReader reader(message.data(), message.size());
+    EXPECT_TRUE(reader.next().has_value());
+    EXPECT_FALSE(reader.next().has_value());
+    EXPECT_TRUE(reader.isMalformed());
+}
+
+TEST(BridgeProtocol_test, TruncatedMessageIsMalformed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bbd13262-f2b0-40dd-af31-a222aee44b67");
+    BridgeMessageWriter writer;
+    ASSERT_TRUE(writer.append(BridgeRecordType::RELEASE, releaseRecord(0U, 1U)));
+
+    BridgeMessageReader reader(writer.data(), sizeof(BridgeRecordHeader) - 1U);
+    EXPECT_FALSE(reader.next().has_value());
+    EXPECT_TRUE(reader.isMalformed());
+}
+
+} // namespace
@@ -0,0 +1,296 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_domain_bridge/domain_bridge_sink.hpp"
+#include "iceoryx_domain_bridge/domain_bridge_source.hpp"
+#include "iceoryx_posh/internal/capro/capro_message.hpp"
+#include "iceoryx_posh/mepoo/chained_payload.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/popo/untyped_publisher.hpp"
+#include "iceoryx_posh/popo/untyped_subscriber.hpp"
+#include "iceoryx_posh/roudi/introspection_types.hpp"
+#include "iceoryx_posh/roudi_env/minimal_iceoryx_config.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_posh/testing/roudi_gtest.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::gw;
+using namespace iox::roudi_env;
+
+/// @brief drives the forwarding of the source from the test thread, which owns the runtime
+class TestDomainBridgeSource : public DomainBridgeSource
+{
+  public:
+    using DomainBridgeSource::DomainBridgeSource;
+
+    void forwardAll()
+    {
+        forEachChannel([&](auto& channel) { forward(channel); });
+        waitForNextForwarding(std::chrono::steady_clock::now());
+    }
+};
+
+struct BridgedSample
+{
+    uint64_t value{0U};
+    uint64_t userHeader{0U};
+};
+
+/// @brief The source and the sink are connected in a single domain. The subscriber of the test receives the chunks
+/// of the publisher of the test and their copies from the publisher of the sink, which are distinguished by their
+/// origin. The source does not subscribe to the publisher of the sink, since both use the DOMAIN_BRIDGE interface.
+class DomainBridge_test : public iox::testing::RouDi_GTest
+{
+  public:
+    DomainBridge_test()
+        : RouDi_GTest(MinimalIceoryxConfigBuilder().payloadChunkCount(32U).create())
+    {
+    }
+
+    void createSource(const bool forceCopy, const capro::ServiceDescription& bridgedService)
+    {
+        m_source.reset();
+        m_source = std::make_unique<TestDomainBridgeSource>(
+            m_transports.first, forceCopy, units::Duration::fromMilliseconds(10));
+        config::GatewayConfig config;
+        config.m_configuredServices.push_back({bridgedService});
+        m_source->loadConfiguration(config);
+    }
+
+    void startBridge(const bool forceCopy)
+    {
+        createSource(forceCopy, m_serviceDescription);
+
+        m_source->discover(
+            {capro::CaproMessageType::OFFER, m_serviceDescription, capro::CaproServiceType::PUBLISHER});
+        receiveInSink();
+        triggerDiscoveryLoopAndWaitToFinish();
+    }
+
+    /// @brief processes the messages of the source until the receive timeout of the transport elapses
+    void receiveInSink()
+    {
+        uint32_t cycles{0U};
+        m_sink.run([&] { return cycles++ < 3U; });
+    }
+
+    void bridge()
+    {
+        m_source->forwardAll();
+        receiveInSink();
+    }
+
+    void publish(const uint64_t value, const uint64_t userHeader)
+    {
+        m_publisher.loan(sizeof(value), alignof(uint64_t), sizeof(userHeader), alignof(uint64_t))
+            .and_then([&](auto& userPayload) {
+                *static_cast<uint64_t*>(mepoo::ChunkHeader::fromUserPayload(userPayload)->userHeader()) = userHeader;
+                *static_cast<uint64_t*>(userPayload) = value;
+                m_publisher.publish(userPayload);
+            })
+            .or_else([](auto&) { GTEST_FAIL() << "Expected to loan a chunk"; });
+    }
+
+    std::vector<BridgedSample> takeBridgedSamples()
+    {
+        std::vector<BridgedSample> samples;
+        for (auto userPayload = m_subscriber.take(); !userPayload.has_error(); userPayload = m_subscriber.take())
+        {
+            const auto* chunkHeader = mepoo::ChunkHeader::fromUserPayload(userPayload.value());
+            if (chunkHeader->originId() != m_publisher.getUid())
+            {
+                samples.push_back({*static_cast<const uint64_t*>(userPayload.value()),
+                                   *static_cast<const uint64_t*>(chunkHeader->userHeader())});
+            }
+            m_subscriber.release(userPayload.value());
+        }
+        return samples;
+    }
+
+    runtime::PoshRuntime* m_runtime{&runtime::PoshRuntime::initRuntime("domain_bridge_test")};
+    capro::ServiceDescription m_serviceDescription{"Radar", "Front", "Objects"};
+    popo::UntypedPublisher m_publisher{m_serviceDescription};
+    popo::UntypedSubscriber m_subscriber{m_serviceDescription};
+    BridgeTransport::Pair_t m_transports{
+        BridgeTransport::createPair(units::Duration::fromMilliseconds(10)).expect("creating the transports")};
+    DomainBridgeSink m_sink{m_transports.second};
+    std::unique_ptr<TestDomainBridgeSource> m_source;
+};
+
+TEST_F(DomainBridge_test, ChunksAreBridgedByReferenceOnceTheSinkHasMappedTheSegment)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0c4f459b-0594-420a-b258-0c1785ab3ba6");
+    startBridge(false);
+
+    // the first chunk announces the segment and is sent by copy until the sink has mapped the segment
+    constexpr uint64_t MAX_CYCLES{100U};
+    uint64_t numberOfPublishedChunks{0U};
+    while (m_source->numberOfChunksSentByReference() == 0U && numberOfPublishedChunks < MAX_CYCLES)
+    {
+        publish(numberOfPublishedChunks, numberOfPublishedChunks + 1000U);
+        ++numberOfPublishedChunks;
+        bridge();
+    }
+
+    EXPECT_THAT(m_sink.numberOfMappedSegments(), Ge(1U));
+    EXPECT_THAT(m_source->numberOfChunksSentByReference(), Eq(1U));
+    EXPECT_THAT(m_source->numberOfChunksSentByReference() + m_source->numberOfChunksSentByCopy(),
+                Eq(numberOfPublishedChunks));
+    EXPECT_THAT(m_sink.numberOfPublishedChunks(), Eq(numberOfPublishedChunks));
+
+    const auto samples = takeBridgedSamples();
+    ASSERT_THAT(samples.size(), Eq(numberOfPublishedChunks));
+    for (uint64_t i = 0U; i < samples.size(); ++i)
+    {
+        EXPECT_THAT(samples[i].value, Eq(i));
+        EXPECT_THAT(samples[i].userHeader, Eq(i + 1000U));
+    }
+}
+
+TEST_F(DomainBridge_test, ChunksSentByReferenceAreReleasedByTheSink)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ff9e1c3f-068f-4baf-a61f-96c9151fff78");
+    startBridge(false);
+
+    // more chunks than the mempool provides are only available when the references are released
+    constexpr uint64_t NUMBER_OF_CHUNKS{100U};
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        publish(i, 0U);
+        bridge();
+        EXPECT_THAT(takeBridgedSamples().size(), Eq(1U));
+    }
+
+    EXPECT_THAT(m_source->numberOfChunksSentByReference(), Gt(0U));
+    EXPECT_THAT(m_sink.numberOfPublishedChunks(), Eq(NUMBER_OF_CHUNKS));
+}
+
+TEST_F(DomainBridge_test, ChunksAreBridgedByCopyWhenCopyIsForced)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4959bbde-6c20-4709-ba50-2ce3366c1ed2");
+    startBridge(true);
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        publish(i, i + 1000U);
+    }
+    bridge();
+
+    EXPECT_THAT(m_source->numberOfChunksSentByReference(), Eq(0U));
+    EXPECT_THAT(m_source->numberOfChunksSentByCopy(), Eq(NUMBER_OF_CHUNKS));
+
+    const auto samples = takeBridgedSamples();
+    ASSERT_THAT(samples.size(), Eq(NUMBER_OF_CHUNKS));
+    for (uint64_t i = 0U; i < samples.size(); ++i)
+    {
+        EXPECT_THAT(samples[i].value, Eq(i));
+        EXPECT_THAT(samples[i].userHeader, Eq(i + 1000U));
+    }
+}
+
+TEST_F(DomainBridge_test, ChainedMessageIsBridged)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b8b55841-7b2d-4d66-a394-db9ad23d4d46");
+    // larger than the chunks of the minimal config, i.e. a chained message is required
+    constexpr uint64_t USER_PAYLOAD_SIZE{300U};
+    startBridge(false);
+
+    std::vector<uint8_t> data(USER_PAYLOAD_SIZE);
+    for (uint64_t i = 0U; i < USER_PAYLOAD_SIZE; ++i)
+    {
+        data[i] = static_cast<uint8_t>(i);
+    }
+    m_publisher.loanChained(USER_PAYLOAD_SIZE)
+        .and_then([&](auto& userPayload) {
+            mepoo::ChainedPayload::fromUserPayload(userPayload).and_then([&](auto& chainedPayload) {
+                chainedPayload.copyFrom(data.data(), data.size());
+            });
+            m_publisher.publish(userPayload);
+        })
+        .or_else([](auto&) { GTEST_FAIL() << "Expected to loan a chained message"; });
+    bridge();
+
+    EXPECT_THAT(m_source->numberOfChunksSentByCopy(), Eq(1U));
+
+    auto original = m_subscriber.take();
+    ASSERT_FALSE(original.has_error());
+    m_subscriber.release(original.value());
+
+    auto userPayload = m_subscriber.take();
+    ASSERT_FALSE(userPayload.has_error());
+    EXPECT_THAT(mepoo::ChunkHeader::fromUserPayload(userPayload.value())->originId(), Ne(m_publisher.getUid()));
+    auto chainedPayload = mepoo::ConstChainedPayload::fromUserPayload(userPayload.value());
+    ASSERT_TRUE(chainedPayload.has_value());
+    ASSERT_THAT(chainedPayload->size(), Eq(USER_PAYLOAD_SIZE));
+    std::vector<uint8_t> bridgedData(USER_PAYLOAD_SIZE);
+    chainedPayload->copyTo(bridgedData.data(), bridgedData.size());
+    EXPECT_THAT(bridgedData, Eq(data));
+    m_subscriber.release(userPayload.value());
+}
+
+TEST_F(DomainBridge_test, ServiceNotMatchingTheConfigurationIsNotBridged)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "da4ccf05-b227-416c-8bd8-df5d41458b7b");
+    startBridge(false);
+
+    m_source->discover(
+        {capro::CaproMessageType::OFFER, {"Lidar", "Front", "Points"}, capro::CaproServiceType::PUBLISHER});
+
+    EXPECT_THAT(m_source->getNumberOfChannels(), Eq(1U));
+}
+
+TEST_F(DomainBridge_test, InternalServicesAreOnlyBridgedWhenTheirServiceIsConfigured)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "badc0a0d-2e5a-41a2-bca0-d54c49621be0");
+    const capro::ServiceDescription introspection{roudi::INTROSPECTION_SERVICE_ID, "RouDi_ID", "Port"};
+
+    createSource(false, {"*", "*", "*"});
+    m_source->discover({capro::CaproMessageType::OFFER, introspection, capro::CaproServiceType::PUBLISHER});
+    EXPECT_THAT(m_source->getNumberOfChannels(), Eq(0U));
+    m_source->discover({capro::CaproMessageType::OFFER, m_serviceDescription, capro::CaproServiceType::PUBLISHER});
+    EXPECT_THAT(m_source->getNumberOfChannels(), Eq(1U));
+
+    createSource(false, {roudi::INTROSPECTION_SERVICE_ID, "*", "*"});
+    m_source->discover({capro::CaproMessageType::OFFER, introspection, capro::CaproServiceType::PUBLISHER});
+    EXPECT_THAT(m_source->getNumberOfChannels(), Eq(1U));
+}
+
+TEST_F(DomainBridge_test, ConnectionIsClosedWhenTheSinkIsGone)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ab110e46-fb70-4ddd-bbba-0e487eedb4ff");
+    startBridge(true);
+    EXPECT_TRUE(m_source->isConnected());
+
+    m_transports.second.close();
+    publish(1U, 0U);
+    m_source->forwardAll();
+
+    EXPECT_FALSE(m_source->isConnected());
+}
+
+} // namespace
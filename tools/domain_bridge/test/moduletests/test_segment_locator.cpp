@@ -0,0 +1,136 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_domain_bridge/segment_locator.hpp"
+#include "iceoryx_platform/platform_settings.hpp"
+#include "iox/attributes.hpp"
+#include "iox/posix_shared_memory_object.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::gw;
+
+class SegmentLocator_test : public Test
+{
+  public:
+    void TearDown() override
+    {
+        IOX_DISCARD_RESULT(std::remove(m_memoryMapsFile.c_str()));
+    }
+
+    void writeMemoryMaps(const char* const memoryMaps)
+    {
+        std::ofstream file(m_memoryMapsFile, std::ios::trunc);
+        file << memoryMaps;
+    }
+
+    static const void* address(const uint64_t value)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) the address is only compared with the regions
+        return reinterpret_cast<const void*>(static_cast<uintptr_t>(value));
+    }
+
+    std::string m_memoryMapsFile{std::string(platform::IOX_TEMP_DIR) + "/test-segment-locator-maps"};
+};
+
+TEST_F(SegmentLocator_test, AddressInASharedMemoryObjectIsLocated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7de2ecbe-b8eb-485e-9f95-d752744d147a");
+    writeMemoryMaps("7f0000000000-7f0000010000 rw-s 00000000 00:19 1234        /dev/shm/test-segment-locator-fake\n"
+                    "7f0000010000-7f0000020000 r-xp 00000000 08:01 42        /usr/lib/libc.so.6\n"
+                    "7f0000030000-7f0000040000 r--s 00020000 00:19 1234        /dev/shm/test-segment-locator-fake\n");
+    SegmentLocator sut(m_memoryMapsFile);
+
+    auto location = sut.locate(address(0x7f0000030100));
+    ASSERT_TRUE(location.has_value());
+    EXPECT_THAT(location->offset, Eq(0x20100U));
+
+    auto segment = sut.segment(location->segmentIndex);
+    ASSERT_TRUE(segment.has_value());
+    EXPECT_THAT(segment->name.c_str(), StrEq("test-segment-locator-fake"));
+    EXPECT_THAT(segment->size, Eq(0x30000U));
+
+    auto otherRegion = sut.locate(address(0x7f0000000010));
+    ASSERT_TRUE(otherRegion.has_value());
+    EXPECT_THAT(otherRegion->segmentIndex, Eq(location->segmentIndex));
+    EXPECT_THAT(otherRegion->offset, Eq(0x10U));
+}
+
+TEST_F(SegmentLocator_test, AddressOutsideOfSharedMemoryObjectsIsNotLocated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2471a805-5d81-4057-88f2-5b50deea387a");
+    writeMemoryMaps("7f0000000000-7f0000010000 rw-s 00000000 00:19 1234        /dev/shm/test-segment-locator-fake\n"
+                    "7f0000010000-7f0000020000 r-xp 00000000 08:01 42        /usr/lib/libc.so.6\n"
+                    "7f0000020000-7f0000030000 rw-p 00000000 00:19 17        /dev/shm/private\n"
+                    "7f0000030000-7f0000040000 rw-s 00000000 00:19 18        /dev/shm/gone (deleted)\n"
+                    "7f0000040000-7f0000050000 rw-p 00000000 00:00 0 \n");
+    SegmentLocator sut(m_memoryMapsFile);
+
+    EXPECT_FALSE(sut.locate(address(0x6f0000000000)).has_value());
+    EXPECT_FALSE(sut.locate(address(0x7f0000010000)).has_value());
+    EXPECT_FALSE(sut.locate(address(0x7f0000020000)).has_value());
+    EXPECT_FALSE(sut.locate(address(0x7f0000030000)).has_value());
+    EXPECT_FALSE(sut.locate(address(0x7f0000040000)).has_value());
+    EXPECT_FALSE(sut.segment(1U).has_value());
+}
+
+TEST_F(SegmentLocator_test, NothingIsLocatedWithoutMemoryMaps)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0181631b-798e-461d-88e7-75ccda42ab72");
+    SegmentLocator sut(m_memoryMapsFile);
+
+    int value{0};
+    EXPECT_FALSE(sut.locate(&value).has_value());
+    EXPECT_FALSE(sut.segment(0U).has_value());
+}
+
+#if defined(__linux__)
+TEST_F(SegmentLocator_test, AddressInAMappedSharedMemoryObjectIsLocated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b2222ef1-9bc4-436b-9c53-afe4861d1a11");
+    constexpr uint64_t MEMORY_SIZE{8192U};
+    constexpr uint64_t OFFSET{4100U};
+    // the memory maps are parsed again when the shared memory is mapped after the construction of the locator
+    SegmentLocator sut;
+    auto sharedMemory = PosixSharedMemoryObjectBuilder()
+                            .name("test-segment-locator")
+                            .memorySizeInBytes(MEMORY_SIZE)
+                            .accessMode(AccessMode::ReadWrite)
+                            .openMode(OpenMode::PurgeAndCreate)
+                            .create()
+                            .expect("creating the shared memory");
+
+    auto location = sut.locate(static_cast<uint8_t*>(sharedMemory.getBaseAddress()) + OFFSET);
+    ASSERT_TRUE(location.has_value());
+    EXPECT_THAT(location->offset, Eq(OFFSET));
+
+    auto segment = sut.segment(location->segmentIndex);
+    ASSERT_TRUE(segment.has_value());
+    EXPECT_THAT(segment->name.c_str(), StrEq("test-segment-locator"));
+    EXPECT_THAT(segment->size, Ge(MEMORY_SIZE));
+}
+#endif
+
+} // namespace
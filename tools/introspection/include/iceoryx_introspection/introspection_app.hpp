@@ -19,6 +19,7 @@
 #include "iceoryx_introspection/introspection_types.hpp"
 #include "iceoryx_platform/getopt.hpp"
 #include "iceoryx_posh/popo/subscriber.hpp"
+#include "iceoryx_posh/roudi/mempool_advisor.hpp"
 
 #include <curses.h>
 #include <map>
@@ -38,6 +39,8 @@ static constexpr option longOptions[] = {{"help", no_argument, nullptr, 'h'},
                                          {"port", no_argument, nullptr, 0},
                                          {"process", no_argument, nullptr, 0},
                                          {"all", no_argument, nullptr, 0},
+                                         {"mempool-advice", no_argument, nullptr, 0},
+                                         {"headroom", required_argument, nullptr, 0},
                                          {nullptr, 0, nullptr, 0}};
 
 static constexpr const char* shortOptions = "hvt:d:";
@@ -87,6 +90,11 @@ class IntrospectionApp
 
     bool doIntrospection = false;
 
+    bool doMemPoolAdvice = false;
+
+    /// @brief additional chunks in percent of the observed peak usage for the mempool advice
+    uint32_t headroomPercent = roudi::DEFAULT_MEMPOOL_ADVISOR_HEADROOM_PERCENT;
+
     /// @brief this is needed for the child classes to extend the parseCmdLineArguments function
     IntrospectionApp() noexcept;
 
@@ -98,6 +106,11 @@ class IntrospectionApp
     void runIntrospection(const iox::units::Duration updatePeriodMs,
                           const IntrospectionSelection introspectionSelection);
 
+    /// @brief waits for the mempool introspection data and prints a RouDi config with mempools derived from the
+    /// observed chunk size histograms of the segments to stdout
+    /// @param[in] headroomPercent additional chunks in percent of the observed peak usage
+    void runMemPoolAdvisor(const uint32_t headroomPercent);
+
   private:
     /// @brief initializes ncurses terminal
     void initTerminal();
@@ -132,6 +145,9 @@ class IntrospectionApp
     /// @brief prints table showing current mempool usage
     void printMemPoolInfo(const MemPoolIntrospectionInfo& introspectionInfo);
 
+    /// @brief prints the advised mempool configuration of all segments in the TOML format of the RouDi config
+    void printMemPoolAdvice(const MemPoolIntrospectionInfoContainer& introspectionInfo, const uint32_t headroomPercent);
+
     template <typename Topic>
     iox::unique_ptr<iox::popo::Subscriber<Topic>>
     createSubscriber(const iox::capro::ServiceDescription& serviceDescription) noexcept;
@@ -29,7 +29,11 @@ IceOryxIntrospectionApp::IceOryxIntrospectionApp(int argc, char* argv[]) noexcep
 
 void IceOryxIntrospectionApp::run() noexcept
 {
-    if (doIntrospection)
+    if (doMemPoolAdvice)
+    {
+        runMemPoolAdvisor(headroomPercent);
+    }
+    else if (doIntrospection)
     {
         runIntrospection(DEFAULT_UPDATE_PERIOD, introspectionSelection);
     }
@@ -77,6 +77,12 @@ void IntrospectionApp::printHelp() noexcept
                  "  --mempool               Subscribe to mempool introspection data.\n"
                  "  --port                  Subscribe to port introspection data.\n"
                  "  --process               Subscribe to process introspection data.\n"
+                 "\nMempool advice:\n"
+                 "  --mempool-advice        Print a RouDi config with mempools sized according to the chunk sizes\n"
+                 "                          requested since RouDi was started and exit.\n"
+                 "  --headroom <percent>    Additional chunks in percent of the observed peak usage\n"
+                 "                          [default: "
+              << roudi::DEFAULT_MEMPOOL_ADVISOR_HEADROOM_PERCENT << "]\n"
               << std::endl;
 }
 
@@ -161,6 +167,20 @@ void IntrospectionApp::parseCmdLineArguments(int argc,
                 introspectionSelection.mempool = true;
                 doIntrospection = true;
             }
+            else if (strcmp(longOptions[index].name, "mempool-advice") == 0)
+            {
+                doMemPoolAdvice = true;
+            }
+            else if (strcmp(longOptions[index].name, "headroom") == 0)
+            {
+                auto result = convert::from_string<uint32_t>(optarg);
+                if (!result.has_value())
+                {
+                    std::cout << "Invalid argument for 'headroom'! Will be ignored!";
+                    break;
+                }
+                headroomPercent = result.value();
+            }
 
             break;
 
@@ -170,7 +190,7 @@ void IntrospectionApp::parseCmdLineArguments(int argc,
             exit(EXIT_FAILURE);
         }
     }
-    if (!doIntrospection)
+    if (!doIntrospection && !doMemPoolAdvice)
     {
         std::cout << "Wrong usage. ";
         printShortInfo(argv[0]);
@@ -296,6 +316,21 @@ constexpr const char* format_uint64_t<unsigned long long>() noexcept
 template <typename T>
 static constexpr const char* FORMAT_UINT64_T{format_uint64_t<T>()};
 
+/// @brief the name of the traffic class as it is used in the RouDi config
+static const char* trafficClassName(const mepoo::TrafficClass trafficClass) noexcept
+{
+    switch (trafficClass)
+    {
+    case mepoo::TrafficClass::LATENCY_CRITICAL:
+        return "latency-critical";
+    case mepoo::TrafficClass::BULK:
+        return "bulk";
+    case mepoo::TrafficClass::UNSPECIFIED:
+        break;
+    }
+    return "unspecified";
+}
+
 void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspectionInfo)
 {
     wprintw(pad, "Segment ID: %d\n", introspectionInfo.m_id);
@@ -306,22 +341,65 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
 
     wprintw(pad, "Shared memory segment reader group: ");
     prettyPrint(iox::into<std::string>(introspectionInfo.m_readerGroupName), PrettyOptions::bold);
+    wprintw(pad, "\n");
+
+    wprintw(pad, "Shared memory segment NUMA placement: ");
+    switch (introspectionInfo.m_numaPlacement.policy)
+    {
+    case NumaPolicy::BIND:
+        wprintw(pad, "bound to node %u", introspectionInfo.m_numaPlacement.node);
+        break;
+    case NumaPolicy::INTERLEAVE:
+        wprintw(pad, "interleaved");
+        break;
+    case NumaPolicy::DEFAULT:
+        wprintw(pad, "default");
+        break;
+    }
+    if (introspectionInfo.m_hasNumaNode)
+    {
+        wprintw(pad, " (first page on node %u)", introspectionInfo.m_numaNode);
+    }
+    wprintw(pad, "\n");
+
+    wprintw(pad, "Shared memory segment traffic class: %s\n", trafficClassName(introspectionInfo.m_trafficClass));
+
+    uint64_t usedChunkMemory{0U};
+    uint64_t chunkMemory{0U};
+    for (const auto& info : introspectionInfo.m_mempoolInfo)
+    {
+        usedChunkMemory += static_cast<uint64_t>(info.m_usedChunks) * info.m_chunkSize;
+        chunkMemory += static_cast<uint64_t>(info.m_numChunks) * info.m_chunkSize;
+    }
+    wprintw(pad, "Shared memory segment usage: ");
+    wprintw(pad, FORMAT_UINT64_T<uint64_t>, 0, usedChunkMemory, " of ");
+    wprintw(pad, FORMAT_UINT64_T<uint64_t>, 0, chunkMemory, " bytes in use");
+    if (chunkMemory > 0U)
+    {
+        wprintw(pad, " (%.1f%%)", 100.0 * static_cast<double>(usedChunkMemory) / static_cast<double>(chunkMemory));
+    }
     wprintw(pad, "\n\n");
 
     constexpr int32_t memPoolWidth{8};
     constexpr int32_t usedchunksWidth{14};
     constexpr int32_t numchunksWidth{9};
     constexpr int32_t minFreechunksWidth{9};
+    constexpr int32_t reservedChunksWidth{9};
     constexpr int32_t chunkSizeWidth{11};
     constexpr int32_t chunkPayloadSizeWidth{13};
+    constexpr int32_t overflowSegmentsWidth{9};
 
     wprintw(pad, "%*s |", memPoolWidth, "MemPool");
     wprintw(pad, "%*s |", usedchunksWidth, "Chunks In Use");
     wprintw(pad, "%*s |", numchunksWidth, "Total");
     wprintw(pad, "%*s |", minFreechunksWidth, "Min Free");
+    wprintw(pad, "%*s |", reservedChunksWidth, "Reserved");
     wprintw(pad, "%*s |", chunkSizeWidth, "Chunk Size");
-    wprintw(pad, "%*s\n", chunkPayloadSizeWidth, "Chunk Payload Size");
-    wprintw(pad, "--------------------------------------------------------------------------------\n");
+    wprintw(pad, "%*s |", chunkPayloadSizeWidth, "Chunk Payload Size");
+    wprintw(pad, "%*s\n", overflowSegmentsWidth, "Overflow");
+    wprintw(pad,
+            "--------------------------------------------------------------------------------------------"
+            "-----------\n");
 
     for (size_t i = 0u; i < introspectionInfo.m_mempoolInfo.size(); ++i)
     {
@@ -332,13 +410,71 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
             wprintw(pad, "%*u |", usedchunksWidth, info.m_usedChunks);
             wprintw(pad, "%*u |", numchunksWidth, info.m_numChunks);
             wprintw(pad, "%*u |", minFreechunksWidth, info.m_minFreeChunks);
+            wprintw(pad, "%*u |", reservedChunksWidth, info.m_reservedChunks);
             wprintw(pad, FORMAT_UINT64_T<uint64_t>, chunkSizeWidth, info.m_chunkSize, " |");
-            wprintw(pad, FORMAT_UINT64_T<uint64_t>, chunkPayloadSizeWidth, info.m_chunkPayloadSize, "\n");
+            wprintw(pad, FORMAT_UINT64_T<uint64_t>, chunkPayloadSizeWidth, info.m_chunkPayloadSize, " |");
+            wprintw(pad, "%*u\n", overflowSegmentsWidth, info.m_numOverflowSegments);
         }
     }
     wprintw(pad, "\n");
 }
 
+void IntrospectionApp::printMemPoolAdvice(const MemPoolIntrospectionInfoContainer& introspectionInfo,
+                                          const uint32_t headroomPercent)
+{
+    std::cout << "# mempool configuration derived from the chunk sizes requested since RouDi was started\n"
+              << "# with a headroom of " << headroomPercent << "% on top of the peak number of chunks in use\n"
+              << "[general]\n"
+              << "version = 1\n";
+
+    for (const auto& segment : introspectionInfo)
+    {
+        // the first segment is the RouDi internal memory which is not configurable
+        if (segment.m_id == 0U)
+        {
+            continue;
+        }
+
+        auto mePooConfig = roudi::adviseMePooConfig(segment.m_chunkSizeHistogram, headroomPercent);
+
+        std::cout << "\n[[segment]]\n"
+                  << "reader = \"" << iox::into<std::string>(segment.m_readerGroupName) << "\"\n"
+                  << "writer = \"" << iox::into<std::string>(segment.m_writerGroupName) << "\"\n";
+        if (segment.m_numaPlacement.policy == NumaPolicy::BIND)
+        {
+            std::cout << "numa-node = " << segment.m_numaPlacement.node << "\n";
+        }
+        else if (segment.m_numaPlacement.policy == NumaPolicy::INTERLEAVE)
+        {
+            std::cout << "numa-interleave = true\n";
+        }
+        if (segment.m_trafficClass != mepoo::TrafficClass::UNSPECIFIED)
+        {
+            std::cout << "traffic-class = \"" << trafficClassName(segment.m_trafficClass) << "\"\n";
+        }
+
+        if (mePooConfig.m_mempoolConfig.empty())
+        {
+            std::cout << "# no chunks were requested from this segment; the mempools of the current config are kept\n";
+            for (const auto& info : segment.m_mempoolInfo)
+            {
+                if (info.m_numChunks > 0U)
+                {
+                    mePooConfig.addMemPool({info.m_chunkPayloadSize, info.m_numChunks});
+                }
+            }
+        }
+
+        for (const auto& mempool : mePooConfig.m_mempoolConfig)
+        {
+            std::cout << "\n[[segment.mempool]]\n"
+                      << "size = " << mempool.m_size << "\n"
+                      << "count = " << mempool.m_chunkCount << "\n";
+        }
+    }
+    std::cout << std::flush;
+}
+
 void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPublisherPortData>& publisherPortData,
                                                   const std::vector<ComposedSubscriberPortData>& subscriberPortData)
 {
@@ -351,6 +487,9 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     // constexpr int32_t chunkSizeWidth{12};
     // constexpr int32_t chunksWidth{12};
     // constexpr int32_t intervalWidth{19};
+    constexpr int32_t quotaChunksWidth{10};
+    constexpr int32_t quotaReservedWidth{10};
+    constexpr int32_t quotaExceededWidth{10};
     constexpr int32_t subscriptionStateWidth{14};
     // constexpr int32_t fifoWidth{17};    // uncomment once this information is needed
     constexpr int32_t scopeWidth{12};
@@ -368,6 +507,9 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     // wprintw(pad, " %*s |", chunkSizeWidth, "Chunk Size");
     // wprintw(pad, " %*s |", chunksWidth, "Chunks");
     // wprintw(pad, " %*s |", intervalWidth, "Last Send Interval");
+    wprintw(pad, " %*s |", quotaChunksWidth, "Quota Use");
+    wprintw(pad, " %*s |", quotaReservedWidth, "Reserved");
+    wprintw(pad, " %*s |", quotaExceededWidth, "Exceeded");
     wprintw(pad, " %*s\n", interfaceSourceWidth, "Src. Itf.");
 
     wprintw(pad, " %*s |", serviceWidth, "");
@@ -379,10 +521,14 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     // wprintw(pad, " %*s |", chunkSizeWidth, "[Byte]");
     // wprintw(pad, " %*s |", chunksWidth, "[/Minute]");
     // wprintw(pad, " %*s |", intervalWidth, "[Milliseconds]");
+    wprintw(pad, " %*s |", quotaChunksWidth, "[Chunks]");
+    wprintw(pad, " %*s |", quotaReservedWidth, "[Used/All]");
+    wprintw(pad, " %*s |", quotaExceededWidth, "[Requests]");
     wprintw(pad, " %*s\n", interfaceSourceWidth, "");
 
     wprintw(pad,
             "---------------------------------------------------------------------------------------------------\n");
+    wprintw(pad, "-------------------------------------\n");
 
     bool needsLineBreak{false};
     uint32_t currentLine{0U};
@@ -424,6 +570,17 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
         // std::string m_chunkSize{"n/a"};
         // std::string m_chunksPerMinute{"n/a"};
         // std::string sendInterval{"n/a"};
+        std::string quotaChunks{"n/a"};
+        std::string quotaReserved{"n/a"};
+        std::string quotaExceeded{"n/a"};
+        const auto& throughput = *publisherPort.throughputData;
+        if (throughput.m_hasChunkQuota)
+        {
+            quotaChunks = std::to_string(throughput.m_chunksInUse);
+            quotaReserved = std::to_string(throughput.m_reservedChunksInUse) + "/"
+                            + std::to_string(throughput.m_reservedChunks);
+            quotaExceeded = std::to_string(throughput.m_numberOfQuotaExceededRequests);
+        }
 
         currentLine = 0;
         do
@@ -448,6 +605,9 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
             // wprintw(pad, " %s |", printEntry(chunkSizeWidth, m_chunkSize).c_str());
             // wprintw(pad, " %s |", printEntry(chunksWidth, m_chunksPerMinute).c_str());
             // wprintw(pad, " %s |", printEntry(intervalWidth, sendInterval).c_str());
+            wprintw(pad, " %s |", printEntry(quotaChunksWidth, quotaChunks).c_str());
+            wprintw(pad, " %s |", printEntry(quotaReservedWidth, quotaReserved).c_str());
+            wprintw(pad, " %s |", printEntry(quotaExceededWidth, quotaExceeded).c_str());
             wprintw(
                 pad,
                 " %s\n",
@@ -891,6 +1051,55 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriod,
     closeTerminal();
 }
 
+void IntrospectionApp::runMemPoolAdvisor(const uint32_t headroomPercent)
+{
+#ifdef HAS_EXPERIMENTAL_POSH
+    auto nodeResult = iox::posh::experimental::NodeBuilder(iox::roudi::INTROSPECTION_APP_NAME)
+                          .roudi_registration_timeout(iox::runtime::PROCESS_WAITING_FOR_ROUDI_TIMEOUT)
+                          .domain_id(domainId)
+                          .create();
+
+    if (nodeResult.has_error())
+    {
+        std::cout << "Could not register at RouDi!" << std::endl;
+        return;
+    }
+    auto node = std::move(nodeResult.value());
+
+    auto memPoolSubscriber = node.subscriber(IntrospectionMempoolService)
+                                 .queue_capacity(1)
+                                 .history_request(1)
+                                 .create<MemPoolIntrospectionInfoContainer>()
+                                 .expect("Getting subscriber for mempool topic");
+#else
+    iox::runtime::PoshRuntime::initRuntime(iox::roudi::INTROSPECTION_APP_NAME);
+
+    auto memPoolSubscriber = createSubscriber<MemPoolIntrospectionInfoContainer>(IntrospectionMempoolService);
+#endif
+
+    memPoolSubscriber->subscribe();
+    if (waitForSubscription(memPoolSubscriber) == false)
+    {
+        std::cerr << "Timeout while waiting for subscription for mempool introspection data!" << std::endl;
+        return;
+    }
+
+    // the mempool introspection is sent periodically, therefore wait for more than one send interval
+    constexpr uint32_t NUMBER_OF_LOOPS_TILL_TIMEOUT{500U};
+    for (uint32_t i = 0U; i < NUMBER_OF_LOOPS_TILL_TIMEOUT; ++i)
+    {
+        auto sample = memPoolSubscriber->take();
+        if (!sample.has_error())
+        {
+            printMemPoolAdvice(*sample.value(), headroomPercent);
+            return;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(WAIT_INTERVAL.toMilliseconds()));
+    }
+
+    std::cerr << "Timeout while waiting for mempool introspection data!" << std::endl;
+}
+
 } // namespace introspection
 } // namespace client
 } // namespace iox
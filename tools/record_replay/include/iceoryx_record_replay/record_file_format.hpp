@@ -0,0 +1,169 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_TOOLS_RECORD_REPLAY_RECORD_FILE_FORMAT_HPP
+#define IOX_TOOLS_RECORD_REPLAY_RECORD_FILE_FORMAT_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace record
+{
+/// @brief The layout of a record file
+/// @code
+/// | FileHeader, padded to the page size |
+/// | block 0 | block 1 | ... | block N |
+/// | TopicEntry[numberOfTopics] | BlockIndexEntry[numberOfBlocks] |
+/// @endcode
+/// A block is a page aligned region of the file which is memory-mapped while it is written. It contains a sequence
+/// of records, each starting with a RecordHeader, followed by zero padding up to the next block. The topics and the
+/// block index are appended when the file is closed. If the recording was not closed, e.g. because the recorder was
+/// killed, the reader recovers the topics and the block index by scanning the blocks.
+
+enum class RecordFileError : uint8_t
+{
+    FILE_ACCESS_FAILED,
+    MEMORY_MAPPING_FAILED,
+    INVALID_FILE_FORMAT,
+    UNSUPPORTED_FILE_VERSION,
+    FILE_ALREADY_CLOSED,
+};
+
+/// @brief converts the RecordFileError to a string literal
+const char* asStringLiteral(const RecordFileError error) noexcept;
+
+constexpr uint64_t RECORD_FILE_MAGIC{0x3130434552584f49U}; // "IOXREC01" in little endian
+constexpr uint32_t RECORD_FILE_VERSION{1U};
+constexpr uint32_t RECORD_MAGIC{0x52584f49U}; // "IOXR" in little endian
+constexpr uint64_t RECORD_ALIGNMENT{8U};
+
+constexpr uint64_t alignToRecord(const uint64_t size) noexcept
+{
+    return (size + RECORD_ALIGNMENT - 1U) / RECORD_ALIGNMENT * RECORD_ALIGNMENT;
+}
+
+struct FileHeader
+{
+    uint64_t magic{RECORD_FILE_MAGIC};
+    uint32_t version{RECORD_FILE_VERSION};
+    /// @brief 1 if the topics and the block index were written, 0 if they must be recovered by scanning the blocks
+    uint32_t isClosed{0U};
+    /// @brief the system time of the start of the recording in nanoseconds since epoch; the timestamps of the
+    /// records are relative to this point in time
+    uint64_t startTime{0U};
+    /// @brief the alignment of the blocks in the file, i.e. the page size of the writer
+    uint64_t blockAlignment{0U};
+    uint64_t topicTableOffset{0U};
+    uint64_t numberOfTopics{0U};
+    uint64_t blockIndexOffset{0U};
+    uint64_t numberOfBlocks{0U};
+    uint64_t numberOfChunks{0U};
+};
+
+enum class RecordType : uint16_t
+{
+    TOPIC = 1U,
+    CHUNK = 2U,
+};
+
+struct RecordHeader
+{
+    uint32_t magic{RECORD_MAGIC};
+    RecordType type{RecordType::CHUNK};
+    uint16_t reserved{0U};
+    /// @brief the size of the record including the RecordHeader and the padding to RECORD_ALIGNMENT
+    uint64_t size{0U};
+};
+
+/// @brief The record of a topic, it is written before the first chunk of the topic and in the topic table
+struct TopicEntry
+{
+    static constexpr uint64_t ID_STRING_SIZE{alignToRecord(capro::IdString_t::capacity() + 1U)};
+
+    uint32_t topicId{0U};
+    uint32_t reserved{0U};
+    char service[ID_STRING_SIZE]{};
+    char instance[ID_STRING_SIZE]{};
+    char event[ID_STRING_SIZE]{};
+
+    static TopicEntry fromServiceDescription(const uint32_t topicId,
+                                             const capro::ServiceDescription& serviceDescription) noexcept;
+    capro::ServiceDescription toServiceDescription() const noexcept;
+};
+
+/// @brief The metadata of a recorded chunk; in the file it is followed by the user-header and the user-payload
+/// which starts at the next multiple of RECORD_ALIGNMENT
+struct ChunkEntry
+{
+    static constexpr uint16_t FLAG_CHAINED{1U};
+
+    /// @brief nanoseconds since the start of the recording at which the chunk was received
+    uint64_t timestamp{0U};
+    uint64_t sequenceNumber{0U};
+    uint64_t originId{0U};
+    uint64_t userPayloadSize{0U};
+    uint32_t topicId{0U};
+    uint32_t userHeaderSize{0U};
+    uint32_t userPayloadAlignment{0U};
+    uint16_t userHeaderId{0U};
+    /// @brief FLAG_CHAINED if the chunk was a chained message whose segments were gathered into the user-payload
+    uint16_t flags{0U};
+
+    /// @brief the offset of the user-header relative to the begin of the RecordHeader
+    static constexpr uint64_t userHeaderOffset() noexcept;
+    /// @brief the offset of the user-payload relative to the begin of the RecordHeader
+    uint64_t userPayloadOffset() const noexcept;
+    /// @brief the size of the whole record including the RecordHeader and the padding
+    uint64_t recordSize() const noexcept;
+};
+
+struct BlockIndexEntry
+{
+    uint64_t offset{0U};
+    /// @brief the number of bytes of the block which are occupied by records
+    uint64_t usedSize{0U};
+    uint64_t firstTimestamp{0U};
+    uint64_t lastTimestamp{0U};
+    uint64_t numberOfChunks{0U};
+};
+
+constexpr uint64_t ChunkEntry::userHeaderOffset() noexcept
+{
+    return sizeof(RecordHeader) + sizeof(ChunkEntry);
+}
+
+inline uint64_t ChunkEntry::userPayloadOffset() const noexcept
+{
+    return alignToRecord(userHeaderOffset() + userHeaderSize);
+}
+
+inline uint64_t ChunkEntry::recordSize() const noexcept
+{
+    return alignToRecord(userPayloadOffset() + userPayloadSize);
+}
+
+static_assert(sizeof(RecordHeader) % RECORD_ALIGNMENT == 0U, "RecordHeader must keep the records aligned");
+static_assert(sizeof(ChunkEntry) % RECORD_ALIGNMENT == 0U, "ChunkEntry must keep the user-header aligned");
+static_assert(sizeof(TopicEntry) % RECORD_ALIGNMENT == 0U, "TopicEntry must keep the records aligned");
+
+} // namespace record
+} // namespace iox
+
+#endif // IOX_TOOLS_RECORD_REPLAY_RECORD_FILE_FORMAT_HPP
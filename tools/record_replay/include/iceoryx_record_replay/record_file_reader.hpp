@@ -0,0 +1,102 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_TOOLS_RECORD_REPLAY_RECORD_FILE_READER_HPP
+#define IOX_TOOLS_RECORD_REPLAY_RECORD_FILE_READER_HPP
+
+#include "iceoryx_record_replay/record_file_format.hpp"
+#include "iox/detail/posix_memory_map.hpp"
+#include "iox/expected.hpp"
+#include "iox/file_path.hpp"
+#include "iox/optional.hpp"
+
+#include <vector>
+
+namespace iox
+{
+namespace record
+{
+/// @brief A chunk of a recording; the pointers refer to the memory-mapped record file and are valid as long as the
+/// RecordFileReader exists
+struct RecordedChunk
+{
+    const ChunkEntry* entry{nullptr};
+    const void* userHeader{nullptr};
+    const void* userPayload{nullptr};
+};
+
+/// @brief Reads a record file. The whole file is memory-mapped read-only and the chunks are accessed in place.
+class RecordFileReader
+{
+  public:
+    /// @brief Opens a record file; if the file was not closed by the writer the topics and the block index are
+    /// recovered by scanning the blocks
+    /// @param[in] path of the record file
+    /// @return the reader or the RecordFileError which occurred
+    static expected<RecordFileReader, RecordFileError> open(const FilePath& path) noexcept;
+
+    RecordFileReader(const RecordFileReader&) = delete;
+    RecordFileReader(RecordFileReader&&) noexcept = default;
+    RecordFileReader& operator=(const RecordFileReader&) = delete;
+    RecordFileReader& operator=(RecordFileReader&&) noexcept = default;
+    ~RecordFileReader() noexcept = default;
+
+    const FileHeader& fileHeader() const noexcept;
+
+    /// @brief true if the topics and the block index were recovered since the file was not closed
+    bool isRecovered() const noexcept;
+
+    const std::vector<TopicEntry>& topics() const noexcept;
+
+    const std::vector<BlockIndexEntry>& blocks() const noexcept;
+
+    /// @brief the timestamps of the first and the last chunk of the recording
+    uint64_t firstTimestamp() const noexcept;
+    uint64_t lastTimestamp() const noexcept;
+
+    /// @brief Positions the reader at the first chunk whose timestamp is not smaller than the given one. The block
+    /// is found with a binary search in the block index and the chunk with a scan of the block.
+    /// @param[in] timestamp in nanoseconds since the start of the recording
+    void seek(const uint64_t timestamp) noexcept;
+
+    /// @brief Returns the chunk at the current position and advances the position
+    /// @return the chunk or 'nullopt' if the end of the recording is reached
+    optional<RecordedChunk> next() noexcept;
+
+  private:
+    RecordFileReader(detail::PosixMemoryMap&& memoryMap, const uint64_t fileSize) noexcept;
+
+    const uint8_t* data() const noexcept;
+    expected<void, RecordFileError> readIndex() noexcept;
+    expected<void, RecordFileError> recoverIndex() noexcept;
+    const RecordHeader* recordAt(const uint64_t offset, const uint64_t blockEnd) const noexcept;
+
+  private:
+    detail::PosixMemoryMap m_memoryMap;
+    uint64_t m_fileSize{0U};
+    FileHeader m_fileHeader;
+    bool m_isRecovered{false};
+    std::vector<TopicEntry> m_topics;
+    std::vector<BlockIndexEntry> m_blocks;
+    uint64_t m_currentBlock{0U};
+    uint64_t m_currentOffset{0U};
+};
+
+} // namespace record
+} // namespace iox
+
+#endif // IOX_TOOLS_RECORD_REPLAY_RECORD_FILE_READER_HPP
@@ -0,0 +1,117 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_TOOLS_RECORD_REPLAY_RECORD_FILE_WRITER_HPP
+#define IOX_TOOLS_RECORD_REPLAY_RECORD_FILE_WRITER_HPP
+
+#include "iceoryx_posh/mepoo/chained_payload.hpp"
+#include "iceoryx_record_replay/record_file_format.hpp"
+#include "iox/detail/posix_memory_map.hpp"
+#include "iox/expected.hpp"
+#include "iox/file.hpp"
+#include "iox/file_path.hpp"
+#include "iox/optional.hpp"
+
+#include <chrono>
+#include <vector>
+
+namespace iox
+{
+namespace record
+{
+/// @brief Writes a record file. The records are copied directly into a memory-mapped block of the file, i.e. the
+/// chunks are copied once from the shared memory into the page cache and the kernel writes the blocks back in large
+/// sequential writes.
+class RecordFileWriter
+{
+  public:
+    static constexpr uint64_t DEFAULT_BLOCK_SIZE{16U * 1024U * 1024U};
+
+    /// @brief Creates a record file, an existing file is overwritten
+    /// @param[in] path of the record file
+    /// @param[in] blockSize the size of the memory-mapped blocks, it is rounded up to a multiple of the page size
+    /// @return the writer or the RecordFileError which occurred
+    static expected<RecordFileWriter, RecordFileError> create(const FilePath& path,
+                                                              const uint64_t blockSize = DEFAULT_BLOCK_SIZE) noexcept;
+
+    RecordFileWriter(const RecordFileWriter&) = delete;
+    RecordFileWriter(RecordFileWriter&& rhs) noexcept;
+    RecordFileWriter& operator=(const RecordFileWriter&) = delete;
+    RecordFileWriter& operator=(RecordFileWriter&& rhs) noexcept;
+
+    /// @brief Closes the file if this was not yet done
+    ~RecordFileWriter() noexcept;
+
+    /// @brief Adds a topic to the recording
+    /// @param[in] serviceDescription of the topic
+    /// @return the id of the topic which is used for 'writeChunk'
+    expected<uint32_t, RecordFileError> addTopic(const capro::ServiceDescription& serviceDescription) noexcept;
+
+    /// @brief Appends a chunk to the recording
+    /// @param[in] chunkEntry with the metadata of the chunk; the sizes define how many bytes are copied
+    /// @param[in] userHeader of the chunk, can be nullptr if chunkEntry.userHeaderSize is 0
+    /// @param[in] userPayload of the chunk
+    expected<void, RecordFileError>
+    writeChunk(const ChunkEntry& chunkEntry, const void* const userHeader, const void* const userPayload) noexcept;
+
+    /// @brief Appends a chained message to the recording; the segments are gathered into a single user-payload
+    /// @param[in] chunkEntry with the metadata of the chunk; FLAG_CHAINED is set and the user-payload size is taken
+    /// from the chained message
+    /// @param[in] chainedPayload of the chained message
+    expected<void, RecordFileError> writeChainedChunk(ChunkEntry chunkEntry,
+                                                      const mepoo::ConstChainedPayload& chainedPayload) noexcept;
+
+    /// @brief Writes the topics and the block index and truncates the file to its final size
+    expected<void, RecordFileError> close() noexcept;
+
+    /// @brief the number of chunks which were written
+    uint64_t numberOfChunks() const noexcept;
+
+    /// @brief the number of bytes which are occupied by the blocks
+    uint64_t size() const noexcept;
+
+    /// @brief the nanoseconds since the creation of the file which is used as timestamp for the chunks
+    uint64_t elapsedTime() const noexcept;
+
+  private:
+    RecordFileWriter(File&& file, const uint64_t blockSize, const uint64_t pageSize) noexcept;
+
+    expected<uint8_t*, RecordFileError> reserve(const uint64_t recordSize) noexcept;
+    void commitChunk(uint8_t* const record, const ChunkEntry& chunkEntry) noexcept;
+    expected<void, RecordFileError> startBlock(const uint64_t minimumSize) noexcept;
+    expected<void, RecordFileError> resizeFile(const uint64_t size) const noexcept;
+    expected<void, RecordFileError>
+    writeAt(const uint64_t offset, const void* const data, const uint64_t size) noexcept;
+
+  private:
+    optional<File> m_file;
+    optional<detail::PosixMemoryMap> m_block;
+    uint64_t m_blockLength{0U};
+    uint64_t m_blockSize{DEFAULT_BLOCK_SIZE};
+    uint64_t m_pageSize{0U};
+    FileHeader m_fileHeader;
+    std::chrono::steady_clock::time_point m_startTime;
+    /// @brief the file offset at which the next block starts
+    uint64_t m_nextBlockOffset{0U};
+    std::vector<TopicEntry> m_topics;
+    std::vector<BlockIndexEntry> m_blocks;
+};
+
+} // namespace record
+} // namespace iox
+
+#endif // IOX_TOOLS_RECORD_REPLAY_RECORD_FILE_WRITER_HPP
@@ -0,0 +1,95 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_TOOLS_RECORD_REPLAY_RECORDER_HPP
+#define IOX_TOOLS_RECORD_REPLAY_RECORDER_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/popo/untyped_subscriber.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
+#include "iceoryx_posh/runtime/service_discovery.hpp"
+#include "iceoryx_record_replay/record_file_writer.hpp"
+#include "iox/duration.hpp"
+#include "iox/function_ref.hpp"
+#include "iox/optional.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace iox
+{
+namespace record
+{
+/// @brief Records the publish-subscribe topics which match the given service, instance and event into a record
+/// file. The topics are found with the ServiceDiscovery and a UntypedSubscriber is created for each of them, i.e. the
+/// recorder also picks up publishers which are offered after the recording was started.
+class Recorder
+{
+  public:
+    /// @brief Creates the recorder; 'nullopt' acts as wildcard for the service, instance and event
+    /// @param[in] writer to which the chunks are written, must outlive the recorder
+    /// @note The runtime must be initialized before the recorder is created
+    Recorder(RecordFileWriter& writer,
+             const optional<capro::IdString_t>& service,
+             const optional<capro::IdString_t>& instance,
+             const optional<capro::IdString_t>& event) noexcept;
+
+    Recorder(const Recorder&) = delete;
+    Recorder(Recorder&&) = delete;
+    Recorder& operator=(const Recorder&) = delete;
+    Recorder& operator=(Recorder&&) = delete;
+    ~Recorder() noexcept = default;
+
+    /// @brief Searches for new topics and creates a subscriber for each of them
+    void discoverTopics() noexcept;
+
+    /// @brief Records until 'keepRunning' returns false
+    /// @param[in] keepRunning is called after every wake-up of the recorder
+    /// @param[in] discoveryInterval the interval in which new topics are searched
+    void run(const function_ref<bool()> keepRunning, const units::Duration discoveryInterval) noexcept;
+
+    /// @brief Writes all chunks which are currently available to the record file
+    void recordAvailableChunks() noexcept;
+
+    /// @brief the number of topics which are recorded
+    uint64_t numberOfTopics() const noexcept;
+
+  private:
+    struct RecordedTopic
+    {
+        std::unique_ptr<popo::UntypedSubscriber> subscriber;
+        uint32_t topicId{0U};
+    };
+
+    bool isRecorded(const capro::ServiceDescription& serviceDescription) const noexcept;
+    void addTopic(const capro::ServiceDescription& serviceDescription) noexcept;
+    void recordChunks(RecordedTopic& topic) noexcept;
+
+  private:
+    RecordFileWriter& m_writer;
+    optional<capro::IdString_t> m_service;
+    optional<capro::IdString_t> m_instance;
+    optional<capro::IdString_t> m_event;
+    runtime::ServiceDiscovery m_serviceDiscovery;
+    popo::WaitSet<> m_waitSet;
+    std::vector<RecordedTopic> m_topics;
+};
+
+} // namespace record
+} // namespace iox
+
+#endif // IOX_TOOLS_RECORD_REPLAY_RECORDER_HPP
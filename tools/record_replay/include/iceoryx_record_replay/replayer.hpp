@@ -0,0 +1,75 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_TOOLS_RECORD_REPLAY_REPLAYER_HPP
+#define IOX_TOOLS_RECORD_REPLAY_REPLAYER_HPP
+
+#include "iceoryx_posh/popo/untyped_publisher.hpp"
+#include "iceoryx_record_replay/record_file_reader.hpp"
+#include "iox/duration.hpp"
+#include "iox/function_ref.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace iox
+{
+namespace record
+{
+/// @brief Republishes the chunks of a record file with the timing of the recording. A UntypedPublisher is created
+/// for each recorded topic and every chunk is loaned from the shared memory, filled from the memory-mapped record
+/// file and published.
+class Replayer
+{
+  public:
+    /// @brief Creates the replayer and a publisher for each topic of the recording
+    /// @param[in] reader of the record file, must outlive the replayer
+    /// @param[in] rate with which the recording is replayed, e.g. 2.0 replays twice as fast as recorded; a rate of 0.0
+    /// replays the chunks as fast as possible
+    /// @note The runtime must be initialized before the replayer is created
+    Replayer(RecordFileReader& reader, const double rate) noexcept;
+
+    Replayer(const Replayer&) = delete;
+    Replayer(Replayer&&) = delete;
+    Replayer& operator=(const Replayer&) = delete;
+    Replayer& operator=(Replayer&&) = delete;
+    ~Replayer() noexcept = default;
+
+    /// @brief Continues the replay at the first chunk which was recorded 'offset' after the first chunk
+    void seek(const units::Duration offset) noexcept;
+
+    /// @brief Replays the recording until the end is reached or 'keepRunning' returns false
+    /// @param[in] keepRunning is called before every chunk
+    /// @return the number of published chunks
+    uint64_t run(const function_ref<bool()> keepRunning) noexcept;
+
+    /// @brief Publishes a recorded chunk
+    /// @param[in] chunk which is published with the publisher of its topic
+    /// @return true if the chunk was published
+    bool publish(const RecordedChunk& chunk) noexcept;
+
+  private:
+    RecordFileReader& m_reader;
+    double m_rate{1.0};
+    uint64_t m_startTimestamp{0U};
+    std::vector<std::unique_ptr<popo::UntypedPublisher>> m_publishers;
+};
+
+} // namespace record
+} // namespace iox
+
+#endif // IOX_TOOLS_RECORD_REPLAY_REPLAYER_HPP
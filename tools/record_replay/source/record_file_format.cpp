@@ -0,0 +1,75 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_record_replay/record_file_format.hpp"
+
+#include <cstring>
+
+namespace iox
+{
+namespace record
+{
+const char* asStringLiteral(const RecordFileError error) noexcept
+{
+    switch (error)
+    {
+    case RecordFileError::FILE_ACCESS_FAILED:
+        return "RecordFileError::FILE_ACCESS_FAILED";
+    case RecordFileError::MEMORY_MAPPING_FAILED:
+        return "RecordFileError::MEMORY_MAPPING_FAILED";
+    case RecordFileError::INVALID_FILE_FORMAT:
+        return "RecordFileError::INVALID_FILE_FORMAT";
+    case RecordFileError::UNSUPPORTED_FILE_VERSION:
+        return "RecordFileError::UNSUPPORTED_FILE_VERSION";
+    case RecordFileError::FILE_ALREADY_CLOSED:
+        return "RecordFileError::FILE_ALREADY_CLOSED";
+    }
+
+    return "[Undefined RecordFileError]";
+}
+
+namespace
+{
+void copyIdString(char (&destination)[TopicEntry::ID_STRING_SIZE], const capro::IdString_t& source) noexcept
+{
+    std::memcpy(&destination[0], source.c_str(), source.size());
+    destination[source.size()] = '\0';
+}
+} // namespace
+
+TopicEntry TopicEntry::fromServiceDescription(const uint32_t topicId,
+                                              const capro::ServiceDescription& serviceDescription) noexcept
+{
+    TopicEntry entry;
+    entry.topicId = topicId;
+    copyIdString(entry.service, serviceDescription.getServiceIDString());
+    copyIdString(entry.instance, serviceDescription.getInstanceIDString());
+    copyIdString(entry.event, serviceDescription.getEventIDString());
+    return entry;
+}
+
+capro::ServiceDescription TopicEntry::toServiceDescription() const noexcept
+{
+    // the strings of a corrupted file are not necessarily terminated
+    auto toIdString = [](const char(&idString)[ID_STRING_SIZE]) {
+        return capro::IdString_t(TruncateToCapacity, &idString[0], strnlen(&idString[0], ID_STRING_SIZE));
+    };
+    return capro::ServiceDescription(toIdString(service), toIdString(instance), toIdString(event));
+}
+
+} // namespace record
+} // namespace iox
@@ -0,0 +1,314 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_record_replay/record_file_reader.hpp"
+#include "iox/file.hpp"
+#include "iox/logging.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace iox
+{
+namespace record
+{
+expected<RecordFileReader, RecordFileError> RecordFileReader::open(const FilePath& path) noexcept
+{
+    auto file = FileBuilder().access_mode(AccessMode::ReadOnly).open_mode(OpenMode::OpenExisting).open(path);
+    if (file.has_error())
+    {
+        IOX_LOG(Error, "Unable to open the record file '" << path.as_string() << "'");
+        return err(RecordFileError::FILE_ACCESS_FAILED);
+    }
+
+    auto fileSize = file->get_size();
+    if (fileSize.has_error())
+    {
+        return err(RecordFileError::FILE_ACCESS_FAILED);
+    }
+    if (fileSize.value() < sizeof(FileHeader))
+    {
+        return err(RecordFileError::INVALID_FILE_FORMAT);
+    }
+
+    // the mapping stays valid when the file is closed
+    auto memoryMap = detail::PosixMemoryMapBuilder()
+                         .fileDescriptor(file->get_file_handle())
+                         .length(fileSize.value())
+                         .accessMode(AccessMode::ReadOnly)
+                         .flags(detail::PosixMemoryMapFlags::SHARE_CHANGES)
+                         .create();
+    if (memoryMap.has_error())
+    {
+        IOX_LOG(Error, "Unable to map the record file '" << path.as_string() << "'");
+        return err(RecordFileError::MEMORY_MAPPING_FAILED);
+    }
+
+    RecordFileReader reader(std::move(memoryMap.value()), fileSize.value());
+    if (reader.m_fileHeader.magic != RECORD_FILE_MAGIC)
+    {
+        return err(RecordFileError::INVALID_FILE_FORMAT);
+    }
+    if (reader.m_fileHeader.version != RECORD_FILE_VERSION)
+    {
+        return err(RecordFileError::UNSUPPORTED_FILE_VERSION);
+    }
+
+    auto result = (reader.m_fileHeader.isClosed != 0U) ? reader.readIndex() : reader.recoverIndex();
+    if (result.has_error())
+    {
+        return err(result.error());
+    }
+
+    reader.seek(0U);
+    return ok(std::move(reader));
+}
+
+RecordFileReader::RecordFileReader(detail::PosixMemoryMap&& memoryMap, const uint64_t fileSize) noexcept
+    : m_memoryMap(std::move(memoryMap))
+    , m_fileSize(fileSize)
+{
+    std::memcpy(&m_fileHeader, data(), sizeof(m_fileHeader));
+}
+
+const uint8_t* RecordFileReader::data() const noexcept
+{
+    return static_cast<const uint8_t*>(m_memoryMap.getBaseAddress());
+}
+
+const FileHeader& RecordFileReader::fileHeader() const noexcept
+{
+    return m_fileHeader;
+}
+
+bool RecordFileReader::isRecovered() const noexcept
+{
+    return m_isRecovered;
+}
+
+const std::vector<TopicEntry>& RecordFileReader::topics() const noexcept
+{
+    return m_topics;
+}
+
+const std::vector<BlockIndexEntry>& RecordFileReader::blocks() const noexcept
+{
+    return m_blocks;
+}
+
+uint64_t RecordFileReader::firstTimestamp() const noexcept
+{
+    auto block = std::find_if(
+        m_blocks.begin(), m_blocks.end(), [](const auto& entry) { return entry.numberOfChunks > 0U; });
+    return (block == m_blocks.end()) ? 0U : block->firstTimestamp;
+}
+
+uint64_t RecordFileReader::lastTimestamp() const noexcept
+{
+    return m_blocks.empty() ? 0U : m_blocks.back().lastTimestamp;
+}
+
+expected<void, RecordFileError> RecordFileReader::readIndex() noexcept
+{
+    const uint64_t topicTableSize = m_fileHeader.numberOfTopics * sizeof(TopicEntry);
+    const uint64_t blockIndexSize = m_fileHeader.numberOfBlocks * sizeof(BlockIndexEntry);
+    if (m_fileHeader.topicTableOffset > m_fileSize || topicTableSize > m_fileSize - m_fileHeader.topicTableOffset
+        || m_fileHeader.blockIndexOffset > m_fileSize || blockIndexSize > m_fileSize - m_fileHeader.blockIndexOffset)
+    {
+        IOX_LOG(Error, "The topic table or the block index exceeds the record file");
+        return err(RecordFileError::INVALID_FILE_FORMAT);
+    }
+
+    m_topics.resize(m_fileHeader.numberOfTopics);
+    std::memcpy(m_topics.data(), data() + m_fileHeader.topicTableOffset, topicTableSize);
+    m_blocks.resize(m_fileHeader.numberOfBlocks);
+    std::memcpy(m_blocks.data(), data() + m_fileHeader.blockIndexOffset, blockIndexSize);
+
+    for (const auto& block : m_blocks)
+    {
+        if (block.offset > m_fileSize || block.usedSize > m_fileSize - block.offset)
+        {
+            IOX_LOG(Error, "A block of the block index exceeds the record file");
+            return err(RecordFileError::INVALID_FILE_FORMAT);
+        }
+    }
+
+    return ok();
+}
+
+expected<void, RecordFileError> RecordFileReader::recoverIndex() noexcept
+{
+    const uint64_t blockAlignment = m_fileHeader.blockAlignment;
+    if (blockAlignment < sizeof(FileHeader) || blockAlignment % RECORD_ALIGNMENT != 0U)
+    {
+        return err(RecordFileError::INVALID_FILE_FORMAT);
+    }
+
+    IOX_LOG(Warn, "The record file was not closed, the index is recovered by scanning the blocks");
+    m_isRecovered = true;
+
+    // the records of a block are contiguous and the rest of a block is zero; since blocks are aligned to
+    // blockAlignment, the scan continues at the next aligned offset when no record is found
+    optional<BlockIndexEntry> block;
+    uint64_t lastTimestamp{0U};
+    uint64_t numberOfChunks{0U};
+    uint64_t offset{blockAlignment};
+    while (offset < m_fileSize)
+    {
+        const auto* recordHeader = recordAt(offset, m_fileSize);
+        if (recordHeader == nullptr)
+        {
+            if (block.has_value())
+            {
+                m_blocks.push_back(block.value());
+                block.reset();
+            }
+            offset = (offset / blockAlignment + 1U) * blockAlignment;
+            continue;
+        }
+
+        if (!block.has_value())
+        {
+            BlockIndexEntry entry;
+            entry.offset = offset;
+            entry.firstTimestamp = lastTimestamp;
+            entry.lastTimestamp = lastTimestamp;
+            block.emplace(entry);
+        }
+
+        if (recordHeader->type == RecordType::TOPIC && recordHeader->size >= sizeof(RecordHeader) + sizeof(TopicEntry))
+        {
+            TopicEntry topic;
+            std::memcpy(&topic, data() + offset + sizeof(RecordHeader), sizeof(topic));
+            m_topics.push_back(topic);
+        }
+        else if (recordHeader->type == RecordType::CHUNK
+                 && recordHeader->size >= sizeof(RecordHeader) + sizeof(ChunkEntry))
+        {
+            ChunkEntry chunk;
+            std::memcpy(&chunk, data() + offset + sizeof(RecordHeader), sizeof(chunk));
+            if (block->numberOfChunks == 0U)
+            {
+                block->firstTimestamp = chunk.timestamp;
+            }
+            block->lastTimestamp = chunk.timestamp;
+            lastTimestamp = chunk.timestamp;
+            ++block->numberOfChunks;
+            ++numberOfChunks;
+        }
+
+        offset += recordHeader->size;
+        block->usedSize = offset - block->offset;
+    }
+
+    if (block.has_value())
+    {
+        m_blocks.push_back(block.value());
+    }
+
+    m_fileHeader.numberOfTopics = m_topics.size();
+    m_fileHeader.numberOfBlocks = m_blocks.size();
+    m_fileHeader.numberOfChunks = numberOfChunks;
+    return ok();
+}
+
+const RecordHeader* RecordFileReader::recordAt(const uint64_t offset, const uint64_t blockEnd) const noexcept
+{
+    if (offset % RECORD_ALIGNMENT != 0U || offset > blockEnd || blockEnd - offset < sizeof(RecordHeader))
+    {
+        return nullptr;
+    }
+
+    // NOLINTJUSTIFICATION the records are aligned to RECORD_ALIGNMENT within the page aligned mapping
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto* recordHeader = reinterpret_cast<const RecordHeader*>(data() + offset);
+    if (recordHeader->magic != RECORD_MAGIC || recordHeader->size < sizeof(RecordHeader)
+        || recordHeader->size % RECORD_ALIGNMENT != 0U || recordHeader->size > blockEnd - offset)
+    {
+        return nullptr;
+    }
+    return recordHeader;
+}
+
+void RecordFileReader::seek(const uint64_t timestamp) noexcept
+{
+    // the timestamps of the block index are monotonic, therefore the first block which can contain the chunk is the
+    // first one whose last timestamp is not smaller than the requested one
+    auto block = std::lower_bound(
+        m_blocks.begin(), m_blocks.end(), timestamp, [](const BlockIndexEntry& entry, const uint64_t value) {
+            return entry.lastTimestamp < value;
+        });
+    m_currentBlock = static_cast<uint64_t>(std::distance(m_blocks.begin(), block));
+    m_currentOffset = (block == m_blocks.end()) ? 0U : block->offset;
+
+    while (true)
+    {
+        const auto currentBlock = m_currentBlock;
+        const auto currentOffset = m_currentOffset;
+        auto chunk = next();
+        if (!chunk.has_value() || chunk->entry->timestamp >= timestamp)
+        {
+            m_currentBlock = currentBlock;
+            m_currentOffset = currentOffset;
+            return;
+        }
+    }
+}
+
+optional<RecordedChunk> RecordFileReader::next() noexcept
+{
+    while (m_currentBlock < m_blocks.size())
+    {
+        const auto& block = m_blocks[m_currentBlock];
+        m_currentOffset = std::max(m_currentOffset, block.offset);
+
+        const auto* recordHeader = recordAt(m_currentOffset, block.offset + block.usedSize);
+        if (recordHeader == nullptr)
+        {
+            ++m_currentBlock;
+            continue;
+        }
+
+        const auto* record = data() + m_currentOffset;
+        m_currentOffset += recordHeader->size;
+
+        if (recordHeader->type != RecordType::CHUNK || recordHeader->size < sizeof(RecordHeader) + sizeof(ChunkEntry))
+        {
+            continue;
+        }
+
+        // NOLINTJUSTIFICATION the records are aligned to RECORD_ALIGNMENT within the page aligned mapping
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        const auto* entry = reinterpret_cast<const ChunkEntry*>(record + sizeof(RecordHeader));
+        if (entry->recordSize() != recordHeader->size)
+        {
+            IOX_LOG(Warn, "Skipping a corrupted chunk record of the record file");
+            continue;
+        }
+
+        RecordedChunk chunk;
+        chunk.entry = entry;
+        chunk.userHeader = (entry->userHeaderSize > 0U) ? record + ChunkEntry::userHeaderOffset() : nullptr;
+        chunk.userPayload = record + entry->userPayloadOffset();
+        return chunk;
+    }
+
+    return nullopt;
+}
+
+} // namespace record
+} // namespace iox
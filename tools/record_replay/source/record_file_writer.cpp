@@ -0,0 +1,357 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_record_replay/record_file_writer.hpp"
+#include "iceoryx_platform/unistd.hpp"
+#include "iox/detail/system_configuration.hpp"
+#include "iox/logging.hpp"
+#include "iox/posix_call.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace iox
+{
+namespace record
+{
+expected<RecordFileWriter, RecordFileError> RecordFileWriter::create(const FilePath& path,
+                                                                     const uint64_t blockSize) noexcept
+{
+    auto file = FileBuilder()
+                    .access_mode(AccessMode::ReadWrite)
+                    .open_mode(OpenMode::PurgeAndCreate)
+                    .permissions(perms::owner_read | perms::owner_write | perms::group_read | perms::others_read)
+                    .create(path);
+    if (file.has_error())
+    {
+        IOX_LOG(Error, "Unable to create the record file '" << path.as_string() << "'");
+        return err(RecordFileError::FILE_ACCESS_FAILED);
+    }
+
+    const uint64_t pageSize = detail::pageSize();
+    const uint64_t alignedBlockSize = (blockSize == 0U) ? pageSize : (blockSize + pageSize - 1U) / pageSize * pageSize;
+    RecordFileWriter writer(std::move(file.value()), alignedBlockSize, pageSize);
+
+    // the header is written immediately to be able to recover a recording which was not closed
+    auto result = writer.resizeFile(pageSize);
+    if (!result.has_error())
+    {
+        result = writer.writeAt(0U, &writer.m_fileHeader, sizeof(writer.m_fileHeader));
+    }
+    if (result.has_error())
+    {
+        return err(result.error());
+    }
+
+    return ok(std::move(writer));
+}
+
+RecordFileWriter::RecordFileWriter(File&& file, const uint64_t blockSize, const uint64_t pageSize) noexcept
+    : m_file(std::move(file))
+    , m_blockSize(blockSize)
+    , m_pageSize(pageSize)
+    , m_startTime(std::chrono::steady_clock::now())
+    , m_nextBlockOffset(pageSize)
+{
+    m_fileHeader.blockAlignment = pageSize;
+    m_fileHeader.startTime = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch())
+            .count());
+}
+
+RecordFileWriter::RecordFileWriter(RecordFileWriter&& rhs) noexcept
+{
+    *this = std::move(rhs);
+}
+
+RecordFileWriter& RecordFileWriter::operator=(RecordFileWriter&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        if (m_file.has_value())
+        {
+            close().or_else([](auto& error) {
+                IOX_LOG(Error, "Unable to close the record file: " << asStringLiteral(error));
+            });
+        }
+
+        m_file = std::move(rhs.m_file);
+        m_block = std::move(rhs.m_block);
+        m_blockLength = rhs.m_blockLength;
+        m_blockSize = rhs.m_blockSize;
+        m_pageSize = rhs.m_pageSize;
+        m_fileHeader = rhs.m_fileHeader;
+        m_startTime = rhs.m_startTime;
+        m_nextBlockOffset = rhs.m_nextBlockOffset;
+        m_topics = std::move(rhs.m_topics);
+        m_blocks = std::move(rhs.m_blocks);
+
+        rhs.m_file.reset();
+        rhs.m_block.reset();
+    }
+    return *this;
+}
+
+RecordFileWriter::~RecordFileWriter() noexcept
+{
+    if (m_file.has_value())
+    {
+        close().or_else(
+            [](auto& error) { IOX_LOG(Error, "Unable to close the record file: " << asStringLiteral(error)); });
+    }
+}
+
+expected<uint32_t, RecordFileError>
+RecordFileWriter::addTopic(const capro::ServiceDescription& serviceDescription) noexcept
+{
+    constexpr uint64_t RECORD_SIZE{sizeof(RecordHeader) + sizeof(TopicEntry)};
+
+    const auto topicId = static_cast<uint32_t>(m_topics.size());
+    const auto topicEntry = TopicEntry::fromServiceDescription(topicId, serviceDescription);
+
+    auto reservation = reserve(RECORD_SIZE);
+    if (reservation.has_error())
+    {
+        return err(reservation.error());
+    }
+
+    RecordHeader recordHeader;
+    recordHeader.type = RecordType::TOPIC;
+    recordHeader.size = RECORD_SIZE;
+    auto* const record = reservation.value();
+    std::memcpy(record, &recordHeader, sizeof(recordHeader));
+    std::memcpy(record + sizeof(recordHeader), &topicEntry, sizeof(topicEntry));
+
+    m_topics.push_back(topicEntry);
+    m_fileHeader.numberOfTopics = m_topics.size();
+    return ok(topicId);
+}
+
+expected<void, RecordFileError> RecordFileWriter::writeChunk(const ChunkEntry& chunkEntry,
+                                                             const void* const userHeader,
+                                                             const void* const userPayload) noexcept
+{
+    auto reservation = reserve(chunkEntry.recordSize());
+    if (reservation.has_error())
+    {
+        return err(reservation.error());
+    }
+
+    auto* const record = reservation.value();
+    if (chunkEntry.userHeaderSize > 0U)
+    {
+        std::memcpy(record + ChunkEntry::userHeaderOffset(), userHeader, chunkEntry.userHeaderSize);
+    }
+    std::memcpy(record + chunkEntry.userPayloadOffset(), userPayload, chunkEntry.userPayloadSize);
+    commitChunk(record, chunkEntry);
+
+    return ok();
+}
+
+expected<void, RecordFileError>
+RecordFileWriter::writeChainedChunk(ChunkEntry chunkEntry, const mepoo::ConstChainedPayload& chainedPayload) noexcept
+{
+    chunkEntry.flags |= ChunkEntry::FLAG_CHAINED;
+    chunkEntry.userHeaderSize = 0U;
+    chunkEntry.userPayloadSize = chainedPayload.size();
+
+    auto reservation = reserve(chunkEntry.recordSize());
+    if (reservation.has_error())
+    {
+        return err(reservation.error());
+    }
+
+    auto* const record = reservation.value();
+    chainedPayload.copyTo(record + chunkEntry.userPayloadOffset(), chunkEntry.userPayloadSize);
+    commitChunk(record, chunkEntry);
+
+    return ok();
+}
+
+void RecordFileWriter::commitChunk(uint8_t* const record, const ChunkEntry& chunkEntry) noexcept
+{
+    RecordHeader recordHeader;
+    recordHeader.type = RecordType::CHUNK;
+    recordHeader.size = chunkEntry.recordSize();
+    std::memcpy(record, &recordHeader, sizeof(recordHeader));
+    std::memcpy(record + sizeof(recordHeader), &chunkEntry, sizeof(chunkEntry));
+
+    auto& block = m_blocks.back();
+    if (block.numberOfChunks == 0U)
+    {
+        block.firstTimestamp = chunkEntry.timestamp;
+    }
+    block.lastTimestamp = chunkEntry.timestamp;
+    ++block.numberOfChunks;
+    ++m_fileHeader.numberOfChunks;
+}
+
+expected<void, RecordFileError> RecordFileWriter::close() noexcept
+{
+    if (!m_file.has_value())
+    {
+        return err(RecordFileError::FILE_ALREADY_CLOSED);
+    }
+
+    // unmapping the last block hands it over to the kernel for the write-back
+    m_block.reset();
+
+    const uint64_t topicTableOffset = alignToRecord(size() + m_pageSize);
+    const uint64_t topicTableSize = m_topics.size() * sizeof(TopicEntry);
+    const uint64_t blockIndexOffset = topicTableOffset + topicTableSize;
+    const uint64_t blockIndexSize = m_blocks.size() * sizeof(BlockIndexEntry);
+
+    m_fileHeader.isClosed = 1U;
+    m_fileHeader.topicTableOffset = topicTableOffset;
+    m_fileHeader.numberOfTopics = m_topics.size();
+    m_fileHeader.blockIndexOffset = blockIndexOffset;
+    m_fileHeader.numberOfBlocks = m_blocks.size();
+
+    auto result = resizeFile(blockIndexOffset + blockIndexSize);
+    if (!result.has_error())
+    {
+        result = writeAt(topicTableOffset, m_topics.data(), topicTableSize);
+    }
+    if (!result.has_error())
+    {
+        result = writeAt(blockIndexOffset, m_blocks.data(), blockIndexSize);
+    }
+    if (!result.has_error())
+    {
+        // the header is written last, i.e. the file is only marked as closed when the index is complete
+        result = writeAt(0U, &m_fileHeader, sizeof(m_fileHeader));
+    }
+
+    m_file.reset();
+    return result;
+}
+
+uint64_t RecordFileWriter::numberOfChunks() const noexcept
+{
+    return m_fileHeader.numberOfChunks;
+}
+
+uint64_t RecordFileWriter::size() const noexcept
+{
+    // the blocks are contiguous and only the last block is partially used
+    return m_blocks.empty() ? 0U : m_blocks.back().offset + m_blocks.back().usedSize - m_pageSize;
+}
+
+uint64_t RecordFileWriter::elapsedTime() const noexcept
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_startTime)
+            .count());
+}
+
+expected<uint8_t*, RecordFileError> RecordFileWriter::reserve(const uint64_t recordSize) noexcept
+{
+    if (!m_file.has_value())
+    {
+        return err(RecordFileError::FILE_ALREADY_CLOSED);
+    }
+
+    if (!m_block.has_value() || m_blocks.back().usedSize + recordSize > m_blockLength)
+    {
+        auto result = startBlock(recordSize);
+        if (result.has_error())
+        {
+            return err(result.error());
+        }
+    }
+
+    auto& block = m_blocks.back();
+    auto* const record = static_cast<uint8_t*>(m_block->getBaseAddress()) + block.usedSize;
+    block.usedSize += recordSize;
+    return ok(record);
+}
+
+expected<void, RecordFileError> RecordFileWriter::startBlock(const uint64_t minimumSize) noexcept
+{
+    const uint64_t offset = m_nextBlockOffset;
+    const uint64_t length = std::max(m_blockSize, (minimumSize + m_pageSize - 1U) / m_pageSize * m_pageSize);
+
+    m_block.reset();
+    auto resizeResult = resizeFile(offset + length);
+    if (resizeResult.has_error())
+    {
+        return resizeResult;
+    }
+
+    auto block = detail::PosixMemoryMapBuilder()
+                     .fileDescriptor(m_file->get_file_handle())
+                     .length(length)
+                     .offset(static_cast<off_t>(offset))
+                     .accessMode(AccessMode::ReadWrite)
+                     .flags(detail::PosixMemoryMapFlags::SHARE_CHANGES)
+                     .create();
+    if (block.has_error())
+    {
+        IOX_LOG(Error, "Unable to map a block of " << length << " bytes of the record file");
+        return err(RecordFileError::MEMORY_MAPPING_FAILED);
+    }
+
+    m_block.emplace(std::move(block.value()));
+    m_blockLength = length;
+    m_nextBlockOffset = offset + length;
+
+    BlockIndexEntry blockIndexEntry;
+    blockIndexEntry.offset = offset;
+    // keeps the timestamps of the block index monotonic even if a block contains only topics
+    if (!m_blocks.empty())
+    {
+        blockIndexEntry.firstTimestamp = m_blocks.back().lastTimestamp;
+        blockIndexEntry.lastTimestamp = m_blocks.back().lastTimestamp;
+    }
+    m_blocks.push_back(blockIndexEntry);
+    m_fileHeader.numberOfBlocks = m_blocks.size();
+
+    return ok();
+}
+
+expected<void, RecordFileError> RecordFileWriter::resizeFile(const uint64_t size) const noexcept
+{
+    auto result = IOX_POSIX_CALL(iox_ftruncate)(m_file->get_file_handle(), static_cast<off_t>(size))
+                      .failureReturnValue(-1)
+                      .evaluate();
+    if (result.has_error())
+    {
+        IOX_LOG(Error, "Unable to resize the record file to " << size << " bytes");
+        return err(RecordFileError::FILE_ACCESS_FAILED);
+    }
+    return ok();
+}
+
+expected<void, RecordFileError>
+RecordFileWriter::writeAt(const uint64_t offset, const void* const data, const uint64_t size) noexcept
+{
+    if (size == 0U)
+    {
+        return ok();
+    }
+
+    auto result = m_file->write_at(offset, static_cast<const uint8_t*>(data), size);
+    if (result.has_error() || result.value() != size)
+    {
+        IOX_LOG(Error, "Unable to write " << size << " bytes to the record file");
+        return err(RecordFileError::FILE_ACCESS_FAILED);
+    }
+    return ok();
+}
+
+} // namespace record
+} // namespace iox
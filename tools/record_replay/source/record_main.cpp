@@ -0,0 +1,99 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_record_replay/recorder.hpp"
+#include "iox/cli_definition.hpp"
+#include "iox/signal_watcher.hpp"
+
+#include <chrono>
+#include <iostream>
+
+namespace
+{
+struct CommandLine
+{
+    IOX_CLI_DEFINITION(CommandLine);
+
+    IOX_CLI_REQUIRED(iox::cli::Argument_t, output, 'o', "output", "The record file which is created");
+    IOX_CLI_OPTIONAL(
+        iox::cli::Argument_t, service, {""}, 's', "service", "The service which is recorded, all when not set");
+    IOX_CLI_OPTIONAL(
+        iox::cli::Argument_t, instance, {""}, 'i', "instance", "The instance which is recorded, all when not set");
+    IOX_CLI_OPTIONAL(iox::cli::Argument_t, event, {""}, 'e', "event", "The event which is recorded, all when not set");
+    IOX_CLI_OPTIONAL(
+        uint64_t, duration, 0U, 'd', "duration", "The duration of the recording in seconds, 0 records until Ctrl+C");
+    IOX_CLI_OPTIONAL(
+        uint64_t, blockSize, 16U, 'b', "block-size", "The size of the memory-mapped blocks of the file in MiB");
+};
+
+iox::optional<iox::capro::IdString_t> toFilter(const iox::cli::Argument_t& value)
+{
+    if (value.empty())
+    {
+        return iox::nullopt;
+    }
+    return iox::capro::IdString_t(iox::TruncateToCapacity, value.c_str());
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    using namespace iox::record;
+    constexpr uint64_t MIB{1024U * 1024U};
+
+    auto cmd = CommandLine::parse(argc, argv, "Records publish-subscribe topics into a record file");
+
+    auto path = iox::FilePath::create(cmd.output());
+    if (path.has_error())
+    {
+        std::cerr << "\"" << cmd.output().c_str() << "\" is not a valid file path" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    auto writer = RecordFileWriter::create(path.value(), cmd.blockSize() * MIB);
+    if (writer.has_error())
+    {
+        std::cerr << "Unable to create the record file: " << asStringLiteral(writer.error()) << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    iox::runtime::PoshRuntime::initRuntime("iox-record");
+
+    {
+        Recorder recorder(writer.value(), toFilter(cmd.service()), toFilter(cmd.instance()), toFilter(cmd.event()));
+
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(cmd.duration());
+        const auto hasDuration = cmd.duration() > 0U;
+        recorder.run(
+            [&] {
+                return !iox::hasTerminationRequested()
+                       && (!hasDuration || std::chrono::steady_clock::now() < deadline);
+            },
+            iox::units::Duration::fromMilliseconds(100));
+    }
+
+    const auto numberOfChunks = writer->numberOfChunks();
+    if (writer->close().has_error())
+    {
+        std::cerr << "Unable to close the record file" << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::cout << "Recorded " << numberOfChunks << " chunks into " << cmd.output().c_str() << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,188 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_record_replay/recorder.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/mepoo/chained_payload.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/roudi/introspection_types.hpp"
+#include "iox/logging.hpp"
+
+#include <chrono>
+
+namespace iox
+{
+namespace record
+{
+Recorder::Recorder(RecordFileWriter& writer,
+                   const optional<capro::IdString_t>& service,
+                   const optional<capro::IdString_t>& instance,
+                   const optional<capro::IdString_t>& event) noexcept
+    : m_writer(writer)
+    , m_service(service)
+    , m_instance(instance)
+    , m_event(event)
+{
+}
+
+void Recorder::discoverTopics() noexcept
+{
+    std::vector<capro::ServiceDescription> foundTopics;
+    m_serviceDiscovery.findService(
+        m_service,
+        m_instance,
+        m_event,
+        [&](const capro::ServiceDescription& serviceDescription) { foundTopics.push_back(serviceDescription); },
+        popo::MessagingPattern::PUB_SUB);
+
+    for (const auto& serviceDescription : foundTopics)
+    {
+        if (!isRecorded(serviceDescription))
+        {
+            addTopic(serviceDescription);
+        }
+    }
+}
+
+bool Recorder::isRecorded(const capro::ServiceDescription& serviceDescription) const noexcept
+{
+    // the internal topics are only recorded when they are explicitly requested
+    if (!m_service.has_value()
+        && (serviceDescription.getServiceIDString() == capro::IdString_t(TruncateToCapacity,
+                                                                         roudi::INTROSPECTION_SERVICE_ID)
+            || serviceDescription.getServiceIDString()
+                   == capro::IdString_t(TruncateToCapacity, SERVICE_DISCOVERY_SERVICE_NAME)))
+    {
+        return true;
+    }
+
+    for (const auto& topic : m_topics)
+    {
+        if (topic.subscriber->getServiceDescription() == serviceDescription)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void Recorder::addTopic(const capro::ServiceDescription& serviceDescription) noexcept
+{
+    auto topicId = m_writer.addTopic(serviceDescription);
+    if (topicId.has_error())
+    {
+        IOX_LOG(Error,
+                "Unable to add the topic " << serviceDescription
+                                           << " to the recording: " << asStringLiteral(topicId.error()));
+        return;
+    }
+
+    popo::SubscriberOptions options;
+    options.queueCapacity = popo::SubscriberChunkQueueData_t::MAX_CAPACITY;
+    options.nodeName = NodeName_t(TruncateToCapacity, "iox-record");
+
+    RecordedTopic topic;
+    topic.subscriber = std::make_unique<popo::UntypedSubscriber>(serviceDescription, options);
+    topic.topicId = topicId.value();
+
+    const auto notificationId = m_topics.size();
+    if (m_waitSet.attachState(*topic.subscriber, popo::SubscriberState::HAS_DATA, notificationId).has_error())
+    {
+        IOX_LOG(Warn,
+                "Unable to record the topic " << serviceDescription
+                                              << " since the maximum number of subscribers is reached");
+        return;
+    }
+
+    IOX_LOG(Info, "Recording " << serviceDescription);
+    m_topics.emplace_back(std::move(topic));
+}
+
+void Recorder::run(const function_ref<bool()> keepRunning, const units::Duration discoveryInterval) noexcept
+{
+    const auto interval = std::chrono::nanoseconds(discoveryInterval.toNanoseconds());
+    auto nextDiscovery = std::chrono::steady_clock::now();
+
+    while (keepRunning())
+    {
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= nextDiscovery)
+        {
+            discoverTopics();
+            nextDiscovery = now + interval;
+        }
+
+        auto notificationVector = m_waitSet.timedWait(discoveryInterval);
+        for (const auto* notification : notificationVector)
+        {
+            recordChunks(m_topics[notification->getNotificationId()]);
+        }
+    }
+
+    recordAvailableChunks();
+}
+
+void Recorder::recordAvailableChunks() noexcept
+{
+    for (auto& topic : m_topics)
+    {
+        recordChunks(topic);
+    }
+}
+
+void Recorder::recordChunks(RecordedTopic& topic) noexcept
+{
+    while (true)
+    {
+        auto userPayload = topic.subscriber->take();
+        if (userPayload.has_error())
+        {
+            return;
+        }
+
+        const auto* chunkHeader = mepoo::ChunkHeader::fromUserPayload(userPayload.value());
+
+        ChunkEntry chunkEntry;
+        chunkEntry.timestamp = m_writer.elapsedTime();
+        chunkEntry.sequenceNumber = chunkHeader->sequenceNumber();
+        chunkEntry.originId = static_cast<uint64_t>(chunkHeader->originId());
+        chunkEntry.userPayloadSize = chunkHeader->userPayloadSize();
+        chunkEntry.topicId = topic.topicId;
+        chunkEntry.userHeaderSize = chunkHeader->userHeaderSize();
+        chunkEntry.userPayloadAlignment = chunkHeader->userPayloadAlignment();
+        chunkEntry.userHeaderId = chunkHeader->userHeaderId();
+
+        auto chainedPayload = mepoo::ConstChainedPayload::fromUserPayload(userPayload.value());
+        auto result = chainedPayload.has_value()
+                          ? m_writer.writeChainedChunk(chunkEntry, chainedPayload.value())
+                          : m_writer.writeChunk(chunkEntry, chunkHeader->userHeader(), userPayload.value());
+        if (result.has_error())
+        {
+            IOX_LOG(Error, "Unable to record a chunk: " << asStringLiteral(result.error()));
+        }
+
+        topic.subscriber->release(userPayload.value());
+    }
+}
+
+uint64_t Recorder::numberOfTopics() const noexcept
+{
+    return m_topics.size();
+}
+
+} // namespace record
+} // namespace iox
@@ -0,0 +1,89 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_record_replay/replayer.hpp"
+#include "iox/cli_definition.hpp"
+#include "iox/signal_watcher.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+namespace
+{
+struct CommandLine
+{
+    IOX_CLI_DEFINITION(CommandLine);
+
+    IOX_CLI_REQUIRED(iox::cli::Argument_t, input, 'i', "input", "The record file which is replayed");
+    IOX_CLI_OPTIONAL(
+        double, rate, 1.0, 'r', "rate", "The replay rate relative to the recording, 0 replays as fast as possible");
+    IOX_CLI_OPTIONAL(
+        uint64_t, start, 0U, 's', "start", "The offset in milliseconds from the begin of the recording to start at");
+    IOX_CLI_OPTIONAL(uint64_t,
+                     delay,
+                     1000U,
+                     'd',
+                     "delay",
+                     "The delay in milliseconds between the creation of the publishers and the replay");
+};
+} // namespace
+
+int main(int argc, char** argv)
+{
+    using namespace iox::record;
+
+    auto cmd = CommandLine::parse(argc, argv, "Replays a record file with the timing of the recording");
+
+    if (cmd.rate() < 0.0)
+    {
+        std::cerr << "The rate must not be negative" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    auto path = iox::FilePath::create(cmd.input());
+    if (path.has_error())
+    {
+        std::cerr << "\"" << cmd.input().c_str() << "\" is not a valid file path" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    auto reader = RecordFileReader::open(path.value());
+    if (reader.has_error())
+    {
+        std::cerr << "Unable to open the record file: " << asStringLiteral(reader.error()) << std::endl;
+        return EXIT_FAILURE;
+    }
+    if (reader->isRecovered())
+    {
+        std::cout << "The record file was not closed, the index was recovered" << std::endl;
+    }
+
+    iox::runtime::PoshRuntime::initRuntime("iox-replay");
+
+    Replayer replayer(reader.value(), cmd.rate());
+    replayer.seek(iox::units::Duration::fromMilliseconds(cmd.start()));
+
+    // gives the subscribers the opportunity to connect to the publishers before the first chunk is published
+    std::this_thread::sleep_for(std::chrono::milliseconds(cmd.delay()));
+
+    const auto numberOfChunks = replayer.run([] { return !iox::hasTerminationRequested(); });
+    std::cout << "Replayed " << numberOfChunks << " chunks from " << cmd.input().c_str() << std::endl;
+
+    return EXIT_SUCCESS;
+}
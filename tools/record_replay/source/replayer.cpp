@@ -0,0 +1,140 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_record_replay/replayer.hpp"
+#include "iceoryx_posh/mepoo/chained_payload.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iox/logging.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+namespace iox
+{
+namespace record
+{
+Replayer::Replayer(RecordFileReader& reader, const double rate) noexcept
+    : m_reader(reader)
+    , m_rate(rate)
+    , m_startTimestamp(reader.firstTimestamp())
+{
+    popo::PublisherOptions options;
+    options.nodeName = NodeName_t(TruncateToCapacity, "iox-replay");
+
+    for (const auto& topic : m_reader.topics())
+    {
+        if (m_publishers.size() <= topic.topicId)
+        {
+            m_publishers.resize(topic.topicId + 1U);
+        }
+        const auto serviceDescription = topic.toServiceDescription();
+        IOX_LOG(Info, "Replaying " << serviceDescription);
+        m_publishers[topic.topicId] = std::make_unique<popo::UntypedPublisher>(serviceDescription, options);
+    }
+}
+
+void Replayer::seek(const units::Duration offset) noexcept
+{
+    m_startTimestamp = m_reader.firstTimestamp() + offset.toNanoseconds();
+    m_reader.seek(m_startTimestamp);
+}
+
+uint64_t Replayer::run(const function_ref<bool()> keepRunning) noexcept
+{
+    // the sleep is split into slices to react on a termination request during long pauses of the recording
+    constexpr std::chrono::milliseconds MAX_SLEEP_SLICE{100};
+
+    const auto replayStart = std::chrono::steady_clock::now();
+    uint64_t numberOfPublishedChunks{0U};
+
+    while (keepRunning())
+    {
+        auto chunk = m_reader.next();
+        if (!chunk.has_value())
+        {
+            break;
+        }
+
+        if (m_rate > 0.0)
+        {
+            const auto timestamp = std::max(chunk->entry->timestamp, m_startTimestamp);
+            const auto releaseTime =
+                replayStart
+                + std::chrono::nanoseconds(static_cast<int64_t>(static_cast<double>(timestamp - m_startTimestamp)
+                                                                / m_rate));
+            auto now = std::chrono::steady_clock::now();
+            while (now < releaseTime && keepRunning())
+            {
+                std::this_thread::sleep_for(
+                    std::min<std::chrono::steady_clock::duration>(releaseTime - now, MAX_SLEEP_SLICE));
+                now = std::chrono::steady_clock::now();
+            }
+        }
+
+        if (publish(chunk.value()))
+        {
+            ++numberOfPublishedChunks;
+        }
+    }
+
+    return numberOfPublishedChunks;
+}
+
+bool Replayer::publish(const RecordedChunk& chunk) noexcept
+{
+    const auto& entry = *chunk.entry;
+    if (entry.topicId >= m_publishers.size() || !m_publishers[entry.topicId])
+    {
+        IOX_LOG(Warn, "Skipping a chunk of the unknown topic " << entry.topicId);
+        return false;
+    }
+    auto& publisher = *m_publishers[entry.topicId];
+
+    if ((entry.flags & ChunkEntry::FLAG_CHAINED) != 0U)
+    {
+        return publisher.loanChained(entry.userPayloadSize, entry.userPayloadAlignment)
+            .and_then([&](auto& userPayload) {
+                mepoo::ChainedPayload::fromUserPayload(userPayload).and_then([&](auto& chainedPayload) {
+                    chainedPayload.copyFrom(chunk.userPayload, entry.userPayloadSize);
+                });
+                publisher.publish(userPayload);
+            })
+            .or_else([](auto& error) { IOX_LOG(Warn, "Unable to loan a chained message: " << error); })
+            .has_value();
+    }
+
+    const uint32_t userHeaderAlignment =
+        (entry.userHeaderSize == 0U) ? CHUNK_NO_USER_HEADER_ALIGNMENT : alignof(mepoo::ChunkHeader);
+    return publisher.loan(entry.userPayloadSize, entry.userPayloadAlignment, entry.userHeaderSize, userHeaderAlignment)
+        .and_then([&](auto& userPayload) {
+            if (entry.userHeaderSize > 0U)
+            {
+                std::memcpy(mepoo::ChunkHeader::fromUserPayload(userPayload)->userHeader(),
+                            chunk.userHeader,
+                            entry.userHeaderSize);
+            }
+            std::memcpy(userPayload, chunk.userPayload, entry.userPayloadSize);
+            publisher.publish(userPayload);
+        })
+        .or_else([](auto& error) { IOX_LOG(Warn, "Unable to loan a chunk: " << error); })
+        .has_value();
+}
+
+} // namespace record
+} // namespace iox
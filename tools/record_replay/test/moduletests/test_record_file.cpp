@@ -0,0 +1,227 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_platform/platform_settings.hpp"
+#include "iceoryx_record_replay/record_file_reader.hpp"
+#include "iceoryx_record_replay/record_file_writer.hpp"
+#include "iox/file.hpp"
+#include "iox/path.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::record;
+
+class RecordFile_test : public Test
+{
+  public:
+    static constexpr uint64_t PAGE_SIZED_BLOCKS{4096U};
+
+    void SetUp() override
+    {
+        IOX_DISCARD_RESULT(File::remove(m_filePath));
+    }
+
+    void TearDown() override
+    {
+        IOX_DISCARD_RESULT(File::remove(m_filePath));
+    }
+
+    static ChunkEntry chunkEntry(const uint32_t topicId, const uint64_t timestamp, const uint64_t userPayloadSize)
+    {
+        ChunkEntry entry;
+        entry.timestamp = timestamp;
+        entry.sequenceNumber = timestamp;
+        entry.userPayloadSize = userPayloadSize;
+        entry.topicId = topicId;
+        entry.userPayloadAlignment = alignof(uint64_t);
+        return entry;
+    }
+
+    static void writeChunks(RecordFileWriter& writer, const uint64_t numberOfChunks, const uint64_t timeStep)
+    {
+        for (uint64_t i = 0U; i < numberOfChunks; ++i)
+        {
+            const uint64_t userPayload{i};
+            ASSERT_FALSE(writer.writeChunk(chunkEntry(0U, i * timeStep, sizeof(userPayload)), nullptr, &userPayload)
+                             .has_error());
+        }
+    }
+
+    FilePath m_filePath = [] {
+        auto path = Path::create(platform::IOX_TEMP_DIR).expect("invalid temp dir");
+        path.append(string<16>(TruncateToCapacity, "test-record-file")).expect("invalid file name");
+        return FilePath::create(path.as_string()).expect("invalid file path");
+    }();
+    capro::ServiceDescription m_serviceDescription{"Radar", "Front", "Objects"};
+};
+
+TEST_F(RecordFile_test, WrittenChunksAreReadInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "46c225e5-b031-4542-86b6-8e6d65e45eed");
+    constexpr uint64_t NUMBER_OF_CHUNKS{100U};
+    constexpr uint64_t USER_HEADER{0xC0FFEEU};
+    {
+        auto writer = RecordFileWriter::create(m_filePath).expect("creating the record file");
+        ASSERT_FALSE(writer.addTopic(m_serviceDescription).has_error());
+        auto topicId = writer.addTopic({"Radar", "Rear", "Objects"});
+        ASSERT_FALSE(topicId.has_error());
+
+        for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+        {
+            const uint64_t userPayload{i};
+            auto entry = chunkEntry(topicId.value(), i, sizeof(userPayload));
+            entry.userHeaderSize = sizeof(USER_HEADER);
+            entry.userHeaderId = 42U;
+            ASSERT_FALSE(writer.writeChunk(entry, &USER_HEADER, &userPayload).has_error());
+        }
+        EXPECT_THAT(writer.numberOfChunks(), Eq(NUMBER_OF_CHUNKS));
+        ASSERT_FALSE(writer.close().has_error());
+    }
+
+    auto reader = RecordFileReader::open(m_filePath).expect("opening the record file");
+    EXPECT_FALSE(reader.isRecovered());
+    EXPECT_THAT(reader.fileHeader().numberOfChunks, Eq(NUMBER_OF_CHUNKS));
+    ASSERT_THAT(reader.topics().size(), Eq(2U));
+    EXPECT_THAT(reader.topics()[0].toServiceDescription(), Eq(m_serviceDescription));
+    EXPECT_THAT(reader.topics()[1].toServiceDescription(), Eq(capro::ServiceDescription("Radar", "Rear", "Objects")));
+
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto chunk = reader.next();
+        ASSERT_TRUE(chunk.has_value());
+        EXPECT_THAT(chunk->entry->topicId, Eq(1U));
+        EXPECT_THAT(chunk->entry->timestamp, Eq(i));
+        EXPECT_THAT(chunk->entry->userHeaderId, Eq(42U));
+        EXPECT_THAT(*static_cast<const uint64_t*>(chunk->userHeader), Eq(USER_HEADER));
+        EXPECT_THAT(*static_cast<const uint64_t*>(chunk->userPayload), Eq(i));
+    }
+    EXPECT_FALSE(reader.next().has_value());
+}
+
+TEST_F(RecordFile_test, ChunksAreSpreadOverMultipleBlocks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b537e4ab-c698-4edd-a10c-2be17b3c595e");
+    constexpr uint64_t NUMBER_OF_CHUNKS{10U};
+    constexpr uint64_t USER_PAYLOAD_SIZE{3000U};
+    {
+        auto writer = RecordFileWriter::create(m_filePath, PAGE_SIZED_BLOCKS).expect("creating the record file");
+        ASSERT_FALSE(writer.addTopic(m_serviceDescription).has_error());
+
+        std::vector<uint8_t> userPayload(USER_PAYLOAD_SIZE);
+        for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+        {
+            std::memset(userPayload.data(), static_cast<int>(i), userPayload.size());
+            ASSERT_FALSE(writer.writeChunk(chunkEntry(0U, i, USER_PAYLOAD_SIZE), nullptr, userPayload.data())
+                             .has_error());
+        }
+    }
+
+    auto reader = RecordFileReader::open(m_filePath).expect("opening the record file");
+    EXPECT_THAT(reader.blocks().size(), Gt(1U));
+
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto chunk = reader.next();
+        ASSERT_TRUE(chunk.has_value());
+        ASSERT_THAT(chunk->entry->userPayloadSize, Eq(USER_PAYLOAD_SIZE));
+        const auto* userPayload = static_cast<const uint8_t*>(chunk->userPayload);
+        EXPECT_THAT(userPayload[0], Eq(i));
+        EXPECT_THAT(userPayload[USER_PAYLOAD_SIZE - 1U], Eq(i));
+    }
+    EXPECT_FALSE(reader.next().has_value());
+}
+
+TEST_F(RecordFile_test, SeekPositionsAtFirstChunkNotBeforeTimestamp)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5b4b021f-e21a-4066-a431-5438da2acbde");
+    constexpr uint64_t NUMBER_OF_CHUNKS{1000U};
+    constexpr uint64_t TIME_STEP{10U};
+    {
+        auto writer = RecordFileWriter::create(m_filePath, PAGE_SIZED_BLOCKS).expect("creating the record file");
+        ASSERT_FALSE(writer.addTopic(m_serviceDescription).has_error());
+        writeChunks(writer, NUMBER_OF_CHUNKS, TIME_STEP);
+    }
+
+    auto reader = RecordFileReader::open(m_filePath).expect("opening the record file");
+    ASSERT_THAT(reader.blocks().size(), Gt(1U));
+    EXPECT_THAT(reader.firstTimestamp(), Eq(0U));
+    EXPECT_THAT(reader.lastTimestamp(), Eq((NUMBER_OF_CHUNKS - 1U) * TIME_STEP));
+
+    reader.seek(5555U);
+    auto chunk = reader.next();
+    ASSERT_TRUE(chunk.has_value());
+    EXPECT_THAT(chunk->entry->timestamp, Eq(5560U));
+
+    reader.seek(0U);
+    chunk = reader.next();
+    ASSERT_TRUE(chunk.has_value());
+    EXPECT_THAT(chunk->entry->timestamp, Eq(0U));
+
+    reader.seek(NUMBER_OF_CHUNKS * TIME_STEP);
+    EXPECT_FALSE(reader.next().has_value());
+}
+
+TEST_F(RecordFile_test, IndexOfFileWhichWasNotClosedIsRecovered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1c804504-b49f-40e6-860d-7538f3a4fcad");
+    constexpr uint64_t NUMBER_OF_CHUNKS{500U};
+    auto writer = RecordFileWriter::create(m_filePath, PAGE_SIZED_BLOCKS).expect("creating the record file");
+    ASSERT_FALSE(writer.addTopic(m_serviceDescription).has_error());
+    writeChunks(writer, NUMBER_OF_CHUNKS, 1U);
+
+    // the writer is still open, i.e. the reader sees the file as it is left behind by a crashed recorder
+    auto reader = RecordFileReader::open(m_filePath).expect("opening the record file");
+    EXPECT_TRUE(reader.isRecovered());
+    ASSERT_THAT(reader.topics().size(), Eq(1U));
+    EXPECT_THAT(reader.topics()[0].toServiceDescription(), Eq(m_serviceDescription));
+
+    uint64_t numberOfChunks{0U};
+    while (auto chunk = reader.next())
+    {
+        EXPECT_THAT(*static_cast<const uint64_t*>(chunk->userPayload), Eq(numberOfChunks));
+        ++numberOfChunks;
+    }
+    EXPECT_THAT(numberOfChunks, Eq(NUMBER_OF_CHUNKS));
+}
+
+TEST_F(RecordFile_test, OpeningFileWithoutRecordFileHeaderFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "302aa200-0201-4928-b1fe-68aa40649d30");
+    {
+        auto file = FileBuilder()
+                        .open_mode(OpenMode::PurgeAndCreate)
+                        .access_mode(AccessMode::ReadWrite)
+                        .permissions(perms::owner_read | perms::owner_write)
+                        .create(m_filePath)
+                        .expect("creating the file");
+        const std::vector<uint8_t> noRecordFile(sizeof(FileHeader), 0xAAU);
+        ASSERT_FALSE(file.write(noRecordFile.data(), noRecordFile.size()).has_error());
+    }
+
+    auto reader = RecordFileReader::open(m_filePath);
+    ASSERT_TRUE(reader.has_error());
+    EXPECT_THAT(reader.error(), Eq(RecordFileError::INVALID_FILE_FORMAT));
+}
+
+} // namespace
@@ -0,0 +1,199 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_platform/platform_settings.hpp"
+#include "iceoryx_posh/mepoo/chained_payload.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/popo/untyped_publisher.hpp"
+#include "iceoryx_posh/popo/untyped_subscriber.hpp"
+#include "iceoryx_posh/roudi_env/minimal_iceoryx_config.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_posh/testing/roudi_gtest.hpp"
+#include "iceoryx_record_replay/recorder.hpp"
+#include "iceoryx_record_replay/replayer.hpp"
+#include "iox/file.hpp"
+#include "iox/path.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::record;
+using namespace iox::roudi_env;
+
+class RecordReplay_test : public iox::testing::RouDi_GTest
+{
+  public:
+    RecordReplay_test()
+        : RouDi_GTest(MinimalIceoryxConfigBuilder().create())
+    {
+    }
+
+    void SetUp() override
+    {
+        IOX_DISCARD_RESULT(File::remove(m_filePath));
+    }
+
+    void TearDown() override
+    {
+        IOX_DISCARD_RESULT(File::remove(m_filePath));
+    }
+
+    void publish(popo::UntypedPublisher& publisher, const uint64_t value, const uint64_t userHeader)
+    {
+        publisher.loan(sizeof(value), alignof(uint64_t), sizeof(userHeader), alignof(uint64_t))
+            .and_then([&](auto& userPayload) {
+                *static_cast<uint64_t*>(mepoo::ChunkHeader::fromUserPayload(userPayload)->userHeader()) = userHeader;
+                *static_cast<uint64_t*>(userPayload) = value;
+                publisher.publish(userPayload);
+            })
+            .or_else([](auto&) { GTEST_FAIL() << "Expected to loan a chunk"; });
+    }
+
+    /// @brief records the chunks which are published by 'publishChunks' and closes the record file
+    template <typename PublishChunks>
+    void record(const optional<capro::IdString_t>& service, const PublishChunks& publishChunks)
+    {
+        auto writer = RecordFileWriter::create(m_filePath).expect("creating the record file");
+        Recorder recorder(writer, service, nullopt, nullopt);
+
+        triggerDiscoveryLoopAndWaitToFinish();
+        recorder.discoverTopics();
+        triggerDiscoveryLoopAndWaitToFinish();
+
+        publishChunks();
+        recorder.recordAvailableChunks();
+        m_numberOfRecordedTopics = recorder.numberOfTopics();
+
+        ASSERT_FALSE(writer.close().has_error());
+    }
+
+    runtime::PoshRuntime* m_runtime{&runtime::PoshRuntime::initRuntime("record_replay_test")};
+    FilePath m_filePath = [] {
+        auto path = Path::create(platform::IOX_TEMP_DIR).expect("invalid temp dir");
+        path.append(string<18>(TruncateToCapacity, "test-record-replay")).expect("invalid file name");
+        return FilePath::create(path.as_string()).expect("invalid file path");
+    }();
+    capro::ServiceDescription m_serviceDescription{"Radar", "Front", "Objects"};
+    uint64_t m_numberOfRecordedTopics{0U};
+};
+
+TEST_F(RecordReplay_test, RecordedChunksAreReplayedWithUserHeader)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6fcce1e9-7ecf-41e1-a4eb-61dd3df856ce");
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    constexpr uint64_t USER_HEADER{0xC0FFEEU};
+
+    popo::UntypedPublisher publisher(m_serviceDescription);
+    record(capro::IdString_t("Radar"), [&] {
+        for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+        {
+            publish(publisher, i, USER_HEADER + i);
+        }
+    });
+    EXPECT_THAT(m_numberOfRecordedTopics, Eq(1U));
+
+    auto reader = RecordFileReader::open(m_filePath).expect("opening the record file");
+    EXPECT_THAT(reader.fileHeader().numberOfChunks, Eq(NUMBER_OF_CHUNKS));
+
+    popo::UntypedSubscriber subscriber(m_serviceDescription);
+    Replayer sut(reader, 0.0);
+    triggerDiscoveryLoopAndWaitToFinish();
+
+    EXPECT_THAT(sut.run([] { return true; }), Eq(NUMBER_OF_CHUNKS));
+
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto userPayload = subscriber.take();
+        ASSERT_FALSE(userPayload.has_error());
+        const auto* chunkHeader = mepoo::ChunkHeader::fromUserPayload(userPayload.value());
+        ASSERT_THAT(chunkHeader->userHeaderSize(), Eq(sizeof(uint64_t)));
+        EXPECT_THAT(*static_cast<const uint64_t*>(chunkHeader->userHeader()), Eq(USER_HEADER + i));
+        EXPECT_THAT(*static_cast<const uint64_t*>(userPayload.value()), Eq(i));
+        subscriber.release(userPayload.value());
+    }
+    EXPECT_TRUE(subscriber.take().has_error());
+}
+
+TEST_F(RecordReplay_test, ChainedMessageIsRecordedAndReplayed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2d7bad33-c1ea-428a-8097-f163a0655e05");
+    // larger than the chunks of the minimal config, i.e. a chained message is required
+    constexpr uint64_t USER_PAYLOAD_SIZE{300U};
+
+    std::vector<uint8_t> data(USER_PAYLOAD_SIZE);
+    for (uint64_t i = 0U; i < USER_PAYLOAD_SIZE; ++i)
+    {
+        data[i] = static_cast<uint8_t>(i);
+    }
+
+    popo::UntypedPublisher publisher(m_serviceDescription);
+    record(nullopt, [&] {
+        publisher.loanChained(USER_PAYLOAD_SIZE)
+            .and_then([&](auto& userPayload) {
+                mepoo::ChainedPayload::fromUserPayload(userPayload).and_then([&](auto& chainedPayload) {
+                    chainedPayload.copyFrom(data.data(), data.size());
+                });
+                publisher.publish(userPayload);
+            })
+            .or_else([](auto&) { GTEST_FAIL() << "Expected to loan a chained message"; });
+    });
+
+    auto reader = RecordFileReader::open(m_filePath).expect("opening the record file");
+    popo::UntypedSubscriber subscriber(m_serviceDescription);
+    Replayer sut(reader, 0.0);
+    triggerDiscoveryLoopAndWaitToFinish();
+
+    EXPECT_THAT(sut.run([] { return true; }), Eq(1U));
+
+    auto userPayload = subscriber.take();
+    ASSERT_FALSE(userPayload.has_error());
+    auto chainedPayload = mepoo::ConstChainedPayload::fromUserPayload(userPayload.value());
+    ASSERT_TRUE(chainedPayload.has_value());
+    ASSERT_THAT(chainedPayload->size(), Eq(USER_PAYLOAD_SIZE));
+    std::vector<uint8_t> replayedData(USER_PAYLOAD_SIZE);
+    chainedPayload->copyTo(replayedData.data(), replayedData.size());
+    EXPECT_THAT(replayedData, Eq(data));
+    subscriber.release(userPayload.value());
+}
+
+TEST_F(RecordReplay_test, TopicsNotMatchingTheFilterAreNotRecorded)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "344b8dc9-42d6-4f5e-838b-d5b103608eb6");
+    popo::UntypedPublisher radarPublisher(m_serviceDescription);
+    popo::UntypedPublisher lidarPublisher({"Lidar", "Front", "Points"});
+    record(capro::IdString_t("Lidar"), [&] {
+        publish(radarPublisher, 1U, 0U);
+        publish(lidarPublisher, 2U, 0U);
+    });
+    EXPECT_THAT(m_numberOfRecordedTopics, Eq(1U));
+
+    auto reader = RecordFileReader::open(m_filePath).expect("opening the record file");
+    ASSERT_THAT(reader.topics().size(), Eq(1U));
+    EXPECT_THAT(reader.topics()[0].toServiceDescription(), Eq(capro::ServiceDescription("Lidar", "Front", "Points")));
+    auto chunk = reader.next();
+    ASSERT_TRUE(chunk.has_value());
+    EXPECT_THAT(*static_cast<const uint64_t*>(chunk->userPayload), Eq(2U));
+    EXPECT_FALSE(reader.next().has_value());
+}
+
+} // namespace